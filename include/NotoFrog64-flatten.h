@@ -1,10 +1,9 @@
-// Generated by   : ImageConverter 565 Online
-// Generated from : NotoFrog64-flatten.png
-// Time generated : Fri, 01 Jan 21 13:55:26 +0100  (Server timezone: CET)
-// Image Size     : 64x64 pixels
+// Generated by   : tools/convert_images.py, do not edit
+// Generated from : assets/NotoFrog64-flatten.png
 // Memory usage   : 8192 bytes
 
-
+#ifndef __NOTOFROG64_FLATTEN_H
+#define __NOTOFROG64_FLATTEN_H
 #if defined(__AVR__)
     #include <avr/pgmspace.h>
 #elif defined(__PIC32MX__)
@@ -13,6 +12,7 @@
     #define PROGMEM
 #endif
 
+// NotoFrog64: 64x64 raw565, 8192 bytes of flash
 const unsigned short NotoFrog64[4096] PROGMEM={
 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0010 (16) pixels
 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0020 (32) pixels
@@ -271,3 +271,5 @@ const unsigned short NotoFrog64[4096] PROGMEM={
 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0FF0 (4080) pixels
 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1000 (4096) pixels
 };
+
+#endif
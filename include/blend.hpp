@@ -0,0 +1,41 @@
+#ifndef __BLEND_H
+#define __BLEND_H
+#include <Arduino.h>
+
+static inline uint16_t swap565(uint16_t c) {
+    return (c >> 8) | (c << 8);
+}
+
+// Alpha blends one colour into raw RGB565 pixels with the same result as
+// TFT_eSPI::alphaBlend, without going through a sprite per pixel. The
+// colour is split up front, red and blue share one 32 bit multiply (each
+// channel product stays below 16 bits).
+class ColorBlend {
+private:
+    uint32_t fgRB, fgG;
+public:
+    const uint16_t color;
+    const uint16_t swapped; // byte order used in TFT_eSprite memory
+
+    explicit ColorBlend(uint16_t color):
+        fgRB(expandRB(color)), fgG(expandG(color)), color(color), swapped(swap565(color)) {}
+
+    static inline uint32_t expandRB(uint16_t c) {
+        return (((c >> 10) & 0x3E) + 1) | ((((c << 1) & 0x3E) + 1) << 16);
+    }
+    static inline uint32_t expandG(uint16_t c) {
+        return ((c >> 4) & 0x7E) + 1;
+    }
+
+    inline uint16_t blend(uint8_t alpha, uint16_t bg) const {
+        const uint32_t rb = ((fgRB * alpha) + (expandRB(bg) * (255 - alpha))) >> 9;
+        const uint32_t g = ((fgG * alpha) + (expandG(bg) * (255 - alpha))) >> 9;
+        return ((rb & 0x1F) << 11) | (g << 5) | ((rb >> 16) & 0x1F);
+    }
+
+    inline void blendSwapped(uint8_t alpha, uint16_t *pixel) const {
+        *pixel = swap565(blend(alpha, swap565(*pixel)));
+    }
+};
+
+#endif
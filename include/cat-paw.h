@@ -1,10 +1,9 @@
-// Generated by   : ImageConverter 565 Online
-// Generated from : cat-paw.png
-// Time generated : Sat, 02 Jan 21 13:27:45 +0100  (Server timezone: CET)
-// Image Size     : 16x16 pixels
+// Generated by   : tools/convert_images.py, do not edit
+// Generated from : assets/cat-paw.png
 // Memory usage   : 512 bytes
 
-
+#ifndef __CAT_PAW_H
+#define __CAT_PAW_H
 #if defined(__AVR__)
     #include <avr/pgmspace.h>
 #elif defined(__PIC32MX__)
@@ -13,6 +12,7 @@
     #define PROGMEM
 #endif
 
+// cat_paw: 16x16 raw565, 512 bytes of flash
 const unsigned short cat_paw[256] PROGMEM={
 0x0000, 0x0000, 0x0000, 0x0000, 0x4A69, 0x7BCF, 0x0000, 0x0000, 0x0000, 0x2104, 0xA514, 0x9CF3, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0010 (16) pixels
 0x0000, 0x0000, 0x0000, 0x632C, 0xF7BE, 0xFFFF, 0xBDF7, 0x0000, 0x0000, 0xD69A, 0xFFFF, 0xFFFF, 0xB596, 0x0000, 0x0000, 0x0000,   // 0x0020 (32) pixels
@@ -31,3 +31,5 @@ const unsigned short cat_paw[256] PROGMEM={
 0x0000, 0x0000, 0x0000, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA534, 0x0000, 0x0000,   // 0x00F0 (240) pixels
 0x0000, 0x0000, 0x0000, 0x630C, 0xAD75, 0xAD55, 0x6B6D, 0x0000, 0x0000, 0x0020, 0x7BCF, 0x8410, 0x6B6D, 0x0000, 0x0000, 0x0000,   // 0x0100 (256) pixels
 };
+
+#endif
@@ -0,0 +1,840 @@
+// Generated by   : tools/bake_face.py, do not edit
+// Generated from : cat-watch-face.h + NotoSansBold15.h numerals
+// Memory usage   : 13240 bytes
+
+#ifndef __CAT_WATCH_FACE_DIAL_INDEXED_H
+#define __CAT_WATCH_FACE_DIAL_INDEXED_H
+#if defined(__AVR__)
+    #include <avr/pgmspace.h>
+#elif defined(__PIC32MX__)
+    #define PROGMEM
+#elif defined(__arm__)
+    #define PROGMEM
+#endif
+
+// CAT_WATCH_FACE_DIAL: 92x92 palette8, 8976 bytes of flash
+const unsigned short CAT_WATCH_FACE_DIAL_PALETTE8[256] PROGMEM={
+0x0000, 0xFFFF, 0xEC60, 0xEC86, 0xF4C6, 0x0231, 0xCC01, 0x2AF2, 0x3B11, 0xECC9, 0xEE77, 0xFDC3, 0xE570, 0xDD50, 0xD531, 0x4944,   // 0x0010 (16) pixels
+0xF523, 0xF6D9, 0xE462, 0xEBEE, 0xFE86, 0xF444, 0x74D7, 0x6C97, 0x69E6, 0x2968, 0xC408, 0xD71D, 0xD6FC, 0xCEDC, 0xD6FD, 0xEE35,   // 0x0020 (32) pixels
+0xF4A4, 0xED22, 0xF5C2, 0xFF35, 0xAE1B, 0xBE9C, 0xF7BE, 0x1250, 0x0A51, 0xFE66, 0xF565, 0x52AA, 0x93C7, 0xF614, 0xCD47, 0xEC43,   // 0x0030 (48) pixels
+0x7D18, 0xEF7D, 0xEC80, 0xF692, 0xB63B, 0xFD86, 0xDC20, 0x53F5, 0xFE45, 0xFF7C, 0xF525, 0xFE26, 0xD4E6, 0xF585, 0x6AC7, 0xFE46,   // 0x0040 (64) pixels
+0xED04, 0xEC44, 0xF524, 0xED8A, 0x4208, 0xF79D, 0xE50B, 0xEC83, 0xF504, 0xB596, 0xB575, 0xAD75, 0x9471, 0x4BD5, 0xF626, 0xFF56,   // 0x0050 (80) pixels
+0x9BE7, 0xC6BC, 0xDC67, 0xFE25, 0x1AD2, 0x1AB2, 0xF5B1, 0xF584, 0xFDE6, 0xDC21, 0xF544, 0x9DBA, 0x9599, 0xE4C1, 0xF4A5, 0xE73D,   // 0x0060 (96) pixels
+0xEDC6, 0xF6FA, 0xDEDB, 0xBE7B, 0xF630, 0xDC41, 0xE75E, 0xFDC6, 0xD445, 0x8347, 0xFE05, 0xFD45, 0x5B0C, 0xFF14, 0xFD65, 0xFDE5,   // 0x0070 (112) pixels
+0x8518, 0x8538, 0xFFBE, 0x3B74, 0xFCE4, 0xDC8A, 0xECA1, 0xF655, 0xBCA7, 0xF503, 0xE77E, 0x1292, 0x3AAE, 0xF73B, 0xEBAD, 0xE5D4,   // 0x0080 (128) pixels
+0xCDF6, 0x9B6A, 0xFFDF, 0xFD85, 0xC618, 0xCE38, 0xEF9E, 0xD400, 0x1272, 0xED6F, 0xFDC5, 0xE615, 0xDD66, 0xE5F4, 0xDD0E, 0xABC7,   // 0x0090 (144) pixels
+0xE4A3, 0xF5B0, 0xF564, 0xF6B8, 0xEE15, 0xFD25, 0xEC8B, 0xFDA6, 0xF7DF, 0xF4E3, 0xDF3D, 0xFE06, 0xDF5D, 0xFCA5, 0xFED3, 0xFDA5,   // 0x00A0 (160) pixels
+0xFC64, 0x82E6, 0xE592, 0xFCE5, 0xF6D6, 0x2B13, 0x2B33, 0xE5B3, 0xC32C, 0x8D59, 0xFF9D, 0x22D3, 0x9579, 0xF5E7, 0xFD64, 0xE481,   // 0x00B0 (176) pixels
+0xE444, 0x7BAD, 0xFE03, 0x5416, 0x5C36, 0x5C56, 0xDEFB, 0xD69A, 0xA534, 0xED0C, 0x228F, 0x7308, 0xC4E6, 0xF563, 0xFD63, 0xFF76,   // 0x00C0 (192) pixels
+0xE56D, 0xED03, 0xDF1D, 0x0A71, 0x5247, 0x42CC, 0xEC81, 0xE4E3, 0xECC2, 0xA5DA, 0xED4E, 0xE5C6, 0xA61A, 0xBDF9, 0xAE1A, 0xB5F9,   // 0x00D0 (208) pixels
+0xA4F3, 0xCE79, 0xF5C4, 0xFC85, 0xED01, 0x2313, 0x9B65, 0xFD05, 0xAC47, 0xFD24, 0x2841, 0x92AA, 0x8303, 0xAAEB, 0xA44F, 0xB4D1,   // 0x00E0 (224) pixels
+0xD422, 0x3354, 0x4394, 0x49A2, 0xD38C, 0x5985, 0x838B, 0x43B5, 0x4AEE, 0x6B6D, 0xA3E9, 0xBC06, 0xDD2F, 0xEDEE, 0xF697, 0x7207,   // 0x00F0 (240) pixels
+0x40E3, 0x7BCF, 0x52ED, 0xABC5, 0xD587, 0xDC89, 0xEBAE, 0xFF3B, 0x6477, 0x8B67, 0xDC82, 0xECEA, 0xEE98, 0xF75C, 0xAC49, 0x7B47,   // 0x0100 (256) pixels
+};
+
+const unsigned char CAT_WATCH_FACE_DIAL_INDEX8[8464] PROGMEM={
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x66, 0xB4, 0x37, 0x1E, 0x01, 0x01, 0x01, 0x7A, 0x30, 0xE2, 0xAB, 0x37,
+0x63, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x63,
+0x55, 0x05, 0x05, 0x25, 0x01, 0x01, 0x1B, 0x55, 0x05, 0x05, 0x05, 0x05, 0x05, 0x34, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xAC, 0x05, 0x7B, 0x05, 0x05, 0x25,
+0x01, 0x01, 0x01, 0x4D, 0xF8, 0x9A, 0x98, 0xE7, 0x05, 0x37, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4D, 0xAB, 0x1D, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0x82,
+0x01, 0x01, 0x01, 0xA9, 0x05, 0x37, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x86, 0x7A, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xE1,
+0x05, 0x71, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x66, 0xB4, 0x37, 0x1E,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x66, 0xB4, 0x37, 0x1E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x16, 0x05, 0xD5, 0x26, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x66, 0xB4, 0x37, 0x1E, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x63, 0x55, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0x01,
+0x63, 0x55, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x98, 0x05, 0x05, 0x25,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x05, 0x54, 0x9C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x63, 0x55, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0xAC, 0x05, 0x7B, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0xAC, 0x05, 0x7B, 0x05, 0x05,
+0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0x01,
+0x71, 0x05, 0xAB, 0x9C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xAC,
+0x05, 0x7B, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4D, 0xAB,
+0x1D, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0x4D, 0xAB, 0x1D, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0x71, 0x05, 0xA6, 0x7A, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4D, 0xAB, 0x1D, 0x05, 0x05,
+0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x86, 0x7A, 0x98, 0x05, 0x05, 0x25,
+0x01, 0x01, 0x01, 0x86, 0x7A, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x34, 0x05, 0x05, 0xC3, 0x88, 0x88, 0x88, 0x88, 0x98, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x86, 0x7A, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x98, 0x05, 0x05, 0x25,
+0x01, 0x01, 0xC9, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x98, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x98, 0x05, 0x05,
+0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x98, 0x05, 0x05,
+0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x98, 0x05, 0x05, 0x25,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x98, 0x05, 0x05,
+0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x66, 0xB4, 0x37, 0x1E, 0x01, 0x01, 0x01, 0x01, 0xA9, 0x73,
+0x54, 0xB4, 0x1B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x7A, 0x30, 0xE2,
+0xAB, 0x37, 0x63, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x63, 0x55, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0x30, 0x05, 0x05, 0x28, 0x05, 0x55, 0x7A,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1B, 0x55, 0x05, 0x05, 0x05, 0x05, 0x05, 0x34,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xAC, 0x05, 0x7B, 0x05,
+0x05, 0x25, 0x01, 0x01, 0x98, 0x28, 0x05, 0x24, 0x82, 0x73, 0x05, 0x16, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x39, 0x77, 0xFB, 0x02, 0x89, 0xAA, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x4D, 0xF8, 0x9A, 0x98, 0xE7, 0x05, 0x37, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4D, 0xAB, 0x1D, 0x05, 0x05, 0x25, 0x01, 0x01,
+0x34, 0x05, 0xC3, 0x01, 0x01, 0xC9, 0x05, 0xE1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x61, 0x89, 0x76, 0x57, 0x53, 0x29,
+0x57, 0xB9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x82, 0x01, 0x01, 0x01, 0xA9, 0x05, 0x37, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x86, 0x7A, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0xC9, 0x05, 0xA6, 0x01,
+0x01, 0x34, 0x05, 0x28, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x39, 0x89, 0x76, 0xD2, 0x14, 0x14, 0x14, 0x14, 0x14, 0x76, 0xF7, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0xE1, 0x05, 0x71, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x5B, 0x05, 0x4D, 0x01, 0x01, 0x63, 0x05, 0x05,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xEE,
+0x47, 0x57, 0x14, 0x14, 0x14, 0x14, 0x29, 0x57, 0x76, 0x32, 0xEE, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x16, 0x05, 0xD5, 0x26,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x98, 0x05,
+0x05, 0x25, 0x01, 0x01, 0xC9, 0x05, 0x73, 0x01, 0x01, 0x34, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x72, 0xF7, 0x11, 0x77, 0x77, 0x77, 0x77, 0x93, 0xF7, 0x2D, 0xC8, 0x38, 0x14, 0x14, 0x14,
+0x14, 0x6F, 0x32, 0x02, 0x02, 0x02, 0x2D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x05, 0x54, 0x9C, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01,
+0x24, 0x05, 0x88, 0x01, 0x01, 0xCE, 0x05, 0x55, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x82,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xAA, 0xEE, 0xCA, 0x02, 0xC8, 0x10,
+0x32, 0x02, 0x10, 0xBD, 0xBD, 0xC8, 0x32, 0x76, 0x57, 0x38, 0x14, 0x14, 0xD2, 0x02, 0x02, 0x02,
+0x02, 0x02, 0x89, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x71, 0x05, 0xAB, 0x9C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x86, 0x05, 0x05, 0x1B,
+0x01, 0x17, 0x05, 0xB4, 0x01, 0x01, 0x01, 0x01, 0x2D, 0x03, 0x02, 0x02, 0x02, 0xC6, 0x46, 0x56,
+0x77, 0xF7, 0x01, 0x01, 0x39, 0x56, 0x32, 0x02, 0x02, 0x53, 0x14, 0x14, 0xC8, 0x02, 0x57, 0x14,
+0x14, 0x14, 0x29, 0x6A, 0x10, 0x32, 0x10, 0xD2, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x71, 0x05, 0xA6,
+0x7A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x01, 0xB5, 0x05, 0x54, 0x4D, 0x05, 0x05, 0x63,
+0x01, 0x01, 0x01, 0x77, 0x79, 0x38, 0x14, 0x14, 0x14, 0x29, 0x53, 0xD2, 0xBD, 0x76, 0x09, 0x91,
+0x76, 0x57, 0x29, 0x02, 0x02, 0x6F, 0x14, 0x14, 0xBD, 0x02, 0x10, 0x14, 0x14, 0x14, 0x14, 0x14,
+0x14, 0x29, 0xBD, 0x32, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x05, 0x05, 0xC3, 0x88, 0x88, 0x88, 0x88,
+0x98, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x98, 0x05,
+0x05, 0x25, 0x01, 0x01, 0x01, 0x86, 0x37, 0x05, 0x05, 0x88, 0x5C, 0x01, 0x01, 0x01, 0x01, 0xFB,
+0x53, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x6A, 0x32, 0xBD, 0x29, 0x14, 0x14, 0x76,
+0x02, 0x57, 0x14, 0x14, 0x57, 0x02, 0x76, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x53,
+0xC8, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0xC9, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x98, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x98, 0x86, 0x82, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFB, 0x57, 0xBD, 0x57, 0x6F,
+0x29, 0x14, 0x14, 0x14, 0xD2, 0x32, 0x6A, 0x14, 0x14, 0x14, 0x14, 0x10, 0x02, 0x10, 0x14, 0x14,
+0x6A, 0x02, 0x02, 0x29, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x29, 0x10, 0x02, 0x02,
+0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x91, 0x02, 0x02, 0x02, 0x02, 0x32, 0x10, 0x38, 0xD2,
+0x76, 0x53, 0x14, 0x14, 0x14, 0x14, 0x14, 0x57, 0x02, 0x76, 0x14, 0x14, 0x29, 0x02, 0x02, 0x6A,
+0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x10, 0x02, 0x02, 0x02, 0x41, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x77, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x32, 0x32, 0x53, 0x14, 0x14, 0x14,
+0x14, 0x14, 0x14, 0x6A, 0x02, 0x02, 0x29, 0x14, 0x14, 0x76, 0x02, 0x57, 0x14, 0x14, 0x14, 0x14,
+0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x29, 0xC8, 0x02, 0x02, 0xCA, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11,
+0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x6F, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x38,
+0x02, 0x02, 0x53, 0x14, 0x14, 0x10, 0x02, 0xBD, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+0x14, 0x14, 0x14, 0x38, 0x32, 0x02, 0x2D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x72, 0x02, 0x02, 0x02, 0x02,
+0x02, 0x02, 0x10, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x32, 0x02, 0x6F, 0x14,
+0x14, 0x53, 0xBD, 0x38, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+0x57, 0x02, 0x61, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xB9, 0x02, 0x02, 0x02, 0x02, 0x32, 0x3F, 0x14,
+0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x6A, 0x57, 0x29, 0x14, 0x14, 0x14, 0x14, 0x14,
+0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x29, 0x32, 0x39, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0xEE, 0x02, 0x02, 0x02, 0x02, 0xBD, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+0x2E, 0xF9, 0x2C, 0x8C, 0x14, 0x14, 0x14, 0x14, 0x14, 0x92, 0x77, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x72, 0xC6, 0x02, 0x02, 0x02, 0x53, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x2E, 0x44, 0x44, 0x44, 0x44,
+0x8C, 0x14, 0x14, 0x14, 0x14, 0x53, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2D, 0x02, 0x02,
+0x76, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xBB, 0x44, 0x44, 0x44, 0x44, 0x2C, 0x14, 0x14, 0x14,
+0x14, 0x14, 0x76, 0x39, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x86, 0x30, 0x4D, 0x4D, 0x17, 0x66, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xAA, 0x03, 0x32, 0x10, 0x14, 0x14, 0x14,
+0x14, 0x14, 0x29, 0xBC, 0xD8, 0xF4, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+0x14, 0x14, 0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x14, 0x14, 0x14, 0x14, 0x14, 0x10, 0x93,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x24, 0xB4, 0xA6, 0xA5, 0x37, 0x34, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x73, 0x05, 0x05, 0x05, 0x05, 0x55, 0x66, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x02, 0x57, 0x14, 0x14, 0x14, 0x14, 0x29, 0x69, 0x44,
+0x44, 0x44, 0x78, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x2C,
+0x44, 0x44, 0x44, 0x44, 0xFF, 0x14, 0x14, 0x14, 0x14, 0x14, 0xD2, 0x2D, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1D, 0x05, 0x05,
+0x05, 0x05, 0x05, 0x05, 0x24, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x05, 0x7B, 0x1B, 0x26,
+0x4D, 0x05, 0xF8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x56, 0xD2, 0x14, 0x14, 0x14, 0x14, 0xF4, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4E,
+0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xCB, 0x44, 0x44, 0x44, 0x44,
+0x2E, 0x14, 0x14, 0x14, 0x14, 0x14, 0x6A, 0x89, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5C, 0x34, 0x82, 0x98, 0x73, 0x05,
+0xB4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x71, 0x05, 0xB3, 0x01, 0x01, 0x34, 0x05, 0x7B, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x91,
+0xD2, 0x14, 0x14, 0x14, 0x14, 0x78, 0x44, 0x44, 0x44, 0x44, 0x44, 0x2E, 0x14, 0x14, 0x14, 0x14,
+0x14, 0x14, 0x4E, 0x60, 0x29, 0x14, 0x14, 0x14, 0xCB, 0x50, 0x2C, 0x2E, 0x14, 0x14, 0x14, 0x14,
+0x14, 0x29, 0x53, 0x46, 0x84, 0x84, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xB5, 0x05, 0x16, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x5C, 0x05, 0xE2, 0x01, 0x01, 0xCE, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0xD2, 0x14, 0x14, 0x14,
+0x14, 0xF4, 0x44, 0x44, 0x44, 0x44, 0x44, 0x8C, 0x14, 0x14, 0x14, 0x2E, 0x8F, 0xA1, 0xEF, 0xEF,
+0xBC, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x29, 0x29, 0x29, 0x29, 0x29, 0x60, 0xD8, 0xC4,
+0x6C, 0xB7, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x25, 0xC9, 0x16, 0x28, 0xE1, 0x86, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51,
+0x05, 0x05, 0x17, 0x70, 0x55, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2D, 0xD2, 0x14, 0x14, 0x14, 0x14, 0x29, 0x3E, 0x44,
+0x44, 0x44, 0x3E, 0x29, 0x14, 0x14, 0x3F, 0x18, 0x18, 0x18, 0xE5, 0xE5, 0x3C, 0x14, 0x29, 0x29,
+0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x8C, 0x2C, 0x44, 0xA1, 0x1A, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4D,
+0x05, 0x05, 0xAB, 0x63, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x05, 0x05, 0x05,
+0x71, 0x05, 0x88, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x77, 0x57, 0x14, 0x14, 0x14, 0x14, 0x14, 0x60, 0x2C, 0x44, 0x69, 0xCB, 0x14,
+0x14, 0x14, 0x14, 0xBC, 0x0F, 0xF0, 0xF0, 0xDC, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+0x29, 0x4E, 0xFF, 0x44, 0x2C, 0x8C, 0x6F, 0xCA, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0xC9, 0x70, 0x55, 0x05,
+0x30, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5F, 0x34, 0x9A, 0x34, 0x05, 0x4D, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11,
+0x10, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x29, 0x29, 0x29, 0x29, 0x29,
+0x8C, 0xE3, 0xDA, 0x8C, 0x29, 0x29, 0x29, 0x29, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x4E, 0x78, 0x60,
+0x53, 0x53, 0x57, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5C, 0x05, 0x88, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x86, 0xE1, 0x05, 0xC9, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x39, 0x76, 0x14, 0x14, 0x14,
+0x14, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x6A, 0x3E, 0x2E,
+0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x60, 0x53, 0x53, 0x53, 0x53, 0xCB, 0xBC, 0x78, 0xD8, 0x8F, 0xDE,
+0xB8, 0xD0, 0xB7, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x66, 0x82, 0x01, 0x01, 0x01, 0x16, 0x05, 0x55, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x71, 0xB5, 0xB3, 0x88, 0x05, 0xE7, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x53, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+0x29, 0x29, 0x29, 0x29, 0x29, 0x3F, 0x3F, 0x3F, 0x3F, 0x4E, 0x44, 0xC4, 0x8C, 0x53, 0x53, 0x53,
+0xBC, 0x3E, 0x6A, 0x6A, 0x6A, 0x6F, 0xD8, 0xFF, 0x69, 0x69, 0xA1, 0x4C, 0x4B, 0x4B, 0x62, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xC9, 0xC3, 0x37,
+0xB4, 0x73, 0x05, 0x05, 0x30, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4D, 0x05, 0x05, 0x55,
+0x30, 0x98, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0xB6, 0xF1, 0xBB, 0x69, 0x50, 0xD8, 0xD8, 0x78, 0x2E, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+0x3F, 0x3F, 0x53, 0x53, 0x53, 0x50, 0x44, 0x44, 0x44, 0xBB, 0x2C, 0x3E, 0xF9, 0x3D, 0x6F, 0x8A,
+0x8A, 0x8A, 0x9F, 0x9F, 0x9F, 0xAE, 0x03, 0x82, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0xAB, 0x05, 0x05, 0x05, 0x55, 0x71,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x98, 0x86, 0x26, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x26, 0xD1,
+0x4A, 0xD6, 0xD8, 0x2C, 0x69, 0x69, 0xFF, 0x4E, 0x3B, 0x53, 0x53, 0x53, 0xD8, 0x78, 0x8C, 0x3C,
+0xF9, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x69, 0x8A, 0x9F, 0x9F, 0x9F, 0x83, 0x83, 0x2C, 0x3E,
+0xEB, 0x68, 0x2D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x98, 0x86, 0x26, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xB9, 0xD2, 0x53,
+0x53, 0x53, 0x6A, 0x53, 0x6A, 0x6A, 0x6A, 0x6A, 0x60, 0xD8, 0x69, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0xF9, 0x83, 0x83, 0xAE, 0xAE, 0xAE, 0x5A, 0x40, 0xEB, 0x3E, 0x44, 0x6C, 0x4B,
+0xB6, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x76, 0x6F, 0x3C, 0x50, 0x44, 0x3C,
+0x6F, 0x6F, 0x8A, 0x8A, 0x8A, 0x8A, 0x3D, 0xC4, 0x44, 0x44, 0xDB, 0xA8, 0xA8, 0xDD, 0xC4, 0xEB,
+0x5A, 0x42, 0x42, 0x42, 0x42, 0x48, 0x48, 0x48, 0xC8, 0xA7, 0x84, 0x4C, 0x44, 0x2B, 0xD1, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x26, 0xD1, 0x69, 0x44, 0xC4, 0x50, 0x3C, 0x3D, 0x9F, 0x9F, 0x9F, 0x83,
+0x83, 0x83, 0xAE, 0xEB, 0x44, 0xA8, 0xF6, 0xF6, 0xF6, 0xF6, 0xE4, 0x40, 0x48, 0x48, 0x48, 0x48,
+0x48, 0x48, 0x48, 0x99, 0xFB, 0x72, 0x01, 0x01, 0x26, 0xD1, 0x5F, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xD1,
+0x44, 0x2B, 0xB8, 0x1A, 0x5A, 0x9F, 0x2A, 0xF9, 0x3C, 0xAE, 0xAE, 0xAE, 0xAE, 0x5A, 0x42, 0x42,
+0x1A, 0x7E, 0x7E, 0x7E, 0x7E, 0xE4, 0x04, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x99, 0x32,
+0x1F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x31, 0x62, 0x82, 0x01, 0x61,
+0x32, 0x68, 0xC4, 0x69, 0x40, 0x42, 0x42, 0x42, 0x42, 0x48, 0x48, 0x48, 0x48, 0x04, 0x09, 0xF5,
+0x09, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x99, 0x32, 0x5A, 0x65, 0x0A, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xDF, 0x44, 0x8F, 0x48,
+0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+0x48, 0x48, 0x48, 0x48, 0x99, 0x32, 0x57, 0x9B, 0x3D, 0x87, 0x94, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x26, 0x4C, 0x2B, 0x80, 0x03, 0xC8, 0x48, 0x48, 0x48, 0x48,
+0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0xC8,
+0x76, 0x8A, 0x9B, 0x3D, 0x36, 0x87, 0x87, 0x94, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x5F, 0xE9, 0xB1, 0x31, 0x01, 0xAA, 0x89, 0xC6, 0x99, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0xC8, 0x32, 0x10, 0x6A, 0x9B, 0x3D, 0x36,
+0x87, 0x87, 0x87, 0x87, 0x8D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x86, 0x30, 0x4D, 0xA6, 0x37, 0x34, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4C, 0xD0, 0x82,
+0x01, 0x01, 0x01, 0x01, 0x61, 0xCA, 0x32, 0xC8, 0x99, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+0x48, 0x99, 0x99, 0x76, 0x32, 0x10, 0x6F, 0x9B, 0x9B, 0x3D, 0x36, 0x87, 0x87, 0x87, 0x87, 0x5A,
+0xFA, 0x8D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x1C, 0x37, 0x37, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0xE2, 0x05, 0xC3, 0xE1, 0x05, 0x05, 0xCE, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x39, 0x77, 0xB9, 0x02, 0x32, 0x76, 0x76, 0x76, 0x76, 0xC6, 0x02, 0x03, 0x79, 0x57,
+0x6A, 0x9B, 0x9B, 0x9B, 0x3D, 0x36, 0x87, 0x87, 0x87, 0x12, 0x3D, 0x9F, 0x3D, 0x87, 0x8D, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x82, 0xA6, 0x05, 0x05, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x26, 0x05, 0x05, 0x7A, 0x01, 0x30, 0x05, 0xB4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x7D, 0x46, 0x6D, 0x33, 0x33, 0x33, 0x33, 0x9E, 0x23, 0x23, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x58,
+0xFA, 0x87, 0x65, 0xC1, 0x3D, 0x8A, 0x9F, 0x2A, 0x65, 0x87, 0x87, 0x8D, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x05, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x98, 0x28, 0x05, 0x1C,
+0x01, 0x17, 0x05, 0x17, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x61, 0xC0, 0xBF, 0xBF,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x6D, 0x9B, 0x9B, 0x9B, 0x58, 0x58, 0x58, 0x3D, 0x2A, 0x8A, 0x8A,
+0x9F, 0x9F, 0x2A, 0x36, 0x87, 0x87, 0x87, 0x87, 0x8D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x51, 0x05, 0x16, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xAC, 0x05, 0x88, 0xE2, 0x05, 0xA6, 0x7A,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFD, 0xC0, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+0xBF, 0x6D, 0x9B, 0x9B, 0x58, 0x58, 0x58, 0x6F, 0x8A, 0x8A, 0x8A, 0x9F, 0x9F, 0x83, 0x65, 0x87,
+0x87, 0x87, 0x87, 0x12, 0x65, 0x8B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x26, 0xA5, 0xAB,
+0x9C, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x26, 0x73, 0x05, 0x05, 0x28, 0x51, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0xAA, 0x46, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x6D, 0x6F, 0x6F,
+0x58, 0x58, 0x8A, 0x8A, 0x8A, 0x8A, 0x9F, 0x2A, 0x83, 0x90, 0x87, 0x87, 0x87, 0x12, 0x48, 0x6E,
+0x2A, 0x65, 0x94, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x17, 0x05, 0x63, 0x51, 0x05, 0x05, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x98, 0x73, 0x05, 0xE7, 0x30, 0x05, 0x05, 0xCE, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0xF5, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x6D, 0xFA, 0x3D, 0x6F, 0x8A, 0x8A, 0x8A,
+0x9F, 0x9F, 0x9F, 0xFA, 0x42, 0x65, 0x65, 0x90, 0x3A, 0x6E, 0x6B, 0x6B, 0x6B, 0x3A, 0x65, 0x1F,
+0x01, 0x01, 0x01, 0x01, 0x63, 0x05, 0x17, 0x01, 0x49, 0x05, 0x05, 0xFD, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xCE, 0x05, 0x73, 0x01,
+0x01, 0x34, 0x05, 0x55, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x6D, 0xBF,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x6D, 0xFA, 0xC1, 0x5A, 0x92, 0x3D, 0x9F, 0x9F, 0x9F, 0x83, 0x65,
+0x5A, 0x83, 0x6E, 0x6E, 0x6E, 0x6B, 0x6B, 0x6B, 0x95, 0x95, 0x3A, 0x59, 0x11, 0x01, 0x01, 0x01,
+0x4D, 0x05, 0x28, 0x28, 0x28, 0x05, 0x05, 0x28, 0xCE, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5B, 0x05, 0x37, 0x01, 0x01, 0x5F, 0x05, 0x05,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFC, 0x64, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+0xBF, 0x23, 0x90, 0x87, 0x87, 0x87, 0x87, 0x65, 0x5A, 0x83, 0x83, 0x36, 0x2A, 0x6E, 0x6E, 0x6E,
+0x6B, 0x6B, 0x6B, 0x95, 0x95, 0x95, 0xD7, 0x48, 0x68, 0xAA, 0x01, 0x01, 0x30, 0x4D, 0x4D, 0x4D,
+0x7C, 0x05, 0x05, 0xC5, 0x4A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x1C, 0x05, 0x05, 0xB4, 0x17, 0xA5, 0x05, 0x4D, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x72, 0x52, 0x23, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x4F, 0x90, 0x87,
+0x87, 0x87, 0x87, 0x87, 0x90, 0x83, 0x83, 0x87, 0x2A, 0x6E, 0x6B, 0x6B, 0x6B, 0x6B, 0x95, 0x95,
+0x95, 0xD7, 0xD7, 0xD7, 0x47, 0xEC, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xD0, 0x05, 0x05, 0x87,
+0x75, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0xCE, 0xAB, 0x05, 0x05, 0x05, 0xB5, 0x86, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x8E, 0xC0, 0x4F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xC7, 0x87, 0x87, 0x87, 0x36, 0x90,
+0x6E, 0x83, 0x6E, 0x87, 0x6B, 0x6B, 0x3A, 0x6B, 0x95, 0x95, 0x95, 0x95, 0xD7, 0x47, 0x65, 0x87,
+0x12, 0x59, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0xCD, 0x05, 0x05, 0x57, 0x36, 0xAA, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x26,
+0x86, 0x82, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x94, 0x87,
+0xC0, 0x4F, 0xBF, 0xBF, 0xBF, 0xBF, 0x43, 0x90, 0x2A, 0x6E, 0x83, 0x83, 0x83, 0x83, 0x6B, 0x87,
+0x6B, 0x90, 0x87, 0x3A, 0x95, 0x95, 0xD7, 0x47, 0x36, 0x87, 0x87, 0x87, 0x87, 0x87, 0x8E, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x75, 0x3D, 0x3B, 0x12, 0x61, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x61, 0x32, 0x5D, 0x46, 0x23, 0xBF,
+0xBF, 0xBF, 0x43, 0x90, 0x9F, 0x83, 0x83, 0x83, 0x83, 0x6E, 0x2A, 0x36, 0x90, 0x87, 0x12, 0x3A,
+0x95, 0x3A, 0x65, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x36, 0xFD, 0x01, 0x01, 0x01, 0x01,
+0x01, 0xA7, 0x40, 0x9B, 0xC7, 0xFC, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x72, 0x36, 0xB2, 0x21, 0x52, 0x33, 0xBF, 0xBF, 0xED, 0xFA,
+0x42, 0x40, 0x3A, 0x83, 0x83, 0x83, 0x3A, 0x87, 0x87, 0x12, 0x95, 0x95, 0xD7, 0x12, 0x87, 0x87,
+0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x59, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1F, 0xC7, 0x9B,
+0xC7, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5C,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x98, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x75, 0x22, 0xB2, 0xB2, 0x21, 0x46, 0x6D, 0x64, 0x87, 0x87, 0x87, 0x87, 0x90,
+0x35, 0x35, 0x3A, 0x87, 0x87, 0x48, 0xD7, 0xE6, 0xF2, 0xC5, 0xC5, 0xC5, 0xC5, 0x06, 0x87, 0x87,
+0x87, 0x2F, 0x2F, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x8D, 0x90, 0x6F, 0xC7, 0x11, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xF8, 0x05, 0x05, 0x05, 0x05,
+0x05, 0x05, 0x05, 0x98, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xA7,
+0x65, 0xD4, 0x22, 0xB2, 0x0B, 0xD4, 0x52, 0x87, 0x87, 0x87, 0x87, 0x65, 0x35, 0x35, 0x48, 0x87,
+0x65, 0xD7, 0xD7, 0xE8, 0x05, 0x05, 0x05, 0x05, 0x05, 0xB0, 0x2F, 0x41, 0x20, 0x9D, 0x20, 0x46,
+0x01, 0x01, 0x01, 0x01, 0x72, 0xF5, 0x87, 0x90, 0x65, 0x61, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xC2, 0x25, 0x25, 0x25, 0x25, 0xF8, 0x05, 0x4D, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFC, 0x87, 0x87, 0x87, 0x5D,
+0x0B, 0x0B, 0x5D, 0x87, 0x87, 0x87, 0x12, 0x2A, 0x35, 0x35, 0x40, 0x87, 0x65, 0xD7, 0xD7, 0x7C,
+0x05, 0xE6, 0x1A, 0x1A, 0x1A, 0x5E, 0x20, 0x2F, 0x12, 0x59, 0x36, 0x68, 0x01, 0x01, 0x01, 0xAA,
+0xEC, 0x90, 0x12, 0x87, 0x87, 0x72, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x82, 0xAB, 0x05, 0x63, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFD, 0x87, 0x87, 0x87, 0xAF, 0x0B, 0x0B, 0x5D, 0x87,
+0x2A, 0x6E, 0x97, 0x97, 0x97, 0x97, 0x40, 0x87, 0x36, 0xA3, 0xA3, 0x27, 0x05, 0x1A, 0x9D, 0x9D,
+0x20, 0x12, 0x87, 0x87, 0x87, 0x87, 0x87, 0xE0, 0x61, 0x11, 0xA7, 0xE0, 0x87, 0x40, 0x83, 0xC1,
+0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0xC9, 0x05, 0xA5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0xAA, 0x7D, 0x7D, 0x06, 0x5D, 0x21, 0x0B, 0xBD, 0xBD, 0xAF, 0x87, 0x97, 0x97, 0x97, 0x97,
+0x97, 0x97, 0x40, 0x36, 0x87, 0x47, 0xA3, 0x28, 0x05, 0xE8, 0xBA, 0xF2, 0xD6, 0x87, 0x87, 0x87,
+0x87, 0x87, 0x87, 0x87, 0x65, 0x87, 0x12, 0x3A, 0x87, 0x12, 0x2A, 0x36, 0x7D, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xE1,
+0x05, 0x5C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFD, 0x8E, 0x36, 0x65, 0x36,
+0x87, 0x2C, 0x6C, 0xC5, 0xC5, 0xF3, 0x87, 0x87, 0x6B, 0x35, 0x35, 0x35, 0x35, 0x35, 0x90, 0x90,
+0x59, 0x36, 0x20, 0x27, 0x05, 0x05, 0x05, 0x05, 0x05, 0xD6, 0x87, 0x87, 0x87, 0x87, 0x87, 0x65,
+0x48, 0x87, 0x90, 0x6B, 0x47, 0x87, 0x36, 0x1F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x05, 0x7B, 0x26, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x72, 0x52, 0x21, 0xBE, 0xBE, 0x40, 0x7C, 0x05, 0x05, 0x28,
+0x28, 0xFE, 0x6B, 0x3A, 0x95, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x90, 0x12, 0x59, 0x87, 0x87, 0x03,
+0x03, 0x9D, 0x52, 0x7C, 0x05, 0x7C, 0x2F, 0x12, 0x2F, 0x2F, 0x12, 0x12, 0xA3, 0x36, 0x36, 0x48,
+0x90, 0xE0, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4D, 0x05, 0x16, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x0A, 0x5D, 0xBE, 0xBE, 0xBE, 0xE9, 0x05, 0xC5, 0x68, 0x95, 0x95, 0x95, 0x95, 0x95,
+0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x12, 0x87, 0x36, 0x12, 0x41, 0x9D, 0x9D, 0x9D, 0xD3, 0x81,
+0x05, 0x27, 0xA0, 0xA0, 0xA0, 0x15, 0x36, 0xF5, 0x87, 0x87, 0x87, 0x75, 0x8D, 0xAA, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x1E, 0x05, 0x05, 0x9A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xA2, 0xC8,
+0xBE, 0xBE, 0x40, 0x05, 0x27, 0x59, 0x20, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+0xA3, 0xA3, 0x65, 0x87, 0x20, 0x9D, 0x03, 0x03, 0x9D, 0xA0, 0xA0, 0x6C, 0x05, 0xC5, 0xA0, 0x15,
+0x15, 0x2F, 0x8E, 0x01, 0x01, 0xAA, 0x82, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xB5, 0x05, 0xB3,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0xC8, 0xD9, 0xD9, 0xD8, 0x05,
+0xF2, 0xBB, 0x27, 0x27, 0xE9, 0x03, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x87, 0x12,
+0x9D, 0x9D, 0x8F, 0x05, 0x7C, 0xF2, 0x7C, 0x05, 0x05, 0x8F, 0x15, 0x15, 0x15, 0x36, 0x7D, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5F, 0x05, 0x05, 0x51, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0xAF, 0x74, 0x74, 0xEA, 0x05, 0x27, 0x28, 0x7C, 0x05,
+0x05, 0x6C, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0x2F, 0x87, 0x12, 0x9D, 0x9D, 0x1A, 0xBA,
+0x05, 0x05, 0x05, 0xBA, 0x81, 0x15, 0x15, 0x15, 0x36, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x82, 0xEC, 0x59, 0x12, 0x2C, 0x05, 0x27, 0x68, 0x87, 0xF9, 0x05, 0x28, 0xA0, 0x15,
+0x15, 0x15, 0x15, 0x41, 0x2F, 0xF5, 0x8E, 0x36, 0x2F, 0x20, 0x20, 0xA0, 0x41, 0xB0, 0x41, 0x15,
+0x15, 0x2F, 0x12, 0x59, 0xFC, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x61, 0x7F, 0x4C, 0x05, 0x08, 0x94, 0x94, 0x8B, 0x05, 0x05, 0x06, 0x87, 0x68, 0xF5, 0x8E, 0xEC,
+0xA7, 0xAA, 0xAA, 0x61, 0x0C, 0x68, 0x87, 0x87, 0x87, 0xE0, 0x52, 0x75, 0x8E, 0x0C, 0x1F, 0xAA,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1E, 0x05,
+0x28, 0x9C, 0x01, 0xCE, 0x05, 0xC3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x37, 0x05, 0x54, 0xB3, 0x88,
+0x05, 0x16, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x86, 0xB5, 0x05, 0x05, 0x05, 0x17, 0x98, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x82, 0x86, 0x82, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// CAT_WATCH_FACE_DIAL: 92x92 palette4, 4264 bytes of flash
+const unsigned short CAT_WATCH_FACE_DIAL_PALETTE4[16] PROGMEM={
+0x0000, 0xEF3C, 0xF7BE, 0xFFFF, 0xF4E4, 0xE440, 0xE4ED, 0xFE86, 0x4A49, 0x0A51, 0x9BC7, 0x53F5, 0x8D37, 0xF6D6, 0xBE7B, 0xFDA5,   // 0x0010 (16) pixels
+};
+
+const unsigned char CAT_WATCH_FACE_DIAL_INDEX4[4232] PROGMEM={
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x1B, 0xB1, 0x33, 0x32, 0xCB, 0x9B, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3E,
+0x99, 0x9E, 0x33, 0x19, 0x99, 0x99, 0x9E, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xC9, 0x99, 0x9E,
+0x33, 0x3B, 0xB1, 0x2B, 0x9B, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xB9, 0xE9, 0x9E, 0x33, 0x33,
+0x33, 0x3C, 0x9B, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x29, 0x9E, 0x33, 0x33, 0x33, 0x3B,
+0x9C, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x00, 0x00, 0x00, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x1B, 0xB1,
+0x33, 0x33, 0x31, 0xBB, 0x13, 0x33, 0x33, 0x33, 0x29, 0x9E, 0x33, 0x33, 0x33, 0xC9, 0x92, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x31, 0xBB, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x30, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3E, 0x99, 0x9E, 0x33, 0x33,
+0xE9, 0x99, 0xE3, 0x33, 0x33, 0x33, 0x29, 0x9E, 0x33, 0x33, 0x3C, 0x99, 0x13, 0x33, 0x33, 0x33,
+0x33, 0x33, 0xE9, 0x99, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00,
+0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xC9, 0x99, 0x9E, 0x33, 0x3C, 0x99, 0x99,
+0xE3, 0x33, 0x33, 0x33, 0x29, 0x9E, 0x33, 0x33, 0xC9, 0x91, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3C,
+0x99, 0x99, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x03, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xB9, 0xE9, 0x9E, 0x33, 0x3B, 0x9E, 0x99, 0xE3, 0x33,
+0x33, 0x33, 0x29, 0x9E, 0x33, 0x3C, 0x99, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3B, 0x9E, 0x99,
+0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x03, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x29, 0x9E, 0x33, 0x32, 0x22, 0x99, 0xE3, 0x33, 0x33, 0x33,
+0x29, 0x9E, 0x33, 0xE9, 0x99, 0x99, 0x99, 0x23, 0x33, 0x33, 0x33, 0x32, 0x22, 0x99, 0xE3, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x29, 0x9E, 0x33, 0x33, 0x32, 0x99, 0xE3, 0x33, 0x33, 0x33, 0x29, 0x9E,
+0x33, 0xE9, 0x99, 0x99, 0x99, 0x23, 0x33, 0x33, 0x33, 0x33, 0x32, 0x99, 0xE3, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x29, 0x9E, 0x33, 0x33, 0x32, 0x99, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x99, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x29, 0x9E, 0x33, 0x33, 0x32, 0x99, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x99, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x29, 0x9E,
+0x33, 0x33, 0x32, 0x99, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x32, 0x99, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x29, 0x9E, 0x33, 0x33,
+0x32, 0x99, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x32, 0x99, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x29, 0x9E, 0x33, 0x33, 0x32, 0x99,
+0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x32, 0x99, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x1B, 0xB1, 0x33, 0x33, 0xCB,
+0x9B, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0xCB,
+0x9B, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3E, 0x99, 0x9E, 0x33, 0x3C, 0x99, 0x99, 0x92,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x19, 0x99, 0x99, 0x9E,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xC9, 0x99, 0x9E, 0x33, 0x29, 0x9E, 0x3B, 0x9C, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x1D, 0x65, 0x62, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3B, 0xB1, 0x2B, 0x9B, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0xB9, 0xE9, 0x9E, 0x33, 0xE9, 0x93, 0x3E, 0x9B, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x16, 0x5F, 0x77,
+0xF6, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3C, 0x9B, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x22, 0x29, 0x9E, 0x33, 0xE9, 0x93, 0x3E, 0x99, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x16, 0x5F, 0x77, 0x77, 0x75, 0x13,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3B, 0x9C, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x29, 0x9E, 0x33, 0xC9, 0xB3, 0x3E, 0x99, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3D, 0x4F, 0x77, 0x77, 0x7F, 0x55, 0xD3, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xC9, 0x92, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x29,
+0x9E, 0x33, 0xE9, 0xB3, 0x3E, 0x99, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x32, 0x1D, 0xDD, 0xDD, 0xD1, 0xD4, 0x77, 0x77, 0x7F, 0x55, 0x55, 0xD3, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x3C, 0x99, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x29, 0x9E, 0x33,
+0xE9, 0x93, 0x3E, 0x99, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2D, 0x65, 0x44,
+0x55, 0x4F, 0x44, 0x55, 0xF7, 0x77, 0xF5, 0x55, 0x55, 0x63, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0xC9, 0x91, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x29, 0x9E, 0x33, 0x29, 0x91,
+0x3B, 0x9B, 0x33, 0x33, 0xD4, 0x55, 0x55, 0x66, 0xD1, 0x33, 0x16, 0x55, 0x57, 0x77, 0x45, 0xF7,
+0x77, 0x7F, 0x45, 0x4F, 0x55, 0x55, 0x55, 0x43, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3C, 0x99,
+0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x29, 0x9E, 0x33, 0x3B, 0x99, 0xB9, 0x9E,
+0x33, 0x3D, 0x47, 0x77, 0x77, 0x7F, 0x45, 0x66, 0x5F, 0x75, 0x5F, 0x77, 0x45, 0x47, 0x77, 0x77,
+0x77, 0x45, 0x55, 0x55, 0x55, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xE9, 0x99, 0x99, 0x99,
+0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x29, 0x9E, 0x33, 0x32, 0xB9, 0x99, 0xC3, 0x33, 0x36,
+0x77, 0x77, 0x77, 0x77, 0x7F, 0x54, 0x77, 0x75, 0x5F, 0x77, 0xF5, 0x57, 0x77, 0x77, 0x77, 0x77,
+0x45, 0x55, 0x55, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xE9, 0x99, 0x99, 0x99, 0x23, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x23, 0x33, 0x33, 0x36, 0xF4, 0xFF,
+0x77, 0x77, 0xF5, 0xF7, 0x77, 0x74, 0x54, 0x77, 0xF5, 0x57, 0x77, 0x77, 0x77, 0x77, 0x74, 0x55,
+0x55, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x55, 0x55, 0x54, 0x7F,
+0x57, 0x77, 0x77, 0x7F, 0x55, 0x77, 0x75, 0x5F, 0x77, 0x77, 0x77, 0x77, 0x77, 0x45, 0x55, 0x43,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3D, 0x55, 0x55, 0x55, 0x55, 0x77, 0x77,
+0x77, 0x7F, 0x55, 0x77, 0x75, 0x5F, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0x55, 0x63, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3D, 0x55, 0x55, 0x55, 0x5F, 0x77, 0x77, 0x77, 0x77,
+0x55, 0x77, 0x74, 0x54, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x55, 0xD3, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x55, 0x55, 0x55, 0x47, 0x77, 0x77, 0x77, 0x77, 0x55, 0xF7,
+0x77, 0x47, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xF5, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x65, 0x55, 0x55, 0x77, 0x77, 0x77, 0x77, 0x77, 0xFF, 0x77, 0x77, 0x77,
+0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0xD5, 0x55, 0x54, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+0x4A, 0xAF, 0x77, 0x77, 0x7F, 0xD3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x25, 0x55, 0x57, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0x88, 0x88,
+0xF7, 0x77, 0x77, 0x63, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3D, 0x55,
+0x57, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7A, 0x88, 0x88, 0xA7, 0x77,
+0x77, 0x51, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x2C, 0xBB, 0xC1, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x45, 0x47, 0x77,
+0x77, 0x74, 0xAF, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x87, 0x77, 0x77, 0x4D,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xEB, 0x99, 0xBE, 0x33, 0x33, 0x33, 0x33,
+0xB9, 0x99, 0x99, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xD5, 0xF7, 0x77, 0x77, 0xA8,
+0x88, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7A, 0x88, 0x88, 0xA7, 0x77, 0x77, 0xFD, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3E, 0x99, 0x99, 0x99, 0xE3, 0x33, 0x33, 0x3E, 0x99, 0x12,
+0xB9, 0xB3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0xF7, 0x77, 0x7F, 0x88, 0x88, 0x87,
+0x77, 0x77, 0x77, 0x77, 0x77, 0x7F, 0x88, 0x88, 0x47, 0x77, 0x77, 0xF6, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0xCE, 0x32, 0xB9, 0xB3, 0x33, 0x33, 0x3C, 0x9B, 0x33, 0xE9, 0x93,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0xF7, 0x77, 0x7A, 0x88, 0x88, 0x84, 0x77, 0x77,
+0x77, 0x7F, 0x77, 0x77, 0xFA, 0xA4, 0x77, 0x77, 0x77, 0x76, 0xEE, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0xB9, 0xC3, 0x33, 0x33, 0x3C, 0x9B, 0x33, 0xE9, 0x93, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0xF7, 0x77, 0x74, 0x88, 0x88, 0x8F, 0x77, 0x74, 0xAA, 0x88,
+0x47, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7F, 0xA8, 0x8E, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x3E, 0xEC, 0x9B, 0x23, 0x33, 0x33, 0x3E, 0x99, 0xBC, 0x99, 0x93, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x3D, 0xF7, 0x77, 0x77, 0x88, 0x88, 0x87, 0x77, 0x78, 0x88, 0x88, 0x47, 0x77,
+0x77, 0x77, 0x77, 0x7F, 0xA8, 0xAA, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3B,
+0x99, 0x9E, 0x33, 0x33, 0x33, 0x33, 0xC9, 0x99, 0xC9, 0x93, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x3D, 0xF7, 0x77, 0x77, 0xFA, 0x8A, 0xF7, 0x77, 0x74, 0x88, 0x8A, 0x77, 0x77, 0x77, 0x77,
+0x77, 0xA8, 0xA4, 0xF6, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3E, 0xEC, 0x99,
+0xC3, 0x33, 0x33, 0x33, 0x31, 0xE1, 0xE9, 0xB3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3D,
+0x47, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x48, 0x04, 0x77, 0x77, 0x77, 0x77, 0x7F, 0xAF,
+0x77, 0xF6, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xC9, 0x93, 0x33,
+0x33, 0x33, 0x33, 0x32, 0xB9, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x57, 0x77,
+0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7F, 0x84, 0x77, 0x77, 0x7F, 0x77, 0x77, 0xF4, 0xAA, 0xAA,
+0xCC, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x33, 0x33, 0xC9, 0x93, 0x33, 0x33, 0x33,
+0xCB, 0xB9, 0x9B, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x47, 0x77, 0x77, 0x77,
+0x77, 0x77, 0x77, 0x77, 0x7F, 0x88, 0x47, 0x77, 0x48, 0xFF, 0xFF, 0xAA, 0xAA, 0xAC, 0xCC, 0x13,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3E, 0x9B, 0xBB, 0x99, 0xC3, 0x33, 0x33, 0x33, 0xB9, 0x99,
+0xC2, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x1B, 0xAA, 0xAA, 0xAA, 0x47, 0x77, 0x77,
+0x77, 0x77, 0x7A, 0x88, 0x8A, 0xA8, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x3E, 0x99, 0x99, 0x9C, 0x33, 0x33, 0x33, 0x33, 0x22, 0x23, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2E, 0xCA, 0xAA, 0xAA, 0xAF, 0x77, 0x77, 0xAA, 0xF4,
+0xA8, 0x88, 0x88, 0x8A, 0xFF, 0xFF, 0xFF, 0xA8, 0xA4, 0xD3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x32, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0xF7, 0x77, 0xF7, 0xFF, 0xFF, 0xFA, 0xA8, 0x88, 0x88,
+0x88, 0x8A, 0xFF, 0xFF, 0x44, 0x4A, 0x88, 0x8C, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x3D, 0x5F, 0x4A, 0x84, 0xFF, 0xFF, 0xFF, 0xF8, 0x88, 0xAA, 0x6A, 0x8A,
+0x44, 0x44, 0x44, 0x44, 0x4D, 0xEC, 0x88, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x2E, 0xA8, 0x8A, 0x4F, 0xFF, 0xFF, 0xFF, 0xFA, 0x8A, 0x66, 0x66, 0x64, 0x44, 0x44,
+0x44, 0x44, 0x62, 0x33, 0x2E, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3E,
+0x88, 0xCA, 0x4F, 0x4A, 0x4F, 0xFF, 0x44, 0x44, 0xA6, 0x66, 0x66, 0x44, 0x44, 0x44, 0x44, 0x45,
+0xD3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x13, 0x31,
+0x54, 0x8A, 0x44, 0x44, 0x44, 0x44, 0x44, 0x66, 0x44, 0x44, 0x44, 0x44, 0x44, 0x54, 0x5D, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x68, 0xA4,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0xFF, 0xF5, 0xD3, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2C, 0x8E, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x5F, 0xFF, 0x55, 0x5D, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x8B, 0x13, 0x26, 0x54, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x54, 0xFF, 0xF5, 0x55, 0x55, 0xD3, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0xCB, 0x9B, 0xE3,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3C, 0xC3, 0x33, 0x33, 0x16, 0x54, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x45, 0x54, 0xFF, 0xFF, 0x55, 0x55, 0x54, 0x5D, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x1B, 0xB3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3B, 0x99, 0xB9, 0x9E, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x1D, 0x65, 0x55, 0x55, 0x55, 0x54, 0x4F,
+0xFF, 0xFF, 0xF5, 0x55, 0x55, 0xFF, 0xF5, 0xD3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x99, 0x93,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x29, 0x92, 0x3C, 0x9B, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x16, 0xDD, 0xDD, 0xDD, 0xDD, 0xFF, 0xFF, 0xFF,
+0x55, 0x54, 0xFF, 0xFF, 0x55, 0x5D, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3C, 0x99, 0x93, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x29, 0x91, 0x3B, 0x9C, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x16, 0xDD, 0xDD, 0xDD, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xF5, 0x55, 0x55, 0xD3, 0x33, 0x33, 0x33, 0x33, 0xE9, 0xC9, 0x93, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x3C, 0x99, 0xB9, 0x92, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x16, 0xDD, 0xDD, 0xDD, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55,
+0x55, 0x55, 0x5D, 0x33, 0x33, 0x33, 0x32, 0x99, 0x19, 0x93, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x32, 0xB9, 0x99, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x26, 0xDD, 0xDD, 0xDD, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x55, 0x55, 0x4F,
+0x45, 0xD3, 0x33, 0x33, 0x3C, 0x9E, 0xE9, 0x93, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x2B, 0x9B, 0xC9, 0x9E, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x34, 0xDD, 0xDD, 0xDD, 0xDD, 0x5F, 0xFF, 0xFF, 0xFF, 0xF5, 0x45, 0x54, 0x4F, 0xFF, 0xF4, 0x5D,
+0x33, 0x33, 0xE9, 0xB3, 0xC9, 0x91, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xE9, 0xB3,
+0x3E, 0x99, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0xDD,
+0xDD, 0xDD, 0xDD, 0x54, 0x4F, 0xFF, 0xFF, 0xF5, 0x4F, 0xFF, 0xFF, 0xFF, 0x44, 0x45, 0xD3, 0x33,
+0xB9, 0x99, 0x99, 0x99, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xC9, 0xB3, 0x31, 0x99,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3D, 0x6D, 0xDD, 0xDD,
+0xDD, 0x45, 0x55, 0x55, 0x4F, 0xF5, 0x4F, 0xFF, 0xFF, 0xF4, 0x44, 0x44, 0x42, 0x33, 0xCB, 0xBB,
+0x99, 0x98, 0xC3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x19, 0x9B, 0xB9, 0x9B, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x4D, 0xDD, 0xDD, 0xDD, 0x45,
+0x55, 0x55, 0x4F, 0xF5, 0x4F, 0xFF, 0xFF, 0x44, 0x44, 0x44, 0x46, 0x33, 0x33, 0x33, 0xC9, 0x95,
+0x63, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3E, 0x99, 0x99, 0xB2, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x66, 0xDD, 0xDD, 0xDD, 0x45, 0x55, 0x54,
+0xFF, 0xF5, 0xFF, 0x4F, 0x44, 0x44, 0x44, 0x55, 0x55, 0xD3, 0x33, 0x33, 0xE9, 0x9F, 0x52, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xD5, 0x6D, 0xDD, 0xDD, 0x64, 0xFF, 0xFF, 0xFF, 0xF5,
+0xF4, 0x54, 0x44, 0x44, 0x55, 0x55, 0x55, 0x63, 0x33, 0x33, 0x36, 0xF7, 0x51, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x15, 0x56, 0xDD, 0xDD, 0x64, 0xFF, 0xFF, 0xFF, 0x45, 0x45, 0x54,
+0x44, 0x55, 0x55, 0x55, 0x55, 0x51, 0x33, 0x33, 0x3D, 0x4F, 0x4D, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x25, 0xF4, 0x4D, 0xDD, 0x65, 0x44, 0x4F, 0xFF, 0x45, 0x55, 0x44, 0x45, 0x55,
+0x55, 0x55, 0x55, 0x5D, 0x33, 0x33, 0x3D, 0x4F, 0x4D, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3C, 0xBB, 0xBB, 0xBB, 0xB2, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x36, 0xFF, 0xF4, 0x6D, 0x65, 0x55, 0x54, 0xFF, 0x45, 0x54, 0x4A, 0x88, 0x88, 0x85, 0x55,
+0x54, 0x46, 0x33, 0x33, 0x3D, 0x4F, 0x4D, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x3B, 0x99, 0x99, 0x99, 0x92, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3D,
+0x54, 0xFF, 0xF5, 0x45, 0x55, 0x55, 0xFF, 0x45, 0x54, 0x48, 0x99, 0x99, 0x94, 0x44, 0x44, 0x46,
+0x33, 0x33, 0x26, 0x54, 0x51, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x31, 0xEE, 0xEE, 0xB9, 0xB3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3D, 0x55, 0x55,
+0xFF, 0x55, 0x55, 0x5F, 0xFF, 0x45, 0x54, 0x48, 0x9A, 0xAA, 0xA4, 0x44, 0x55, 0x55, 0x33, 0x32,
+0x64, 0x55, 0x52, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x99, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x55, 0x55, 0xFF, 0x55,
+0xFF, 0xFF, 0xFF, 0x45, 0x54, 0x49, 0x9A, 0x44, 0x45, 0x55, 0x55, 0x55, 0x1D, 0xD5, 0x54, 0xF4,
+0x63, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x3E, 0x99, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x11, 0x55, 0x4F, 0x44, 0x55, 0xFF, 0xFF,
+0xFF, 0x45, 0x54, 0x49, 0x98, 0x98, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0xF5, 0x13, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3B,
+0x9C, 0x33, 0x33, 0x33, 0x33, 0x31, 0x65, 0x55, 0x5A, 0x88, 0x8A, 0x55, 0xFF, 0xFF, 0xFF, 0x44,
+0x55, 0x49, 0x99, 0x99, 0x9A, 0x55, 0x55, 0x55, 0x45, 0x4F, 0x45, 0x5D, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xE9, 0x92, 0x33,
+0x33, 0x33, 0x33, 0x24, 0x4F, 0xF4, 0x89, 0x99, 0x9A, 0xF4, 0x4F, 0xFF, 0xFF, 0x45, 0x55, 0x54,
+0x44, 0x48, 0x98, 0x55, 0x44, 0x55, 0x45, 0x54, 0x45, 0xD3, 0x33, 0x33, 0x33, 0x33, 0x03, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xB9, 0xC3, 0x33, 0x33, 0x33,
+0x33, 0xD5, 0xFF, 0xF8, 0x98, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x55, 0x54, 0x44, 0x44, 0x4A,
+0x99, 0x44, 0x44, 0x56, 0x55, 0x56, 0xD2, 0x33, 0x33, 0x33, 0x33, 0x30, 0x03, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x99, 0x13, 0x33, 0x33, 0x33, 0x33, 0x64,
+0x44, 0x49, 0x95, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x55, 0x44, 0x44, 0x44, 0x48, 0x98, 0x44,
+0x45, 0x63, 0x32, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3B, 0x9B, 0x33, 0x33, 0x33, 0x33, 0x33, 0x64, 0x44, 0xA9,
+0x8A, 0x99, 0x84, 0x44, 0x44, 0x44, 0x44, 0x55, 0x44, 0xA9, 0x88, 0x89, 0x9A, 0x44, 0x45, 0x13,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x19, 0x9E, 0x33, 0x33, 0x33, 0x33, 0x33, 0xD5, 0x44, 0xA9, 0x99, 0x89,
+0x98, 0x44, 0x44, 0x44, 0x44, 0x55, 0x44, 0xA9, 0x99, 0x99, 0xA4, 0x44, 0x5D, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x55, 0xA9, 0x95, 0x5A, 0x99, 0x44,
+0x44, 0x44, 0x56, 0x65, 0x44, 0x44, 0x44, 0x44, 0x45, 0x55, 0xD3, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x30, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x1D, 0xC9, 0xBD, 0xDD, 0x99, 0x55, 0x56, 0x66,
+0xD2, 0x21, 0x64, 0x55, 0x55, 0x46, 0x66, 0xD2, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x19, 0x91, 0x3E, 0x99, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x3B, 0x99, 0xB9, 0x9C, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x32, 0xB9, 0x99, 0xB2, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+#endif
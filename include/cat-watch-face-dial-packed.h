@@ -0,0 +1,662 @@
+// Generated by   : tools/bake_face.py, do not edit
+// Generated from : cat-watch-face.h + NotoSansBold15.h numerals
+// Memory usage   : 10508 bytes
+
+#ifndef __CAT_WATCH_FACE_DIAL_PACKED_H
+#define __CAT_WATCH_FACE_DIAL_PACKED_H
+#if defined(__AVR__)
+    #include <avr/pgmspace.h>
+#elif defined(__PIC32MX__)
+    #define PROGMEM
+#elif defined(__arm__)
+    #define PROGMEM
+#endif
+#include "packed_image.hpp"
+
+// CAT_WATCH_FACE_DIAL: 92x92 rle565, 6279 bytes of flash
+static const uint8_t CAT_WATCH_FACE_DIAL_PACKED_DATA[6095] PROGMEM = {
+0x89, 0x00, 0x00, 0xC4, 0xFF, 0xFF, 0x89, 0x00, 0x00, 0x87, 0x00, 0x00, 0x9D, 0xFF, 0xFF, 0x03,
+0xE7, 0x5E, 0x5C, 0x36, 0x53, 0xF5, 0xD6, 0xFD, 0x81, 0xFF, 0xFF, 0x05, 0xE7, 0x7E, 0x7C, 0xF8,
+0x43, 0x94, 0x22, 0xD3, 0x54, 0x15, 0xBE, 0x7B, 0x9C, 0xFF, 0xFF, 0x87, 0x00, 0x00, 0x85, 0x00,
+0x00, 0x9E, 0xFF, 0xFF, 0x01, 0xBE, 0x7B, 0x1A, 0xB2, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x80,
+0xFF, 0xFF, 0x01, 0xD7, 0x1D, 0x1A, 0xB2, 0x83, 0x02, 0x31, 0x00, 0xB6, 0x3B, 0x9D, 0xFF, 0xFF,
+0x85, 0x00, 0x00, 0x84, 0x00, 0x00, 0x9E, 0xFF, 0xFF, 0x02, 0x95, 0x79, 0x02, 0x31, 0x12, 0x92,
+0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x81, 0xFF, 0xFF, 0x06, 0x4B, 0xD5, 0x64, 0x77, 0xDF, 0x3D,
+0xF7, 0xDF, 0x43, 0xB5, 0x02, 0x31, 0x54, 0x15, 0x9E, 0xFF, 0xFF, 0x84, 0x00, 0x00, 0x83, 0x00,
+0x00, 0x9F, 0xFF, 0xFF, 0x02, 0x4B, 0xD5, 0x22, 0xD3, 0xCE, 0xDC, 0x80, 0x02, 0x31, 0x00, 0xBE,
+0x9C, 0x81, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x81, 0xFF, 0xFF, 0x02, 0x8D, 0x59, 0x02, 0x31, 0x53,
+0xF5, 0x9F, 0xFF, 0xFF, 0x83, 0x00, 0x00, 0x82, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x02, 0xEF, 0x9E,
+0xE7, 0x7E, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x85, 0xFF, 0xFF, 0x02, 0x33, 0x54,
+0x02, 0x31, 0x85, 0x38, 0xA0, 0xFF, 0xFF, 0x82, 0x00, 0x00, 0x81, 0x00, 0x00, 0x8F, 0xFF, 0xFF,
+0x03, 0xE7, 0x5E, 0x5C, 0x36, 0x53, 0xF5, 0xD6, 0xFD, 0x83, 0xFF, 0xFF, 0x03, 0xE7, 0x5E, 0x5C,
+0x36, 0x53, 0xF5, 0xD6, 0xFD, 0x85, 0xFF, 0xFF, 0x00, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE,
+0x9C, 0x84, 0xFF, 0xFF, 0x03, 0x74, 0xB7, 0x02, 0x31, 0x23, 0x13, 0xF7, 0xBE, 0x89, 0xFF, 0xFF,
+0x03, 0xE7, 0x5E, 0x5C, 0x36, 0x53, 0xF5, 0xD6, 0xFD, 0x92, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x80,
+0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x01, 0xBE, 0x7B, 0x1A, 0xB2, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C,
+0x82, 0xFF, 0xFF, 0x01, 0xBE, 0x7B, 0x1A, 0xB2, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x85, 0xFF,
+0xFF, 0x00, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x83, 0xFF, 0xFF, 0x03, 0x7D, 0x18,
+0x02, 0x31, 0x1A, 0xD2, 0xDF, 0x5D, 0x89, 0xFF, 0xFF, 0x01, 0xBE, 0x7B, 0x1A, 0xB2, 0x80, 0x02,
+0x31, 0x00, 0xBE, 0x9C, 0x93, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x8E, 0xFF, 0xFF,
+0x02, 0x95, 0x79, 0x02, 0x31, 0x12, 0x92, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x81, 0xFF, 0xFF,
+0x02, 0x95, 0x79, 0x02, 0x31, 0x12, 0x92, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x85, 0xFF, 0xFF,
+0x00, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x82, 0xFF, 0xFF, 0x03, 0x85, 0x38, 0x02,
+0x31, 0x22, 0xF3, 0xDF, 0x5D, 0x89, 0xFF, 0xFF, 0x02, 0x95, 0x79, 0x02, 0x31, 0x12, 0x92, 0x80,
+0x02, 0x31, 0x00, 0xBE, 0x9C, 0x93, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+0xFF, 0x02, 0x4B, 0xD5, 0x22, 0xD3, 0xCE, 0xDC, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x81, 0xFF,
+0xFF, 0x02, 0x4B, 0xD5, 0x22, 0xD3, 0xCE, 0xDC, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x85, 0xFF,
+0xFF, 0x00, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x81, 0xFF, 0xFF, 0x03, 0x85, 0x38,
+0x02, 0x31, 0x2B, 0x33, 0xE7, 0x7E, 0x8A, 0xFF, 0xFF, 0x02, 0x4B, 0xD5, 0x22, 0xD3, 0xCE, 0xDC,
+0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x94, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+0xFF, 0xFF, 0x02, 0xEF, 0x9E, 0xE7, 0x7E, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x81,
+0xFF, 0xFF, 0x02, 0xEF, 0x9E, 0xE7, 0x7E, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x85,
+0xFF, 0xFF, 0x00, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x80, 0xFF, 0xFF, 0x00, 0xB6,
+0x3B, 0x80, 0x02, 0x31, 0x00, 0x0A, 0x71, 0x82, 0x12, 0x72, 0x00, 0xF7, 0xDF, 0x86, 0xFF, 0xFF,
+0x02, 0xEF, 0x9E, 0xE7, 0x7E, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x94, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x92, 0xFF, 0xFF, 0x00, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x83,
+0xFF, 0xFF, 0x00, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x85, 0xFF, 0xFF, 0x00, 0xF7,
+0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x80, 0xFF, 0xFF, 0x00, 0xA5, 0xDA, 0x85, 0x02, 0x31,
+0x00, 0xF7, 0xDF, 0x88, 0xFF, 0xFF, 0x00, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x95,
+0xFF, 0xFF, 0x92, 0xFF, 0xFF, 0x00, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x83, 0xFF,
+0xFF, 0x00, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x9E, 0xFF, 0xFF, 0x00, 0xF7, 0xDF,
+0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x95, 0xFF, 0xFF, 0x92, 0xFF, 0xFF, 0x00, 0xF7, 0xDF, 0x80,
+0x02, 0x31, 0x00, 0xBE, 0x9C, 0x83, 0xFF, 0xFF, 0x00, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE,
+0x9C, 0x9E, 0xFF, 0xFF, 0x00, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x95, 0xFF, 0xFF,
+0x92, 0xFF, 0xFF, 0x00, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x83, 0xFF, 0xFF, 0x00,
+0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x9E, 0xFF, 0xFF, 0x00, 0xF7, 0xDF, 0x80, 0x02,
+0x31, 0x00, 0xBE, 0x9C, 0x95, 0xFF, 0xFF, 0x92, 0xFF, 0xFF, 0x00, 0xF7, 0xDF, 0x80, 0x02, 0x31,
+0x00, 0xBE, 0x9C, 0x83, 0xFF, 0xFF, 0x00, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x9E,
+0xFF, 0xFF, 0x00, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x95, 0xFF, 0xFF, 0x92, 0xFF,
+0xFF, 0x00, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x83, 0xFF, 0xFF, 0x00, 0xF7, 0xDF,
+0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x9E, 0xFF, 0xFF, 0x00, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00,
+0xBE, 0x9C, 0x95, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0x84, 0xFF,
+0xFF, 0x03, 0xE7, 0x5E, 0x5C, 0x36, 0x53, 0xF5, 0xD6, 0xFD, 0x82, 0xFF, 0xFF, 0x04, 0x8D, 0x59,
+0x3B, 0x74, 0x1A, 0xD2, 0x5C, 0x36, 0xD7, 0x1D, 0xB8, 0xFF, 0xFF, 0x05, 0xE7, 0x7E, 0x7C, 0xF8,
+0x43, 0x94, 0x22, 0xD3, 0x54, 0x15, 0xBE, 0x7B, 0x87, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x01, 0xBE,
+0x7B, 0x1A, 0xB2, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x81, 0xFF, 0xFF, 0x00, 0x7C, 0xF8, 0x80,
+0x02, 0x31, 0x03, 0x0A, 0x51, 0x02, 0x31, 0x1A, 0xB2, 0xE7, 0x7E, 0xB6, 0xFF, 0xFF, 0x01, 0xD7,
+0x1D, 0x1A, 0xB2, 0x83, 0x02, 0x31, 0x00, 0xB6, 0x3B, 0x86, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0x02,
+0x95, 0x79, 0x02, 0x31, 0x12, 0x92, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x80, 0xFF, 0xFF, 0x07,
+0xF7, 0xDF, 0x0A, 0x51, 0x02, 0x31, 0xAE, 0x1B, 0xFF, 0xDF, 0x3B, 0x94, 0x02, 0x31, 0x74, 0xD7,
+0xA2, 0xFF, 0xFF, 0x05, 0xFF, 0x7C, 0xF6, 0x55, 0xEC, 0xEB, 0xEC, 0x60, 0xED, 0x6F, 0xFF, 0x9D,
+0x8D, 0xFF, 0xFF, 0x06, 0x4B, 0xD5, 0x64, 0x77, 0xDF, 0x3D, 0xF7, 0xDF, 0x43, 0xB5, 0x02, 0x31,
+0x54, 0x15, 0x86, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0x02, 0x4B, 0xD5, 0x22, 0xD3, 0xCE, 0xDC, 0x80,
+0x02, 0x31, 0x00, 0xBE, 0x9C, 0x80, 0xFF, 0xFF, 0x02, 0xB6, 0x3B, 0x02, 0x31, 0x0A, 0x71, 0x80,
+0xFF, 0xFF, 0x02, 0xA5, 0xFA, 0x02, 0x31, 0x33, 0x34, 0xA0, 0xFF, 0xFF, 0x07, 0xFF, 0x1A, 0xED,
+0x6F, 0xEC, 0xA1, 0xF5, 0x84, 0xFE, 0x25, 0xFE, 0x66, 0xF5, 0xA4, 0xED, 0x0C, 0x8D, 0xFF, 0xFF,
+0x00, 0xFF, 0xDF, 0x81, 0xFF, 0xFF, 0x02, 0x8D, 0x59, 0x02, 0x31, 0x53, 0xF5, 0x86, 0xFF, 0xFF,
+0x82, 0xFF, 0xFF, 0x02, 0xEF, 0x9E, 0xE7, 0x7E, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C,
+0x80, 0xFF, 0xFF, 0x02, 0xA5, 0xDA, 0x02, 0x31, 0x2B, 0x33, 0x80, 0xFF, 0xFF, 0x02, 0xB6, 0x5B,
+0x02, 0x31, 0x0A, 0x51, 0x9E, 0xFF, 0xFF, 0x03, 0xFF, 0x7C, 0xED, 0x6F, 0xEC, 0xC1, 0xF5, 0xC4,
+0x83, 0xFE, 0x86, 0x01, 0xEC, 0xC1, 0xFF, 0x3B, 0x90, 0xFF, 0xFF, 0x02, 0x33, 0x54, 0x02, 0x31,
+0x85, 0x38, 0x86, 0xFF, 0xFF, 0x84, 0xFF, 0xFF, 0x00, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE,
+0x9C, 0x80, 0xFF, 0xFF, 0x02, 0x9D, 0xB9, 0x02, 0x31, 0x4B, 0xD5, 0x80, 0xFF, 0xFF, 0x00, 0xBE,
+0x7B, 0x80, 0x02, 0x31, 0x9D, 0xFF, 0xFF, 0x02, 0xF6, 0x97, 0xEC, 0xA3, 0xF5, 0xA4, 0x82, 0xFE,
+0x86, 0x04, 0xFE, 0x66, 0xF5, 0x84, 0xEC, 0xA1, 0xEC, 0x80, 0xF6, 0x97, 0x8F, 0xFF, 0xFF, 0x03,
+0x74, 0xB7, 0x02, 0x31, 0x23, 0x13, 0xF7, 0xBE, 0x86, 0xFF, 0xFF, 0x84, 0xFF, 0xFF, 0x00, 0xF7,
+0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x80, 0xFF, 0xFF, 0x02, 0xA5, 0xDA, 0x02, 0x31, 0x3B,
+0x74, 0x80, 0xFF, 0xFF, 0x00, 0xB6, 0x5B, 0x80, 0x02, 0x31, 0x93, 0xFF, 0xFF, 0x03, 0xFF, 0xDE,
+0xFF, 0x3B, 0xF6, 0xD9, 0xF6, 0x56, 0x80, 0xF6, 0x35, 0x05, 0xF6, 0x55, 0xF6, 0xD8, 0xFF, 0x3B,
+0xF5, 0xF3, 0xEC, 0xE2, 0xFE, 0x45, 0x82, 0xFE, 0x86, 0x01, 0xFD, 0xE5, 0xEC, 0xA0, 0x81, 0xEC,
+0x60, 0x00, 0xF5, 0xF3, 0x8E, 0xFF, 0xFF, 0x03, 0x7D, 0x18, 0x02, 0x31, 0x1A, 0xD2, 0xDF, 0x5D,
+0x87, 0xFF, 0xFF, 0x84, 0xFF, 0xFF, 0x00, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x80,
+0xFF, 0xFF, 0x02, 0xAE, 0x1B, 0x02, 0x31, 0x12, 0x72, 0x80, 0xFF, 0xFF, 0x02, 0xAE, 0x1A, 0x02,
+0x31, 0x1A, 0xB2, 0x85, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x88, 0xFF, 0xFF, 0x0F, 0xFF, 0x9D, 0xF6,
+0x97, 0xED, 0x4E, 0xEC, 0x60, 0xEC, 0xE2, 0xF5, 0x43, 0xEC, 0x80, 0xEC, 0x60, 0xF5, 0x23, 0xF5,
+0x83, 0xF5, 0x63, 0xEC, 0xE2, 0xEC, 0x80, 0xEC, 0xC1, 0xF5, 0x84, 0xFE, 0x45, 0x80, 0xFE, 0x86,
+0x00, 0xF5, 0xC4, 0x83, 0xEC, 0x60, 0x00, 0xED, 0x6F, 0x8D, 0xFF, 0xFF, 0x03, 0x85, 0x38, 0x02,
+0x31, 0x22, 0xF3, 0xDF, 0x5D, 0x88, 0xFF, 0xFF, 0x84, 0xFF, 0xFF, 0x00, 0xF7, 0xDF, 0x80, 0x02,
+0x31, 0x00, 0xBE, 0x9C, 0x80, 0xFF, 0xFF, 0x00, 0xEF, 0x9E, 0x80, 0x02, 0x31, 0x04, 0xD7, 0x1D,
+0xFF, 0xFF, 0x6C, 0x97, 0x02, 0x31, 0x5C, 0x36, 0x82, 0xFF, 0xFF, 0x01, 0xF6, 0x34, 0xEC, 0x85,
+0x81, 0xEC, 0x60, 0x04, 0xEC, 0x81, 0xED, 0x0B, 0xF5, 0xB1, 0xF6, 0x76, 0xFF, 0x3B, 0x80, 0xFF,
+0xFF, 0x02, 0xFF, 0x5C, 0xF5, 0xB1, 0xEC, 0x80, 0x80, 0xEC, 0x60, 0x00, 0xFE, 0x25, 0x80, 0xFE,
+0x86, 0x02, 0xEC, 0xE2, 0xEC, 0x60, 0xF5, 0x84, 0x81, 0xFE, 0x86, 0x05, 0xFE, 0x66, 0xFE, 0x05,
+0xF5, 0x43, 0xEC, 0x80, 0xF5, 0x43, 0xF5, 0xC4, 0x84, 0xEC, 0x60, 0x00, 0xEC, 0xA7, 0x8C, 0xFF,
+0xFF, 0x03, 0x85, 0x38, 0x02, 0x31, 0x2B, 0x33, 0xE7, 0x7E, 0x89, 0xFF, 0xFF, 0x84, 0xFF, 0xFF,
+0x00, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x81, 0xFF, 0xFF, 0x03, 0x64, 0x56, 0x02,
+0x31, 0x1A, 0xD2, 0x4B, 0xD5, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x7B, 0x81, 0xFF, 0xFF, 0x02, 0xF6,
+0x55, 0xF5, 0x02, 0xFE, 0x45, 0x81, 0xFE, 0x86, 0x09, 0xFE, 0x66, 0xFE, 0x25, 0xF5, 0xE4, 0xF5,
+0x63, 0xEC, 0xC1, 0xEC, 0xC9, 0xF5, 0x90, 0xEC, 0xA1, 0xF5, 0xA4, 0xFE, 0x66, 0x80, 0xEC, 0x60,
+0x00, 0xFD, 0xE5, 0x80, 0xFE, 0x86, 0x02, 0xF5, 0x63, 0xEC, 0x60, 0xF5, 0x22, 0x84, 0xFE, 0x86,
+0x02, 0xFE, 0x66, 0xF5, 0x63, 0xEC, 0x80, 0x85, 0xEC, 0x60, 0x8B, 0xFF, 0xFF, 0x00, 0xB6, 0x3B,
+0x80, 0x02, 0x31, 0x00, 0x0A, 0x71, 0x82, 0x12, 0x72, 0x00, 0xF7, 0xDF, 0x85, 0xFF, 0xFF, 0x84,
+0xFF, 0xFF, 0x00, 0xF7, 0xDF, 0x80, 0x02, 0x31, 0x00, 0xBE, 0x9C, 0x81, 0xFF, 0xFF, 0x01, 0xEF,
+0x9E, 0x53, 0xF5, 0x80, 0x02, 0x31, 0x01, 0x12, 0x72, 0x95, 0x99, 0x82, 0xFF, 0xFF, 0x01, 0xEC,
+0xEA, 0xFE, 0x25, 0x86, 0xFE, 0x86, 0x03, 0xFE, 0x05, 0xEC, 0x80, 0xF5, 0x63, 0xFE, 0x66, 0x80,
+0xFE, 0x86, 0x02, 0xEC, 0xC1, 0xEC, 0x60, 0xF5, 0x84, 0x80, 0xFE, 0x86, 0x02, 0xF5, 0xA4, 0xEC,
+0x60, 0xEC, 0xA1, 0x86, 0xFE, 0x86, 0x01, 0xFE, 0x25, 0xEC, 0xE2, 0x84, 0xEC, 0x60, 0x8B, 0xFF,
+0xFF, 0x00, 0xA5, 0xDA, 0x85, 0x02, 0x31, 0x00, 0xF7, 0xDF, 0x85, 0xFF, 0xFF, 0x8D, 0xFF, 0xFF,
+0x02, 0xF7, 0xDF, 0xEF, 0xBE, 0xFF, 0xDF, 0x83, 0xFF, 0xFF, 0x05, 0xEC, 0xEA, 0xF5, 0xA4, 0xF5,
+0x63, 0xF5, 0xA4, 0xFD, 0xE5, 0xFE, 0x66, 0x81, 0xFE, 0x86, 0x02, 0xF5, 0xC4, 0xEC, 0x80, 0xFE,
+0x05, 0x82, 0xFE, 0x86, 0x02, 0xF5, 0x43, 0xEC, 0x60, 0xF5, 0x23, 0x80, 0xFE, 0x86, 0x00, 0xFE,
+0x05, 0x80, 0xEC, 0x60, 0x00, 0xFE, 0x66, 0x86, 0xFE, 0x86, 0x01, 0xFE, 0x66, 0xF5, 0x23, 0x83,
+0xEC, 0x60, 0x9B, 0xFF, 0xFF, 0x95, 0xFF, 0xFF, 0x00, 0xF5, 0x90, 0x82, 0xEC, 0x60, 0x05, 0xEC,
+0x80, 0xF5, 0x43, 0xFE, 0x45, 0xF5, 0xC4, 0xEC, 0xA1, 0xFE, 0x25, 0x83, 0xFE, 0x86, 0x02, 0xF5,
+0xA4, 0xEC, 0x60, 0xEC, 0xC1, 0x80, 0xFE, 0x86, 0x00, 0xFE, 0x66, 0x80, 0xEC, 0x60, 0x00, 0xFE,
+0x05, 0x88, 0xFE, 0x86, 0x00, 0xF5, 0x23, 0x81, 0xEC, 0x60, 0x00, 0xEC, 0x84, 0x9B, 0xFF, 0xFF,
+0x95, 0xFF, 0xFF, 0x00, 0xF6, 0x35, 0x84, 0xEC, 0x60, 0x80, 0xEC, 0x80, 0x00, 0xFE, 0x25, 0x84,
+0xFE, 0x86, 0x00, 0xFE, 0x05, 0x80, 0xEC, 0x60, 0x00, 0xFE, 0x66, 0x80, 0xFE, 0x86, 0x02, 0xEC,
+0xA1, 0xEC, 0x60, 0xF5, 0xA4, 0x88, 0xFE, 0x86, 0x01, 0xFE, 0x66, 0xEC, 0xE2, 0x80, 0xEC, 0x60,
+0x00, 0xED, 0x4E, 0x9B, 0xFF, 0xFF, 0x95, 0xFF, 0xFF, 0x00, 0xFE, 0xF9, 0x85, 0xEC, 0x60, 0x00,
+0xFD, 0xE5, 0x85, 0xFE, 0x86, 0x00, 0xFE, 0x45, 0x80, 0xEC, 0x60, 0x00, 0xFE, 0x25, 0x80, 0xFE,
+0x86, 0x02, 0xF5, 0x22, 0xEC, 0x60, 0xF5, 0x63, 0x89, 0xFE, 0x86, 0x03, 0xFE, 0x45, 0xEC, 0x80,
+0xEC, 0x60, 0xF6, 0x14, 0x9B, 0xFF, 0xFF, 0x95, 0xFF, 0xFF, 0x00, 0xFF, 0xBE, 0x84, 0xEC, 0x60,
+0x00, 0xF5, 0x43, 0x87, 0xFE, 0x86, 0x02, 0xEC, 0xA0, 0xEC, 0x60, 0xF5, 0xE5, 0x80, 0xFE, 0x86,
+0x02, 0xFE, 0x25, 0xF5, 0x63, 0xFE, 0x45, 0x8A, 0xFE, 0x86, 0x02, 0xF5, 0x84, 0xEC, 0x60, 0xFF,
+0x1A, 0x9B, 0xFF, 0xFF, 0x96, 0xFF, 0xFF, 0x00, 0xED, 0x2D, 0x82, 0xEC, 0x60, 0x01, 0xEC, 0x80,
+0xFE, 0x46, 0x87, 0xFE, 0x86, 0x02, 0xFE, 0x05, 0xF5, 0x84, 0xFE, 0x66, 0x8F, 0xFE, 0x86, 0x02,
+0xFE, 0x66, 0xEC, 0xA0, 0xFF, 0x7C, 0x9B, 0xFF, 0xFF, 0x96, 0xFF, 0xFF, 0x00, 0xF6, 0x97, 0x82,
+0xEC, 0x60, 0x00, 0xF5, 0x63, 0x94, 0xFE, 0x86, 0x03, 0xCD, 0x47, 0x8B, 0xA7, 0x93, 0xE7, 0xDD,
+0xA6, 0x83, 0xFE, 0x86, 0x01, 0xF5, 0x64, 0xF6, 0x35, 0x9B, 0xFF, 0xFF, 0x96, 0xFF, 0xFF, 0x01,
+0xFF, 0xBE, 0xEC, 0x81, 0x81, 0xEC, 0x60, 0x00, 0xFE, 0x25, 0x93, 0xFE, 0x86, 0x00, 0xCD, 0x47,
+0x82, 0x42, 0x08, 0x00, 0xDD, 0xA6, 0x82, 0xFE, 0x86, 0x01, 0xFE, 0x25, 0xEC, 0xC9, 0x9B, 0xFF,
+0xFF, 0x97, 0xFF, 0xFF, 0x00, 0xF6, 0x13, 0x80, 0xEC, 0x60, 0x00, 0xEC, 0xA1, 0x94, 0xFE, 0x86,
+0x00, 0x73, 0x27, 0x82, 0x42, 0x08, 0x00, 0x8B, 0xC7, 0x83, 0xFE, 0x86, 0x01, 0xEC, 0xC1, 0xFF,
+0x5C, 0x9A, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0x01, 0xEF, 0xBE, 0x7D, 0x18, 0x80, 0x4B, 0xD5, 0x01,
+0x6C, 0xB7, 0xE7, 0x5E, 0x8D, 0xFF, 0xFF, 0x03, 0xFF, 0x9D, 0xEC, 0xA6, 0xEC, 0x80, 0xF5, 0x23,
+0x83, 0xFE, 0x86, 0x03, 0xFE, 0x66, 0xC5, 0x07, 0xAC, 0x87, 0xD5, 0x87, 0x8B, 0xFE, 0x86, 0x00,
+0x4A, 0x28, 0x82, 0x42, 0x08, 0x00, 0x4A, 0x48, 0x83, 0xFE, 0x86, 0x01, 0xF5, 0x43, 0xF6, 0xB8,
+0x90, 0xFF, 0xFF, 0x05, 0xAE, 0x3B, 0x5C, 0x36, 0x2B, 0x33, 0x2B, 0x13, 0x54, 0x15, 0xB6, 0x3B,
+0x82, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0x00, 0x3B, 0x94, 0x82, 0x02, 0x31, 0x01, 0x1A, 0xB2, 0xE7,
+0x5E, 0x8D, 0xFF, 0xFF, 0x02, 0xF6, 0xD9, 0xEC, 0x60, 0xF5, 0x84, 0x82, 0xFE, 0x86, 0x01, 0xFE,
+0x66, 0x83, 0x67, 0x81, 0x42, 0x08, 0x00, 0xB4, 0xC7, 0x8A, 0xFE, 0x86, 0x00, 0x93, 0xC7, 0x82,
+0x42, 0x08, 0x00, 0x7B, 0x47, 0x83, 0xFE, 0x86, 0x01, 0xF5, 0xC4, 0xF6, 0x14, 0x8F, 0xFF, 0xFF,
+0x00, 0xCE, 0xDC, 0x84, 0x02, 0x31, 0x00, 0xAE, 0x1B, 0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x07,
+0xB6, 0x3B, 0x02, 0x31, 0x12, 0x92, 0xD7, 0x1D, 0xF7, 0xBE, 0x4B, 0xD5, 0x02, 0x31, 0x64, 0x77,
+0x8E, 0xFF, 0xFF, 0x01, 0xF5, 0xB1, 0xF5, 0xC4, 0x82, 0xFE, 0x86, 0x00, 0xD5, 0x87, 0x83, 0x42,
+0x08, 0x00, 0xF6, 0x26, 0x89, 0xFE, 0x86, 0x01, 0xE5, 0xC6, 0x42, 0x28, 0x81, 0x42, 0x08, 0x00,
+0xCD, 0x47, 0x83, 0xFE, 0x86, 0x01, 0xFE, 0x05, 0xED, 0x6F, 0x90, 0xFF, 0xFF, 0x06, 0x9D, 0x99,
+0xB6, 0x5B, 0xFF, 0xDF, 0xF7, 0xDF, 0x3B, 0x74, 0x02, 0x31, 0x5C, 0x36, 0x81, 0xFF, 0xFF, 0x81,
+0xFF, 0xFF, 0x02, 0x85, 0x38, 0x02, 0x31, 0x54, 0x16, 0x80, 0xFF, 0xFF, 0x02, 0xB6, 0x3B, 0x02,
+0x31, 0x12, 0x92, 0x8E, 0xFF, 0xFF, 0x01, 0xF5, 0x90, 0xF5, 0xC4, 0x82, 0xFE, 0x86, 0x00, 0xBC,
+0xC7, 0x83, 0x42, 0x08, 0x00, 0xCD, 0x67, 0x84, 0xFE, 0x86, 0x02, 0xF6, 0x46, 0xED, 0xE6, 0xFE,
+0x66, 0x81, 0xFE, 0x86, 0x03, 0xE5, 0xC6, 0x9C, 0x07, 0x8B, 0xC7, 0xD5, 0x47, 0x83, 0xFE, 0x86,
+0x04, 0xFE, 0x66, 0xFE, 0x25, 0xE4, 0xEC, 0xBD, 0xF7, 0xC6, 0x38, 0x92, 0xFF, 0xFF, 0x02, 0x5C,
+0x56, 0x02, 0x31, 0x74, 0xD7, 0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x02, 0x95, 0x99, 0x02, 0x31,
+0x43, 0x94, 0x80, 0xFF, 0xFF, 0x00, 0xAD, 0xFA, 0x80, 0x02, 0x31, 0x8E, 0xFF, 0xFF, 0x01, 0xF5,
+0xB1, 0xF5, 0xC4, 0x82, 0xFE, 0x86, 0x00, 0xD5, 0x67, 0x83, 0x42, 0x08, 0x00, 0xDD, 0x86, 0x81,
+0xFE, 0x86, 0x02, 0xCD, 0x27, 0xAB, 0xE7, 0x8A, 0xE7, 0x80, 0x72, 0x07, 0x00, 0xC4, 0xC6, 0x85,
+0xFE, 0x86, 0x83, 0xFE, 0x66, 0x04, 0xED, 0xE6, 0xAC, 0x47, 0x4A, 0x27, 0x63, 0x2C, 0xD6, 0x9A,
+0x8F, 0xFF, 0xFF, 0x05, 0xBE, 0x9C, 0xA5, 0xFA, 0x74, 0xD7, 0x0A, 0x51, 0x33, 0x54, 0xEF, 0x7E,
+0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x00, 0xC6, 0xBC, 0x80, 0x02, 0x31, 0x02, 0x6C, 0x97, 0x85,
+0x18, 0x1A, 0xB2, 0x80, 0x02, 0x31, 0x8E, 0xFF, 0xFF, 0x01, 0xF6, 0x14, 0xF5, 0xC4, 0x82, 0xFE,
+0x86, 0x01, 0xFE, 0x66, 0x6A, 0xE7, 0x81, 0x42, 0x08, 0x01, 0x62, 0xC7, 0xFE, 0x66, 0x80, 0xFE,
+0x86, 0x07, 0xFE, 0x46, 0x69, 0xE6, 0x61, 0xC6, 0x61, 0xA6, 0x59, 0x85, 0x51, 0x65, 0xCD, 0x25,
+0xFE, 0x86, 0x87, 0xFE, 0x66, 0x04, 0xDD, 0x86, 0x93, 0xC7, 0x42, 0x08, 0x7A, 0xE7, 0xC4, 0x09,
+0x91, 0xFF, 0xFF, 0x00, 0x4B, 0xD5, 0x80, 0x02, 0x31, 0x01, 0x22, 0xD3, 0xBE, 0x7B, 0x82, 0xFF,
+0xFF, 0x82, 0xFF, 0xFF, 0x00, 0x7C, 0xF8, 0x81, 0x02, 0x31, 0x02, 0x85, 0x38, 0x02, 0x31, 0x12,
+0x72, 0x8E, 0xFF, 0xFF, 0x01, 0xF6, 0x55, 0xF5, 0x84, 0x83, 0xFE, 0x86, 0x04, 0xEE, 0x06, 0x8B,
+0xC7, 0x42, 0x08, 0x83, 0x87, 0xE5, 0xE6, 0x82, 0xFE, 0x86, 0x04, 0xC4, 0xC5, 0x49, 0x24, 0x41,
+0x03, 0x40, 0xE3, 0x83, 0x03, 0x87, 0xFE, 0x66, 0x06, 0xF6, 0x26, 0x7B, 0x47, 0x42, 0x08, 0x93,
+0xC7, 0xDD, 0x66, 0xFD, 0xE5, 0xED, 0x4E, 0x91, 0xFF, 0xFF, 0x05, 0xBE, 0x9C, 0xA5, 0xFA, 0x85,
+0x18, 0x1A, 0xB2, 0x02, 0x31, 0x7D, 0x18, 0x81, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x05, 0xE7, 0x5D,
+0xB6, 0x3B, 0xDF, 0x3D, 0xB6, 0x3B, 0x02, 0x31, 0x4B, 0xF5, 0x8E, 0xFF, 0xFF, 0x01, 0xF6, 0xD9,
+0xF5, 0x23, 0x88, 0xFE, 0x86, 0x83, 0xFE, 0x66, 0x03, 0xDD, 0x85, 0x49, 0xA2, 0x28, 0x41, 0xDD,
+0x85, 0x82, 0xFE, 0x66, 0x83, 0xFE, 0x46, 0x02, 0xF6, 0x06, 0xBC, 0xA7, 0xED, 0xA6, 0x80, 0xFE,
+0x25, 0x01, 0xF5, 0xA4, 0xF5, 0xB1, 0x94, 0xFF, 0xFF, 0x02, 0x95, 0x99, 0x02, 0x31, 0x0A, 0x72,
+0x81, 0xFF, 0xFF, 0x85, 0xFF, 0xFF, 0x03, 0xEF, 0x9E, 0x33, 0x54, 0x02, 0x31, 0xA5, 0xDA, 0x8E,
+0xFF, 0xFF, 0x01, 0xFF, 0x7C, 0xEC, 0xA1, 0x82, 0xFE, 0x86, 0x8A, 0xFE, 0x66, 0x02, 0xF6, 0x05,
+0x62, 0x87, 0xCD, 0x07, 0x83, 0xFE, 0x46, 0x00, 0xED, 0xE6, 0x82, 0xFE, 0x25, 0x08, 0xE5, 0x86,
+0xC4, 0xC6, 0xBC, 0x87, 0xAC, 0x47, 0xAB, 0xC6, 0xA4, 0x4F, 0xA5, 0x34, 0x9C, 0xF3, 0xD6, 0x9A,
+0x8C, 0xFF, 0xFF, 0x01, 0xE7, 0x5E, 0xFF, 0xDF, 0x81, 0xFF, 0xFF, 0x02, 0x74, 0xB7, 0x02, 0x31,
+0x1A, 0xB2, 0x81, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0x05, 0x85, 0x38, 0x5C, 0x56, 0x54, 0x16, 0x12,
+0x72, 0x02, 0x31, 0x43, 0xB5, 0x90, 0xFF, 0xFF, 0x01, 0xEC, 0xC8, 0xFE, 0x25, 0x89, 0xFE, 0x66,
+0x82, 0xFE, 0x46, 0x03, 0xF6, 0x06, 0x42, 0x08, 0x52, 0x47, 0xDD, 0x46, 0x81, 0xFE, 0x25, 0x01,
+0xC4, 0xE6, 0x6A, 0xC7, 0x81, 0xFE, 0x05, 0x09, 0xFD, 0xE5, 0xB4, 0x47, 0x7B, 0x07, 0x83, 0x47,
+0x83, 0x27, 0x82, 0xC7, 0x94, 0x91, 0xAD, 0x55, 0xAD, 0x75, 0xDE, 0xDB, 0x8C, 0xFF, 0xFF, 0x04,
+0xA5, 0xDA, 0x0A, 0x71, 0x53, 0xF5, 0x5C, 0x36, 0x3B, 0x94, 0x80, 0x02, 0x31, 0x00, 0x7D, 0x18,
+0x81, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0x00, 0x4B, 0xD5, 0x80, 0x02, 0x31, 0x02, 0x1A, 0xB2, 0x7D,
+0x18, 0xF7, 0xDF, 0x8E, 0xFF, 0xFF, 0x08, 0xDE, 0xFB, 0x7B, 0xCF, 0x7B, 0x09, 0x83, 0x47, 0x9C,
+0x27, 0xAC, 0x67, 0xAC, 0x87, 0xBC, 0xC7, 0xCD, 0x47, 0x85, 0xFE, 0x46, 0x81, 0xFE, 0x25, 0x00,
+0xA4, 0x07, 0x81, 0x42, 0x08, 0x05, 0x73, 0x07, 0x93, 0xA7, 0x6A, 0xE7, 0x8B, 0x67, 0xED, 0x85,
+0xFD, 0xE5, 0x81, 0xFD, 0xC5, 0x81, 0xFD, 0xA5, 0x02, 0xFD, 0x84, 0xEC, 0xA6, 0xFF, 0xDF, 0x8F,
+0xFF, 0xFF, 0x01, 0xBE, 0x9C, 0x22, 0xF3, 0x81, 0x02, 0x31, 0x01, 0x1A, 0xB2, 0x85, 0x38, 0x82,
+0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0x02, 0xF7, 0xDF, 0xEF, 0xBE, 0xF7, 0xBE, 0x91, 0xFF, 0xFF, 0x05,
+0xF7, 0x9E, 0xCE, 0x79, 0xB5, 0x75, 0xA3, 0x46, 0xAC, 0x47, 0x93, 0xC7, 0x80, 0x83, 0x67, 0x02,
+0x7B, 0x47, 0xF6, 0x06, 0xFE, 0x26, 0x81, 0xFE, 0x25, 0x04, 0xAC, 0x47, 0xBC, 0xA7, 0xE5, 0x66,
+0xD5, 0x06, 0x8B, 0x67, 0x84, 0x42, 0x08, 0x01, 0x83, 0x47, 0xFD, 0xC5, 0x81, 0xFD, 0xA5, 0x80,
+0xFD, 0x85, 0x04, 0x93, 0x87, 0x72, 0xC7, 0xB4, 0x06, 0xD4, 0x64, 0xF6, 0x14, 0x92, 0xFF, 0xFF,
+0x02, 0xF7, 0xDF, 0xEF, 0xBE, 0xF7, 0xBE, 0x84, 0xFF, 0xFF, 0x9B, 0xFF, 0xFF, 0x01, 0xED, 0x0C,
+0xF5, 0xC4, 0x81, 0xFE, 0x25, 0x01, 0xF6, 0x05, 0xFE, 0x25, 0x82, 0xFE, 0x05, 0x02, 0xED, 0x86,
+0xB4, 0x47, 0x83, 0x47, 0x86, 0x42, 0x08, 0x00, 0x8B, 0x47, 0x80, 0xFD, 0x85, 0x80, 0xFD, 0x64,
+0x08, 0xFD, 0x44, 0xF5, 0x44, 0xE4, 0xE5, 0xB3, 0xE6, 0x72, 0xA7, 0x42, 0x08, 0x63, 0x2C, 0xAD,
+0x75, 0xDE, 0xFB, 0x99, 0xFF, 0xFF, 0x9B, 0xFF, 0xFF, 0x06, 0xF6, 0xF9, 0xEC, 0xC1, 0xF5, 0xE5,
+0xCD, 0x06, 0x9B, 0xC7, 0x42, 0x28, 0xCC, 0xC6, 0x80, 0xFD, 0xE5, 0x82, 0xFD, 0xC5, 0x01, 0xF5,
+0x85, 0x52, 0x47, 0x80, 0x42, 0x08, 0x06, 0x92, 0xAA, 0xC3, 0x2C, 0xCB, 0x4C, 0xAA, 0xEB, 0x52,
+0x28, 0xBC, 0x06, 0xF5, 0x44, 0x82, 0xF5, 0x24, 0x81, 0xF5, 0x04, 0x06, 0xEC, 0xA2, 0xE5, 0xB3,
+0xC6, 0x18, 0x8C, 0x51, 0x42, 0x08, 0x52, 0xAA, 0xCE, 0x59, 0x97, 0xFF, 0xFF, 0x9A, 0xFF, 0xFF,
+0x07, 0xF7, 0xBE, 0xCE, 0x79, 0x8B, 0x07, 0x42, 0x08, 0x4A, 0x27, 0x9B, 0xA7, 0xD4, 0xC6, 0xF5,
+0xA5, 0x81, 0xFD, 0xA5, 0x81, 0xFD, 0x85, 0x03, 0xFD, 0x84, 0xBC, 0x26, 0x42, 0x08, 0xBB, 0x2B,
+0x82, 0xEB, 0xAE, 0x01, 0xD3, 0x8C, 0xEC, 0xE4, 0x85, 0xF5, 0x04, 0x02, 0xF4, 0xE3, 0xEC, 0xEA,
+0xFF, 0xDE, 0x80, 0xFF, 0xFF, 0x02, 0xF7, 0xBE, 0xCE, 0x79, 0xE7, 0x1C, 0x97, 0xFF, 0xFF, 0x99,
+0xFF, 0xFF, 0x09, 0xCE, 0x59, 0x42, 0x28, 0x52, 0xAA, 0xA5, 0x14, 0xC4, 0x08, 0xF5, 0x44, 0xFD,
+0xA5, 0xED, 0x45, 0x8B, 0x67, 0xDC, 0xE5, 0x81, 0xFD, 0x64, 0x01, 0xFD, 0x44, 0xF5, 0x44, 0x80,
+0xF5, 0x24, 0x01, 0xC3, 0xE7, 0xE3, 0xAD, 0x80, 0xEB, 0xAD, 0x02, 0xE3, 0xAD, 0xDB, 0xCC, 0xF4,
+0xC7, 0x85, 0xF5, 0x04, 0x02, 0xF4, 0xE3, 0xEC, 0x80, 0xEE, 0x35, 0x9D, 0xFF, 0xFF, 0x99, 0xFF,
+0xFF, 0x09, 0xEF, 0x7D, 0xDE, 0xDB, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0xFA, 0xEC, 0x80, 0xD4, 0x85,
+0x52, 0x47, 0x83, 0x07, 0xED, 0x05, 0x82, 0xF5, 0x24, 0x82, 0xF5, 0x04, 0x03, 0xF4, 0xE6, 0xEC,
+0x89, 0xE4, 0x69, 0xEC, 0xA8, 0x86, 0xF5, 0x04, 0x04, 0xF4, 0xE3, 0xEC, 0x80, 0xF5, 0x44, 0xDC,
+0x41, 0xEE, 0x57, 0x9C, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0x02, 0xB4, 0xD1, 0x42, 0x08, 0xAB, 0x86,
+0x93, 0xF5, 0x04, 0x06, 0xF4, 0xC3, 0xEC, 0x80, 0xF5, 0x84, 0xFE, 0x06, 0xF5, 0xA5, 0xD4, 0x00,
+0xEE, 0x15, 0x9B, 0xFF, 0xFF, 0x9C, 0xFF, 0xFF, 0x05, 0xF7, 0xBE, 0x94, 0x92, 0x52, 0xAA, 0xCD,
+0xF6, 0xEC, 0xA7, 0xF4, 0xC2, 0x91, 0xF5, 0x04, 0x05, 0xEC, 0xA2, 0xEC, 0xA1, 0xFD, 0xC5, 0xFE,
+0x06, 0xF5, 0xA5, 0xDC, 0x40, 0x80, 0xD4, 0x00, 0x00, 0xEE, 0x15, 0x9A, 0xFF, 0xFF, 0x9B, 0xFF,
+0xFF, 0x08, 0xE7, 0x3C, 0x6B, 0x6D, 0x73, 0xAE, 0xEF, 0x5D, 0xFF, 0xFF, 0xFF, 0x9D, 0xED, 0x6F,
+0xEC, 0x81, 0xF4, 0xE3, 0x8D, 0xF5, 0x04, 0x06, 0xF4, 0xC2, 0xEC, 0x80, 0xF5, 0x23, 0xFE, 0x05,
+0xFE, 0x06, 0xF5, 0xA5, 0xDC, 0x20, 0x82, 0xD4, 0x00, 0x00, 0xE6, 0x14, 0x99, 0xFF, 0xFF, 0x87,
+0xFF, 0xFF, 0x05, 0xEF, 0xBE, 0x7D, 0x18, 0x4B, 0xD5, 0x2B, 0x33, 0x54, 0x15, 0xB6, 0x5B, 0x8C,
+0xFF, 0xFF, 0x02, 0x8C, 0x71, 0x9C, 0xF3, 0xFF, 0xDF, 0x82, 0xFF, 0xFF, 0x04, 0xFE, 0xFA, 0xED,
+0x4E, 0xEC, 0x80, 0xF4, 0xC2, 0xF4, 0xE3, 0x86, 0xF5, 0x04, 0x05, 0xF4, 0xE3, 0xF4, 0xC3, 0xEC,
+0xA1, 0xEC, 0x80, 0xF5, 0x23, 0xFD, 0xE5, 0x80, 0xFE, 0x06, 0x01, 0xF5, 0x85, 0xDC, 0x20, 0x81,
+0xD4, 0x00, 0x03, 0xD4, 0x20, 0xF5, 0x44, 0xDC, 0x62, 0xE5, 0xF4, 0x8C, 0xFF, 0xFF, 0x00, 0xD6,
+0xFC, 0x80, 0x53, 0xF5, 0x87, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x03, 0x43, 0x94, 0x02, 0x31, 0x0A,
+0x71, 0x33, 0x34, 0x80, 0x02, 0x31, 0x00, 0xAE, 0x1A, 0x94, 0xFF, 0xFF, 0x04, 0xFF, 0x5C, 0xF6,
+0x55, 0xED, 0x2C, 0xEC, 0x60, 0xEC, 0x80, 0x82, 0xEC, 0xA1, 0x05, 0xEC, 0x81, 0xEC, 0x60, 0xEC,
+0xC6, 0xF5, 0x03, 0xF5, 0x84, 0xFE, 0x05, 0x81, 0xFE, 0x06, 0x01, 0xF5, 0x85, 0xDC, 0x20, 0x81,
+0xD4, 0x00, 0x05, 0xE4, 0xA2, 0xF5, 0x85, 0xFD, 0xA5, 0xF5, 0x85, 0xD4, 0x20, 0xE5, 0xF4, 0x8A,
+0xFF, 0xFF, 0x01, 0xFF, 0xDF, 0x2B, 0x33, 0x80, 0x02, 0x31, 0x87, 0xFF, 0xFF, 0x86, 0xFF, 0xFF,
+0x00, 0xF7, 0xBE, 0x80, 0x02, 0x31, 0x04, 0xE7, 0x7E, 0xFF, 0xFF, 0x7C, 0xF8, 0x02, 0x31, 0x5C,
+0x36, 0x96, 0xFF, 0xFF, 0x03, 0xF7, 0x1B, 0xE5, 0x2B, 0xFE, 0xF4, 0xFE, 0x92, 0x80, 0xF6, 0x71,
+0x03, 0xFE, 0x92, 0xFE, 0xD3, 0xFF, 0x35, 0xFF, 0x55, 0x83, 0xFE, 0x06, 0x09, 0xFD, 0xE6, 0xDC,
+0x82, 0xD4, 0x00, 0xDC, 0x41, 0xED, 0x03, 0xF5, 0x85, 0xFD, 0xC5, 0xFD, 0xA5, 0xF5, 0x65, 0xDC,
+0x41, 0x80, 0xD4, 0x00, 0x00, 0xE5, 0xF4, 0x89, 0xFF, 0xFF, 0x00, 0x7C, 0xF8, 0x81, 0x02, 0x31,
+0x87, 0xFF, 0xFF, 0x86, 0xFF, 0xFF, 0x07, 0xF7, 0xDF, 0x0A, 0x51, 0x02, 0x31, 0xD6, 0xFC, 0xFF,
+0xFF, 0x6C, 0x97, 0x02, 0x31, 0x6C, 0xB7, 0x96, 0xFF, 0xFF, 0x01, 0xF7, 0x1A, 0xE5, 0x6D, 0x85,
+0xFF, 0x76, 0x00, 0xFF, 0x34, 0x81, 0xFE, 0x06, 0x81, 0xFD, 0xE6, 0x01, 0xF5, 0x85, 0xF5, 0x65,
+0x80, 0xFD, 0xC5, 0x80, 0xFD, 0xA5, 0x01, 0xF5, 0x65, 0xDC, 0x20, 0x82, 0xD4, 0x00, 0x00, 0xE5,
+0xF4, 0x87, 0xFF, 0xFF, 0x02, 0xC6, 0xBC, 0x02, 0x31, 0x74, 0xD7, 0x80, 0x02, 0x31, 0x87, 0xFF,
+0xFF, 0x87, 0xFF, 0xFF, 0x06, 0x95, 0x79, 0x02, 0x31, 0x12, 0x72, 0x43, 0x94, 0x02, 0x31, 0x2B,
+0x33, 0xE7, 0x7E, 0x96, 0xFF, 0xFF, 0x01, 0xF7, 0x5C, 0xE5, 0x6D, 0x85, 0xFF, 0x76, 0x00, 0xFF,
+0x34, 0x80, 0xFE, 0x06, 0x81, 0xFD, 0xE6, 0x00, 0xFD, 0xE5, 0x81, 0xFD, 0xC5, 0x80, 0xFD, 0xA5,
+0x01, 0xFD, 0x85, 0xDC, 0x41, 0x82, 0xD4, 0x00, 0x02, 0xE4, 0x82, 0xDC, 0x41, 0xE6, 0x15, 0x85,
+0xFF, 0xFF, 0x03, 0xF7, 0xBE, 0x2B, 0x13, 0x22, 0xF3, 0xDF, 0x5D, 0x80, 0x02, 0x31, 0x87, 0xFF,
+0xFF, 0x87, 0xFF, 0xFF, 0x01, 0xF7, 0xBE, 0x3B, 0x74, 0x80, 0x02, 0x31, 0x01, 0x0A, 0x51, 0xC6,
+0xBC, 0x97, 0xFF, 0xFF, 0x01, 0xFF, 0x7D, 0xE5, 0x0A, 0x85, 0xFF, 0x76, 0x00, 0xFF, 0x34, 0x80,
+0xFD, 0xE5, 0x80, 0xFD, 0xE6, 0x82, 0xFD, 0xC5, 0x03, 0xFD, 0xA5, 0xF5, 0x65, 0xFD, 0x85, 0xE4,
+0xC3, 0x81, 0xD4, 0x00, 0x05, 0xE4, 0x62, 0xF5, 0x04, 0xFD, 0x65, 0xF5, 0x45, 0xDC, 0x41, 0xEE,
+0x15, 0x84, 0xFF, 0xFF, 0x03, 0x6C, 0xB7, 0x02, 0x31, 0xBE, 0x7B, 0xC6, 0x9C, 0x80, 0x02, 0x31,
+0x87, 0xFF, 0xFF, 0x86, 0xFF, 0xFF, 0x04, 0xF7, 0xDF, 0x3B, 0x74, 0x02, 0x31, 0x43, 0xB5, 0x7D,
+0x18, 0x80, 0x02, 0x31, 0x00, 0xAE, 0x1A, 0x97, 0xFF, 0xFF, 0x00, 0xDC, 0x88, 0x85, 0xFF, 0x76,
+0x03, 0xFF, 0x34, 0xDC, 0x82, 0xF5, 0x85, 0xFD, 0xE5, 0x81, 0xFD, 0xC5, 0x81, 0xFD, 0xA5, 0x01,
+0xDC, 0x62, 0xF5, 0x24, 0x80, 0xDC, 0x41, 0x02, 0xE4, 0xC3, 0xF5, 0x25, 0xFD, 0x65, 0x81, 0xFD,
+0x45, 0x02, 0xF5, 0x25, 0xDC, 0x41, 0xEE, 0x35, 0x82, 0xFF, 0xFF, 0x04, 0xBE, 0x7B, 0x02, 0x31,
+0x6C, 0x97, 0xFF, 0xFF, 0xB5, 0x96, 0x80, 0x02, 0x31, 0x00, 0xF7, 0x7C, 0x86, 0xFF, 0xFF, 0x86,
+0xFF, 0xFF, 0x02, 0xAD, 0xFA, 0x02, 0x31, 0x3B, 0x74, 0x80, 0xFF, 0xFF, 0x02, 0xB6, 0x3B, 0x02,
+0x31, 0x1A, 0xB2, 0x97, 0xFF, 0xFF, 0x01, 0xE5, 0x50, 0xFF, 0x14, 0x84, 0xFF, 0x76, 0x05, 0xFF,
+0x34, 0xDC, 0x82, 0xED, 0x03, 0xF5, 0x44, 0xF5, 0x64, 0xF5, 0x85, 0x81, 0xFD, 0xA5, 0x03, 0xFD,
+0x85, 0xDC, 0x61, 0xF5, 0x44, 0xFD, 0x85, 0x81, 0xFD, 0x65, 0x81, 0xFD, 0x45, 0x80, 0xFD, 0x25,
+0x02, 0xF5, 0x05, 0xDC, 0x21, 0xEE, 0xB9, 0x81, 0xFF, 0xFF, 0x01, 0x4B, 0xF5, 0x02, 0x31, 0x80,
+0x0A, 0x51, 0x00, 0x0A, 0x31, 0x80, 0x02, 0x31, 0x01, 0x0A, 0x31, 0xAE, 0x1A, 0x85, 0xFF, 0xFF,
+0x86, 0xFF, 0xFF, 0x02, 0x9D, 0xBA, 0x02, 0x31, 0x53, 0xF5, 0x80, 0xFF, 0xFF, 0x00, 0xE7, 0x5D,
+0x80, 0x02, 0x31, 0x97, 0xFF, 0xFF, 0x01, 0xEE, 0x98, 0xEE, 0x10, 0x84, 0xFF, 0x76, 0x01, 0xFF,
+0x35, 0xE4, 0xC3, 0x82, 0xD4, 0x00, 0x01, 0xDC, 0x41, 0xF5, 0x44, 0x80, 0xFD, 0x85, 0x01, 0xDC,
+0x20, 0xF5, 0x45, 0x81, 0xFD, 0x65, 0x81, 0xFD, 0x45, 0x81, 0xFD, 0x25, 0x03, 0xFD, 0x05, 0xF4,
+0xE4, 0xDC, 0x45, 0xFF, 0x7D, 0x80, 0xFF, 0xFF, 0x00, 0x7D, 0x18, 0x81, 0x4B, 0xD5, 0x00, 0x32,
+0xAF, 0x80, 0x02, 0x31, 0x01, 0x42, 0xAC, 0xB5, 0x55, 0x85, 0xFF, 0xFF, 0x86, 0xFF, 0xFF, 0x00,
+0xD6, 0xFC, 0x80, 0x02, 0x31, 0x04, 0x5C, 0x36, 0x6C, 0x97, 0x2B, 0x13, 0x02, 0x31, 0x4B, 0xF5,
+0x97, 0xFF, 0xFF, 0x02, 0xFF, 0xDE, 0xDC, 0x66, 0xFF, 0x35, 0x83, 0xFF, 0x76, 0x01, 0xFF, 0x56,
+0xE4, 0xC3, 0x83, 0xD4, 0x00, 0x00, 0xE4, 0xC3, 0x80, 0xFD, 0x85, 0x02, 0xD4, 0x00, 0xF5, 0x45,
+0xFD, 0x65, 0x82, 0xFD, 0x45, 0x81, 0xFD, 0x25, 0x81, 0xFD, 0x05, 0x01, 0xEC, 0x83, 0xDD, 0x2F,
+0x84, 0xFF, 0xFF, 0x00, 0xAC, 0xF3, 0x80, 0x02, 0x31, 0x01, 0xD4, 0x00, 0xDC, 0xAA, 0x85, 0xFF,
+0xFF, 0x87, 0xFF, 0xFF, 0x01, 0xAD, 0xFA, 0x22, 0xD3, 0x81, 0x02, 0x31, 0x01, 0x64, 0x56, 0xEF,
+0x9E, 0x98, 0xFF, 0xFF, 0x02, 0xDD, 0x0E, 0xE5, 0x4C, 0xFF, 0x56, 0x83, 0xFF, 0x76, 0x00, 0xE4,
+0xE4, 0x81, 0xD4, 0x00, 0x05, 0xDC, 0x20, 0xE4, 0xC3, 0xFD, 0x65, 0xFD, 0x85, 0xFD, 0x65, 0xD4,
+0x00, 0x80, 0xFD, 0x45, 0x01, 0xF5, 0x25, 0xFD, 0x45, 0x82, 0xFD, 0x25, 0x06, 0xFD, 0x05, 0xEC,
+0xA3, 0xDC, 0x42, 0xD4, 0x00, 0xE4, 0x62, 0xDC, 0x21, 0xF6, 0xD9, 0x83, 0xFF, 0xFF, 0x00, 0xBD,
+0xF9, 0x80, 0x02, 0x31, 0x02, 0xED, 0x84, 0xDC, 0x40, 0xFF, 0x7D, 0x84, 0xFF, 0xFF, 0x89, 0xFF,
+0xFF, 0x02, 0xF7, 0xBE, 0xEF, 0xBE, 0xFF, 0xDF, 0x9A, 0xFF, 0xFF, 0x03, 0xEE, 0x15, 0xD4, 0x00,
+0xE5, 0x6C, 0xFF, 0x56, 0x82, 0xFF, 0x76, 0x03, 0xED, 0x69, 0xE4, 0xA3, 0xF5, 0x65, 0xFD, 0x65,
+0x82, 0xFD, 0x85, 0x05, 0xFD, 0x45, 0xD4, 0x00, 0xFD, 0x45, 0xE4, 0xA3, 0xD4, 0x00, 0xF5, 0x05,
+0x80, 0xFD, 0x25, 0x02, 0xFD, 0x05, 0xEC, 0xA3, 0xDC, 0x20, 0x83, 0xD4, 0x00, 0x00, 0xDD, 0x0E,
+0x84, 0xFF, 0xFF, 0x04, 0xDC, 0x8A, 0xF5, 0xC5, 0xFE, 0x26, 0xE4, 0xA2, 0xF6, 0xFA, 0x84, 0xFF,
+0xFF, 0xA8, 0xFF, 0xFF, 0x04, 0xF6, 0xFA, 0xE4, 0x80, 0xE4, 0xC1, 0xE5, 0x0B, 0xFF, 0x35, 0x81,
+0xFF, 0x76, 0x02, 0xED, 0x8B, 0xE4, 0xA3, 0xFD, 0xA5, 0x82, 0xFD, 0x85, 0x09, 0xFD, 0x65, 0xF5,
+0x45, 0xDC, 0x20, 0xE4, 0xA3, 0xD4, 0x00, 0xE4, 0x62, 0xF5, 0x05, 0xFD, 0x25, 0xF5, 0x05, 0xDC,
+0x41, 0x85, 0xD4, 0x00, 0x01, 0xDC, 0x00, 0xF7, 0x7C, 0x83, 0xFF, 0xFF, 0x04, 0xE5, 0xD3, 0xED,
+0x44, 0xFE, 0x06, 0xE5, 0x03, 0xEE, 0xB8, 0x84, 0xFF, 0xFF, 0xA8, 0xFF, 0xFF, 0x05, 0xFF, 0xBE,
+0xDC, 0x20, 0xFE, 0x03, 0xED, 0x42, 0xDC, 0x86, 0xF6, 0x92, 0x80, 0xFF, 0x76, 0x04, 0xED, 0xEE,
+0xDC, 0x62, 0xF5, 0x24, 0xED, 0x04, 0xF5, 0x25, 0x81, 0xFD, 0x85, 0x03, 0xF5, 0x25, 0xD4, 0x20,
+0xD4, 0x00, 0xE4, 0x62, 0x80, 0xFD, 0x25, 0x01, 0xFD, 0x05, 0xE4, 0x62, 0x86, 0xD4, 0x00, 0x01,
+0xDC, 0x21, 0xEE, 0x77, 0x83, 0xFF, 0xFF, 0x04, 0xEE, 0x35, 0xE4, 0xE3, 0xFE, 0x06, 0xE4, 0xE3,
+0xEE, 0x97, 0x84, 0xFF, 0xFF, 0x95, 0xFF, 0xFF, 0x00, 0x95, 0x99, 0x85, 0x53, 0xF5, 0x00, 0xF7,
+0xDF, 0x89, 0xFF, 0xFF, 0x01, 0xDC, 0xAB, 0xF5, 0xC2, 0x80, 0xFE, 0x03, 0x03, 0xED, 0x42, 0xE5,
+0x4B, 0xFE, 0xF4, 0xF6, 0x30, 0x82, 0xD4, 0x00, 0x00, 0xE4, 0x83, 0x80, 0xFD, 0x86, 0x00, 0xF5,
+0x25, 0x80, 0xD4, 0x00, 0x04, 0xF5, 0x04, 0xFD, 0x05, 0x8B, 0xAA, 0x53, 0x0D, 0x4A, 0xCC, 0x81,
+0x42, 0xCC, 0x00, 0xCB, 0xE1, 0x81, 0xD4, 0x00, 0x80, 0xEC, 0x63, 0x00, 0xE5, 0x71, 0x83, 0xFF,
+0xFF, 0x04, 0xE5, 0xF4, 0xE4, 0xC3, 0xFD, 0xE5, 0xE4, 0xE3, 0xEE, 0xB9, 0x84, 0xFF, 0xFF, 0x95,
+0xFF, 0xFF, 0x00, 0x64, 0x76, 0x85, 0x02, 0x31, 0x00, 0xF7, 0xDF, 0x89, 0xFF, 0xFF, 0x07, 0xE5,
+0xB3, 0xDC, 0x80, 0xED, 0x01, 0xF5, 0xA2, 0xFE, 0x03, 0xFD, 0xE3, 0xEC, 0xE1, 0xDC, 0x86, 0x82,
+0xD4, 0x00, 0x00, 0xDC, 0x41, 0x80, 0xFD, 0x86, 0x02, 0xF5, 0x04, 0xD4, 0x00, 0xDC, 0x41, 0x80,
+0xFD, 0x05, 0x00, 0x4B, 0x0D, 0x83, 0x02, 0x31, 0x06, 0xDC, 0x44, 0xEC, 0x63, 0xEC, 0x84, 0xF4,
+0xA4, 0xFC, 0xA5, 0xF4, 0x84, 0xDC, 0xCC, 0x82, 0xFF, 0xFF, 0x05, 0xFF, 0xDE, 0xDC, 0x89, 0xD4,
+0x00, 0xE4, 0xC3, 0xDC, 0x61, 0xF7, 0x1A, 0x84, 0xFF, 0xFF, 0x95, 0xFF, 0xFF, 0x00, 0xDF, 0x1D,
+0x82, 0xBE, 0x9C, 0x02, 0x64, 0x76, 0x02, 0x31, 0x4B, 0xD5, 0x8A, 0xFF, 0xFF, 0x00, 0xEE, 0x98,
+0x81, 0xD4, 0x00, 0x00, 0xE4, 0xC1, 0x80, 0xFD, 0xE3, 0x00, 0xE4, 0xE1, 0x81, 0xD4, 0x00, 0x01,
+0xE4, 0x82, 0xF5, 0x65, 0x80, 0xFD, 0x86, 0x02, 0xED, 0x04, 0xD4, 0x00, 0xDC, 0x41, 0x80, 0xFD,
+0x05, 0x02, 0x3A, 0xCE, 0x02, 0x31, 0x83, 0x8B, 0x81, 0xBC, 0x08, 0x06, 0xF4, 0xA5, 0xF4, 0xA4,
+0xEC, 0x63, 0xE4, 0x42, 0xDC, 0x21, 0xDC, 0x20, 0xD4, 0x24, 0x81, 0xFF, 0xFF, 0x03, 0xFF, 0x9D,
+0xDD, 0x2F, 0xE4, 0xA3, 0xE4, 0xA2, 0x80, 0xD4, 0x00, 0x00, 0xFF, 0xBE, 0x84, 0xFF, 0xFF, 0x99,
+0xFF, 0xFF, 0x03, 0xFF, 0xDF, 0x22, 0xD3, 0x02, 0x31, 0xBE, 0x7B, 0x8A, 0xFF, 0xFF, 0x00, 0xF7,
+0x5C, 0x81, 0xD4, 0x00, 0x00, 0xE4, 0x81, 0x80, 0xFD, 0xC3, 0x03, 0xE4, 0xC1, 0xD4, 0x00, 0xF5,
+0x46, 0xFD, 0x65, 0x82, 0xFD, 0xA6, 0x02, 0xED, 0x04, 0xD4, 0x00, 0xDC, 0x20, 0x80, 0xFC, 0xE5,
+0x02, 0x12, 0x50, 0x02, 0x31, 0xBC, 0x28, 0x80, 0xFC, 0xC5, 0x01, 0xF4, 0x84, 0xE4, 0x42, 0x83,
+0xD4, 0x00, 0x09, 0xD4, 0x22, 0xF6, 0xFA, 0xF6, 0xD9, 0xE5, 0xB3, 0xD4, 0x22, 0xD4, 0x00, 0xED,
+0x04, 0xFD, 0x85, 0xEC, 0xE3, 0xE5, 0x70, 0x85, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x02, 0xA5, 0xDA,
+0x02, 0x31, 0x2B, 0x13, 0x89, 0xFF, 0xFF, 0x06, 0xFF, 0x9D, 0xF7, 0x1B, 0xF7, 0x3B, 0xD4, 0x01,
+0xE4, 0xA1, 0xED, 0x22, 0xFD, 0xA3, 0x80, 0xF5, 0x63, 0x01, 0xE4, 0x81, 0xD4, 0x00, 0x84, 0xFD,
+0xA6, 0x0A, 0xEC, 0xE4, 0xDC, 0x20, 0xD4, 0x00, 0xEC, 0x83, 0xFC, 0xE5, 0x0A, 0x31, 0x02, 0x31,
+0x4A, 0xEE, 0x22, 0x8F, 0x52, 0xED, 0x9B, 0x85, 0x85, 0xD4, 0x00, 0x08, 0xDC, 0x41, 0xD4, 0x00,
+0xE4, 0x62, 0xF5, 0x25, 0xD4, 0x00, 0xE4, 0x82, 0xF5, 0x65, 0xDC, 0x20, 0xF7, 0x3B, 0x85, 0xFF,
+0xFF, 0x99, 0xFF, 0xFF, 0x02, 0x33, 0x54, 0x02, 0x31, 0x95, 0x99, 0x87, 0xFF, 0xFF, 0x07, 0xF7,
+0x5C, 0xDC, 0xED, 0xDC, 0x20, 0xDC, 0x61, 0xDC, 0x60, 0xD4, 0x00, 0x93, 0xE8, 0x53, 0x2C, 0x80,
+0x3A, 0xAC, 0x00, 0xAB, 0xC5, 0x80, 0xD4, 0x00, 0x00, 0xFD, 0x45, 0x83, 0xFD, 0x86, 0x05, 0xE4,
+0xA3, 0xE4, 0x83, 0xDC, 0x21, 0xDC, 0x00, 0xF4, 0xA4, 0x0A, 0x50, 0x83, 0x02, 0x31, 0x00, 0x93,
+0x65, 0x83, 0xD4, 0x00, 0x08, 0xDC, 0x42, 0xF4, 0xE4, 0xD4, 0x00, 0xE4, 0x83, 0xFD, 0x45, 0xEC,
+0xA3, 0xD4, 0x00, 0xDC, 0x20, 0xEE, 0x35, 0x86, 0xFF, 0xFF, 0x98, 0xFF, 0xFF, 0x03, 0xBE, 0x9C,
+0x02, 0x31, 0x12, 0x92, 0xF7, 0xBE, 0x86, 0xFF, 0xFF, 0x02, 0xFF, 0xBE, 0xDC, 0x47, 0xED, 0x02,
+0x80, 0xFD, 0x83, 0x01, 0xED, 0x44, 0x32, 0xCE, 0x80, 0x02, 0x31, 0x05, 0x0A, 0x31, 0x0A, 0x51,
+0xAC, 0x49, 0xFD, 0x45, 0xF5, 0x05, 0xFD, 0x25, 0x83, 0xFD, 0x45, 0x02, 0xE4, 0x83, 0xE4, 0x62,
+0xDC, 0x21, 0x80, 0xD4, 0x00, 0x80, 0xEC, 0x86, 0x06, 0xFC, 0xA5, 0xDC, 0x66, 0x3A, 0xAE, 0x02,
+0x31, 0x3A, 0xCD, 0xE4, 0x43, 0xE4, 0x22, 0x80, 0xEC, 0x43, 0x02, 0xE4, 0x22, 0xE4, 0x62, 0xFC,
+0xE5, 0x80, 0xDC, 0x20, 0x03, 0xF4, 0xE4, 0xE4, 0xA3, 0xD4, 0x22, 0xEE, 0x57, 0x87, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x97, 0xFF, 0xFF, 0x02, 0x4B, 0xD5, 0x02, 0x31, 0x74, 0xD7, 0x87, 0xFF, 0xFF,
+0x02, 0xEE, 0x56, 0xE4, 0xA1, 0xFD, 0x83, 0x80, 0xFD, 0x63, 0x03, 0x63, 0x6C, 0x02, 0x31, 0x42,
+0xCC, 0xD4, 0x65, 0x89, 0xFD, 0x25, 0x04, 0xE4, 0x62, 0xD4, 0x00, 0xDC, 0x00, 0xE4, 0x63, 0xEC,
+0x84, 0x81, 0xFC, 0xA5, 0x03, 0xFC, 0x85, 0x9B, 0xA9, 0x02, 0x31, 0x12, 0x50, 0x81, 0xFC, 0x64,
+0x02, 0xF4, 0x44, 0xDC, 0x00, 0xDC, 0x89, 0x81, 0xD4, 0x00, 0x02, 0xDC, 0x8A, 0xE5, 0xF4, 0xFF,
+0x7D, 0x87, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFF, 0xFF, 0x00, 0xD6, 0xFD,
+0x80, 0x02, 0x31, 0x00, 0xDF, 0x3D, 0x87, 0xFF, 0xFF, 0x01, 0xE5, 0x92, 0xEC, 0xE2, 0x80, 0xFD,
+0x43, 0x04, 0xED, 0x04, 0x02, 0x31, 0x12, 0x50, 0xD4, 0x21, 0xF4, 0xC4, 0x89, 0xFC, 0xE5, 0x06,
+0xDC, 0x42, 0xD4, 0x00, 0xF4, 0xA4, 0xFC, 0xA5, 0xE4, 0x66, 0xEC, 0x86, 0xFC, 0xA5, 0x80, 0xFC,
+0x84, 0x03, 0x63, 0x0C, 0x02, 0x31, 0x42, 0xCD, 0xFC, 0x64, 0x80, 0xF4, 0x44, 0x01, 0xEC, 0x23,
+0xDD, 0x0E, 0x80, 0xFF, 0xFF, 0x01, 0xFF, 0x9D, 0xFF, 0xDF, 0x8A, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+0x80, 0x00, 0x00, 0x95, 0xFF, 0xFF, 0x02, 0x5C, 0x56, 0x02, 0x31, 0x54, 0x16, 0x88, 0xFF, 0xFF,
+0x01, 0xE5, 0x71, 0xEC, 0xC2, 0x80, 0xFD, 0x24, 0x07, 0xAC, 0x28, 0x02, 0x31, 0x53, 0x0D, 0x73,
+0x29, 0x1A, 0x70, 0x12, 0x50, 0x6B, 0x2C, 0xEC, 0x86, 0x86, 0xFC, 0xA5, 0x01, 0xD4, 0x00, 0xE4,
+0x42, 0x80, 0xFC, 0xA5, 0x04, 0xB3, 0xE8, 0x02, 0x31, 0x3A, 0xAE, 0x52, 0xED, 0x32, 0xAE, 0x80,
+0x02, 0x31, 0x00, 0xAB, 0xA8, 0x81, 0xF4, 0x44, 0x01, 0xDC, 0x00, 0xF7, 0x3B, 0x8D, 0xFF, 0xFF,
+0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x94, 0xFF, 0xFF, 0x00, 0xE7, 0x5D, 0x80, 0x02, 0x31, 0x00,
+0xC6, 0xBC, 0x88, 0xFF, 0xFF, 0x01, 0xEE, 0x77, 0xE4, 0x61, 0x80, 0xFC, 0xE4, 0x04, 0xA3, 0xE9,
+0x02, 0x31, 0x12, 0x50, 0x0A, 0x31, 0x3A, 0xAD, 0x80, 0x02, 0x31, 0x00, 0x63, 0x0C, 0x85, 0xFC,
+0x85, 0x02, 0xEC, 0x43, 0xD4, 0x00, 0xE4, 0x42, 0x80, 0xFC, 0xA5, 0x01, 0xCC, 0x07, 0x2A, 0x8F,
+0x81, 0x02, 0x31, 0x01, 0x22, 0x6F, 0xA3, 0x89, 0x80, 0xF4, 0x44, 0x02, 0xF4, 0x24, 0xDC, 0x00,
+0xEE, 0x77, 0x8E, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x81, 0x00, 0x00, 0xA1, 0xFF, 0xFF, 0x0C, 0xFF,
+0xDF, 0xDD, 0x2F, 0xDC, 0x21, 0xEC, 0x62, 0x93, 0xA8, 0x02, 0x31, 0x0A, 0x50, 0xCC, 0x04, 0xD4,
+0x00, 0x93, 0x67, 0x02, 0x31, 0x0A, 0x31, 0xFC, 0x44, 0x82, 0xF4, 0x44, 0x05, 0xEC, 0x44, 0xE4,
+0x23, 0xDC, 0x89, 0xDC, 0xED, 0xDC, 0x20, 0xEC, 0x63, 0x80, 0xF4, 0x84, 0x03, 0xFC, 0x84, 0xEC,
+0x44, 0xE4, 0x45, 0xEC, 0x24, 0x80, 0xF4, 0x44, 0x03, 0xEC, 0x23, 0xE4, 0x22, 0xDC, 0x01, 0xEE,
+0x98, 0x8E, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x82, 0x00, 0x00, 0xA2, 0xFF, 0xFF, 0x04, 0xF6, 0xDA,
+0xE5, 0xD4, 0x94, 0x30, 0x02, 0x31, 0x3B, 0x11, 0x80, 0xEE, 0x15, 0x00, 0xE5, 0xF5, 0x80, 0x02,
+0x31, 0x06, 0xCC, 0x00, 0xD4, 0x00, 0xD4, 0x24, 0xDC, 0x89, 0xDD, 0x0E, 0xDD, 0x2F, 0xE5, 0xD3,
+0x80, 0xFF, 0x9D, 0x02, 0xF6, 0xFA, 0xE5, 0x50, 0xD4, 0x45, 0x81, 0xD4, 0x00, 0x06, 0xD4, 0x22,
+0xDC, 0x47, 0xDC, 0xAB, 0xDD, 0x0E, 0xE5, 0x50, 0xEE, 0x35, 0xFF, 0x7D, 0x8E, 0xFF, 0xFF, 0x82,
+0x00, 0x00, 0x83, 0x00, 0x00, 0xA3, 0xFF, 0xFF, 0x07, 0xD6, 0xFD, 0x02, 0x31, 0x0A, 0x51, 0xDF,
+0x5D, 0xFF, 0xFF, 0xAE, 0x1A, 0x02, 0x31, 0x0A, 0x71, 0xA3, 0xFF, 0xFF, 0x83, 0x00, 0x00, 0x84,
+0x00, 0x00, 0xA3, 0xFF, 0xFF, 0x06, 0x54, 0x15, 0x02, 0x31, 0x1A, 0xD2, 0x54, 0x16, 0x0A, 0x72,
+0x02, 0x31, 0x74, 0xD7, 0xA2, 0xFF, 0xFF, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0xA2, 0xFF, 0xFF,
+0x01, 0xEF, 0xBE, 0x5C, 0x56, 0x81, 0x02, 0x31, 0x01, 0x6C, 0x97, 0xF7, 0xDF, 0xA1, 0xFF, 0xFF,
+0x85, 0x00, 0x00, 0x87, 0x00, 0x00, 0xA2, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xEF, 0xBE, 0xFF, 0xDF,
+0xA1, 0xFF, 0xFF, 0x87, 0x00, 0x00, 0x89, 0x00, 0x00, 0xC4, 0xFF, 0xFF, 0x89, 0x00, 0x00,
+};
+static const uint16_t CAT_WATCH_FACE_DIAL_PACKED_ROWS[92] PROGMEM = {
+0x0000, 0x0009, 0x002E, 0x0053, 0x007E, 0x00A7, 0x00CA, 0x010F, 0x015A, 0x01AB, 0x01FC, 0x0253, 0x0292, 0x02B9, 0x02E0, 0x0307,
+0x032E, 0x0355, 0x0358, 0x035B, 0x035E, 0x038B, 0x03BC, 0x0405, 0x0450, 0x0495, 0x04DB, 0x0533, 0x0598, 0x060D, 0x067F, 0x06DD,
+0x0725, 0x0760, 0x0796, 0x07C7, 0x07F4, 0x0819, 0x083C, 0x0861, 0x0884, 0x08D3, 0x091C, 0x096F, 0x09C8, 0x0A23, 0x0A81, 0x0ADA,
+0x0B23, 0x0B75, 0x0BD3, 0x0C32, 0x0C8A, 0x0CC6, 0x0D0D, 0x0D4F, 0x0D8E, 0x0DC6, 0x0DE5, 0x0E0E, 0x0E3F, 0x0E97, 0x0EED, 0x0F43,
+0x0F91, 0x0FE1, 0x1033, 0x108F, 0x10F0, 0x114C, 0x11A1, 0x11FE, 0x1251, 0x129A, 0x12E5, 0x133F, 0x139A, 0x13FF, 0x145A, 0x14B1,
+0x150A, 0x1570, 0x15C7, 0x1620, 0x1673, 0x16C8, 0x1717, 0x1762, 0x177F, 0x179A, 0x17B3, 0x17C6,
+};
+const PackedImage CAT_WATCH_FACE_DIAL_PACKED = { 92, 92, PackedImage::Rle565, 0, 6095, nullptr, CAT_WATCH_FACE_DIAL_PACKED_ROWS, CAT_WATCH_FACE_DIAL_PACKED_DATA };
+
+// CAT_WATCH_FACE_DIAL8: 92x92 rle-palette8, 4229 bytes of flash
+static const uint8_t CAT_WATCH_FACE_DIAL8_PACKED_DATA[3533] PROGMEM = {
+0x89, 0x00, 0xC4, 0x01, 0x89, 0x00, 0x87, 0x00, 0x9D, 0x01, 0x03, 0x66, 0xB4, 0x37, 0x1E, 0x81,
+0x01, 0x05, 0x7A, 0x30, 0xE2, 0xAB, 0x37, 0x63, 0x9C, 0x01, 0x87, 0x00, 0x85, 0x00, 0x9E, 0x01,
+0x08, 0x63, 0x55, 0x05, 0x05, 0x25, 0x01, 0x01, 0x1B, 0x55, 0x83, 0x05, 0x00, 0x34, 0x9D, 0x01,
+0x85, 0x00, 0x84, 0x00, 0x9E, 0x01, 0x05, 0xAC, 0x05, 0x7B, 0x05, 0x05, 0x25, 0x81, 0x01, 0x06,
+0x4D, 0xF8, 0x9A, 0x98, 0xE7, 0x05, 0x37, 0x9E, 0x01, 0x84, 0x00, 0x83, 0x00, 0x9F, 0x01, 0x05,
+0x4D, 0xAB, 0x1D, 0x05, 0x05, 0x25, 0x81, 0x01, 0x00, 0x82, 0x81, 0x01, 0x02, 0xA9, 0x05, 0x37,
+0x9F, 0x01, 0x83, 0x00, 0x82, 0x00, 0xA0, 0x01, 0x05, 0x86, 0x7A, 0x98, 0x05, 0x05, 0x25, 0x85,
+0x01, 0x02, 0xE1, 0x05, 0x71, 0xA0, 0x01, 0x82, 0x00, 0x81, 0x00, 0x8F, 0x01, 0x03, 0x66, 0xB4,
+0x37, 0x1E, 0x83, 0x01, 0x03, 0x66, 0xB4, 0x37, 0x1E, 0x85, 0x01, 0x03, 0x98, 0x05, 0x05, 0x25,
+0x84, 0x01, 0x03, 0x16, 0x05, 0xD5, 0x26, 0x89, 0x01, 0x03, 0x66, 0xB4, 0x37, 0x1E, 0x92, 0x01,
+0x81, 0x00, 0x01, 0x00, 0x00, 0x8F, 0x01, 0x04, 0x63, 0x55, 0x05, 0x05, 0x25, 0x82, 0x01, 0x04,
+0x63, 0x55, 0x05, 0x05, 0x25, 0x85, 0x01, 0x03, 0x98, 0x05, 0x05, 0x25, 0x83, 0x01, 0x03, 0x30,
+0x05, 0x54, 0x9C, 0x89, 0x01, 0x04, 0x63, 0x55, 0x05, 0x05, 0x25, 0x93, 0x01, 0x01, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x8E, 0x01, 0x05, 0xAC, 0x05, 0x7B, 0x05, 0x05, 0x25, 0x81, 0x01, 0x05, 0xAC,
+0x05, 0x7B, 0x05, 0x05, 0x25, 0x85, 0x01, 0x03, 0x98, 0x05, 0x05, 0x25, 0x82, 0x01, 0x03, 0x71,
+0x05, 0xAB, 0x9C, 0x89, 0x01, 0x05, 0xAC, 0x05, 0x7B, 0x05, 0x05, 0x25, 0x93, 0x01, 0x01, 0x00,
+0x00, 0x00, 0x00, 0x8F, 0x01, 0x05, 0x4D, 0xAB, 0x1D, 0x05, 0x05, 0x25, 0x81, 0x01, 0x05, 0x4D,
+0xAB, 0x1D, 0x05, 0x05, 0x25, 0x85, 0x01, 0x03, 0x98, 0x05, 0x05, 0x25, 0x81, 0x01, 0x03, 0x71,
+0x05, 0xA6, 0x7A, 0x8A, 0x01, 0x05, 0x4D, 0xAB, 0x1D, 0x05, 0x05, 0x25, 0x94, 0x01, 0x00, 0x00,
+0x00, 0x00, 0x8F, 0x01, 0x05, 0x86, 0x7A, 0x98, 0x05, 0x05, 0x25, 0x81, 0x01, 0x05, 0x86, 0x7A,
+0x98, 0x05, 0x05, 0x25, 0x85, 0x01, 0x09, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x34, 0x05, 0x05,
+0xC3, 0x82, 0x88, 0x00, 0x98, 0x86, 0x01, 0x05, 0x86, 0x7A, 0x98, 0x05, 0x05, 0x25, 0x94, 0x01,
+0x00, 0x00, 0x92, 0x01, 0x03, 0x98, 0x05, 0x05, 0x25, 0x83, 0x01, 0x03, 0x98, 0x05, 0x05, 0x25,
+0x85, 0x01, 0x06, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0xC9, 0x85, 0x05, 0x00, 0x98, 0x88, 0x01,
+0x03, 0x98, 0x05, 0x05, 0x25, 0x95, 0x01, 0x92, 0x01, 0x03, 0x98, 0x05, 0x05, 0x25, 0x83, 0x01,
+0x03, 0x98, 0x05, 0x05, 0x25, 0x9E, 0x01, 0x03, 0x98, 0x05, 0x05, 0x25, 0x95, 0x01, 0x92, 0x01,
+0x03, 0x98, 0x05, 0x05, 0x25, 0x83, 0x01, 0x03, 0x98, 0x05, 0x05, 0x25, 0x9E, 0x01, 0x03, 0x98,
+0x05, 0x05, 0x25, 0x95, 0x01, 0x92, 0x01, 0x03, 0x98, 0x05, 0x05, 0x25, 0x83, 0x01, 0x03, 0x98,
+0x05, 0x05, 0x25, 0x9E, 0x01, 0x03, 0x98, 0x05, 0x05, 0x25, 0x95, 0x01, 0x92, 0x01, 0x03, 0x98,
+0x05, 0x05, 0x25, 0x83, 0x01, 0x03, 0x98, 0x05, 0x05, 0x25, 0x9E, 0x01, 0x03, 0x98, 0x05, 0x05,
+0x25, 0x95, 0x01, 0x92, 0x01, 0x03, 0x98, 0x05, 0x05, 0x25, 0x83, 0x01, 0x03, 0x98, 0x05, 0x05,
+0x25, 0x9E, 0x01, 0x03, 0x98, 0x05, 0x05, 0x25, 0x95, 0x01, 0xDA, 0x01, 0xDA, 0x01, 0xDA, 0x01,
+0x84, 0x01, 0x03, 0x66, 0xB4, 0x37, 0x1E, 0x82, 0x01, 0x04, 0xA9, 0x73, 0x54, 0xB4, 0x1B, 0xB8,
+0x01, 0x05, 0x7A, 0x30, 0xE2, 0xAB, 0x37, 0x63, 0x87, 0x01, 0x83, 0x01, 0x04, 0x63, 0x55, 0x05,
+0x05, 0x25, 0x81, 0x01, 0x06, 0x30, 0x05, 0x05, 0x28, 0x05, 0x55, 0x7A, 0xB6, 0x01, 0x01, 0x1B,
+0x55, 0x83, 0x05, 0x00, 0x34, 0x86, 0x01, 0x82, 0x01, 0x0F, 0xAC, 0x05, 0x7B, 0x05, 0x05, 0x25,
+0x01, 0x01, 0x98, 0x28, 0x05, 0x24, 0x82, 0x73, 0x05, 0x16, 0xA2, 0x01, 0x05, 0x39, 0x77, 0xFB,
+0x02, 0x89, 0xAA, 0x8D, 0x01, 0x06, 0x4D, 0xF8, 0x9A, 0x98, 0xE7, 0x05, 0x37, 0x86, 0x01, 0x82,
+0x01, 0x0F, 0x4D, 0xAB, 0x1D, 0x05, 0x05, 0x25, 0x01, 0x01, 0x34, 0x05, 0xC3, 0x01, 0x01, 0xC9,
+0x05, 0xE1, 0xA0, 0x01, 0x07, 0x61, 0x89, 0x76, 0x57, 0x53, 0x29, 0x57, 0xB9, 0x8D, 0x01, 0x00,
+0x82, 0x81, 0x01, 0x02, 0xA9, 0x05, 0x37, 0x86, 0x01, 0x82, 0x01, 0x0F, 0x86, 0x7A, 0x98, 0x05,
+0x05, 0x25, 0x01, 0x01, 0xC9, 0x05, 0xA6, 0x01, 0x01, 0x34, 0x05, 0x28, 0x9E, 0x01, 0x03, 0x39,
+0x89, 0x76, 0xD2, 0x83, 0x14, 0x01, 0x76, 0xF7, 0x90, 0x01, 0x02, 0xE1, 0x05, 0x71, 0x86, 0x01,
+0x84, 0x01, 0x0D, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x5B, 0x05, 0x4D, 0x01, 0x01, 0x63, 0x05,
+0x05, 0x9D, 0x01, 0x02, 0xEE, 0x47, 0x57, 0x82, 0x14, 0x04, 0x29, 0x57, 0x76, 0x32, 0xEE, 0x8F,
+0x01, 0x03, 0x16, 0x05, 0xD5, 0x26, 0x86, 0x01, 0x84, 0x01, 0x0D, 0x98, 0x05, 0x05, 0x25, 0x01,
+0x01, 0xC9, 0x05, 0x73, 0x01, 0x01, 0x34, 0x05, 0x05, 0x93, 0x01, 0x02, 0x72, 0xF7, 0x11, 0x82,
+0x77, 0x04, 0x93, 0xF7, 0x2D, 0xC8, 0x38, 0x82, 0x14, 0x01, 0x6F, 0x32, 0x81, 0x02, 0x00, 0x2D,
+0x8E, 0x01, 0x03, 0x30, 0x05, 0x54, 0x9C, 0x87, 0x01, 0x84, 0x01, 0x0D, 0x98, 0x05, 0x05, 0x25,
+0x01, 0x01, 0x24, 0x05, 0x88, 0x01, 0x01, 0xCE, 0x05, 0x55, 0x85, 0x01, 0x00, 0x82, 0x88, 0x01,
+0x12, 0xAA, 0xEE, 0xCA, 0x02, 0xC8, 0x10, 0x32, 0x02, 0x10, 0xBD, 0xBD, 0xC8, 0x32, 0x76, 0x57,
+0x38, 0x14, 0x14, 0xD2, 0x83, 0x02, 0x00, 0x89, 0x8D, 0x01, 0x03, 0x71, 0x05, 0xAB, 0x9C, 0x88,
+0x01, 0x84, 0x01, 0x0D, 0x98, 0x05, 0x05, 0x25, 0x01, 0x01, 0x86, 0x05, 0x05, 0x1B, 0x01, 0x17,
+0x05, 0xB4, 0x82, 0x01, 0x01, 0x2D, 0x03, 0x81, 0x02, 0x11, 0xC6, 0x46, 0x56, 0x77, 0xF7, 0x01,
+0x01, 0x39, 0x56, 0x32, 0x02, 0x02, 0x53, 0x14, 0x14, 0xC8, 0x02, 0x57, 0x81, 0x14, 0x05, 0x29,
+0x6A, 0x10, 0x32, 0x10, 0xD2, 0x84, 0x02, 0x00, 0x03, 0x8C, 0x01, 0x03, 0x71, 0x05, 0xA6, 0x7A,
+0x89, 0x01, 0x84, 0x01, 0x03, 0x98, 0x05, 0x05, 0x25, 0x81, 0x01, 0x06, 0xB5, 0x05, 0x54, 0x4D,
+0x05, 0x05, 0x63, 0x81, 0x01, 0x02, 0x77, 0x79, 0x38, 0x81, 0x14, 0x11, 0x29, 0x53, 0xD2, 0xBD,
+0x76, 0x09, 0x91, 0x76, 0x57, 0x29, 0x02, 0x02, 0x6F, 0x14, 0x14, 0xBD, 0x02, 0x10, 0x84, 0x14,
+0x02, 0x29, 0xBD, 0x32, 0x85, 0x02, 0x8B, 0x01, 0x03, 0x34, 0x05, 0x05, 0xC3, 0x82, 0x88, 0x00,
+0x98, 0x85, 0x01, 0x84, 0x01, 0x03, 0x98, 0x05, 0x05, 0x25, 0x81, 0x01, 0x05, 0x86, 0x37, 0x05,
+0x05, 0x88, 0x5C, 0x82, 0x01, 0x01, 0xFB, 0x53, 0x86, 0x14, 0x0D, 0x6A, 0x32, 0xBD, 0x29, 0x14,
+0x14, 0x76, 0x02, 0x57, 0x14, 0x14, 0x57, 0x02, 0x76, 0x86, 0x14, 0x01, 0x53, 0xC8, 0x84, 0x02,
+0x8B, 0x01, 0x00, 0xC9, 0x85, 0x05, 0x00, 0x98, 0x85, 0x01, 0x8D, 0x01, 0x02, 0x98, 0x86, 0x82,
+0x83, 0x01, 0x05, 0xFB, 0x57, 0xBD, 0x57, 0x6F, 0x29, 0x81, 0x14, 0x02, 0xD2, 0x32, 0x6A, 0x82,
+0x14, 0x08, 0x10, 0x02, 0x10, 0x14, 0x14, 0x6A, 0x02, 0x02, 0x29, 0x86, 0x14, 0x01, 0x29, 0x10,
+0x83, 0x02, 0x9B, 0x01, 0x95, 0x01, 0x00, 0x91, 0x82, 0x02, 0x05, 0x32, 0x10, 0x38, 0xD2, 0x76,
+0x53, 0x83, 0x14, 0x08, 0x57, 0x02, 0x76, 0x14, 0x14, 0x29, 0x02, 0x02, 0x6A, 0x88, 0x14, 0x00,
+0x10, 0x81, 0x02, 0x00, 0x41, 0x9B, 0x01, 0x95, 0x01, 0x00, 0x77, 0x84, 0x02, 0x02, 0x32, 0x32,
+0x53, 0x84, 0x14, 0x08, 0x6A, 0x02, 0x02, 0x29, 0x14, 0x14, 0x76, 0x02, 0x57, 0x88, 0x14, 0x04,
+0x29, 0xC8, 0x02, 0x02, 0xCA, 0x9B, 0x01, 0x95, 0x01, 0x00, 0x11, 0x85, 0x02, 0x00, 0x6F, 0x85,
+0x14, 0x08, 0x38, 0x02, 0x02, 0x53, 0x14, 0x14, 0x10, 0x02, 0xBD, 0x89, 0x14, 0x03, 0x38, 0x32,
+0x02, 0x2D, 0x9B, 0x01, 0x95, 0x01, 0x00, 0x72, 0x84, 0x02, 0x00, 0x10, 0x87, 0x14, 0x07, 0x32,
+0x02, 0x6F, 0x14, 0x14, 0x53, 0xBD, 0x38, 0x8A, 0x14, 0x02, 0x57, 0x02, 0x61, 0x9B, 0x01, 0x96,
+0x01, 0x00, 0xB9, 0x82, 0x02, 0x01, 0x32, 0x3F, 0x87, 0x14, 0x02, 0x6A, 0x57, 0x29, 0x8F, 0x14,
+0x02, 0x29, 0x32, 0x39, 0x9B, 0x01, 0x96, 0x01, 0x00, 0xEE, 0x82, 0x02, 0x00, 0xBD, 0x94, 0x14,
+0x03, 0x2E, 0xF9, 0x2C, 0x8C, 0x83, 0x14, 0x01, 0x92, 0x77, 0x9B, 0x01, 0x96, 0x01, 0x01, 0x72,
+0xC6, 0x81, 0x02, 0x00, 0x53, 0x93, 0x14, 0x00, 0x2E, 0x82, 0x44, 0x00, 0x8C, 0x82, 0x14, 0x01,
+0x53, 0x09, 0x9B, 0x01, 0x97, 0x01, 0x03, 0x2D, 0x02, 0x02, 0x76, 0x94, 0x14, 0x00, 0xBB, 0x82,
+0x44, 0x00, 0x2C, 0x83, 0x14, 0x01, 0x76, 0x39, 0x9A, 0x01, 0x82, 0x01, 0x05, 0x86, 0x30, 0x4D,
+0x4D, 0x17, 0x66, 0x8D, 0x01, 0x03, 0xAA, 0x03, 0x32, 0x10, 0x83, 0x14, 0x03, 0x29, 0xBC, 0xD8,
+0xF4, 0x8B, 0x14, 0x84, 0x44, 0x83, 0x14, 0x01, 0x10, 0x93, 0x90, 0x01, 0x05, 0x24, 0xB4, 0xA6,
+0xA5, 0x37, 0x34, 0x82, 0x01, 0x82, 0x01, 0x00, 0x73, 0x82, 0x05, 0x01, 0x55, 0x66, 0x8D, 0x01,
+0x02, 0x11, 0x02, 0x57, 0x82, 0x14, 0x01, 0x29, 0x69, 0x81, 0x44, 0x00, 0x78, 0x8A, 0x14, 0x00,
+0x2C, 0x82, 0x44, 0x00, 0xFF, 0x83, 0x14, 0x01, 0xD2, 0x2D, 0x8F, 0x01, 0x00, 0x1D, 0x84, 0x05,
+0x00, 0x24, 0x81, 0x01, 0x81, 0x01, 0x07, 0x34, 0x05, 0x7B, 0x1B, 0x26, 0x4D, 0x05, 0xF8, 0x8E,
+0x01, 0x01, 0x56, 0xD2, 0x82, 0x14, 0x00, 0xF4, 0x83, 0x44, 0x00, 0x4E, 0x89, 0x14, 0x00, 0xCB,
+0x82, 0x44, 0x00, 0x2E, 0x83, 0x14, 0x01, 0x6A, 0x89, 0x90, 0x01, 0x06, 0x5C, 0x34, 0x82, 0x98,
+0x73, 0x05, 0xB4, 0x81, 0x01, 0x81, 0x01, 0x07, 0x71, 0x05, 0xB3, 0x01, 0x01, 0x34, 0x05, 0x7B,
+0x8E, 0x01, 0x01, 0x91, 0xD2, 0x82, 0x14, 0x00, 0x78, 0x83, 0x44, 0x00, 0x2E, 0x84, 0x14, 0x02,
+0x4E, 0x60, 0x29, 0x81, 0x14, 0x03, 0xCB, 0x50, 0x2C, 0x2E, 0x83, 0x14, 0x04, 0x29, 0x53, 0x46,
+0x84, 0x84, 0x92, 0x01, 0x02, 0xB5, 0x05, 0x16, 0x81, 0x01, 0x81, 0x01, 0x07, 0x5C, 0x05, 0xE2,
+0x01, 0x01, 0xCE, 0x05, 0x05, 0x8E, 0x01, 0x01, 0x56, 0xD2, 0x82, 0x14, 0x00, 0xF4, 0x83, 0x44,
+0x00, 0x8C, 0x81, 0x14, 0x05, 0x2E, 0x8F, 0xA1, 0xEF, 0xEF, 0xBC, 0x85, 0x14, 0x83, 0x29, 0x04,
+0x60, 0xD8, 0xC4, 0x6C, 0xB7, 0x8F, 0x01, 0x05, 0x25, 0xC9, 0x16, 0x28, 0xE1, 0x86, 0x81, 0x01,
+0x81, 0x01, 0x07, 0x51, 0x05, 0x05, 0x17, 0x70, 0x55, 0x05, 0x05, 0x8E, 0x01, 0x01, 0x2D, 0xD2,
+0x82, 0x14, 0x01, 0x29, 0x3E, 0x81, 0x44, 0x04, 0x3E, 0x29, 0x14, 0x14, 0x3F, 0x81, 0x18, 0x03,
+0xE5, 0xE5, 0x3C, 0x14, 0x87, 0x29, 0x04, 0x8C, 0x2C, 0x44, 0xA1, 0x1A, 0x91, 0x01, 0x04, 0x4D,
+0x05, 0x05, 0xAB, 0x63, 0x82, 0x01, 0x82, 0x01, 0x00, 0x30, 0x81, 0x05, 0x02, 0x71, 0x05, 0x88,
+0x8E, 0x01, 0x01, 0x77, 0x57, 0x83, 0x14, 0x04, 0x60, 0x2C, 0x44, 0x69, 0xCB, 0x82, 0x14, 0x04,
+0xBC, 0x0F, 0xF0, 0xF0, 0xDC, 0x87, 0x29, 0x06, 0x4E, 0xFF, 0x44, 0x2C, 0x8C, 0x6F, 0xCA, 0x91,
+0x01, 0x05, 0x25, 0xC9, 0x70, 0x55, 0x05, 0x30, 0x81, 0x01, 0x83, 0x01, 0x05, 0x5F, 0x34, 0x9A,
+0x34, 0x05, 0x4D, 0x8E, 0x01, 0x01, 0x11, 0x10, 0x88, 0x14, 0x83, 0x29, 0x03, 0x8C, 0xE3, 0xDA,
+0x8C, 0x82, 0x29, 0x83, 0x3F, 0x06, 0x4E, 0x78, 0x60, 0x53, 0x53, 0x57, 0x56, 0x94, 0x01, 0x02,
+0x5C, 0x05, 0x88, 0x81, 0x01, 0x85, 0x01, 0x03, 0x86, 0xE1, 0x05, 0xC9, 0x8E, 0x01, 0x01, 0x39,
+0x76, 0x82, 0x14, 0x8A, 0x29, 0x02, 0x6A, 0x3E, 0x2E, 0x83, 0x3F, 0x00, 0x60, 0x82, 0x53, 0x08,
+0xCB, 0xBC, 0x78, 0xD8, 0x8F, 0xDE, 0xB8, 0xD0, 0xB7, 0x8C, 0x01, 0x01, 0x66, 0x82, 0x81, 0x01,
+0x02, 0x16, 0x05, 0x55, 0x81, 0x01, 0x82, 0x01, 0x05, 0x71, 0xB5, 0xB3, 0x88, 0x05, 0xE7, 0x90,
+0x01, 0x01, 0x09, 0x53, 0x89, 0x29, 0x82, 0x3F, 0x03, 0x4E, 0x44, 0xC4, 0x8C, 0x81, 0x53, 0x01,
+0xBC, 0x3E, 0x81, 0x6A, 0x09, 0x6F, 0xD8, 0xFF, 0x69, 0x69, 0xA1, 0x4C, 0x4B, 0x4B, 0x62, 0x8C,
+0x01, 0x07, 0xC9, 0xC3, 0x37, 0xB4, 0x73, 0x05, 0x05, 0x30, 0x81, 0x01, 0x82, 0x01, 0x05, 0x4D,
+0x05, 0x05, 0x55, 0x30, 0x98, 0x8E, 0x01, 0x08, 0xB6, 0xF1, 0xBB, 0x69, 0x50, 0xD8, 0xD8, 0x78,
+0x2E, 0x85, 0x3F, 0x81, 0x53, 0x00, 0x50, 0x81, 0x44, 0x05, 0xBB, 0x2C, 0x3E, 0xF9, 0x3D, 0x6F,
+0x81, 0x8A, 0x81, 0x9F, 0x02, 0xAE, 0x03, 0x82, 0x8F, 0x01, 0x01, 0x25, 0xAB, 0x81, 0x05, 0x01,
+0x55, 0x71, 0x82, 0x01, 0x82, 0x01, 0x02, 0x98, 0x86, 0x26, 0x91, 0x01, 0x0A, 0x26, 0xD1, 0x4A,
+0xD6, 0xD8, 0x2C, 0x69, 0x69, 0xFF, 0x4E, 0x3B, 0x81, 0x53, 0x04, 0xD8, 0x78, 0x8C, 0x3C, 0xF9,
+0x84, 0x44, 0x01, 0x69, 0x8A, 0x81, 0x9F, 0x06, 0x83, 0x83, 0x2C, 0x3E, 0xEB, 0x68, 0x2D, 0x92,
+0x01, 0x02, 0x98, 0x86, 0x26, 0x84, 0x01, 0x9B, 0x01, 0x01, 0xB9, 0xD2, 0x81, 0x53, 0x01, 0x6A,
+0x53, 0x82, 0x6A, 0x02, 0x60, 0xD8, 0x69, 0x86, 0x44, 0x02, 0xF9, 0x83, 0x83, 0x81, 0xAE, 0x07,
+0x5A, 0x40, 0xEB, 0x3E, 0x44, 0x6C, 0x4B, 0xB6, 0x99, 0x01, 0x9B, 0x01, 0x08, 0x11, 0x76, 0x6F,
+0x3C, 0x50, 0x44, 0x3C, 0x6F, 0x6F, 0x82, 0x8A, 0x0A, 0x3D, 0xC4, 0x44, 0x44, 0xDB, 0xA8, 0xA8,
+0xDD, 0xC4, 0xEB, 0x5A, 0x82, 0x42, 0x81, 0x48, 0x06, 0xC8, 0xA7, 0x84, 0x4C, 0x44, 0x2B, 0xD1,
+0x97, 0x01, 0x9A, 0x01, 0x07, 0x26, 0xD1, 0x69, 0x44, 0xC4, 0x50, 0x3C, 0x3D, 0x81, 0x9F, 0x81,
+0x83, 0x03, 0xAE, 0xEB, 0x44, 0xA8, 0x82, 0xF6, 0x01, 0xE4, 0x40, 0x85, 0x48, 0x07, 0x99, 0xFB,
+0x72, 0x01, 0x01, 0x26, 0xD1, 0x5F, 0x97, 0x01, 0x99, 0x01, 0x09, 0xD1, 0x44, 0x2B, 0xB8, 0x1A,
+0x5A, 0x9F, 0x2A, 0xF9, 0x3C, 0x82, 0xAE, 0x03, 0x5A, 0x42, 0x42, 0x1A, 0x82, 0x7E, 0x01, 0xE4,
+0x04, 0x85, 0x48, 0x02, 0x99, 0x32, 0x1F, 0x9D, 0x01, 0x99, 0x01, 0x09, 0x31, 0x62, 0x82, 0x01,
+0x61, 0x32, 0x68, 0xC4, 0x69, 0x40, 0x82, 0x42, 0x82, 0x48, 0x03, 0x04, 0x09, 0xF5, 0x09, 0x86,
+0x48, 0x04, 0x99, 0x32, 0x5A, 0x65, 0x0A, 0x9C, 0x01, 0x9E, 0x01, 0x02, 0xDF, 0x44, 0x8F, 0x93,
+0x48, 0x06, 0x99, 0x32, 0x57, 0x9B, 0x3D, 0x87, 0x94, 0x9B, 0x01, 0x9C, 0x01, 0x05, 0x26, 0x4C,
+0x2B, 0x80, 0x03, 0xC8, 0x91, 0x48, 0x08, 0xC8, 0x76, 0x8A, 0x9B, 0x3D, 0x36, 0x87, 0x87, 0x94,
+0x9A, 0x01, 0x9B, 0x01, 0x08, 0x5F, 0xE9, 0xB1, 0x31, 0x01, 0xAA, 0x89, 0xC6, 0x99, 0x8D, 0x48,
+0x06, 0xC8, 0x32, 0x10, 0x6A, 0x9B, 0x3D, 0x36, 0x82, 0x87, 0x00, 0x8D, 0x99, 0x01, 0x87, 0x01,
+0x05, 0x86, 0x30, 0x4D, 0xA6, 0x37, 0x34, 0x8C, 0x01, 0x02, 0x4C, 0xD0, 0x82, 0x82, 0x01, 0x04,
+0x61, 0xCA, 0x32, 0xC8, 0x99, 0x86, 0x48, 0x09, 0x99, 0x99, 0x76, 0x32, 0x10, 0x6F, 0x9B, 0x9B,
+0x3D, 0x36, 0x82, 0x87, 0x02, 0x5A, 0xFA, 0x8D, 0x8C, 0x01, 0x02, 0x1C, 0x37, 0x37, 0x87, 0x01,
+0x87, 0x01, 0x06, 0xE2, 0x05, 0xC3, 0xE1, 0x05, 0x05, 0xCE, 0x94, 0x01, 0x04, 0x39, 0x77, 0xB9,
+0x02, 0x32, 0x82, 0x76, 0x05, 0xC6, 0x02, 0x03, 0x79, 0x57, 0x6A, 0x81, 0x9B, 0x01, 0x3D, 0x36,
+0x81, 0x87, 0x05, 0x12, 0x3D, 0x9F, 0x3D, 0x87, 0x8D, 0x8A, 0x01, 0x03, 0x82, 0xA6, 0x05, 0x05,
+0x87, 0x01, 0x86, 0x01, 0x07, 0x26, 0x05, 0x05, 0x7A, 0x01, 0x30, 0x05, 0xB4, 0x96, 0x01, 0x02,
+0x7D, 0x46, 0x6D, 0x82, 0x33, 0x02, 0x9E, 0x23, 0x23, 0x83, 0x9B, 0x0C, 0x58, 0xFA, 0x87, 0x65,
+0xC1, 0x3D, 0x8A, 0x9F, 0x2A, 0x65, 0x87, 0x87, 0x8D, 0x89, 0x01, 0x00, 0x30, 0x81, 0x05, 0x87,
+0x01, 0x86, 0x01, 0x07, 0x98, 0x28, 0x05, 0x1C, 0x01, 0x17, 0x05, 0x17, 0x96, 0x01, 0x01, 0x61,
+0xC0, 0x85, 0xBF, 0x00, 0x6D, 0x81, 0x9B, 0x81, 0x58, 0x07, 0x3D, 0x2A, 0x8A, 0x8A, 0x9F, 0x9F,
+0x2A, 0x36, 0x82, 0x87, 0x00, 0x8D, 0x87, 0x01, 0x04, 0x51, 0x05, 0x16, 0x05, 0x05, 0x87, 0x01,
+0x87, 0x01, 0x06, 0xAC, 0x05, 0x88, 0xE2, 0x05, 0xA6, 0x7A, 0x96, 0x01, 0x01, 0xFD, 0xC0, 0x85,
+0xBF, 0x02, 0x6D, 0x9B, 0x9B, 0x81, 0x58, 0x00, 0x6F, 0x81, 0x8A, 0x03, 0x9F, 0x9F, 0x83, 0x65,
+0x82, 0x87, 0x02, 0x12, 0x65, 0x8B, 0x85, 0x01, 0x05, 0x26, 0xA5, 0xAB, 0x9C, 0x05, 0x05, 0x87,
+0x01, 0x87, 0x01, 0x05, 0x26, 0x73, 0x05, 0x05, 0x28, 0x51, 0x97, 0x01, 0x01, 0xAA, 0x46, 0x85,
+0xBF, 0x04, 0x6D, 0x6F, 0x6F, 0x58, 0x58, 0x82, 0x8A, 0x03, 0x9F, 0x2A, 0x83, 0x90, 0x81, 0x87,
+0x05, 0x12, 0x48, 0x6E, 0x2A, 0x65, 0x94, 0x84, 0x01, 0x05, 0x17, 0x05, 0x63, 0x51, 0x05, 0x05,
+0x87, 0x01, 0x86, 0x01, 0x07, 0x98, 0x73, 0x05, 0xE7, 0x30, 0x05, 0x05, 0xCE, 0x97, 0x01, 0x00,
+0xF5, 0x85, 0xBF, 0x03, 0x6D, 0xFA, 0x3D, 0x6F, 0x81, 0x8A, 0x81, 0x9F, 0x06, 0xFA, 0x42, 0x65,
+0x65, 0x90, 0x3A, 0x6E, 0x81, 0x6B, 0x02, 0x3A, 0x65, 0x1F, 0x82, 0x01, 0x07, 0x63, 0x05, 0x17,
+0x01, 0x49, 0x05, 0x05, 0xFD, 0x86, 0x01, 0x86, 0x01, 0x07, 0xCE, 0x05, 0x73, 0x01, 0x01, 0x34,
+0x05, 0x55, 0x97, 0x01, 0x01, 0x0C, 0x6D, 0x84, 0xBF, 0x05, 0x6D, 0xFA, 0xC1, 0x5A, 0x92, 0x3D,
+0x81, 0x9F, 0x03, 0x83, 0x65, 0x5A, 0x83, 0x81, 0x6E, 0x81, 0x6B, 0x04, 0x95, 0x95, 0x3A, 0x59,
+0x11, 0x81, 0x01, 0x01, 0x4D, 0x05, 0x81, 0x28, 0x03, 0x05, 0x05, 0x28, 0xCE, 0x85, 0x01, 0x86,
+0x01, 0x07, 0x5B, 0x05, 0x37, 0x01, 0x01, 0x5F, 0x05, 0x05, 0x97, 0x01, 0x01, 0xFC, 0x64, 0x84,
+0xBF, 0x01, 0x23, 0x90, 0x82, 0x87, 0x05, 0x65, 0x5A, 0x83, 0x83, 0x36, 0x2A, 0x81, 0x6E, 0x81,
+0x6B, 0x81, 0x95, 0x06, 0xD7, 0x48, 0x68, 0xAA, 0x01, 0x01, 0x30, 0x81, 0x4D, 0x04, 0x7C, 0x05,
+0x05, 0xC5, 0x4A, 0x85, 0x01, 0x86, 0x01, 0x07, 0x1C, 0x05, 0x05, 0xB4, 0x17, 0xA5, 0x05, 0x4D,
+0x97, 0x01, 0x02, 0x72, 0x52, 0x23, 0x83, 0xBF, 0x01, 0x4F, 0x90, 0x83, 0x87, 0x05, 0x90, 0x83,
+0x83, 0x87, 0x2A, 0x6E, 0x82, 0x6B, 0x81, 0x95, 0x81, 0xD7, 0x01, 0x47, 0xEC, 0x84, 0x01, 0x04,
+0xD0, 0x05, 0x05, 0x87, 0x75, 0x85, 0x01, 0x87, 0x01, 0x01, 0xCE, 0xAB, 0x81, 0x05, 0x01, 0xB5,
+0x86, 0x98, 0x01, 0x02, 0x8E, 0xC0, 0x4F, 0x83, 0xBF, 0x00, 0xC7, 0x81, 0x87, 0x09, 0x36, 0x90,
+0x6E, 0x83, 0x6E, 0x87, 0x6B, 0x6B, 0x3A, 0x6B, 0x82, 0x95, 0x06, 0xD7, 0x47, 0x65, 0x87, 0x12,
+0x59, 0x11, 0x83, 0x01, 0x05, 0xCD, 0x05, 0x05, 0x57, 0x36, 0xAA, 0x84, 0x01, 0x89, 0x01, 0x02,
+0x26, 0x86, 0x82, 0x9A, 0x01, 0x03, 0x94, 0x87, 0xC0, 0x4F, 0x82, 0xBF, 0x03, 0x43, 0x90, 0x2A,
+0x6E, 0x82, 0x83, 0x0A, 0x6B, 0x87, 0x6B, 0x90, 0x87, 0x3A, 0x95, 0x95, 0xD7, 0x47, 0x36, 0x83,
+0x87, 0x00, 0x8E, 0x84, 0x01, 0x04, 0x75, 0x3D, 0x3B, 0x12, 0x61, 0x84, 0x01, 0xA8, 0x01, 0x04,
+0x61, 0x32, 0x5D, 0x46, 0x23, 0x81, 0xBF, 0x02, 0x43, 0x90, 0x9F, 0x82, 0x83, 0x09, 0x6E, 0x2A,
+0x36, 0x90, 0x87, 0x12, 0x3A, 0x95, 0x3A, 0x65, 0x85, 0x87, 0x01, 0x36, 0xFD, 0x83, 0x01, 0x04,
+0xA7, 0x40, 0x9B, 0xC7, 0xFC, 0x84, 0x01, 0xA8, 0x01, 0x0C, 0x72, 0x36, 0xB2, 0x21, 0x52, 0x33,
+0xBF, 0xBF, 0xED, 0xFA, 0x42, 0x40, 0x3A, 0x81, 0x83, 0x07, 0x3A, 0x87, 0x87, 0x12, 0x95, 0x95,
+0xD7, 0x12, 0x86, 0x87, 0x01, 0x59, 0x0A, 0x83, 0x01, 0x04, 0x1F, 0xC7, 0x9B, 0xC7, 0x0A, 0x84,
+0x01, 0x95, 0x01, 0x00, 0x5C, 0x85, 0x37, 0x00, 0x98, 0x89, 0x01, 0x07, 0x75, 0x22, 0xB2, 0xB2,
+0x21, 0x46, 0x6D, 0x64, 0x82, 0x87, 0x09, 0x90, 0x35, 0x35, 0x3A, 0x87, 0x87, 0x48, 0xD7, 0xE6,
+0xF2, 0x82, 0xC5, 0x00, 0x06, 0x81, 0x87, 0x02, 0x2F, 0x2F, 0x0C, 0x83, 0x01, 0x04, 0x8D, 0x90,
+0x6F, 0xC7, 0x11, 0x84, 0x01, 0x95, 0x01, 0x00, 0xF8, 0x85, 0x05, 0x00, 0x98, 0x89, 0x01, 0x07,
+0xA7, 0x65, 0xD4, 0x22, 0xB2, 0x0B, 0xD4, 0x52, 0x82, 0x87, 0x08, 0x65, 0x35, 0x35, 0x48, 0x87,
+0x65, 0xD7, 0xD7, 0xE8, 0x83, 0x05, 0x06, 0xB0, 0x2F, 0x41, 0x20, 0x9D, 0x20, 0x46, 0x82, 0x01,
+0x05, 0x72, 0xF5, 0x87, 0x90, 0x65, 0x61, 0x84, 0x01, 0x95, 0x01, 0x00, 0xC2, 0x82, 0x25, 0x02,
+0xF8, 0x05, 0x4D, 0x8A, 0x01, 0x00, 0xFC, 0x81, 0x87, 0x03, 0x5D, 0x0B, 0x0B, 0x5D, 0x81, 0x87,
+0x0B, 0x12, 0x2A, 0x35, 0x35, 0x40, 0x87, 0x65, 0xD7, 0xD7, 0x7C, 0x05, 0xE6, 0x81, 0x1A, 0x06,
+0x5E, 0x20, 0x2F, 0x12, 0x59, 0x36, 0x68, 0x81, 0x01, 0x06, 0xAA, 0xEC, 0x90, 0x12, 0x87, 0x87,
+0x72, 0x84, 0x01, 0x99, 0x01, 0x03, 0x82, 0xAB, 0x05, 0x63, 0x8A, 0x01, 0x00, 0xFD, 0x81, 0x87,
+0x06, 0xAF, 0x0B, 0x0B, 0x5D, 0x87, 0x2A, 0x6E, 0x82, 0x97, 0x0B, 0x40, 0x87, 0x36, 0xA3, 0xA3,
+0x27, 0x05, 0x1A, 0x9D, 0x9D, 0x20, 0x12, 0x83, 0x87, 0x09, 0xE0, 0x61, 0x11, 0xA7, 0xE0, 0x87,
+0x40, 0x83, 0xC1, 0x0C, 0x85, 0x01, 0x99, 0x01, 0x02, 0xC9, 0x05, 0xA5, 0x89, 0x01, 0x0A, 0xAA,
+0x7D, 0x7D, 0x06, 0x5D, 0x21, 0x0B, 0xBD, 0xBD, 0xAF, 0x87, 0x84, 0x97, 0x0A, 0x40, 0x36, 0x87,
+0x47, 0xA3, 0x28, 0x05, 0xE8, 0xBA, 0xF2, 0xD6, 0x85, 0x87, 0x08, 0x65, 0x87, 0x12, 0x3A, 0x87,
+0x12, 0x2A, 0x36, 0x7D, 0x85, 0x01, 0x99, 0x01, 0x02, 0xE1, 0x05, 0x5C, 0x87, 0x01, 0x0D, 0xFD,
+0x8E, 0x36, 0x65, 0x36, 0x87, 0x2C, 0x6C, 0xC5, 0xC5, 0xF3, 0x87, 0x87, 0x6B, 0x83, 0x35, 0x05,
+0x90, 0x90, 0x59, 0x36, 0x20, 0x27, 0x83, 0x05, 0x00, 0xD6, 0x83, 0x87, 0x08, 0x65, 0x48, 0x87,
+0x90, 0x6B, 0x47, 0x87, 0x36, 0x1F, 0x86, 0x01, 0x98, 0x01, 0x03, 0x25, 0x05, 0x7B, 0x26, 0x86,
+0x01, 0x0E, 0x72, 0x52, 0x21, 0xBE, 0xBE, 0x40, 0x7C, 0x05, 0x05, 0x28, 0x28, 0xFE, 0x6B, 0x3A,
+0x95, 0x83, 0x6B, 0x18, 0x90, 0x12, 0x59, 0x87, 0x87, 0x03, 0x03, 0x9D, 0x52, 0x7C, 0x05, 0x7C,
+0x2F, 0x12, 0x2F, 0x2F, 0x12, 0x12, 0xA3, 0x36, 0x36, 0x48, 0x90, 0xE0, 0x0A, 0x87, 0x01, 0x00,
+0x00, 0x97, 0x01, 0x02, 0x4D, 0x05, 0x16, 0x87, 0x01, 0x01, 0x0A, 0x5D, 0x81, 0xBE, 0x03, 0xE9,
+0x05, 0xC5, 0x68, 0x89, 0x95, 0x04, 0x12, 0x87, 0x36, 0x12, 0x41, 0x81, 0x9D, 0x03, 0xD3, 0x81,
+0x05, 0x27, 0x81, 0xA0, 0x02, 0x15, 0x36, 0xF5, 0x81, 0x87, 0x02, 0x75, 0x8D, 0xAA, 0x87, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x96, 0x01, 0x03, 0x1E, 0x05, 0x05, 0x9A, 0x87, 0x01, 0x08, 0xA2, 0xC8,
+0xBE, 0xBE, 0x40, 0x05, 0x27, 0x59, 0x20, 0x89, 0xA3, 0x14, 0x65, 0x87, 0x20, 0x9D, 0x03, 0x03,
+0x9D, 0xA0, 0xA0, 0x6C, 0x05, 0xC5, 0xA0, 0x15, 0x15, 0x2F, 0x8E, 0x01, 0x01, 0xAA, 0x82, 0x8A,
+0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x95, 0x01, 0x02, 0xB5, 0x05, 0xB3, 0x88, 0x01, 0x0B, 0x0C,
+0xC8, 0xD9, 0xD9, 0xD8, 0x05, 0xF2, 0xBB, 0x27, 0x27, 0xE9, 0x03, 0x86, 0x9D, 0x0B, 0x87, 0x12,
+0x9D, 0x9D, 0x8F, 0x05, 0x7C, 0xF2, 0x7C, 0x05, 0x05, 0x8F, 0x81, 0x15, 0x01, 0x36, 0x7D, 0x8D,
+0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x94, 0x01, 0x03, 0x5F, 0x05, 0x05, 0x51, 0x88, 0x01,
+0x0B, 0x0A, 0xAF, 0x74, 0x74, 0xEA, 0x05, 0x27, 0x28, 0x7C, 0x05, 0x05, 0x6C, 0x85, 0xD3, 0x06,
+0x2F, 0x87, 0x12, 0x9D, 0x9D, 0x1A, 0xBA, 0x81, 0x05, 0x01, 0xBA, 0x81, 0x81, 0x15, 0x01, 0x36,
+0x0A, 0x8E, 0x01, 0x01, 0x00, 0x00, 0x81, 0x00, 0xA1, 0x01, 0x0C, 0x82, 0xEC, 0x59, 0x12, 0x2C,
+0x05, 0x27, 0x68, 0x87, 0xF9, 0x05, 0x28, 0xA0, 0x82, 0x15, 0x11, 0x41, 0x2F, 0xF5, 0x8E, 0x36,
+0x2F, 0x20, 0x20, 0xA0, 0x41, 0xB0, 0x41, 0x15, 0x15, 0x2F, 0x12, 0x59, 0xFC, 0x8E, 0x01, 0x81,
+0x00, 0x82, 0x00, 0xA2, 0x01, 0x15, 0x61, 0x7F, 0x4C, 0x05, 0x08, 0x94, 0x94, 0x8B, 0x05, 0x05,
+0x06, 0x87, 0x68, 0xF5, 0x8E, 0xEC, 0xA7, 0xAA, 0xAA, 0x61, 0x0C, 0x68, 0x81, 0x87, 0x06, 0xE0,
+0x52, 0x75, 0x8E, 0x0C, 0x1F, 0xAA, 0x8E, 0x01, 0x82, 0x00, 0x83, 0x00, 0xA3, 0x01, 0x07, 0x1E,
+0x05, 0x28, 0x9C, 0x01, 0xCE, 0x05, 0xC3, 0xA3, 0x01, 0x83, 0x00, 0x84, 0x00, 0xA3, 0x01, 0x06,
+0x37, 0x05, 0x54, 0xB3, 0x88, 0x05, 0x16, 0xA2, 0x01, 0x84, 0x00, 0x85, 0x00, 0xA2, 0x01, 0x01,
+0x86, 0xB5, 0x81, 0x05, 0x01, 0x17, 0x98, 0xA1, 0x01, 0x85, 0x00, 0x87, 0x00, 0xA2, 0x01, 0x02,
+0x82, 0x86, 0x82, 0xA1, 0x01, 0x87, 0x00, 0x89, 0x00, 0xC4, 0x01, 0x89, 0x00,
+};
+static const uint16_t CAT_WATCH_FACE_DIAL8_PACKED_ROWS[92] PROGMEM = {
+0x0000, 0x0006, 0x001C, 0x0032, 0x004B, 0x0064, 0x0079, 0x00A2, 0x00D0, 0x0101, 0x0130, 0x0162, 0x0187, 0x019E, 0x01B5, 0x01CC,
+0x01E3, 0x01FA, 0x01FC, 0x01FE, 0x0200, 0x021A, 0x0237, 0x025F, 0x0289, 0x02B0, 0x02D8, 0x0309, 0x0341, 0x0382, 0x03C3, 0x03FA,
+0x0424, 0x0447, 0x0467, 0x0484, 0x049F, 0x04B6, 0x04CC, 0x04E4, 0x04FA, 0x0525, 0x0554, 0x0585, 0x05BA, 0x05F0, 0x0626, 0x065A,
+0x0685, 0x06B6, 0x06EC, 0x0724, 0x0757, 0x077A, 0x07A2, 0x07C8, 0x07E9, 0x0809, 0x081B, 0x0832, 0x084E, 0x0880, 0x08B2, 0x08E1,
+0x0910, 0x0941, 0x0972, 0x09A7, 0x09DF, 0x0A15, 0x0A47, 0x0A7D, 0x0AAD, 0x0AD7, 0x0B01, 0x0B35, 0x0B69, 0x0BA3, 0x0BD6, 0x0C06,
+0x0C38, 0x0C6F, 0x0CA2, 0x0CD3, 0x0D04, 0x0D36, 0x0D61, 0x0D8A, 0x0D9B, 0x0DAB, 0x0DBB, 0x0DC7,
+};
+static const uint16_t CAT_WATCH_FACE_DIAL8_PACKED_PALETTE[256] PROGMEM = {
+0x0000, 0xFFFF, 0xEC60, 0xEC86, 0xF4C6, 0x0231, 0xCC01, 0x2AF2, 0x3B11, 0xECC9, 0xEE77, 0xFDC3, 0xE570, 0xDD50, 0xD531, 0x4944,
+0xF523, 0xF6D9, 0xE462, 0xEBEE, 0xFE86, 0xF444, 0x74D7, 0x6C97, 0x69E6, 0x2968, 0xC408, 0xD71D, 0xD6FC, 0xCEDC, 0xD6FD, 0xEE35,
+0xF4A4, 0xED22, 0xF5C2, 0xFF35, 0xAE1B, 0xBE9C, 0xF7BE, 0x1250, 0x0A51, 0xFE66, 0xF565, 0x52AA, 0x93C7, 0xF614, 0xCD47, 0xEC43,
+0x7D18, 0xEF7D, 0xEC80, 0xF692, 0xB63B, 0xFD86, 0xDC20, 0x53F5, 0xFE45, 0xFF7C, 0xF525, 0xFE26, 0xD4E6, 0xF585, 0x6AC7, 0xFE46,
+0xED04, 0xEC44, 0xF524, 0xED8A, 0x4208, 0xF79D, 0xE50B, 0xEC83, 0xF504, 0xB596, 0xB575, 0xAD75, 0x9471, 0x4BD5, 0xF626, 0xFF56,
+0x9BE7, 0xC6BC, 0xDC67, 0xFE25, 0x1AD2, 0x1AB2, 0xF5B1, 0xF584, 0xFDE6, 0xDC21, 0xF544, 0x9DBA, 0x9599, 0xE4C1, 0xF4A5, 0xE73D,
+0xEDC6, 0xF6FA, 0xDEDB, 0xBE7B, 0xF630, 0xDC41, 0xE75E, 0xFDC6, 0xD445, 0x8347, 0xFE05, 0xFD45, 0x5B0C, 0xFF14, 0xFD65, 0xFDE5,
+0x8518, 0x8538, 0xFFBE, 0x3B74, 0xFCE4, 0xDC8A, 0xECA1, 0xF655, 0xBCA7, 0xF503, 0xE77E, 0x1292, 0x3AAE, 0xF73B, 0xEBAD, 0xE5D4,
+0xCDF6, 0x9B6A, 0xFFDF, 0xFD85, 0xC618, 0xCE38, 0xEF9E, 0xD400, 0x1272, 0xED6F, 0xFDC5, 0xE615, 0xDD66, 0xE5F4, 0xDD0E, 0xABC7,
+0xE4A3, 0xF5B0, 0xF564, 0xF6B8, 0xEE15, 0xFD25, 0xEC8B, 0xFDA6, 0xF7DF, 0xF4E3, 0xDF3D, 0xFE06, 0xDF5D, 0xFCA5, 0xFED3, 0xFDA5,
+0xFC64, 0x82E6, 0xE592, 0xFCE5, 0xF6D6, 0x2B13, 0x2B33, 0xE5B3, 0xC32C, 0x8D59, 0xFF9D, 0x22D3, 0x9579, 0xF5E7, 0xFD64, 0xE481,
+0xE444, 0x7BAD, 0xFE03, 0x5416, 0x5C36, 0x5C56, 0xDEFB, 0xD69A, 0xA534, 0xED0C, 0x228F, 0x7308, 0xC4E6, 0xF563, 0xFD63, 0xFF76,
+0xE56D, 0xED03, 0xDF1D, 0x0A71, 0x5247, 0x42CC, 0xEC81, 0xE4E3, 0xECC2, 0xA5DA, 0xED4E, 0xE5C6, 0xA61A, 0xBDF9, 0xAE1A, 0xB5F9,
+0xA4F3, 0xCE79, 0xF5C4, 0xFC85, 0xED01, 0x2313, 0x9B65, 0xFD05, 0xAC47, 0xFD24, 0x2841, 0x92AA, 0x8303, 0xAAEB, 0xA44F, 0xB4D1,
+0xD422, 0x3354, 0x4394, 0x49A2, 0xD38C, 0x5985, 0x838B, 0x43B5, 0x4AEE, 0x6B6D, 0xA3E9, 0xBC06, 0xDD2F, 0xEDEE, 0xF697, 0x7207,
+0x40E3, 0x7BCF, 0x52ED, 0xABC5, 0xD587, 0xDC89, 0xEBAE, 0xFF3B, 0x6477, 0x8B67, 0xDC82, 0xECEA, 0xEE98, 0xF75C, 0xAC49, 0x7B47,
+};
+const PackedImage CAT_WATCH_FACE_DIAL8_PACKED = { 92, 92, PackedImage::PaletteRle, 256, 3533, CAT_WATCH_FACE_DIAL8_PACKED_PALETTE, CAT_WATCH_FACE_DIAL8_PACKED_ROWS, CAT_WATCH_FACE_DIAL8_PACKED_DATA };
+
+#endif
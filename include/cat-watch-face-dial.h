@@ -0,0 +1,548 @@
+// Generated by   : tools/bake_face.py, do not edit
+// Generated from : cat-watch-face.h + NotoSansBold15.h numerals
+// Memory usage   : 16928 bytes
+
+#ifndef __CAT_WATCH_FACE_DIAL_H
+#define __CAT_WATCH_FACE_DIAL_H
+#if defined(__AVR__)
+    #include <avr/pgmspace.h>
+#elif defined(__PIC32MX__)
+    #define PROGMEM
+#elif defined(__arm__)
+    #define PROGMEM
+#endif
+
+// CAT_WATCH_FACE_DIAL: 92x92 raw565, 16928 bytes of flash
+const unsigned short CAT_WATCH_FACE_DIAL[8464] PROGMEM={
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0010 (16) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0020 (32) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0030 (48) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0040 (64) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0050 (80) pixels
+0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0060 (96) pixels
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0070 (112) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0080 (128) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE75E, 0x5C36, 0x53F5, 0xD6FD, 0xFFFF, 0xFFFF, 0xFFFF, 0xE77E, 0x7CF8, 0x4394, 0x22D3, 0x5415,   // 0x0090 (144) pixels
+0xBE7B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x00A0 (160) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000,   // 0x00B0 (176) pixels
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF,   // 0x00C0 (192) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x00D0 (208) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBE7B,   // 0x00E0 (224) pixels
+0x1AB2, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xD71D, 0x1AB2, 0x0231, 0x0231, 0x0231, 0x0231, 0x0231, 0xB63B, 0xFFFF, 0xFFFF,   // 0x00F0 (240) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0100 (256) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000,   // 0x0110 (272) pixels
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0120 (288) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0130 (304) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9579, 0x0231, 0x1292, 0x0231, 0x0231, 0xBE9C,   // 0x0140 (320) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0x4BD5, 0x6477, 0xDF3D, 0xF7DF, 0x43B5, 0x0231, 0x5415, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0150 (336) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0160 (352) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0170 (368) pixels
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0180 (384) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0190 (400) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BD5, 0x22D3, 0xCEDC, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,   // 0x01A0 (416) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0x8D59, 0x0231, 0x53F5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x01B0 (432) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x01C0 (448) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01D0 (464) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x01E0 (480) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x01F0 (496) pixels
+0xFFFF, 0xFFFF, 0xEF9E, 0xE77E, 0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x3354,   // 0x0200 (512) pixels
+0x0231, 0x8538, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0210 (528) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0220 (544) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0230 (560) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE75E, 0x5C36, 0x53F5, 0xD6FD,   // 0x0240 (576) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE75E, 0x5C36, 0x53F5, 0xD6FD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0250 (592) pixels
+0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x74B7, 0x0231, 0x2313, 0xF7BE, 0xFFFF, 0xFFFF,   // 0x0260 (608) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE75E, 0x5C36, 0x53F5, 0xD6FD, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0270 (624) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0280 (640) pixels
+0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0290 (656) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBE7B, 0x1AB2, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x02A0 (672) pixels
+0xBE7B, 0x1AB2, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0x0231, 0x0231, 0xBE9C,   // 0x02B0 (688) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7D18, 0x0231, 0x1AD2, 0xDF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x02C0 (704) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBE7B, 0x1AB2, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x02D0 (720) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000,   // 0x02E0 (736) pixels
+0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x02F0 (752) pixels
+0xFFFF, 0xFFFF, 0x9579, 0x0231, 0x1292, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0x9579, 0x0231, 0x1292, 0x0231, 0x0231,   // 0x0300 (768) pixels
+0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0310 (784) pixels
+0x8538, 0x0231, 0x22F3, 0xDF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9579,   // 0x0320 (800) pixels
+0x0231, 0x1292, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0330 (816) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0340 (832) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BD5, 0x22D3,   // 0x0350 (848) pixels
+0xCEDC, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BD5, 0x22D3, 0xCEDC, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0360 (864) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0x8538, 0x0231, 0x2B33, 0xE77E, 0xFFFF,   // 0x0370 (880) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BD5, 0x22D3, 0xCEDC, 0x0231, 0x0231,   // 0x0380 (896) pixels
+0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0390 (912) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x03A0 (928) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9E, 0xE77E, 0xF7DF, 0x0231, 0x0231, 0xBE9C,   // 0x03B0 (944) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xEF9E, 0xE77E, 0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x03C0 (960) pixels
+0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xB63B, 0x0231, 0x0231, 0x0A71, 0x1272, 0x1272, 0x1272, 0x1272, 0xF7DF, 0xFFFF,   // 0x03D0 (976) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9E, 0xE77E, 0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x03E0 (992) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x03F0 (1008) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0400 (1024) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0410 (1040) pixels
+0xFFFF, 0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0x0231, 0x0231, 0xBE9C,   // 0x0420 (1056) pixels
+0xFFFF, 0xFFFF, 0xA5DA, 0x0231, 0x0231, 0x0231, 0x0231, 0x0231, 0x0231, 0x0231, 0xF7DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0430 (1072) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0440 (1088) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0450 (1104) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0460 (1120) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0x0231, 0x0231,   // 0x0470 (1136) pixels
+0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0480 (1152) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0490 (1168) pixels
+0xFFFF, 0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x04A0 (1184) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x04B0 (1200) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x04C0 (1216) pixels
+0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x04D0 (1232) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x04E0 (1248) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0x0231, 0x0231,   // 0x04F0 (1264) pixels
+0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0500 (1280) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0510 (1296) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0x0231, 0x0231, 0xBE9C,   // 0x0520 (1312) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0530 (1328) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0540 (1344) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0550 (1360) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0560 (1376) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0570 (1392) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0580 (1408) pixels
+0xFFFF, 0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0590 (1424) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x05A0 (1440) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x05B0 (1456) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x05C0 (1472) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x05D0 (1488) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0x0231, 0x0231,   // 0x05E0 (1504) pixels
+0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x05F0 (1520) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0600 (1536) pixels
+0xFFFF, 0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0610 (1552) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0620 (1568) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0630 (1584) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0640 (1600) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0650 (1616) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0660 (1632) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0670 (1648) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0680 (1664) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0690 (1680) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x06A0 (1696) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x06B0 (1712) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x06C0 (1728) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x06D0 (1744) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x06E0 (1760) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x06F0 (1776) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0700 (1792) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0710 (1808) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0720 (1824) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0730 (1840) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE75E, 0x5C36, 0x53F5, 0xD6FD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8D59, 0x3B74,   // 0x0740 (1856) pixels
+0x1AD2, 0x5C36, 0xD71D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0750 (1872) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0760 (1888) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0770 (1904) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE77E, 0x7CF8, 0x4394,   // 0x0780 (1920) pixels
+0x22D3, 0x5415, 0xBE7B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0790 (1936) pixels
+0xFFFF, 0xBE7B, 0x1AB2, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0x7CF8, 0x0231, 0x0231, 0x0A51, 0x0231, 0x1AB2, 0xE77E,   // 0x07A0 (1952) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x07B0 (1968) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x07C0 (1984) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x07D0 (2000) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD71D, 0x1AB2, 0x0231, 0x0231, 0x0231, 0x0231, 0x0231, 0xB63B,   // 0x07E0 (2016) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9579, 0x0231, 0x1292, 0x0231,   // 0x07F0 (2032) pixels
+0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xF7DF, 0x0A51, 0x0231, 0xAE1B, 0xFFDF, 0x3B94, 0x0231, 0x74D7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0800 (2048) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0810 (2064) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0820 (2080) pixels
+0xFF7C, 0xF655, 0xECEB, 0xEC60, 0xED6F, 0xFF9D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0830 (2096) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BD5, 0x6477, 0xDF3D, 0xF7DF, 0x43B5, 0x0231, 0x5415, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0840 (2112) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BD5, 0x22D3, 0xCEDC, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF,   // 0x0850 (2128) pixels
+0xB63B, 0x0231, 0x0A71, 0xFFFF, 0xFFFF, 0xA5FA, 0x0231, 0x3334, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0860 (2144) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0870 (2160) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF1A, 0xED6F, 0xECA1, 0xF584, 0xFE25, 0xFE66,   // 0x0880 (2176) pixels
+0xF5A4, 0xED0C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0890 (2192) pixels
+0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8D59, 0x0231, 0x53F5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x08A0 (2208) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9E, 0xE77E, 0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xA5DA, 0x0231, 0x2B33, 0xFFFF,   // 0x08B0 (2224) pixels
+0xFFFF, 0xB65B, 0x0231, 0x0A51, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x08C0 (2240) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x08D0 (2256) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF7C, 0xED6F, 0xECC1, 0xF5C4, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xECC1, 0xFF3B, 0xFFFF,   // 0x08E0 (2272) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x08F0 (2288) pixels
+0xFFFF, 0x3354, 0x0231, 0x8538, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0900 (2304) pixels
+0xFFFF, 0xFFFF, 0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0x9DB9, 0x0231, 0x4BD5, 0xFFFF, 0xFFFF, 0xBE7B, 0x0231, 0x0231,   // 0x0910 (2320) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0920 (2336) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF697,   // 0x0930 (2352) pixels
+0xECA3, 0xF5A4, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE66, 0xF584, 0xECA1, 0xEC80, 0xF697, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0940 (2368) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x74B7, 0x0231, 0x2313, 0xF7BE,   // 0x0950 (2384) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0x0231,   // 0x0960 (2400) pixels
+0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xA5DA, 0x0231, 0x3B74, 0xFFFF, 0xFFFF, 0xB65B, 0x0231, 0x0231, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0970 (2416) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0980 (2432) pixels
+0xFFFF, 0xFFDE, 0xFF3B, 0xF6D9, 0xF656, 0xF635, 0xF635, 0xF655, 0xF6D8, 0xFF3B, 0xF5F3, 0xECE2, 0xFE45, 0xFE86, 0xFE86, 0xFE86,   // 0x0990 (2448) pixels
+0xFE86, 0xFDE5, 0xECA0, 0xEC60, 0xEC60, 0xEC60, 0xF5F3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x09A0 (2464) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7D18, 0x0231, 0x1AD2, 0xDF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x09B0 (2480) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF,   // 0x09C0 (2496) pixels
+0xAE1B, 0x0231, 0x1272, 0xFFFF, 0xFFFF, 0xAE1A, 0x0231, 0x1AB2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,   // 0x09D0 (2512) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9D, 0xF697, 0xED4E, 0xEC60, 0xECE2, 0xF543,   // 0x09E0 (2528) pixels
+0xEC80, 0xEC60, 0xF523, 0xF583, 0xF563, 0xECE2, 0xEC80, 0xECC1, 0xF584, 0xFE45, 0xFE86, 0xFE86, 0xF5C4, 0xEC60, 0xEC60, 0xEC60,   // 0x09F0 (2544) pixels
+0xEC60, 0xEC60, 0xED6F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0A00 (2560) pixels
+0xFFFF, 0xFFFF, 0x8538, 0x0231, 0x22F3, 0xDF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0A10 (2576) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xEF9E, 0x0231, 0x0231, 0xD71D,   // 0x0A20 (2592) pixels
+0xFFFF, 0x6C97, 0x0231, 0x5C36, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF634, 0xEC85, 0xEC60, 0xEC60, 0xEC60, 0xEC81, 0xED0B, 0xF5B1,   // 0x0A30 (2608) pixels
+0xF676, 0xFF3B, 0xFFFF, 0xFFFF, 0xFF5C, 0xF5B1, 0xEC80, 0xEC60, 0xEC60, 0xFE25, 0xFE86, 0xFE86, 0xECE2, 0xEC60, 0xF584, 0xFE86,   // 0x0A40 (2624) pixels
+0xFE86, 0xFE86, 0xFE66, 0xFE05, 0xF543, 0xEC80, 0xF543, 0xF5C4, 0xEC60, 0xEC60, 0xEC60, 0xEC60, 0xEC60, 0xEC60, 0xECA7, 0xFFFF,   // 0x0A50 (2640) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8538, 0x0231, 0x2B33,   // 0x0A60 (2656) pixels
+0xE77E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0A70 (2672) pixels
+0xFFFF, 0xFFFF, 0xF7DF, 0x0231, 0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0x6456, 0x0231, 0x1AD2, 0x4BD5, 0x0231, 0x0231, 0xBE7B,   // 0x0A80 (2688) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xF655, 0xF502, 0xFE45, 0xFE86, 0xFE86, 0xFE86, 0xFE66, 0xFE25, 0xF5E4, 0xF563, 0xECC1, 0xECC9, 0xF590,   // 0x0A90 (2704) pixels
+0xECA1, 0xF5A4, 0xFE66, 0xEC60, 0xEC60, 0xFDE5, 0xFE86, 0xFE86, 0xF563, 0xEC60, 0xF522, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86,   // 0x0AA0 (2720) pixels
+0xFE86, 0xFE66, 0xF563, 0xEC80, 0xEC60, 0xEC60, 0xEC60, 0xEC60, 0xEC60, 0xEC60, 0xEC60, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0AB0 (2736) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB63B, 0x0231, 0x0231, 0x0A71, 0x1272, 0x1272, 0x1272, 0x1272,   // 0x0AC0 (2752) pixels
+0xF7DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0x0231,   // 0x0AD0 (2768) pixels
+0x0231, 0xBE9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9E, 0x53F5, 0x0231, 0x0231, 0x1272, 0x9599, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xECEA,   // 0x0AE0 (2784) pixels
+0xFE25, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE05, 0xEC80, 0xF563, 0xFE66, 0xFE86, 0xFE86, 0xECC1,   // 0x0AF0 (2800) pixels
+0xEC60, 0xF584, 0xFE86, 0xFE86, 0xF5A4, 0xEC60, 0xECA1, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE25,   // 0x0B00 (2816) pixels
+0xECE2, 0xEC60, 0xEC60, 0xEC60, 0xEC60, 0xEC60, 0xEC60, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0B10 (2832) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA5DA, 0x0231, 0x0231, 0x0231, 0x0231, 0x0231, 0x0231, 0x0231, 0xF7DF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0B20 (2848) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0B30 (2864) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0xEFBE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xECEA, 0xF5A4, 0xF563, 0xF5A4, 0xFDE5,   // 0x0B40 (2880) pixels
+0xFE66, 0xFE86, 0xFE86, 0xFE86, 0xF5C4, 0xEC80, 0xFE05, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xF543, 0xEC60, 0xF523, 0xFE86, 0xFE86,   // 0x0B50 (2896) pixels
+0xFE05, 0xEC60, 0xEC60, 0xFE66, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE66, 0xF523, 0xEC60, 0xEC60,   // 0x0B60 (2912) pixels
+0xEC60, 0xEC60, 0xEC60, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0B70 (2928) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0B80 (2944) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0B90 (2960) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF590, 0xEC60, 0xEC60, 0xEC60, 0xEC60, 0xEC80, 0xF543, 0xFE45, 0xF5C4,   // 0x0BA0 (2976) pixels
+0xECA1, 0xFE25, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xF5A4, 0xEC60, 0xECC1, 0xFE86, 0xFE86, 0xFE66, 0xEC60, 0xEC60, 0xFE05,   // 0x0BB0 (2992) pixels
+0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xF523, 0xEC60, 0xEC60, 0xEC60, 0xEC84, 0xFFFF,   // 0x0BC0 (3008) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0BD0 (3024) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0BE0 (3040) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0BF0 (3056) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xF635, 0xEC60, 0xEC60, 0xEC60, 0xEC60, 0xEC60, 0xEC60, 0xEC80, 0xEC80, 0xFE25, 0xFE86, 0xFE86, 0xFE86,   // 0x0C00 (3072) pixels
+0xFE86, 0xFE86, 0xFE86, 0xFE05, 0xEC60, 0xEC60, 0xFE66, 0xFE86, 0xFE86, 0xECA1, 0xEC60, 0xF5A4, 0xFE86, 0xFE86, 0xFE86, 0xFE86,   // 0x0C10 (3088) pixels
+0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE66, 0xECE2, 0xEC60, 0xEC60, 0xED4E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0C20 (3104) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0C30 (3120) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0C40 (3136) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEF9,   // 0x0C50 (3152) pixels
+0xEC60, 0xEC60, 0xEC60, 0xEC60, 0xEC60, 0xEC60, 0xEC60, 0xFDE5, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE45,   // 0x0C60 (3168) pixels
+0xEC60, 0xEC60, 0xFE25, 0xFE86, 0xFE86, 0xF522, 0xEC60, 0xF563, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86,   // 0x0C70 (3184) pixels
+0xFE86, 0xFE86, 0xFE86, 0xFE45, 0xEC80, 0xEC60, 0xF614, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0C80 (3200) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0C90 (3216) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0CA0 (3232) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xEC60, 0xEC60, 0xEC60, 0xEC60,   // 0x0CB0 (3248) pixels
+0xEC60, 0xEC60, 0xF543, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xECA0, 0xEC60, 0xF5E5, 0xFE86,   // 0x0CC0 (3264) pixels
+0xFE86, 0xFE25, 0xF563, 0xFE45, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86,   // 0x0CD0 (3280) pixels
+0xF584, 0xEC60, 0xFF1A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0CE0 (3296) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0CF0 (3312) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0D00 (3328) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xED2D, 0xEC60, 0xEC60, 0xEC60, 0xEC60, 0xEC80, 0xFE46, 0xFE86,   // 0x0D10 (3344) pixels
+0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE05, 0xF584, 0xFE66, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86,   // 0x0D20 (3360) pixels
+0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE66, 0xECA0, 0xFF7C, 0xFFFF,   // 0x0D30 (3376) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0D40 (3392) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0D50 (3408) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0D60 (3424) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF697, 0xEC60, 0xEC60, 0xEC60, 0xEC60, 0xF563, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86,   // 0x0D70 (3440) pixels
+0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86,   // 0x0D80 (3456) pixels
+0xCD47, 0x8BA7, 0x93E7, 0xDDA6, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xF564, 0xF635, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0D90 (3472) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0DA0 (3488) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0DB0 (3504) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0DC0 (3520) pixels
+0xFFBE, 0xEC81, 0xEC60, 0xEC60, 0xEC60, 0xFE25, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86,   // 0x0DD0 (3536) pixels
+0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xCD47, 0x4208, 0x4208, 0x4208, 0x4208,   // 0x0DE0 (3552) pixels
+0xDDA6, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE25, 0xECC9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0DF0 (3568) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0E00 (3584) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0E10 (3600) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF613, 0xEC60, 0xEC60,   // 0x0E20 (3616) pixels
+0xECA1, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86,   // 0x0E30 (3632) pixels
+0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0x7327, 0x4208, 0x4208, 0x4208, 0x4208, 0x8BC7, 0xFE86, 0xFE86, 0xFE86,   // 0x0E40 (3648) pixels
+0xFE86, 0xFE86, 0xECC1, 0xFF5C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0E50 (3664) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0E60 (3680) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFBE, 0x7D18, 0x4BD5, 0x4BD5, 0x6CB7, 0xE75E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0E70 (3696) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9D, 0xECA6, 0xEC80, 0xF523, 0xFE86, 0xFE86, 0xFE86,   // 0x0E80 (3712) pixels
+0xFE86, 0xFE86, 0xFE66, 0xC507, 0xAC87, 0xD587, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86,   // 0x0E90 (3728) pixels
+0xFE86, 0xFE86, 0xFE86, 0x4A28, 0x4208, 0x4208, 0x4208, 0x4208, 0x4A48, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xF543, 0xF6B8,   // 0x0EA0 (3744) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0EB0 (3760) pixels
+0xFFFF, 0xFFFF, 0xAE3B, 0x5C36, 0x2B33, 0x2B13, 0x5415, 0xB63B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0EC0 (3776) pixels
+0x3B94, 0x0231, 0x0231, 0x0231, 0x0231, 0x1AB2, 0xE75E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0ED0 (3792) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6D9, 0xEC60, 0xF584, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE66, 0x8367, 0x4208,   // 0x0EE0 (3808) pixels
+0x4208, 0x4208, 0xB4C7, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0x93C7,   // 0x0EF0 (3824) pixels
+0x4208, 0x4208, 0x4208, 0x4208, 0x7B47, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xF5C4, 0xF614, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0F00 (3840) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCEDC, 0x0231, 0x0231,   // 0x0F10 (3856) pixels
+0x0231, 0x0231, 0x0231, 0x0231, 0xAE1B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB63B, 0x0231, 0x1292, 0xD71D, 0xF7BE,   // 0x0F20 (3872) pixels
+0x4BD5, 0x0231, 0x6477, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0F30 (3888) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xF5B1, 0xF5C4, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xD587, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0xF626,   // 0x0F40 (3904) pixels
+0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xE5C6, 0x4228, 0x4208, 0x4208, 0x4208,   // 0x0F50 (3920) pixels
+0xCD47, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE05, 0xED6F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0F60 (3936) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D99, 0xB65B, 0xFFDF, 0xF7DF, 0x3B74, 0x0231,   // 0x0F70 (3952) pixels
+0x5C36, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8538, 0x0231, 0x5416, 0xFFFF, 0xFFFF, 0xB63B, 0x0231, 0x1292, 0xFFFF,   // 0x0F80 (3968) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF590,   // 0x0F90 (3984) pixels
+0xF5C4, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xBCC7, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0xCD67, 0xFE86, 0xFE86, 0xFE86, 0xFE86,   // 0x0FA0 (4000) pixels
+0xFE86, 0xFE86, 0xF646, 0xEDE6, 0xFE66, 0xFE86, 0xFE86, 0xFE86, 0xE5C6, 0x9C07, 0x8BC7, 0xD547, 0xFE86, 0xFE86, 0xFE86, 0xFE86,   // 0x0FB0 (4016) pixels
+0xFE86, 0xFE66, 0xFE25, 0xE4EC, 0xBDF7, 0xC638, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0FC0 (4032) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C56, 0x0231, 0x74D7, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0FD0 (4048) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0x9599, 0x0231, 0x4394, 0xFFFF, 0xFFFF, 0xADFA, 0x0231, 0x0231, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0FE0 (4064) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF5B1, 0xF5C4, 0xFE86, 0xFE86, 0xFE86,   // 0x0FF0 (4080) pixels
+0xFE86, 0xD567, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0xDD86, 0xFE86, 0xFE86, 0xFE86, 0xCD27, 0xABE7, 0x8AE7, 0x7207, 0x7207,   // 0x1000 (4096) pixels
+0xC4C6, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE66, 0xFE66, 0xFE66, 0xFE66, 0xFE66, 0xEDE6, 0xAC47, 0x4A27,   // 0x1010 (4112) pixels
+0x632C, 0xD69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1020 (4128) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xBE9C, 0xA5FA, 0x74D7, 0x0A51, 0x3354, 0xEF7E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC6BC,   // 0x1030 (4144) pixels
+0x0231, 0x0231, 0x6C97, 0x8518, 0x1AB2, 0x0231, 0x0231, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1040 (4160) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF614, 0xF5C4, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE66, 0x6AE7, 0x4208,   // 0x1050 (4176) pixels
+0x4208, 0x4208, 0x62C7, 0xFE66, 0xFE86, 0xFE86, 0xFE46, 0x69E6, 0x61C6, 0x61A6, 0x5985, 0x5165, 0xCD25, 0xFE86, 0xFE66, 0xFE66,   // 0x1060 (4192) pixels
+0xFE66, 0xFE66, 0xFE66, 0xFE66, 0xFE66, 0xFE66, 0xFE66, 0xDD86, 0x93C7, 0x4208, 0x7AE7, 0xC409, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1070 (4208) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BD5,   // 0x1080 (4224) pixels
+0x0231, 0x0231, 0x22D3, 0xBE7B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7CF8, 0x0231, 0x0231, 0x0231,   // 0x1090 (4240) pixels
+0x8538, 0x0231, 0x1272, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x10A0 (4256) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xF655, 0xF584, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xEE06, 0x8BC7, 0x4208, 0x8387, 0xE5E6, 0xFE86,   // 0x10B0 (4272) pixels
+0xFE86, 0xFE86, 0xFE86, 0xC4C5, 0x4924, 0x4103, 0x40E3, 0x8303, 0xFE66, 0xFE66, 0xFE66, 0xFE66, 0xFE66, 0xFE66, 0xFE66, 0xFE66,   // 0x10C0 (4288) pixels
+0xFE66, 0xF626, 0x7B47, 0x4208, 0x93C7, 0xDD66, 0xFDE5, 0xED4E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x10D0 (4304) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBE9C, 0xA5FA, 0x8518, 0x1AB2, 0x0231,   // 0x10E0 (4320) pixels
+0x7D18, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE75D, 0xB63B, 0xDF3D, 0xB63B, 0x0231, 0x4BF5, 0xFFFF,   // 0x10F0 (4336) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6D9,   // 0x1100 (4352) pixels
+0xF523, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE86, 0xFE66, 0xFE66, 0xFE66, 0xFE66, 0xFE66,   // 0x1110 (4368) pixels
+0xDD85, 0x49A2, 0x2841, 0xDD85, 0xFE66, 0xFE66, 0xFE66, 0xFE66, 0xFE46, 0xFE46, 0xFE46, 0xFE46, 0xFE46, 0xF606, 0xBCA7, 0xEDA6,   // 0x1120 (4384) pixels
+0xFE25, 0xFE25, 0xF5A4, 0xF5B1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1130 (4400) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9599, 0x0231, 0x0A72, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1140 (4416) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9E, 0x3354, 0x0231, 0xA5DA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1150 (4432) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF7C, 0xECA1, 0xFE86, 0xFE86, 0xFE86,   // 0x1160 (4448) pixels
+0xFE86, 0xFE66, 0xFE66, 0xFE66, 0xFE66, 0xFE66, 0xFE66, 0xFE66, 0xFE66, 0xFE66, 0xFE66, 0xFE66, 0xFE66, 0xF605, 0x6287, 0xCD07,   // 0x1170 (4464) pixels
+0xFE46, 0xFE46, 0xFE46, 0xFE46, 0xFE46, 0xEDE6, 0xFE25, 0xFE25, 0xFE25, 0xFE25, 0xE586, 0xC4C6, 0xBC87, 0xAC47, 0xABC6, 0xA44F,   // 0x1180 (4480) pixels
+0xA534, 0x9CF3, 0xD69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1190 (4496) pixels
+0xFFFF, 0xE75E, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0x74B7, 0x0231, 0x1AB2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x11A0 (4512) pixels
+0x8538, 0x5C56, 0x5416, 0x1272, 0x0231, 0x43B5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x11B0 (4528) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xECC8, 0xFE25, 0xFE66, 0xFE66, 0xFE66, 0xFE66, 0xFE66, 0xFE66,   // 0x11C0 (4544) pixels
+0xFE66, 0xFE66, 0xFE66, 0xFE66, 0xFE66, 0xFE46, 0xFE46, 0xFE46, 0xFE46, 0xF606, 0x4208, 0x5247, 0xDD46, 0xFE25, 0xFE25, 0xFE25,   // 0x11D0 (4560) pixels
+0xC4E6, 0x6AC7, 0xFE05, 0xFE05, 0xFE05, 0xFDE5, 0xB447, 0x7B07, 0x8347, 0x8327, 0x82C7, 0x9491, 0xAD55, 0xAD75, 0xDEDB, 0xFFFF,   // 0x11E0 (4576) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA5DA, 0x0A71, 0x53F5,   // 0x11F0 (4592) pixels
+0x5C36, 0x3B94, 0x0231, 0x0231, 0x7D18, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BD5, 0x0231, 0x0231, 0x1AB2,   // 0x1200 (4608) pixels
+0x7D18, 0xF7DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1210 (4624) pixels
+0xFFFF, 0xFFFF, 0xDEFB, 0x7BCF, 0x7B09, 0x8347, 0x9C27, 0xAC67, 0xAC87, 0xBCC7, 0xCD47, 0xFE46, 0xFE46, 0xFE46, 0xFE46, 0xFE46,   // 0x1220 (4640) pixels
+0xFE46, 0xFE46, 0xFE25, 0xFE25, 0xFE25, 0xA407, 0x4208, 0x4208, 0x4208, 0x7307, 0x93A7, 0x6AE7, 0x8B67, 0xED85, 0xFDE5, 0xFDC5,   // 0x1230 (4656) pixels
+0xFDC5, 0xFDC5, 0xFDA5, 0xFDA5, 0xFDA5, 0xFD84, 0xECA6, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1240 (4672) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBE9C, 0x22F3, 0x0231, 0x0231, 0x0231, 0x1AB2, 0x8538,   // 0x1250 (4688) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0xEFBE, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1260 (4704) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xCE79,   // 0x1270 (4720) pixels
+0xB575, 0xA346, 0xAC47, 0x93C7, 0x8367, 0x8367, 0x7B47, 0xF606, 0xFE26, 0xFE25, 0xFE25, 0xFE25, 0xAC47, 0xBCA7, 0xE566, 0xD506,   // 0x1280 (4736) pixels
+0x8B67, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x8347, 0xFDC5, 0xFDA5, 0xFDA5, 0xFDA5, 0xFD85, 0xFD85, 0x9387, 0x72C7,   // 0x1290 (4752) pixels
+0xB406, 0xD464, 0xF614, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x12A0 (4768) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0xEFBE, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x12B0 (4784) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x12C0 (4800) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xED0C, 0xF5C4, 0xFE25,   // 0x12D0 (4816) pixels
+0xFE25, 0xFE25, 0xF605, 0xFE25, 0xFE05, 0xFE05, 0xFE05, 0xFE05, 0xED86, 0xB447, 0x8347, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,   // 0x12E0 (4832) pixels
+0x4208, 0x4208, 0x4208, 0x8B47, 0xFD85, 0xFD85, 0xFD64, 0xFD64, 0xFD44, 0xF544, 0xE4E5, 0xB3E6, 0x72A7, 0x4208, 0x632C, 0xAD75,   // 0x12F0 (4848) pixels
+0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1300 (4864) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1310 (4880) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1320 (4896) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6F9, 0xECC1, 0xF5E5, 0xCD06, 0x9BC7, 0x4228, 0xCCC6,   // 0x1330 (4912) pixels
+0xFDE5, 0xFDE5, 0xFDC5, 0xFDC5, 0xFDC5, 0xFDC5, 0xF585, 0x5247, 0x4208, 0x4208, 0x92AA, 0xC32C, 0xCB4C, 0xAAEB, 0x5228, 0xBC06,   // 0x1340 (4928) pixels
+0xF544, 0xF524, 0xF524, 0xF524, 0xF524, 0xF504, 0xF504, 0xF504, 0xECA2, 0xE5B3, 0xC618, 0x8C51, 0x4208, 0x52AA, 0xCE59, 0xFFFF,   // 0x1350 (4944) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1360 (4960) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1370 (4976) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1380 (4992) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xCE79, 0x8B07, 0x4208, 0x4A27, 0x9BA7, 0xD4C6, 0xF5A5, 0xFDA5, 0xFDA5, 0xFDA5, 0xFD85,   // 0x1390 (5008) pixels
+0xFD85, 0xFD85, 0xFD84, 0xBC26, 0x4208, 0xBB2B, 0xEBAE, 0xEBAE, 0xEBAE, 0xEBAE, 0xD38C, 0xECE4, 0xF504, 0xF504, 0xF504, 0xF504,   // 0x13A0 (5024) pixels
+0xF504, 0xF504, 0xF504, 0xF4E3, 0xECEA, 0xFFDE, 0xFFFF, 0xFFFF, 0xF7BE, 0xCE79, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x13B0 (5040) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x13C0 (5056) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x13D0 (5072) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE59,   // 0x13E0 (5088) pixels
+0x4228, 0x52AA, 0xA514, 0xC408, 0xF544, 0xFDA5, 0xED45, 0x8B67, 0xDCE5, 0xFD64, 0xFD64, 0xFD64, 0xFD44, 0xF544, 0xF524, 0xF524,   // 0x13F0 (5104) pixels
+0xC3E7, 0xE3AD, 0xEBAD, 0xEBAD, 0xE3AD, 0xDBCC, 0xF4C7, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF4E3, 0xEC80,   // 0x1400 (5120) pixels
+0xEE35, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1410 (5136) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1420 (5152) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1430 (5168) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xDEDB, 0xFFDF, 0xFFFF, 0xFEFA,   // 0x1440 (5184) pixels
+0xEC80, 0xD485, 0x5247, 0x8307, 0xED05, 0xF524, 0xF524, 0xF524, 0xF524, 0xF504, 0xF504, 0xF504, 0xF504, 0xF4E6, 0xEC89, 0xE469,   // 0x1450 (5200) pixels
+0xECA8, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF4E3, 0xEC80, 0xF544, 0xDC41, 0xEE57, 0xFFFF, 0xFFFF,   // 0x1460 (5216) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1470 (5232) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1480 (5248) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1490 (5264) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB4D1, 0x4208, 0xAB86, 0xF504,   // 0x14A0 (5280) pixels
+0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504,   // 0x14B0 (5296) pixels
+0xF504, 0xF504, 0xF504, 0xF504, 0xF4C3, 0xEC80, 0xF584, 0xFE06, 0xF5A5, 0xD400, 0xEE15, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x14C0 (5312) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x14D0 (5328) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x14E0 (5344) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x14F0 (5360) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x9492, 0x52AA, 0xCDF6, 0xECA7, 0xF4C2, 0xF504, 0xF504, 0xF504, 0xF504,   // 0x1500 (5376) pixels
+0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xECA2,   // 0x1510 (5392) pixels
+0xECA1, 0xFDC5, 0xFE06, 0xF5A5, 0xDC40, 0xD400, 0xD400, 0xEE15, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1520 (5408) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1530 (5424) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1540 (5440) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1550 (5456) pixels
+0xFFFF, 0xE73C, 0x6B6D, 0x73AE, 0xEF5D, 0xFFFF, 0xFF9D, 0xED6F, 0xEC81, 0xF4E3, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504,   // 0x1560 (5472) pixels
+0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF4C2, 0xEC80, 0xF523, 0xFE05, 0xFE06, 0xF5A5, 0xDC20,   // 0x1570 (5488) pixels
+0xD400, 0xD400, 0xD400, 0xD400, 0xE614, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1580 (5504) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1590 (5520) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFBE, 0x7D18, 0x4BD5, 0x2B33, 0x5415, 0xB65B, 0xFFFF,   // 0x15A0 (5536) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x9CF3, 0xFFDF,   // 0x15B0 (5552) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEFA, 0xED4E, 0xEC80, 0xF4C2, 0xF4E3, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504, 0xF504,   // 0x15C0 (5568) pixels
+0xF504, 0xF4E3, 0xF4C3, 0xECA1, 0xEC80, 0xF523, 0xFDE5, 0xFE06, 0xFE06, 0xF585, 0xDC20, 0xD400, 0xD400, 0xD400, 0xD420, 0xF544,   // 0x15D0 (5584) pixels
+0xDC62, 0xE5F4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x15E0 (5600) pixels
+0xD6FC, 0x53F5, 0x53F5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x15F0 (5616) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4394, 0x0231, 0x0A71, 0x3334, 0x0231, 0x0231, 0xAE1A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1600 (5632) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1610 (5648) pixels
+0xFFFF, 0xFFFF, 0xFF5C, 0xF655, 0xED2C, 0xEC60, 0xEC80, 0xECA1, 0xECA1, 0xECA1, 0xECA1, 0xEC81, 0xEC60, 0xECC6, 0xF503, 0xF584,   // 0x1620 (5664) pixels
+0xFE05, 0xFE06, 0xFE06, 0xFE06, 0xF585, 0xDC20, 0xD400, 0xD400, 0xD400, 0xE4A2, 0xF585, 0xFDA5, 0xF585, 0xD420, 0xE5F4, 0xFFFF,   // 0x1630 (5680) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x2B33, 0x0231, 0x0231, 0xFFFF,   // 0x1640 (5696) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1650 (5712) pixels
+0xF7BE, 0x0231, 0x0231, 0xE77E, 0xFFFF, 0x7CF8, 0x0231, 0x5C36, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1660 (5728) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1670 (5744) pixels
+0xF71B, 0xE52B, 0xFEF4, 0xFE92, 0xF671, 0xF671, 0xFE92, 0xFED3, 0xFF35, 0xFF55, 0xFE06, 0xFE06, 0xFE06, 0xFE06, 0xFE06, 0xFDE6,   // 0x1680 (5760) pixels
+0xDC82, 0xD400, 0xDC41, 0xED03, 0xF585, 0xFDC5, 0xFDA5, 0xF565, 0xDC41, 0xD400, 0xD400, 0xE5F4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1690 (5776) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7CF8, 0x0231, 0x0231, 0x0231, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x16A0 (5792) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0x0A51, 0x0231, 0xD6FC,   // 0x16B0 (5808) pixels
+0xFFFF, 0x6C97, 0x0231, 0x6CB7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x16C0 (5824) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF71A, 0xE56D, 0xFF76, 0xFF76,   // 0x16D0 (5840) pixels
+0xFF76, 0xFF76, 0xFF76, 0xFF76, 0xFF76, 0xFF34, 0xFE06, 0xFE06, 0xFE06, 0xFDE6, 0xFDE6, 0xFDE6, 0xF585, 0xF565, 0xFDC5, 0xFDC5,   // 0x16E0 (5856) pixels
+0xFDA5, 0xFDA5, 0xF565, 0xDC20, 0xD400, 0xD400, 0xD400, 0xD400, 0xE5F4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x16F0 (5872) pixels
+0xFFFF, 0xFFFF, 0xC6BC, 0x0231, 0x74D7, 0x0231, 0x0231, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1700 (5888) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9579, 0x0231, 0x1272, 0x4394, 0x0231, 0x2B33, 0xE77E,   // 0x1710 (5904) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1720 (5920) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF75C, 0xE56D, 0xFF76, 0xFF76, 0xFF76, 0xFF76, 0xFF76, 0xFF76,   // 0x1730 (5936) pixels
+0xFF76, 0xFF34, 0xFE06, 0xFE06, 0xFDE6, 0xFDE6, 0xFDE6, 0xFDE5, 0xFDC5, 0xFDC5, 0xFDC5, 0xFDA5, 0xFDA5, 0xFD85, 0xDC41, 0xD400,   // 0x1740 (5952) pixels
+0xD400, 0xD400, 0xD400, 0xE482, 0xDC41, 0xE615, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x2B13, 0x22F3,   // 0x1750 (5968) pixels
+0xDF5D, 0x0231, 0x0231, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1760 (5984) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x3B74, 0x0231, 0x0231, 0x0A51, 0xC6BC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1770 (6000) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1780 (6016) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D, 0xE50A, 0xFF76, 0xFF76, 0xFF76, 0xFF76, 0xFF76, 0xFF76, 0xFF76, 0xFF34, 0xFDE5, 0xFDE5,   // 0x1790 (6032) pixels
+0xFDE6, 0xFDE6, 0xFDC5, 0xFDC5, 0xFDC5, 0xFDC5, 0xFDA5, 0xF565, 0xFD85, 0xE4C3, 0xD400, 0xD400, 0xD400, 0xE462, 0xF504, 0xFD65,   // 0x17A0 (6048) pixels
+0xF545, 0xDC41, 0xEE15, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6CB7, 0x0231, 0xBE7B, 0xC69C, 0x0231, 0x0231, 0xFFFF,   // 0x17B0 (6064) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x17C0 (6080) pixels
+0xF7DF, 0x3B74, 0x0231, 0x43B5, 0x7D18, 0x0231, 0x0231, 0xAE1A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x17D0 (6096) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x17E0 (6112) pixels
+0xFFFF, 0xDC88, 0xFF76, 0xFF76, 0xFF76, 0xFF76, 0xFF76, 0xFF76, 0xFF76, 0xFF34, 0xDC82, 0xF585, 0xFDE5, 0xFDC5, 0xFDC5, 0xFDC5,   // 0x17F0 (6128) pixels
+0xFDA5, 0xFDA5, 0xFDA5, 0xDC62, 0xF524, 0xDC41, 0xDC41, 0xE4C3, 0xF525, 0xFD65, 0xFD45, 0xFD45, 0xFD45, 0xF525, 0xDC41, 0xEE35,   // 0x1800 (6144) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBE7B, 0x0231, 0x6C97, 0xFFFF, 0xB596, 0x0231, 0x0231, 0xF77C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1810 (6160) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xADFA, 0x0231, 0x3B74, 0xFFFF,   // 0x1820 (6176) pixels
+0xFFFF, 0xB63B, 0x0231, 0x1AB2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1830 (6192) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE550, 0xFF14, 0xFF76,   // 0x1840 (6208) pixels
+0xFF76, 0xFF76, 0xFF76, 0xFF76, 0xFF76, 0xFF34, 0xDC82, 0xED03, 0xF544, 0xF564, 0xF585, 0xFDA5, 0xFDA5, 0xFDA5, 0xFD85, 0xDC61,   // 0x1850 (6224) pixels
+0xF544, 0xFD85, 0xFD65, 0xFD65, 0xFD65, 0xFD45, 0xFD45, 0xFD45, 0xFD25, 0xFD25, 0xF505, 0xDC21, 0xEEB9, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1860 (6240) pixels
+0x4BF5, 0x0231, 0x0A51, 0x0A51, 0x0A31, 0x0231, 0x0231, 0x0A31, 0xAE1A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1870 (6256) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9DBA, 0x0231, 0x53F5, 0xFFFF, 0xFFFF, 0xE75D, 0x0231, 0x0231,   // 0x1880 (6272) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1890 (6288) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEE98, 0xEE10, 0xFF76, 0xFF76, 0xFF76, 0xFF76, 0xFF76,   // 0x18A0 (6304) pixels
+0xFF76, 0xFF35, 0xE4C3, 0xD400, 0xD400, 0xD400, 0xD400, 0xDC41, 0xF544, 0xFD85, 0xFD85, 0xDC20, 0xF545, 0xFD65, 0xFD65, 0xFD65,   // 0x18B0 (6320) pixels
+0xFD45, 0xFD45, 0xFD45, 0xFD25, 0xFD25, 0xFD25, 0xFD05, 0xF4E4, 0xDC45, 0xFF7D, 0xFFFF, 0xFFFF, 0x7D18, 0x4BD5, 0x4BD5, 0x4BD5,   // 0x18C0 (6336) pixels
+0x32AF, 0x0231, 0x0231, 0x42AC, 0xB555, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x18D0 (6352) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6FC, 0x0231, 0x0231, 0x5C36, 0x6C97, 0x2B13, 0x0231, 0x4BF5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x18E0 (6368) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x18F0 (6384) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xDC66, 0xFF35, 0xFF76, 0xFF76, 0xFF76, 0xFF76, 0xFF76, 0xFF56, 0xE4C3, 0xD400,   // 0x1900 (6400) pixels
+0xD400, 0xD400, 0xD400, 0xD400, 0xE4C3, 0xFD85, 0xFD85, 0xD400, 0xF545, 0xFD65, 0xFD45, 0xFD45, 0xFD45, 0xFD45, 0xFD25, 0xFD25,   // 0x1910 (6416) pixels
+0xFD25, 0xFD05, 0xFD05, 0xFD05, 0xEC83, 0xDD2F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xACF3, 0x0231, 0x0231, 0xD400,   // 0x1920 (6432) pixels
+0xDCAA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1930 (6448) pixels
+0xFFFF, 0xADFA, 0x22D3, 0x0231, 0x0231, 0x0231, 0x6456, 0xEF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1940 (6464) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1950 (6480) pixels
+0xFFFF, 0xFFFF, 0xDD0E, 0xE54C, 0xFF56, 0xFF76, 0xFF76, 0xFF76, 0xFF76, 0xFF76, 0xE4E4, 0xD400, 0xD400, 0xD400, 0xDC20, 0xE4C3,   // 0x1960 (6496) pixels
+0xFD65, 0xFD85, 0xFD65, 0xD400, 0xFD45, 0xFD45, 0xF525, 0xFD45, 0xFD25, 0xFD25, 0xFD25, 0xFD25, 0xFD05, 0xECA3, 0xDC42, 0xD400,   // 0x1970 (6512) pixels
+0xE462, 0xDC21, 0xF6D9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF9, 0x0231, 0x0231, 0xED84, 0xDC40, 0xFF7D, 0xFFFF, 0xFFFF,   // 0x1980 (6528) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE,   // 0x1990 (6544) pixels
+0xEFBE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x19A0 (6560) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEE15, 0xD400,   // 0x19B0 (6576) pixels
+0xE56C, 0xFF56, 0xFF76, 0xFF76, 0xFF76, 0xFF76, 0xED69, 0xE4A3, 0xF565, 0xFD65, 0xFD85, 0xFD85, 0xFD85, 0xFD85, 0xFD45, 0xD400,   // 0x19C0 (6592) pixels
+0xFD45, 0xE4A3, 0xD400, 0xF505, 0xFD25, 0xFD25, 0xFD05, 0xECA3, 0xDC20, 0xD400, 0xD400, 0xD400, 0xD400, 0xD400, 0xDD0E, 0xFFFF,   // 0x19D0 (6608) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDC8A, 0xF5C5, 0xFE26, 0xE4A2, 0xF6FA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x19E0 (6624) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x19F0 (6640) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1A00 (6656) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6FA, 0xE480, 0xE4C1, 0xE50B, 0xFF35, 0xFF76,   // 0x1A10 (6672) pixels
+0xFF76, 0xFF76, 0xED8B, 0xE4A3, 0xFDA5, 0xFD85, 0xFD85, 0xFD85, 0xFD85, 0xFD65, 0xF545, 0xDC20, 0xE4A3, 0xD400, 0xE462, 0xF505,   // 0x1A20 (6688) pixels
+0xFD25, 0xF505, 0xDC41, 0xD400, 0xD400, 0xD400, 0xD400, 0xD400, 0xD400, 0xD400, 0xDC00, 0xF77C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1A30 (6704) pixels
+0xFFFF, 0xE5D3, 0xED44, 0xFE06, 0xE503, 0xEEB8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1A40 (6720) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1A50 (6736) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1A60 (6752) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xDC20, 0xFE03, 0xED42, 0xDC86, 0xF692, 0xFF76, 0xFF76, 0xEDEE, 0xDC62,   // 0x1A70 (6768) pixels
+0xF524, 0xED04, 0xF525, 0xFD85, 0xFD85, 0xFD85, 0xF525, 0xD420, 0xD400, 0xE462, 0xFD25, 0xFD25, 0xFD05, 0xE462, 0xD400, 0xD400,   // 0x1A80 (6784) pixels
+0xD400, 0xD400, 0xD400, 0xD400, 0xD400, 0xD400, 0xDC21, 0xEE77, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEE35, 0xE4E3, 0xFE06,   // 0x1A90 (6800) pixels
+0xE4E3, 0xEE97, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1AA0 (6816) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9599,   // 0x1AB0 (6832) pixels
+0x53F5, 0x53F5, 0x53F5, 0x53F5, 0x53F5, 0x53F5, 0x53F5, 0xF7DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1AC0 (6848) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xDCAB, 0xF5C2, 0xFE03, 0xFE03, 0xED42, 0xE54B, 0xFEF4, 0xF630, 0xD400, 0xD400, 0xD400, 0xD400, 0xE483,   // 0x1AD0 (6864) pixels
+0xFD86, 0xFD86, 0xF525, 0xD400, 0xD400, 0xF504, 0xFD05, 0x8BAA, 0x530D, 0x4ACC, 0x42CC, 0x42CC, 0x42CC, 0xCBE1, 0xD400, 0xD400,   // 0x1AE0 (6880) pixels
+0xD400, 0xEC63, 0xEC63, 0xE571, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE5F4, 0xE4C3, 0xFDE5, 0xE4E3, 0xEEB9, 0xFFFF, 0xFFFF,   // 0x1AF0 (6896) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1B00 (6912) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6476, 0x0231, 0x0231, 0x0231, 0x0231,   // 0x1B10 (6928) pixels
+0x0231, 0x0231, 0x0231, 0xF7DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE5B3,   // 0x1B20 (6944) pixels
+0xDC80, 0xED01, 0xF5A2, 0xFE03, 0xFDE3, 0xECE1, 0xDC86, 0xD400, 0xD400, 0xD400, 0xD400, 0xDC41, 0xFD86, 0xFD86, 0xF504, 0xD400,   // 0x1B30 (6960) pixels
+0xDC41, 0xFD05, 0xFD05, 0x4B0D, 0x0231, 0x0231, 0x0231, 0x0231, 0x0231, 0xDC44, 0xEC63, 0xEC84, 0xF4A4, 0xFCA5, 0xF484, 0xDCCC,   // 0x1B40 (6976) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xDC89, 0xD400, 0xE4C3, 0xDC61, 0xF71A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1B50 (6992) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1B60 (7008) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDF1D, 0xBE9C, 0xBE9C, 0xBE9C, 0xBE9C, 0x6476, 0x0231, 0x4BD5, 0xFFFF,   // 0x1B70 (7024) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEE98, 0xD400, 0xD400, 0xD400, 0xE4C1,   // 0x1B80 (7040) pixels
+0xFDE3, 0xFDE3, 0xE4E1, 0xD400, 0xD400, 0xD400, 0xE482, 0xF565, 0xFD86, 0xFD86, 0xED04, 0xD400, 0xDC41, 0xFD05, 0xFD05, 0x3ACE,   // 0x1B90 (7056) pixels
+0x0231, 0x838B, 0xBC08, 0xBC08, 0xBC08, 0xF4A5, 0xF4A4, 0xEC63, 0xE442, 0xDC21, 0xDC20, 0xD424, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9D,   // 0x1BA0 (7072) pixels
+0xDD2F, 0xE4A3, 0xE4A2, 0xD400, 0xD400, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1BB0 (7088) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1BC0 (7104) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x22D3, 0x0231, 0xBE7B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1BD0 (7120) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF75C, 0xD400, 0xD400, 0xD400, 0xE481, 0xFDC3, 0xFDC3, 0xE4C1, 0xD400,   // 0x1BE0 (7136) pixels
+0xF546, 0xFD65, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xED04, 0xD400, 0xDC20, 0xFCE5, 0xFCE5, 0x1250, 0x0231, 0xBC28, 0xFCC5, 0xFCC5,   // 0x1BF0 (7152) pixels
+0xF484, 0xE442, 0xD400, 0xD400, 0xD400, 0xD400, 0xD400, 0xD422, 0xF6FA, 0xF6D9, 0xE5B3, 0xD422, 0xD400, 0xED04, 0xFD85, 0xECE3,   // 0x1C00 (7168) pixels
+0xE570, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1C10 (7184) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1C20 (7200) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xA5DA, 0x0231, 0x2B13, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1C30 (7216) pixels
+0xFFFF, 0xFF9D, 0xF71B, 0xF73B, 0xD401, 0xE4A1, 0xED22, 0xFDA3, 0xF563, 0xF563, 0xE481, 0xD400, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6,   // 0x1C40 (7232) pixels
+0xFDA6, 0xFDA6, 0xECE4, 0xDC20, 0xD400, 0xEC83, 0xFCE5, 0x0A31, 0x0231, 0x4AEE, 0x228F, 0x52ED, 0x9B85, 0xD400, 0xD400, 0xD400,   // 0x1C50 (7248) pixels
+0xD400, 0xD400, 0xD400, 0xD400, 0xDC41, 0xD400, 0xE462, 0xF525, 0xD400, 0xE482, 0xF565, 0xDC20, 0xF73B, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1C60 (7264) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1C70 (7280) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x3354,   // 0x1C80 (7296) pixels
+0x0231, 0x9599, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF75C, 0xDCED, 0xDC20, 0xDC61, 0xDC60,   // 0x1C90 (7312) pixels
+0xD400, 0x93E8, 0x532C, 0x3AAC, 0x3AAC, 0xABC5, 0xD400, 0xD400, 0xFD45, 0xFD86, 0xFD86, 0xFD86, 0xFD86, 0xFD86, 0xE4A3, 0xE483,   // 0x1CA0 (7328) pixels
+0xDC21, 0xDC00, 0xF4A4, 0x0A50, 0x0231, 0x0231, 0x0231, 0x0231, 0x0231, 0x9365, 0xD400, 0xD400, 0xD400, 0xD400, 0xD400, 0xDC42,   // 0x1CB0 (7344) pixels
+0xF4E4, 0xD400, 0xE483, 0xFD45, 0xECA3, 0xD400, 0xDC20, 0xEE35, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1CC0 (7360) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1CD0 (7376) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBE9C, 0x0231, 0x1292, 0xF7BE, 0xFFFF, 0xFFFF,   // 0x1CE0 (7392) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xDC47, 0xED02, 0xFD83, 0xFD83, 0xED44, 0x32CE, 0x0231, 0x0231, 0x0A31,   // 0x1CF0 (7408) pixels
+0x0A51, 0xAC49, 0xFD45, 0xF505, 0xFD25, 0xFD45, 0xFD45, 0xFD45, 0xFD45, 0xFD45, 0xE483, 0xE462, 0xDC21, 0xD400, 0xD400, 0xEC86,   // 0x1D00 (7424) pixels
+0xEC86, 0xFCA5, 0xDC66, 0x3AAE, 0x0231, 0x3ACD, 0xE443, 0xE422, 0xEC43, 0xEC43, 0xE422, 0xE462, 0xFCE5, 0xDC20, 0xDC20, 0xF4E4,   // 0x1D10 (7440) pixels
+0xE4A3, 0xD422, 0xEE57, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1D20 (7456) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1D30 (7472) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BD5, 0x0231, 0x74D7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1D40 (7488) pixels
+0xFFFF, 0xFFFF, 0xEE56, 0xE4A1, 0xFD83, 0xFD63, 0xFD63, 0x636C, 0x0231, 0x42CC, 0xD465, 0xFD25, 0xFD25, 0xFD25, 0xFD25, 0xFD25,   // 0x1D50 (7504) pixels
+0xFD25, 0xFD25, 0xFD25, 0xFD25, 0xFD25, 0xFD25, 0xE462, 0xD400, 0xDC00, 0xE463, 0xEC84, 0xFCA5, 0xFCA5, 0xFCA5, 0xFC85, 0x9BA9,   // 0x1D60 (7520) pixels
+0x0231, 0x1250, 0xFC64, 0xFC64, 0xFC64, 0xF444, 0xDC00, 0xDC89, 0xD400, 0xD400, 0xD400, 0xDC8A, 0xE5F4, 0xFF7D, 0xFFFF, 0xFFFF,   // 0x1D70 (7536) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1D80 (7552) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1D90 (7568) pixels
+0xFFFF, 0xD6FD, 0x0231, 0x0231, 0xDF3D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE592, 0xECE2,   // 0x1DA0 (7584) pixels
+0xFD43, 0xFD43, 0xED04, 0x0231, 0x1250, 0xD421, 0xF4C4, 0xFCE5, 0xFCE5, 0xFCE5, 0xFCE5, 0xFCE5, 0xFCE5, 0xFCE5, 0xFCE5, 0xFCE5,   // 0x1DB0 (7600) pixels
+0xFCE5, 0xFCE5, 0xDC42, 0xD400, 0xF4A4, 0xFCA5, 0xE466, 0xEC86, 0xFCA5, 0xFC84, 0xFC84, 0x630C, 0x0231, 0x42CD, 0xFC64, 0xF444,   // 0x1DC0 (7616) pixels
+0xF444, 0xEC23, 0xDD0E, 0xFFFF, 0xFFFF, 0xFF9D, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1DD0 (7632) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1DE0 (7648) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C56, 0x0231, 0x5416,   // 0x1DF0 (7664) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE571, 0xECC2, 0xFD24, 0xFD24, 0xAC28, 0x0231,   // 0x1E00 (7680) pixels
+0x530D, 0x7329, 0x1A70, 0x1250, 0x6B2C, 0xEC86, 0xFCA5, 0xFCA5, 0xFCA5, 0xFCA5, 0xFCA5, 0xFCA5, 0xFCA5, 0xFCA5, 0xD400, 0xE442,   // 0x1E10 (7696) pixels
+0xFCA5, 0xFCA5, 0xB3E8, 0x0231, 0x3AAE, 0x52ED, 0x32AE, 0x0231, 0x0231, 0xABA8, 0xF444, 0xF444, 0xF444, 0xDC00, 0xF73B, 0xFFFF,   // 0x1E20 (7712) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000,   // 0x1E30 (7728) pixels
+0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1E40 (7744) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE75D, 0x0231, 0x0231, 0xC6BC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1E50 (7760) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEE77, 0xE461, 0xFCE4, 0xFCE4, 0xA3E9, 0x0231, 0x1250, 0x0A31, 0x3AAD, 0x0231,   // 0x1E60 (7776) pixels
+0x0231, 0x630C, 0xFC85, 0xFC85, 0xFC85, 0xFC85, 0xFC85, 0xFC85, 0xFC85, 0xEC43, 0xD400, 0xE442, 0xFCA5, 0xFCA5, 0xCC07, 0x2A8F,   // 0x1E70 (7792) pixels
+0x0231, 0x0231, 0x0231, 0x226F, 0xA389, 0xF444, 0xF444, 0xF424, 0xDC00, 0xEE77, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1E80 (7808) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF,   // 0x1E90 (7824) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1EA0 (7840) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1EB0 (7856) pixels
+0xFFFF, 0xFFFF, 0xFFDF, 0xDD2F, 0xDC21, 0xEC62, 0x93A8, 0x0231, 0x0A50, 0xCC04, 0xD400, 0x9367, 0x0231, 0x0A31, 0xFC44, 0xF444,   // 0x1EC0 (7872) pixels
+0xF444, 0xF444, 0xF444, 0xEC44, 0xE423, 0xDC89, 0xDCED, 0xDC20, 0xEC63, 0xF484, 0xF484, 0xFC84, 0xEC44, 0xE445, 0xEC24, 0xF444,   // 0x1ED0 (7888) pixels
+0xF444, 0xEC23, 0xE422, 0xDC01, 0xEE98, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1EE0 (7904) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1EF0 (7920) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1F00 (7936) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1F10 (7952) pixels
+0xF6DA, 0xE5D4, 0x9430, 0x0231, 0x3B11, 0xEE15, 0xEE15, 0xE5F5, 0x0231, 0x0231, 0xCC00, 0xD400, 0xD424, 0xDC89, 0xDD0E, 0xDD2F,   // 0x1F20 (7968) pixels
+0xE5D3, 0xFF9D, 0xFF9D, 0xF6FA, 0xE550, 0xD445, 0xD400, 0xD400, 0xD400, 0xD422, 0xDC47, 0xDCAB, 0xDD0E, 0xE550, 0xEE35, 0xFF7D,   // 0x1F30 (7984) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1F40 (8000) pixels
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1F50 (8016) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1F60 (8032) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6FD, 0x0231,   // 0x1F70 (8048) pixels
+0x0A51, 0xDF5D, 0xFFFF, 0xAE1A, 0x0231, 0x0A71, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1F80 (8064) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1F90 (8080) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1FA0 (8096) pixels
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1FB0 (8112) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1FC0 (8128) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5415, 0x0231, 0x1AD2, 0x5416, 0x0A72,   // 0x1FD0 (8144) pixels
+0x0231, 0x74D7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1FE0 (8160) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1FF0 (8176) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2000 (8192) pixels
+0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2010 (8208) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2020 (8224) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFBE, 0x5C56, 0x0231, 0x0231, 0x0231, 0x6C97, 0xF7DF, 0xFFFF, 0xFFFF,   // 0x2030 (8240) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2040 (8256) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2050 (8272) pixels
+0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2060 (8288) pixels
+0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2070 (8304) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2080 (8320) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xEFBE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2090 (8336) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x20A0 (8352) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x20B0 (8368) pixels
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF,   // 0x20C0 (8384) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x20D0 (8400) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x20E0 (8416) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x20F0 (8432) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2100 (8448) pixels
+0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2110 (8464) pixels
+};
+
+#endif
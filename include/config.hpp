@@ -2,12 +2,14 @@
 #define __CONFIG_H
 #include <Arduino.h>
 #include <ESP8266WebServer.h>
+#include "schedule.hpp"
 class Config{
 public:
     Config();
     void handle();
-    uint16_t getSleepTime();
-    uint16_t getAwakeTime();
-    uint16_t getAwakeTransition();
+    // called after the schedule was changed
+    void onChange(void (*callback)());
+    // the schedule of a day, in days since 1970-01-01 local time
+    const DaySchedule &scheduleFor(uint16_t day);
 };
 #endif
\ No newline at end of file
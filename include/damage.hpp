@@ -0,0 +1,74 @@
+#ifndef __DAMAGE_H
+#define __DAMAGE_H
+#include <Arduino.h>
+
+struct Rect {
+    int16_t x = 0, y = 0, w = 0, h = 0;
+
+    Rect() {}
+    Rect(int16_t x, int16_t y, int16_t w, int16_t h): x(x), y(y), w(w), h(h) {}
+
+    bool empty() const { return w <= 0 || h <= 0; }
+    int16_t right() const { return x + w; }  // exclusive
+    int16_t bottom() const { return y + h; } // exclusive
+
+    bool intersects(const Rect &other) const {
+        return !empty() && !other.empty()
+            && x < other.right() && other.x < right()
+            && y < other.bottom() && other.y < bottom();
+    }
+    bool contains(const Rect &other) const {
+        return !empty()
+            && other.x >= x && other.right() <= right()
+            && other.y >= y && other.bottom() <= bottom();
+    }
+    Rect intersect(const Rect &other) const {
+        const int16_t l = max(x, other.x), t = max(y, other.y);
+        const int16_t r = min(right(), other.right()), b = min(bottom(), other.bottom());
+        return r > l && b > t ? Rect(l, t, r - l, b - t) : Rect();
+    }
+    Rect unite(const Rect &other) const {
+        if (empty()) return other;
+        if (other.empty()) return *this;
+        const int16_t l = min(x, other.x), t = min(y, other.y);
+        return Rect(l, t, max(right(), other.right()) - l, max(bottom(), other.bottom()) - t);
+    }
+};
+
+// Areas of the screen that have to be repainted. Overlapping areas are
+// merged, so every pixel is only pushed once.
+class Damage {
+private:
+    static constexpr uint8_t CAPACITY = 16;
+    Rect rects[CAPACITY];
+    uint8_t count = 0;
+public:
+    void add(Rect area) {
+        if (area.empty()) {
+            return;
+        }
+        for (uint8_t i = 0; i < count;) {
+            if (rects[i].intersects(area)) {
+                // the union might overlap areas we already passed
+                area = area.unite(rects[i]);
+                rects[i] = rects[--count];
+                i = 0;
+            }
+            else {
+                i++;
+            }
+        }
+        if (count == CAPACITY) {
+            // out of room, grow the last area instead
+            count--;
+            add(area.unite(rects[count]));
+            return;
+        }
+        rects[count++] = area;
+    }
+    void clear() { count = 0; }
+    uint8_t size() const { return count; }
+    const Rect &operator[](uint8_t i) const { return rects[i]; }
+};
+
+#endif
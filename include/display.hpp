@@ -3,6 +3,43 @@
 #include <Arduino.h>
 #include <TFT_eSPI.h>
 #include <SPI.h>
+#include "mask_cache.hpp"
+#include "damage.hpp"
+#include "tile_hash.hpp"
+#include "spi_pipe.hpp"
+#include "packed_image.hpp"
+#include "text_cache.hpp"
+
+// Heap used to keep the coverage of recently drawn needle angles (0
+// disables). A needle is only rasterised when it moves, so a mask is only
+// drawn again when its angle comes back: 60 minutes later for the minute
+// needle, 12 hours for the hour needle. Holding every minute angle takes
+// ~14 KB and saves ~7000 cycles a minute, not worth the heap.
+#ifndef NEEDLE_CACHE_BYTES
+#define NEEDLE_CACHE_BYTES 0
+#endif
+// one slot for every hour needle mask (the smaller one) the budget holds
+constexpr uint8_t needleCacheSlots(uint32_t budget) {
+    return budget / 115 < 255 ? budget / 115 : 255;
+}
+// largest needle mask that can be recorded, the minute needle needs 256
+#define NEEDLE_MASK_SIZE 320
+// most face pixels a needle can cover, the minute needle covers 173
+#define NEEDLE_PIXELS 192
+
+// A needle as it is on the face: its coverage mask and, when the face is
+// kept in a sprite, the face pixels it was drawn over (in the order of the
+// mask) so it can be taken off again without repainting the whole face.
+struct DrawnNeedle {
+    bool valid = false; // mask (and pixels) are usable
+    uint32_t key;
+    uint8_t mask[NEEDLE_MASK_SIZE];
+#ifdef CLOCK_FACE_SPRITE
+    uint16_t pixels[NEEDLE_PIXELS];
+#endif
+};
+
+constexpr uint32_t PROGRESS_FULL = 1 << 16;
 
 enum State: int {
     Invalid,
@@ -11,25 +48,83 @@ enum State: int {
     WakingUp
 };
 
+// The parts of the screen, painted from the bottom up
+enum Layer: uint8_t {
+    Background,
+    Dial,
+    HourNeedle,
+    MinuteNeedle,
+    StatusPanel,  // label, paws and animal of the state
+    ProgressMask,
+    NameBanner,
+    LayerCount
+};
+
+struct LayerState {
+    Rect bounds;
+    bool dirty = false; // the whole of bounds has to be repainted
+};
+
+// where the cycles of the last flush went
+struct FrameTiming {
+    uint32_t compose = 0; // painting bands and hashing tiles
+    uint32_t spi = 0;     // the SPI bus was busy
+    uint32_t stall = 0;   // waiting for the SPI bus, the part of spi not overlapped
+};
+
 class Display {
 private:
     TFT_eSPI lcd = TFT_eSPI();  // Invoke library, pins defined in User_Setup.h
+#ifdef CLOCK_FACE_SPRITE
     TFT_eSprite face = TFT_eSprite(&lcd);
+#endif
+    TFT_eSprite band = TFT_eSprite(&lcd); // one row of tiles being composed
+    SpiPipe pipe = SpiPipe(lcd);            // the previous row going out
+    TileHashes tiles;
+    uint32_t bytesSaved = 0;
+    FrameTiming timing;
     State currentState = Invalid;
-    void plotPixel(int16_t x, int16_t y, float alpha, uint16_t color);
-    void drawWideLineAA(float ax, float ay, float bx, float by, float r, uint16_t color);
-    uint16_t lookupColor(uint16_t x, uint16_t y);
-    void drawNeedle(float angle, uint16_t length);
-    void renderFace(float hourAngle, float minuteAngle);
-    void renderEdges();
+    uint8_t currentHour = 0xFF;
+    uint8_t currentMinute = 0xFF;
+    uint32_t currentProgress = UINT32_MAX;
+    uint8_t progressWidth[3] = { 0, 0, 0 };
+    MaskCache needleCache = MaskCache(NEEDLE_CACHE_BYTES, needleCacheSlots(NEEDLE_CACHE_BYTES));
+    TextCache texts = TextCache(TEXT_CACHE_BYTES, 16); // numerals and name
+    DrawnNeedle hourNeedle;
+    DrawnNeedle minuteNeedle;
+    LayerState layers[LayerCount];
+    Damage damage;
+    Rect burst; // pushed in one window on the next flush
+    void loadNeedle(DrawnNeedle &needle, uint16_t degrees, uint16_t length);
+#ifdef CLOCK_FACE_SPRITE
+    void drawNeedle(uint16_t *pixels, uint16_t degrees, uint16_t length, DrawnNeedle &needle);
+    void restoreNeedle(uint16_t *pixels, const DrawnNeedle &needle);
+#else
+    void paintNeedle(const DrawnNeedle &needle, const Rect &clip, int16_t top);
+#endif
+    void renderFace(uint16_t hourAngle, uint16_t minuteAngle);
     void updateStatus(State newState);
-    void updateStatus(const uint16_t* img, const String &txt, uint16_t color);
-    void progressLine(uint32_t line_y, float hide_line);
-    void updateProgress(float progress);
+    void updateProgress(uint32_t progress);
     void showTime(uint8_t hour, uint8_t minute);
+
+    void invalidate(Layer layer);
+    void invalidate(const Rect &area);
+    void moveLayer(Layer layer, const Rect &bounds);
+    Rect progressBand(uint8_t band) const;
+    bool covers(Layer layer, const Rect &area) const;
+    void compose(const Rect &area);
+    void pushRows(const Rect &area);
+    void pushArea(const Rect &area, const Rect &whole);
+    void paint(Layer layer, const Rect &clip, int16_t top);
+    void paintImage(const PackedImage &image, int16_t x, int16_t y, int16_t top);
+    void paintNameBanner(int16_t top);
 public:
     Display();
-    void render(uint8_t hour, uint8_t minute, State state, float progress);
+    // progress through the sleeping or waking up count down, up to PROGRESS_FULL
+    void render(uint8_t hour, uint8_t minute, State state, uint32_t progress);
+    void flush(); // push all damaged areas to the lcd
+    uint32_t spiBytesSaved() const { return bytesSaved; } // by unchanged tiles
+    const FrameTiming &frameTiming() const { return timing; }
     void setBrightness(uint8_t brightness); // 0 = background off, 255= full
 };
 
@@ -0,0 +1,49 @@
+#ifndef __FACE_H
+#define __FACE_H
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "text_cache.hpp"
+
+#define HEX_TO_565(c) (((c & 0xf80000) >> 8) + ((c & 0xfc00) >> 5) + ((c & 0xf8) >> 3))
+
+//constexpr uint32_t CLOCK_CENTER_X = 44;
+//constexpr uint32_t CLOCK_CENTER_Y = CLOCK_CENTER_X;
+constexpr uint32_t CLOCK_RADIUS = 46;
+
+constexpr uint16_t CLOCK_COLOR_FACE = HEX_TO_565(0x004488);
+
+constexpr uint32_t HOUR_ANGLE = 360 / 12;
+constexpr uint32_t MINUTE_ANGLE = 360 / 60;
+
+constexpr uint16_t HOUR_LENGTH = CLOCK_RADIUS / 3;
+constexpr uint16_t MINUTE_LENGTH = CLOCK_RADIUS - 16;
+constexpr uint16_t NUMERAL_OFFSET = CLOCK_RADIUS - 7;
+
+// The needles point in whole degrees, clockwise from 3 o'clock. The hour
+// needle moves half a degree a minute, its 720 positions fall on 360.
+constexpr uint16_t minuteDegrees(uint8_t minute) {
+    return (270 + (MINUTE_ANGLE * minute)) % 360;
+}
+
+constexpr uint16_t hourDegrees(uint8_t hour, uint8_t minute) {
+    return (270 + (HOUR_ANGLE * (hour % 12)) + (minute / 2)) % 360;
+}
+
+// A point on the dial, Q16 for needle ends, whole pixels for numerals
+struct DialPoint {
+    int32_t x, y;
+};
+
+// Q16 end point of the HOUR_LENGTH or MINUTE_LENGTH needle, from flash.
+// The minute needle only has the minuteDegrees() angles.
+DialPoint needleEnd(uint16_t length, uint16_t degrees);
+// whole pixel centre of the numeral at position h (0 is the 3)
+DialPoint numeralCenter(uint8_t h);
+
+// Draw the hour numerals on the face in font (NotoSansBold15), through
+// cache when given. Normally tools/bake_face.py does this at build time into
+// CAT_WATCH_FACE_DIAL, with CLOCK_RUNTIME_NUMERALS it is done every frame.
+// top is the face line at the top of the sprite, for drawing in bands.
+void drawDial(const FlashFont &font, TFT_eSprite &face, int16_t top = 0, TextCache *cache = nullptr);
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef __FLASH_FONT_H
+#define __FLASH_FONT_H
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// A smooth (vlw) font drawn straight from flash. TFT_eSPI's loadFont()
+// copies the metrics of every glyph into heap tables per sprite it is
+// loaded in, this reads the glyph records where they are, and blends the
+// glyphs into sprite memory the way TFT_eSPI draws them. The fonts are cut
+// down to a few glyphs (tools/subset_fonts.py), so finding one is a short
+// scan.
+class FlashFont {
+public:
+    explicit FlashFont(const uint8_t *vlw);
+
+    int16_t height() const { return yAdvance; } // fontHeight()
+    int16_t textWidth(const char *text) const;
+    // draw text placed by datum (TL_DATUM, TC_DATUM or MC_DATUM) on x, y,
+    // blended over background, or over the pixels already there when
+    // background is the text colour (as TFT_eSprite does)
+    void draw(TFT_eSprite &sprite, const char *text, int32_t x, int32_t y, uint8_t datum,
+        uint16_t color, uint16_t background) const;
+    void draw(TFT_eSprite &sprite, const char *text, int32_t x, int32_t y, uint8_t datum, uint16_t color) const {
+        draw(sprite, text, x, y, datum, color, color);
+    }
+    // move x, y from the datum to the top left of text that is width wide
+    void place(int32_t &x, int32_t &y, uint8_t datum, int16_t width) const;
+    // the box the glyphs of text cover, from the top left of the text
+    void bounds(const char *text, int16_t &x, int16_t &y, int16_t &w, int16_t &h) const;
+    // the coverage of text in a w wide alpha mask at x, y of the text, a
+    // pixel covered by two glyphs keeps the last one like draw() does
+    void render(const char *text, uint8_t *alpha, int16_t x, int16_t y, int16_t w, int16_t h) const;
+
+private:
+    struct Glyph {
+        uint8_t height, width, xAdvance;
+        int16_t dY;
+        int8_t dX;
+        const uint8_t *bitmap;
+    };
+    const uint8_t *vlw;
+    uint16_t count, yAdvance, spaceWidth;
+    int16_t maxAscent;
+
+    bool find(uint8_t code, Glyph &glyph) const;
+    // call glyph(g, left, top) for every glyph of text from the top left
+    template<typename Visit>
+    void forEachGlyph(const char *text, Visit visit) const;
+};
+
+#endif
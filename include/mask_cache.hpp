@@ -0,0 +1,36 @@
+#ifndef __MASK_CACHE_H
+#define __MASK_CACHE_H
+#include <Arduino.h>
+
+// Least recently used cache of pre-rendered masks (byte blobs), bounded
+// by a byte budget and a number of slots. Masks live on the heap.
+class MaskCache {
+private:
+    struct Entry {
+        uint32_t key;
+        uint32_t lastUse;
+        uint16_t size;
+        uint8_t *data;
+    };
+    Entry *entries;
+    const uint8_t slots;
+    const uint32_t budget;
+    uint32_t bytes = 0;
+    uint32_t clock = 0;
+    void evict(Entry &entry);
+public:
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+
+    MaskCache(uint32_t budget, uint8_t slots);
+    ~MaskCache();
+    const uint8_t *find(uint32_t key);
+    // copies the mask into the cache, evicting the least recently used
+    // ones to stay within budget, nullptr if it can not be cached
+    const uint8_t *insert(uint32_t key, const uint8_t *data, uint16_t size);
+    // like insert, but the mask is left for the caller to fill in
+    uint8_t *reserve(uint32_t key, uint16_t size);
+    uint32_t used() const { return bytes; }
+};
+
+#endif
@@ -0,0 +1,189 @@
+#ifndef __NEEDLE_H
+#define __NEEDLE_H
+#include <Arduino.h>
+
+#define ALPHA_GAIN 1.3f  // Should be 1.0 but 1.3 looks good on my TFT
+                         // Less than 1.0 makes hands look transparent
+
+// Calculate distance of px,py to closest part of line ax,ay .... bx,by
+float lineDistance(float px, float py, float ax, float ay, float bx, float by);
+
+// Anti aliased line ax,ay to bx,by, (2 * r) wide with rounded ends
+// Calls plot(x, y, alpha) for every pixel in the bounding box of the line.
+// This is the original float version, the ESP8266 has no FPU so it is only
+// kept as a reference for WideLineAA.
+template<typename Plot>
+void drawWideLineAAFloat(float ax, float ay, float bx, float by, float r, Plot plot) {
+    int16_t x0 = (int16_t)floorf(fminf(ax, bx) - r);
+    int16_t x1 = (int16_t) ceilf(fmaxf(ax, bx) + r);
+    int16_t y0 = (int16_t)floorf(fminf(ay, by) - r);
+    int16_t y1 = (int16_t) ceilf(fmaxf(ay, by) + r);
+
+    for (int y = y0; y <= y1; y++) {
+        for (int x = x0; x <= x1; x++) {
+            float alpha = fmaxf(fminf(0.5f - (lineDistance(x, y, ax, ay, bx, by) - r), 1.0f), 0.0f);
+            alpha = alpha * ALPHA_GAIN * 255;
+            if (alpha > 255) alpha = 255;
+            plot(x, y, (uint8_t)alpha);
+        }
+    }
+}
+
+// Fixed point version of drawWideLineAAFloat, gives the same alpha to
+// within one LSB. Coordinates are converted to Q16 once, after that the
+// distance along (s) and across (c) the line are stepped per pixel with
+// integer adds. Only the pixels on the rounded ends need a square root.
+// Supports a radius up to 10 pixels.
+class WideLineAA {
+private:
+    int32_t ax, ay;     // start, Q16
+    int32_t bx, by;     // end, Q16
+    int32_t ux, uy;     // unit direction, Q16
+    int32_t length;     // Q16
+    int32_t outer;      // r + 0.5, Q16
+    int32_t slope;      // x step of the centre line per row, Q16
+    uint8_t alpha(int32_t s, int32_t c) const;
+    int16_t seed(int32_t y) const;
+    WideLineAA() = default;
+    void setup(int32_t ax, int32_t ay, int32_t bx, int32_t by, int32_t r16);
+public:
+    int16_t x0, y0, x1, y1; // bounding box, inclusive
+    WideLineAA(float ax, float ay, float bx, float by, float r);
+    // the same line from Q16 coordinates and radius, for tabled end points
+    static WideLineAA fromQ16(int32_t ax, int32_t ay, int32_t bx, int32_t by, int32_t r);
+
+    template<typename Plot>
+    void draw(Plot plot) const {
+        for (int32_t y = y0; y <= y1; y++) {
+            const int32_t pax = ((int32_t)x0 << 16) - ax;
+            const int32_t pay = (y << 16) - ay;
+            int32_t s = (((int64_t)pax * ux) + ((int64_t)pay * uy)) >> 16;
+            int32_t c = (((int64_t)pax * uy) - ((int64_t)pay * ux)) >> 16;
+            for (int32_t x = x0; x <= x1; x++) {
+                plot(x, y, alpha(s, c));
+                s += ux;
+                c += uy;
+            }
+        }
+    }
+
+    // Same result as draw, but per row only the pixels with a non zero
+    // alpha are visited: solid(x, y, w) gets the run of fully covered
+    // pixels, plot(x, y, alpha) the anti aliased edge pixels around it.
+    // The edges are tracked from row to row, so the inside of the needle is
+    // never sampled.
+    template<typename Solid, typename Plot>
+    void drawSpans(Solid solid, Plot plot) const {
+        int32_t left = x1, right = x0;
+        for (int32_t y = y0; y <= y1; y++) {
+            const int32_t pay = (y << 16) - ay;
+            const int32_t pax = ((int32_t)x0 << 16) - ax;
+            const int32_t rowS = (((int64_t)pax * ux) + ((int64_t)pay * uy)) >> 16;
+            const int32_t rowC = (((int64_t)pax * uy) - ((int64_t)pay * ux)) >> 16;
+            auto at = [&](int32_t x) {
+                return alpha(rowS + ((x - x0) * ux), rowC + ((x - x0) * uy));
+            };
+
+            int32_t inside = seed(y);
+            if (at(inside) == 0) {
+                // only happens beyond the rounded ends
+                inside = x0;
+                while (inside <= x1 && at(inside) == 0) {
+                    inside++;
+                }
+                if (inside > x1) {
+                    continue;
+                }
+            }
+
+            left = min(left, inside);
+            if (at(left) == 0) {
+                while (at(left) == 0) left++;
+            }
+            else {
+                while (left > x0 && at(left - 1) != 0) left--;
+            }
+            right = max(right, inside);
+            if (at(right) == 0) {
+                while (at(right) == 0) right--;
+            }
+            else {
+                while (right < x1 && at(right + 1) != 0) right++;
+            }
+
+            int32_t start = left;
+            uint8_t a;
+            while (start <= right && (a = at(start)) != 255) {
+                plot(start, y, a);
+                start++;
+            }
+            if (start > right) {
+                continue;
+            }
+            int32_t end = right;
+            while ((a = at(end)) != 255) {
+                plot(end, y, a);
+                end--;
+            }
+            solid(start, y, end - start + 1);
+        }
+    }
+};
+
+// The coverage of a needle as recorded from WideLineAA::drawSpans, so it
+// can be drawn again without rasterising. Layout: the bounding box (4 x
+// int16), the number of rows, then per row: dy, dx, the length of the left
+// edge, the solid run and the right edge, followed by the edge alphas.
+class NeedleMask {
+private:
+    const uint8_t *data;
+    int16_t read16(uint8_t offset) const {
+        return (int16_t)(data[offset] | (data[offset + 1] << 8));
+    }
+public:
+    static constexpr uint8_t HEADER = 9;
+
+    explicit NeedleMask(const uint8_t *data): data(data) {}
+    // returns the size of the mask, 0 if it did not fit in capacity
+    static uint16_t record(const WideLineAA &line, uint8_t *out, uint16_t capacity);
+
+    int16_t x0() const { return read16(0); }
+    int16_t y0() const { return read16(2); }
+    int16_t x1() const { return read16(4); }
+    int16_t y1() const { return read16(6); }
+
+    // bytes taken by the recorded mask
+    uint16_t size() const {
+        const uint8_t *row = data + HEADER;
+        for (uint8_t r = data[8]; r > 0; r--) {
+            row += 5 + row[2] + row[4];
+        }
+        return row - data;
+    }
+
+    // same calls as the WideLineAA::drawSpans it was recorded from
+    template<typename Solid, typename Plot>
+    void drawSpans(Solid solid, Plot plot) const {
+        const int16_t left = x0(), top = y0();
+        const uint8_t *row = data + HEADER;
+        for (uint8_t r = data[8]; r > 0; r--) {
+            const int16_t y = top + row[0];
+            int16_t x = left + row[1];
+            const uint8_t edge = row[2], run = row[3], right = row[4];
+            const uint8_t *alpha = row + 5;
+            for (uint8_t i = 0; i < edge; i++) {
+                plot(x++, y, *alpha++);
+            }
+            if (run) {
+                solid(x, y, run);
+                x += run;
+            }
+            for (uint8_t i = 0; i < right; i++) {
+                plot(x++, y, *alpha++);
+            }
+            row = alpha;
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,912 @@
+// Generated by   : tools/convert_images.py, do not edit
+// Generated from : assets/NotoFox64-flatten.png, assets/NotoFrog64-flatten.png, assets/NotoGiraffe64-flatten.png, assets/cat-paw.png, assets/cat-watch-face.png
+// Memory usage   : 14014 bytes
+
+#ifndef __PACKED_IMAGES_H
+#define __PACKED_IMAGES_H
+#if defined(__AVR__)
+    #include <avr/pgmspace.h>
+#elif defined(__PIC32MX__)
+    #define PROGMEM
+#elif defined(__arm__)
+    #define PROGMEM
+#endif
+#include "packed_image.hpp"
+
+// NotoFox64: 64x64 rle565, 3105 bytes of flash
+static const uint8_t NotoFox64_PACKED_DATA[2977] PROGMEM = {
+0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x08, 0x00, 0xB2, 0x00, 0x00, 0x00,
+0x08, 0x00, 0x83, 0x00, 0x00, 0x83, 0x00, 0x00, 0x03, 0xC1, 0xE1, 0xCA, 0x02, 0x91, 0x81, 0x20,
+0x60, 0xAC, 0x00, 0x00, 0x03, 0x20, 0x60, 0x91, 0x81, 0xCA, 0x01, 0xC2, 0x02, 0x83, 0x00, 0x00,
+0x82, 0x00, 0x00, 0x00, 0x08, 0x20, 0x81, 0xC9, 0xE1, 0x02, 0xD2, 0x01, 0xC2, 0x02, 0x61, 0x01,
+0xA8, 0x00, 0x00, 0x02, 0x69, 0x21, 0xC1, 0xE1, 0xCA, 0x01, 0x80, 0xC9, 0xE1, 0x00, 0xD2, 0x01,
+0x83, 0x00, 0x00, 0x82, 0x00, 0x00, 0x04, 0x58, 0xE1, 0xC9, 0xE1, 0xEA, 0xA3, 0xF2, 0xA3, 0xDA,
+0x42, 0x80, 0xC9, 0xE1, 0x02, 0xD2, 0x01, 0x81, 0x61, 0x08, 0x20, 0xA2, 0x00, 0x00, 0x09, 0x08,
+0x00, 0x81, 0x61, 0xCA, 0x01, 0xC9, 0xE1, 0xCA, 0x01, 0xE2, 0x42, 0xF2, 0xA3, 0xEA, 0x62, 0xC9,
+0xE1, 0x38, 0xA0, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x02, 0x91, 0x81, 0xC9, 0xE1, 0xFA, 0xC3,
+0x80, 0xFA, 0xE4, 0x05, 0xFA, 0xE3, 0xE2, 0x62, 0xD2, 0x01, 0xC9, 0xE1, 0xD2, 0x01, 0x79, 0x41,
+0xA0, 0x00, 0x00, 0x04, 0x81, 0x61, 0xD2, 0x01, 0xC9, 0xE1, 0xD2, 0x01, 0xEA, 0x82, 0x81, 0xFA,
+0xE4, 0x02, 0xF2, 0xA3, 0xC9, 0xE1, 0x81, 0x61, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x0C, 0xB1,
+0xC1, 0xD2, 0x01, 0xFA, 0xE4, 0xDA, 0x43, 0xD2, 0x22, 0xFA, 0xC4, 0xFA, 0xE4, 0xFA, 0xE3, 0xEA,
+0x82, 0xD2, 0x01, 0xC9, 0xE1, 0xCA, 0x02, 0x50, 0xE1, 0x9C, 0x00, 0x00, 0x04, 0x58, 0xE1, 0xCA,
+0x01, 0xC9, 0xE1, 0xD2, 0x21, 0xEA, 0x83, 0x80, 0xFA, 0xE4, 0x05, 0xFA, 0xC3, 0xD2, 0x22, 0xDA,
+0x43, 0xFA, 0xE4, 0xC9, 0xE1, 0xA9, 0xC1, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x07, 0xC1, 0xE1,
+0xDA, 0x21, 0xFA, 0xE4, 0xA9, 0x81, 0x88, 0xE0, 0x89, 0x00, 0xB9, 0xC2, 0xEA, 0xA3, 0x80, 0xFA,
+0xE4, 0x00, 0xE2, 0x62, 0x80, 0xCA, 0x01, 0x01, 0xB1, 0xE2, 0x08, 0x00, 0x98, 0x00, 0x00, 0x04,
+0x08, 0x20, 0xB1, 0xC1, 0xC9, 0xE1, 0xD2, 0x01, 0xEA, 0x83, 0x80, 0xFA, 0xE4, 0x07, 0xEA, 0xA3,
+0xB9, 0xC2, 0x89, 0x00, 0x88, 0xE0, 0xA9, 0x81, 0xFA, 0xE4, 0xD2, 0x01, 0xC1, 0xE1, 0x82, 0x00,
+0x00, 0x82, 0x00, 0x00, 0x03, 0xCA, 0x01, 0xDA, 0x42, 0xFA, 0xE4, 0x99, 0x41, 0x82, 0x88, 0xE0,
+0x07, 0xB1, 0xA1, 0xF2, 0xA3, 0xFA, 0xE4, 0xFA, 0xC3, 0xDA, 0x42, 0xC9, 0xE1, 0xCA, 0x02, 0x28,
+0x60, 0x96, 0x00, 0x00, 0x07, 0x30, 0x80, 0xCA, 0x01, 0xC9, 0xE1, 0xE2, 0x42, 0xFA, 0xE3, 0xFA,
+0xE4, 0xF2, 0xA3, 0xB1, 0xA1, 0x82, 0x88, 0xE0, 0x03, 0x99, 0x41, 0xFA, 0xE4, 0xD2, 0x21, 0xCA,
+0x01, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x02, 0xC9, 0xE1, 0xE2, 0x62, 0xFA, 0xE4, 0x84, 0x88,
+0xE0, 0x01, 0x89, 0x00, 0xD2, 0x22, 0x80, 0xFA, 0xE4, 0x03, 0xEA, 0x82, 0xC9, 0xE1, 0xD2, 0x21,
+0x48, 0xC1, 0x94, 0x00, 0x00, 0x00, 0x50, 0xE1, 0x80, 0xD2, 0x01, 0x00, 0xF2, 0xA3, 0x80, 0xFA,
+0xE4, 0x01, 0xCA, 0x22, 0x89, 0x00, 0x83, 0x88, 0xE0, 0x03, 0x89, 0x00, 0xFA, 0xE4, 0xDA, 0x42,
+0xD2, 0x01, 0x82, 0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x18, 0x40, 0xC9, 0xE1, 0xEA, 0x82, 0xF2,
+0xC3, 0x86, 0x88, 0xE0, 0x00, 0xB1, 0xA2, 0x80, 0xFA, 0xE4, 0x03, 0xF2, 0xA3, 0xCA, 0x01, 0xD2,
+0x01, 0x38, 0xA0, 0x84, 0x00, 0x00, 0x06, 0x08, 0x20, 0x10, 0x20, 0x20, 0x60, 0x28, 0x80, 0x20,
+0x60, 0x10, 0x40, 0x08, 0x00, 0x85, 0x00, 0x00, 0x03, 0x48, 0xC0, 0xCA, 0x01, 0xD2, 0x01, 0xF2,
+0xC3, 0x80, 0xFA, 0xE4, 0x00, 0xB1, 0xA2, 0x86, 0x88, 0xE0, 0x02, 0xF2, 0xC3, 0xE2, 0x62, 0xD2,
+0x01, 0x82, 0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x30, 0x80, 0xC9, 0xE1, 0xEA, 0x83, 0xF2, 0xA3,
+0x87, 0x88, 0xE0, 0x00, 0xB9, 0xC2, 0x80, 0xFA, 0xE4, 0x07, 0xF2, 0xA3, 0xC9, 0xE1, 0xD2, 0x01,
+0x10, 0x40, 0x50, 0xE1, 0x99, 0xA1, 0xB9, 0xE1, 0xCA, 0x01, 0x80, 0xD2, 0x01, 0x83, 0xC9, 0xE1,
+0x00, 0xCA, 0x01, 0x80, 0xD2, 0x01, 0x07, 0xC1, 0xE1, 0xA1, 0xC1, 0x79, 0x41, 0x20, 0x60, 0x10,
+0x40, 0xCA, 0x01, 0xD2, 0x01, 0xFA, 0xC3, 0x80, 0xFA, 0xE4, 0x00, 0xB9, 0xC2, 0x87, 0x88, 0xE0,
+0x03, 0xF2, 0xA3, 0xE2, 0x62, 0xC9, 0xE1, 0x10, 0x20, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x03,
+0x30, 0x80, 0xC9, 0xE1, 0xEA, 0xA3, 0xF2, 0xA3, 0x88, 0x88, 0xE0, 0x00, 0xE2, 0x63, 0x80, 0xFA,
+0xE4, 0x02, 0xEA, 0x83, 0xC9, 0xE1, 0xD2, 0x01, 0x81, 0xC9, 0xE1, 0x02, 0xD2, 0x21, 0xDA, 0x42,
+0xE2, 0x42, 0x84, 0xE2, 0x62, 0x02, 0xDA, 0x42, 0xDA, 0x22, 0xD2, 0x01, 0x81, 0xC9, 0xE1, 0x02,
+0xD2, 0x01, 0xC9, 0xE1, 0xF2, 0xA3, 0x80, 0xFA, 0xE4, 0x00, 0xE2, 0x63, 0x88, 0x88, 0xE0, 0x03,
+0xF2, 0xA3, 0xE2, 0x62, 0xC9, 0xE1, 0x10, 0x20, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x28,
+0x60, 0xC9, 0xE1, 0xEA, 0xA3, 0xFA, 0xC3, 0x88, 0x88, 0xE0, 0x00, 0xB9, 0xC2, 0x81, 0xFA, 0xE4,
+0x03, 0xEA, 0x82, 0xDA, 0x42, 0xEA, 0x82, 0xF2, 0xC3, 0x8B, 0xFA, 0xE4, 0x04, 0xFA, 0xC3, 0xF2,
+0xA3, 0xE2, 0x62, 0xDA, 0x22, 0xEA, 0xA3, 0x81, 0xFA, 0xE4, 0x00, 0xB1, 0xA1, 0x88, 0x88, 0xE0,
+0x03, 0xFA, 0xC3, 0xE2, 0x62, 0xC9, 0xE1, 0x10, 0x20, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x04,
+0x20, 0x40, 0xC9, 0xE1, 0xEA, 0x83, 0xFA, 0xE4, 0x91, 0x01, 0x86, 0x88, 0xE0, 0x01, 0xB9, 0xC2,
+0xFA, 0xC3, 0x9A, 0xFA, 0xE4, 0x01, 0xEA, 0xA3, 0xB1, 0x81, 0x86, 0x88, 0xE0, 0x04, 0x91, 0x20,
+0xFA, 0xE4, 0xE2, 0x62, 0xC9, 0xE1, 0x08, 0x00, 0x81, 0x00, 0x00, 0x82, 0x00, 0x00, 0x03, 0xC9,
+0xE1, 0xEA, 0x62, 0xFA, 0xE4, 0xA9, 0x81, 0x84, 0x88, 0xE0, 0x01, 0x99, 0x41, 0xEA, 0xA3, 0x9E,
+0xFA, 0xE4, 0x01, 0xD2, 0x42, 0x89, 0x00, 0x84, 0x88, 0xE0, 0x03, 0xB1, 0x81, 0xFA, 0xE4, 0xDA,
+0x42, 0xD2, 0x01, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x03, 0xC9, 0xE1, 0xE2, 0x42, 0xFA, 0xE4,
+0xDA, 0x43, 0x83, 0x88, 0xE0, 0x01, 0xB1, 0x81, 0xFA, 0xC3, 0xA0, 0xFA, 0xE4, 0x01, 0xEA, 0xA3,
+0x99, 0x41, 0x83, 0x88, 0xE0, 0x03, 0xDA, 0x43, 0xFA, 0xE4, 0xD2, 0x21, 0xCA, 0x01, 0x82, 0x00,
+0x00, 0x82, 0x00, 0x00, 0x01, 0xC1, 0xE1, 0xD2, 0x21, 0x80, 0xFA, 0xE4, 0x00, 0xA9, 0x81, 0x81,
+0x88, 0xE0, 0x00, 0xB1, 0xA1, 0xA3, 0xFA, 0xE4, 0x01, 0xF2, 0xC3, 0xA1, 0x41, 0x81, 0x88, 0xE0,
+0x00, 0xA9, 0x61, 0x80, 0xFA, 0xE4, 0x01, 0xCA, 0x01, 0xB9, 0xE1, 0x82, 0x00, 0x00, 0x82, 0x00,
+0x00, 0x07, 0x99, 0x81, 0xC9, 0xE1, 0xFA, 0xE3, 0xFA, 0xE4, 0xF2, 0xC3, 0x99, 0x21, 0x88, 0xE0,
+0xB1, 0x81, 0xA5, 0xFA, 0xE4, 0x08, 0xF2, 0xC3, 0x99, 0x41, 0x88, 0xE0, 0x99, 0x21, 0xF2, 0xC3,
+0xFA, 0xE4, 0xF2, 0xA3, 0xC9, 0xE1, 0x89, 0x61, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x02, 0x40,
+0xA0, 0xC9, 0xE1, 0xEA, 0x83, 0x80, 0xFA, 0xE4, 0x02, 0xF2, 0xA3, 0xB1, 0xA1, 0xFA, 0xC3, 0xA6,
+0xFA, 0xE3, 0x02, 0xEA, 0xA3, 0xA9, 0x61, 0xF2, 0xA3, 0x80, 0xFA, 0xE4, 0x02, 0xE2, 0x62, 0xC9,
+0xE1, 0x28, 0x60, 0x82, 0x00, 0x00, 0x83, 0x00, 0x00, 0x01, 0xC9, 0xE1, 0xD2, 0x21, 0x82, 0xFA,
+0xE4, 0xA9, 0xFA, 0xE3, 0x81, 0xFA, 0xE4, 0x01, 0xD2, 0x01, 0xC2, 0x01, 0x83, 0x00, 0x00, 0x83,
+0x00, 0x00, 0x02, 0x61, 0x01, 0xC9, 0xE1, 0xEA, 0x62, 0x80, 0xFA, 0xE4, 0xAA, 0xF2, 0xC3, 0x80,
+0xFA, 0xE4, 0x02, 0xDA, 0x42, 0xC9, 0xE1, 0x48, 0xC1, 0x83, 0x00, 0x00, 0x84, 0x00, 0x00, 0x02,
+0xB1, 0xC1, 0xC9, 0xE1, 0xEA, 0x83, 0xAB, 0xF2, 0xC3, 0x03, 0xF2, 0xC4, 0xE2, 0x62, 0xC9, 0xE1,
+0xA1, 0xA1, 0x84, 0x00, 0x00, 0x84, 0x00, 0x00, 0x03, 0x08, 0x00, 0xB9, 0xE1, 0xC9, 0xE1, 0xEA,
+0xA3, 0xAA, 0xF2, 0xC3, 0x02, 0xE2, 0x83, 0xC9, 0xE1, 0xB9, 0xE1, 0x85, 0x00, 0x00, 0x85, 0x00,
+0x00, 0x02, 0x89, 0x61, 0xC9, 0xE1, 0xE2, 0x83, 0xAA, 0xF2, 0xC3, 0x02, 0xE2, 0x62, 0xC9, 0xE1,
+0x58, 0xE1, 0x85, 0x00, 0x00, 0x84, 0x00, 0x00, 0x02, 0x28, 0x60, 0xC9, 0xE1, 0xD2, 0x21, 0xAB,
+0xEA, 0xC3, 0x03, 0xEA, 0xA3, 0xD2, 0x01, 0xCA, 0x01, 0x10, 0x20, 0x84, 0x00, 0x00, 0x84, 0x00,
+0x00, 0x02, 0xC1, 0xE1, 0xC9, 0xE1, 0xEA, 0x83, 0xAC, 0xEA, 0xA3, 0x02, 0xE2, 0x83, 0xC9, 0xE1,
+0xB1, 0xC1, 0x84, 0x00, 0x00, 0x83, 0x00, 0x00, 0x02, 0x89, 0x81, 0xC9, 0xE1, 0xDA, 0x62, 0xAE,
+0xEA, 0xA3, 0x02, 0xDA, 0x42, 0xC9, 0xE1, 0x71, 0x21, 0x83, 0x00, 0x00, 0x82, 0x00, 0x00, 0x02,
+0x40, 0xA0, 0xC9, 0xE1, 0xD2, 0x22, 0xB0, 0xEA, 0xA3, 0x02, 0xD2, 0x01, 0xCA, 0x01, 0x28, 0x60,
+0x82, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x10, 0x20, 0x80, 0xCA, 0x01, 0x00, 0xE2, 0x83, 0x84,
+0xEA, 0xA3, 0x04, 0xE2, 0xA3, 0xE2, 0x83, 0xDA, 0x42, 0xD2, 0x21, 0xD2, 0x01, 0x80, 0xC9, 0xE1,
+0x03, 0xCA, 0x01, 0xD2, 0x01, 0xDA, 0x42, 0xE2, 0x83, 0x8E, 0xEA, 0xA3, 0x02, 0xDA, 0x62, 0xD2,
+0x22, 0xD2, 0x01, 0x80, 0xC9, 0xE1, 0x04, 0xCA, 0x01, 0xD2, 0x01, 0xD2, 0x42, 0xDA, 0x62, 0xE2,
+0x83, 0x85, 0xEA, 0xA3, 0x02, 0xE2, 0x83, 0xC9, 0xE1, 0xC2, 0x01, 0x82, 0x00, 0x00, 0x81, 0x00,
+0x00, 0x02, 0xB1, 0xC1, 0xC9, 0xE1, 0xDA, 0x62, 0x83, 0xE2, 0xA3, 0x02, 0xE2, 0x63, 0xD2, 0x22,
+0xCA, 0x01, 0x80, 0xC9, 0xE1, 0x05, 0xD2, 0x63, 0xDB, 0x26, 0xDB, 0xA8, 0xDB, 0xA9, 0xDB, 0x47,
+0xD2, 0x63, 0x80, 0xC9, 0xE1, 0x00, 0xDA, 0x42, 0x8B, 0xE2, 0xA3, 0x09, 0xE2, 0x83, 0xD2, 0x01,
+0xC9, 0xE1, 0xCA, 0x01, 0xDB, 0x06, 0xDB, 0xA8, 0xDB, 0xA9, 0xDB, 0x47, 0xD2, 0xA4, 0xCA, 0x01,
+0x80, 0xC9, 0xE1, 0x01, 0xD2, 0x21, 0xDA, 0x62, 0x84, 0xE2, 0xA3, 0x02, 0xDA, 0x42, 0xC9, 0xE1,
+0xA1, 0xA1, 0x81, 0x00, 0x00, 0x80, 0x00, 0x00, 0x0D, 0x81, 0x61, 0xC9, 0xE1, 0xCA, 0x01, 0xDA,
+0x42, 0xDA, 0x62, 0xE2, 0x83, 0xE2, 0xA3, 0xDA, 0x62, 0xD2, 0x01, 0xC9, 0xE1, 0xCA, 0x01, 0xDB,
+0x47, 0xED, 0x50, 0xFF, 0x7A, 0x84, 0xFF, 0xDC, 0x04, 0xF6, 0xD7, 0xDB, 0x26, 0xC9, 0xE1, 0xD2,
+0x01, 0xE2, 0x83, 0x88, 0xE2, 0xA3, 0x00, 0xE2, 0x83, 0x80, 0xCA, 0x01, 0x01, 0xEC, 0xCE, 0xFF,
+0xBB, 0x83, 0xFF, 0xDC, 0x03, 0xFF, 0xBB, 0xF6, 0x34, 0xE3, 0xEA, 0xD2, 0x42, 0x80, 0xC9, 0xE1,
+0x05, 0xD2, 0x22, 0xE2, 0x83, 0xE2, 0xA3, 0xE2, 0x83, 0xDA, 0x62, 0xDA, 0x42, 0x80, 0xC9, 0xE1,
+0x00, 0x69, 0x21, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x08, 0x00, 0xB9, 0xC1, 0x82, 0xC9, 0xE1,
+0x80, 0xCA, 0x01, 0x03, 0xC9, 0xE1, 0xD2, 0x43, 0xE4, 0x8D, 0xFF, 0x7A, 0x89, 0xFF, 0xDC, 0x02,
+0xE4, 0xAD, 0xC9, 0xE1, 0xD2, 0x22, 0x88, 0xE2, 0x83, 0x02, 0xCA, 0x01, 0xCA, 0x22, 0xF6, 0xB6,
+0x89, 0xFF, 0xDC, 0x04, 0xF5, 0xF3, 0xDB, 0x26, 0xCA, 0x01, 0xC9, 0xE1, 0xD2, 0x21, 0x82, 0xC9,
+0xE1, 0x01, 0xC1, 0xE1, 0xA1, 0xA1, 0x80, 0x00, 0x00, 0x83, 0x00, 0x00, 0x05, 0x20, 0x60, 0xCA,
+0x42, 0xC9, 0xE1, 0xD2, 0x42, 0xED, 0x50, 0xFF, 0xBC, 0x8C, 0xFF, 0xDC, 0x02, 0xE4, 0x0B, 0xC9,
+0xE1, 0xDA, 0x42, 0x86, 0xE2, 0x83, 0x02, 0xD2, 0x22, 0xC9, 0xE1, 0xF6, 0x14, 0x8C, 0xFF, 0xDC,
+0x05, 0xFF, 0x39, 0xDB, 0xA9, 0xCA, 0x01, 0xC9, 0xE1, 0xBA, 0x64, 0x08, 0x20, 0x83, 0x00, 0x00,
+0x82, 0x00, 0x00, 0x04, 0x18, 0x60, 0xCA, 0x43, 0xCA, 0x01, 0xDC, 0xAD, 0xFF, 0xBC, 0x83, 0xFF,
+0xDC, 0x06, 0xE6, 0xF9, 0x94, 0x70, 0x73, 0x8C, 0x63, 0x0B, 0x84, 0x0E, 0xC5, 0xF5, 0xFF, 0xBC,
+0x82, 0xFF, 0xDC, 0x02, 0xFF, 0xBC, 0xD2, 0x84, 0xC9, 0xE1, 0x85, 0xDA, 0x83, 0x02, 0xDA, 0x63,
+0xC9, 0xE1, 0xE3, 0xEA, 0x83, 0xFF, 0xDC, 0x06, 0xFF, 0xBC, 0xC6, 0x15, 0x84, 0x0E, 0x63, 0x2B,
+0x73, 0x8C, 0x8C, 0x4F, 0xDE, 0xB8, 0x83, 0xFF, 0xDC, 0x03, 0xFF, 0x39, 0xD3, 0x47, 0xC9, 0xE1,
+0xBA, 0x43, 0x83, 0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x28, 0x80, 0xCA, 0x22, 0xD3, 0x27, 0xE6,
+0xB7, 0x84, 0xFF, 0xDC, 0x01, 0xA5, 0x12, 0x00, 0x20, 0x83, 0x00, 0x00, 0x01, 0x29, 0x44, 0xB5,
+0x94, 0x82, 0xFF, 0xDC, 0x02, 0xF6, 0x75, 0xC9, 0xE1, 0xD2, 0x22, 0x84, 0xDA, 0x83, 0x02, 0xD2,
+0x01, 0xD2, 0x22, 0xFF, 0x9B, 0x82, 0xFF, 0xDC, 0x01, 0xBD, 0xB4, 0x29, 0x44, 0x84, 0x00, 0x00,
+0x00, 0x9C, 0xD1, 0x84, 0xFF, 0xDC, 0x03, 0xDD, 0xD3, 0xCA, 0x84, 0xC2, 0x22, 0x10, 0x40, 0x81,
+0x00, 0x00, 0x80, 0x00, 0x00, 0x03, 0x30, 0xA0, 0xC2, 0x63, 0xD5, 0x30, 0xEF, 0x18, 0x85, 0xFF,
+0xDC, 0x00, 0x52, 0x89, 0x86, 0x00, 0x00, 0x00, 0x8C, 0x2F, 0x82, 0xFF, 0xDC, 0x01, 0xDB, 0x06,
+0xC9, 0xE1, 0x83, 0xDA, 0x83, 0x02, 0xDA, 0x63, 0xC9, 0xE1, 0xE4, 0x4C, 0x82, 0xFF, 0xDC, 0x00,
+0x8C, 0x4F, 0x86, 0x00, 0x00, 0x00, 0x52, 0x68, 0x84, 0xFF, 0xDC, 0x04, 0xFF, 0xBB, 0xDE, 0x97,
+0xCC, 0xAE, 0xBA, 0x22, 0x20, 0x60, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x08, 0x20, 0xA3, 0x69,
+0xCE, 0x35, 0xEE, 0xF8, 0x86, 0xFF, 0xDC, 0x04, 0xD6, 0x57, 0x5A, 0xC9, 0x5A, 0xCA, 0x52, 0x89,
+0x29, 0x65, 0x83, 0x00, 0x00, 0x00, 0x94, 0x90, 0x81, 0xFF, 0xDC, 0x02, 0xF6, 0x55, 0xC9, 0xE1,
+0xD2, 0x42, 0x82, 0xDA, 0x83, 0x02, 0xD2, 0x22, 0xCA, 0x01, 0xFF, 0x7A, 0x81, 0xFF, 0xDC, 0x00,
+0x9C, 0xD1, 0x83, 0x00, 0x00, 0x01, 0x29, 0x24, 0x4A, 0x68, 0x80, 0x52, 0x89, 0x00, 0xD6, 0x77,
+0x85, 0xFF, 0xDC, 0x05, 0xFF, 0xBC, 0xDE, 0xB7, 0xCE, 0x14, 0x9A, 0xE7, 0x00, 0x20, 0x00, 0x00,
+0x04, 0x00, 0x00, 0x08, 0x41, 0xBD, 0x93, 0xD6, 0x56, 0xFF, 0xBC, 0x8B, 0xFF, 0xDC, 0x02, 0xE6,
+0xF8, 0x73, 0xAD, 0x08, 0x40, 0x80, 0x00, 0x00, 0x01, 0x08, 0x61, 0xEF, 0x5A, 0x81, 0xFF, 0xDC,
+0x01, 0xD2, 0x63, 0xCA, 0x01, 0x81, 0xDA, 0x83, 0x02, 0xDA, 0x63, 0xC9, 0xE1, 0xDB, 0x26, 0x81,
+0xFF, 0xDC, 0x01, 0xF7, 0x5A, 0x10, 0x82, 0x80, 0x00, 0x00, 0x02, 0x08, 0x40, 0x73, 0x8C, 0xDE,
+0xD8, 0x8B, 0xFF, 0xDC, 0x04, 0xFF, 0xBC, 0xD6, 0x56, 0xC5, 0xD4, 0x08, 0x61, 0x00, 0x00, 0x80,
+0x00, 0x00, 0x02, 0x39, 0xC6, 0xCE, 0x35, 0xE6, 0xF8, 0x8D, 0xFF, 0xDC, 0x01, 0xD6, 0x97, 0x29,
+0x24, 0x80, 0x00, 0x00, 0x00, 0xCE, 0x36, 0x81, 0xFF, 0xDC, 0x02, 0xE4, 0x6C, 0xC9, 0xE1, 0xD2,
+0x42, 0x80, 0xD2, 0x63, 0x02, 0xD2, 0x42, 0xC9, 0xE1, 0xED, 0xD2, 0x81, 0xFF, 0xDC, 0x00, 0xCE,
+0x36, 0x80, 0x00, 0x00, 0x01, 0x21, 0x24, 0xD6, 0x97, 0x8D, 0xFF, 0xDC, 0x02, 0xEF, 0x19, 0xCE,
+0x35, 0x4A, 0x48, 0x80, 0x00, 0x00, 0x81, 0x00, 0x00, 0x02, 0x7B, 0xAC, 0xCE, 0x35, 0xF7, 0x5A,
+0x8D, 0xFF, 0xDC, 0x03, 0xE7, 0x19, 0x5A, 0xA9, 0x73, 0x8C, 0xFF, 0xBB, 0x81, 0xFF, 0xDC, 0x02,
+0xFF, 0x5A, 0xC9, 0xE1, 0xD2, 0x22, 0x80, 0xD2, 0x63, 0x01, 0xCA, 0x01, 0xCA, 0x22, 0x82, 0xFF,
+0xDC, 0x03, 0xFF, 0xBB, 0x6B, 0x4B, 0x52, 0x89, 0xE7, 0x19, 0x8D, 0xFF, 0xDC, 0x02, 0xF7, 0x9B,
+0xCE, 0x35, 0x94, 0x6F, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x08, 0x40, 0xAD, 0x31, 0xD6,
+0x35, 0xFF, 0x9B, 0x94, 0xFF, 0xDC, 0x01, 0xD2, 0xA4, 0xCA, 0x01, 0x80, 0xD2, 0x63, 0x01, 0xC9,
+0xE1, 0xDB, 0x47, 0x94, 0xFF, 0xDC, 0x03, 0xFF, 0xBB, 0xD6, 0x56, 0xBD, 0xB3, 0x10, 0xA2, 0x81,
+0x00, 0x00, 0x82, 0x00, 0x00, 0x03, 0x18, 0xC2, 0xC5, 0xD4, 0xD6, 0x76, 0xFF, 0xBB, 0x93, 0xFF,
+0xBC, 0x05, 0xE4, 0x4B, 0xC9, 0xE1, 0xD2, 0x43, 0xD2, 0x42, 0xC9, 0xE1, 0xED, 0x50, 0x94, 0xFF,
+0xBC, 0x02, 0xDE, 0xB7, 0xCE, 0x35, 0x31, 0x85, 0x82, 0x00, 0x00, 0x83, 0x00, 0x00, 0x03, 0x31,
+0x65, 0xCE, 0x15, 0xDE, 0xB7, 0xFF, 0xBB, 0x92, 0xFF, 0xBC, 0x01, 0xF6, 0xD7, 0xC9, 0xE1, 0x80,
+0xCA, 0x22, 0x01, 0xC9, 0xE1, 0xFF, 0x7A, 0x93, 0xFF, 0xBC, 0x02, 0xE6, 0xF8, 0xCE, 0x35, 0x52,
+0x88, 0x83, 0x00, 0x00, 0x84, 0x00, 0x00, 0x02, 0x5A, 0xA9, 0xCE, 0x35, 0xE6, 0xF8, 0x93, 0xFF,
+0xBB, 0x00, 0xCA, 0x22, 0x80, 0xCA, 0x01, 0x00, 0xD2, 0x83, 0x93, 0xFF, 0xBB, 0x02, 0xEF, 0x39,
+0xCE, 0x35, 0x83, 0xED, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0x02, 0x7B, 0xAC, 0xCE, 0x35, 0xEF,
+0x19, 0x92, 0xFF, 0xBB, 0x00, 0xD3, 0x06, 0x80, 0xC9, 0xE1, 0x00, 0xDB, 0x88, 0x92, 0xFF, 0xBB,
+0x03, 0xF7, 0x5A, 0xCE, 0x35, 0xA4, 0xF0, 0x00, 0x20, 0x84, 0x00, 0x00, 0x86, 0x00, 0x00, 0x02,
+0x83, 0xED, 0xCE, 0x35, 0xEF, 0x39, 0x8E, 0xFF, 0xBB, 0x01, 0xE7, 0x19, 0x63, 0x2C, 0x84, 0x4A,
+0x69, 0x01, 0x63, 0x2C, 0xE7, 0x19, 0x8E, 0xFF, 0xBB, 0x03, 0xF7, 0x7A, 0xD6, 0x35, 0xB5, 0x72,
+0x10, 0x81, 0x85, 0x00, 0x00, 0x87, 0x00, 0x00, 0x02, 0x8C, 0x4E, 0xCE, 0x35, 0xEF, 0x19, 0x8D,
+0xFF, 0x9B, 0x00, 0xB5, 0x94, 0x86, 0x42, 0x08, 0x00, 0xB5, 0x94, 0x8D, 0xFF, 0x9B, 0x03, 0xF7,
+0x5A, 0xD6, 0x35, 0xBD, 0xB3, 0x18, 0xC2, 0x86, 0x00, 0x00, 0x87, 0x00, 0x00, 0x03, 0x00, 0x20,
+0x9C, 0xB0, 0xCE, 0x35, 0xEF, 0x19, 0x8C, 0xF7, 0x7B, 0x01, 0xEF, 0x19, 0x39, 0xC6, 0x84, 0x29,
+0x65, 0x01, 0x31, 0xA6, 0xE6, 0xF9, 0x8C, 0xF7, 0x7B, 0x03, 0xF7, 0x5A, 0xD6, 0x35, 0xC5, 0xD3,
+0x21, 0x03, 0x87, 0x00, 0x00, 0x88, 0x00, 0x00, 0x03, 0x08, 0x41, 0xA4, 0xF1, 0xCE, 0x35, 0xEF,
+0x19, 0x8C, 0xF7, 0x7A, 0x00, 0x94, 0x90, 0x84, 0x18, 0xE3, 0x00, 0x94, 0x90, 0x8C, 0xF7, 0x7A,
+0x03, 0xEF, 0x5A, 0xD6, 0x55, 0xC5, 0xF4, 0x29, 0x24, 0x88, 0x00, 0x00, 0x89, 0x00, 0x00, 0x03,
+0x08, 0x61, 0xAD, 0x31, 0xCE, 0x35, 0xE6, 0xF8, 0x8C, 0xF7, 0x5A, 0x01, 0x84, 0x0E, 0x10, 0x82,
+0x80, 0x08, 0x41, 0x01, 0x10, 0xA2, 0x84, 0x0E, 0x8C, 0xF7, 0x5A, 0x03, 0xEF, 0x39, 0xD6, 0x55,
+0xC5, 0xF4, 0x29, 0x44, 0x89, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x03, 0x08, 0x61, 0xA4, 0xF0, 0xCE,
+0x35, 0xDE, 0xB7, 0x8C, 0xEF, 0x3A, 0x03, 0xCE, 0x56, 0x31, 0x86, 0x49, 0xE7, 0xE6, 0xD8, 0x8C,
+0xEF, 0x3A, 0x03, 0xE6, 0xF9, 0xD6, 0x35, 0xC5, 0xF4, 0x31, 0x64, 0x8A, 0x00, 0x00, 0x8B, 0x00,
+0x00, 0x04, 0x08, 0x41, 0x8C, 0x2E, 0xCE, 0x35, 0xD6, 0x76, 0xE7, 0x19, 0x8A, 0xEF, 0x19, 0x03,
+0xA4, 0xF2, 0x42, 0x08, 0x4A, 0x48, 0xE6, 0xF9, 0x8B, 0xEF, 0x19, 0x03, 0xE6, 0xD8, 0xCE, 0x35,
+0xBD, 0xB3, 0x21, 0x03, 0x8B, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x03, 0x62, 0xE9, 0xCE, 0x14, 0xCE,
+0x35, 0xDE, 0xB8, 0x88, 0xE6, 0xF9, 0x04, 0xC6, 0x16, 0x4A, 0x49, 0x62, 0xEA, 0x42, 0x08, 0x83,
+0xEE, 0x89, 0xE6, 0xF9, 0x04, 0xE6, 0xF8, 0xD6, 0x76, 0xCE, 0x35, 0xA4, 0xD0, 0x10, 0x82, 0x8C,
+0x00, 0x00, 0x8E, 0x00, 0x00, 0x04, 0x21, 0x03, 0xA4, 0xF0, 0xCE, 0x35, 0xD6, 0x76, 0xDE, 0xB8,
+0x83, 0xE6, 0xD8, 0x0A, 0xDE, 0x97, 0xBD, 0xB5, 0x8C, 0x50, 0x42, 0x28, 0x52, 0x8A, 0xCE, 0x57,
+0x94, 0x70, 0x42, 0x08, 0x63, 0x0B, 0xAD, 0x33, 0xCE, 0x16, 0x85, 0xE6, 0xD8, 0x04, 0xDE, 0xB7,
+0xCE, 0x35, 0xCE, 0x14, 0x63, 0x0A, 0x00, 0x20, 0x8D, 0x00, 0x00, 0x90, 0x00, 0x00, 0x04, 0x5A,
+0xA9, 0xC5, 0xD4, 0xCE, 0x35, 0xD6, 0x56, 0xDE, 0xB7, 0x81, 0xDE, 0xB8, 0x00, 0x63, 0x2B, 0x80,
+0x42, 0x08, 0x01, 0x73, 0x8D, 0xCE, 0x56, 0x80, 0xDE, 0xB8, 0x01, 0xA5, 0x12, 0x52, 0x89, 0x80,
+0x42, 0x08, 0x00, 0xB5, 0x94, 0x82, 0xDE, 0xB8, 0x00, 0xDE, 0x97, 0x80, 0xCE, 0x35, 0x01, 0xA4,
+0xD0, 0x21, 0x03, 0x8F, 0x00, 0x00, 0x91, 0x00, 0x00, 0x02, 0x08, 0x61, 0x63, 0x0A, 0xC5, 0xD4,
+0x80, 0xCE, 0x35, 0x04, 0xD6, 0x77, 0xD6, 0x97, 0xBD, 0xD5, 0xAD, 0x53, 0xCE, 0x36, 0x83, 0xDE,
+0x97, 0x06, 0xD6, 0x97, 0xBD, 0xB4, 0xAD, 0x33, 0xD6, 0x97, 0xDE, 0x97, 0xD6, 0x97, 0xD6, 0x76,
+0x80, 0xCE, 0x35, 0x01, 0xB5, 0x52, 0x4A, 0x47, 0x91, 0x00, 0x00, 0x93, 0x00, 0x00, 0x02, 0x08,
+0x61, 0x5A, 0xC9, 0xB5, 0x52, 0x80, 0xCE, 0x35, 0x01, 0xD6, 0x55, 0xD6, 0x56, 0x87, 0xD6, 0x77,
+0x01, 0xD6, 0x56, 0xD6, 0x55, 0x80, 0xCE, 0x35, 0x01, 0xAD, 0x11, 0x42, 0x27, 0x93, 0x00, 0x00,
+0x96, 0x00, 0x00, 0x02, 0x31, 0x65, 0x7B, 0xAC, 0xBD, 0xB3, 0x81, 0xCE, 0x35, 0x00, 0xCE, 0x55,
+0x80, 0xCE, 0x56, 0x00, 0xCE, 0x36, 0x82, 0xCE, 0x35, 0x02, 0xBD, 0x93, 0x73, 0x6B, 0x21, 0x23,
+0x95, 0x00, 0x00, 0x99, 0x00, 0x00, 0x03, 0x29, 0x44, 0x62, 0xE9, 0x94, 0x4E, 0xBD, 0xB3, 0x80,
+0xCE, 0x35, 0x04, 0xCE, 0x15, 0xAD, 0x32, 0x84, 0x0D, 0x5A, 0xA9, 0x21, 0x03, 0x98, 0x00, 0x00,
+0x9D, 0x00, 0x00, 0x01, 0x08, 0x61, 0x10, 0x82, 0x9D, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00,
+0x00,
+};
+static const uint16_t NotoFox64_PACKED_ROWS[64] PROGMEM = {
+0x0000, 0x0003, 0x0006, 0x0015, 0x0030, 0x0053, 0x0086, 0x00BB, 0x00FA, 0x0141, 0x0184, 0x01C5, 0x0214, 0x026C, 0x02BB, 0x02FC,
+0x032B, 0x0356, 0x0381, 0x03AE, 0x03DB, 0x0406, 0x041F, 0x043C, 0x0455, 0x046E, 0x0485, 0x049E, 0x04B5, 0x04CC, 0x04E3, 0x052E,
+0x0585, 0x05E6, 0x0629, 0x0660, 0x06B5, 0x0702, 0x0749, 0x07A0, 0x07EF, 0x0836, 0x0877, 0x08A2, 0x08CB, 0x08F4, 0x0917, 0x093C,
+0x0965, 0x098A, 0x09B5, 0x09DC, 0x0A07, 0x0A2E, 0x0A57, 0x0A82, 0x0ABB, 0x0AF6, 0x0B2B, 0x0B50, 0x0B73, 0x0B90, 0x0B9B, 0x0B9E,
+};
+const PackedImage NotoFox64_PACKED = { 64, 64, PackedImage::Rle565, 0, 2977, nullptr, NotoFox64_PACKED_ROWS, NotoFox64_PACKED_DATA };
+
+// NotoFrog64: 64x64 rle565, 2870 bytes of flash
+static const uint8_t NotoFrog64_PACKED_DATA[2742] PROGMEM = {
+0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x8D,
+0x00, 0x00, 0x07, 0x09, 0x23, 0x22, 0x46, 0x22, 0xE7, 0x2B, 0x48, 0x2B, 0x28, 0x22, 0xC7, 0x19,
+0xE5, 0x08, 0xA1, 0x90, 0x00, 0x00, 0x08, 0x00, 0x20, 0x11, 0x23, 0x22, 0x66, 0x22, 0xE7, 0x2B,
+0x48, 0x2B, 0x28, 0x22, 0xA7, 0x19, 0xC4, 0x00, 0x81, 0x8C, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x01,
+0x19, 0xC4, 0x33, 0xEA, 0x80, 0x3C, 0x2B, 0x03, 0x4C, 0x8C, 0x54, 0xCC, 0x54, 0xAC, 0x44, 0x6B,
+0x80, 0x3C, 0x2B, 0x01, 0x2B, 0x48, 0x08, 0xE2, 0x8C, 0x00, 0x00, 0x02, 0x00, 0x20, 0x19, 0xE5,
+0x33, 0xEA, 0x80, 0x3C, 0x2B, 0x03, 0x4C, 0x8C, 0x54, 0xCC, 0x54, 0xAC, 0x44, 0x6B, 0x80, 0x3C,
+0x2B, 0x01, 0x2B, 0x08, 0x08, 0xC2, 0x8A, 0x00, 0x00, 0x89, 0x00, 0x00, 0x05, 0x00, 0x81, 0x2B,
+0x69, 0x3C, 0x2B, 0x54, 0xCC, 0x7D, 0xCF, 0x9E, 0x71, 0x82, 0x9E, 0x91, 0x04, 0x96, 0x51, 0x75,
+0x8E, 0x44, 0x4B, 0x3C, 0x2B, 0x1A, 0x46, 0x8A, 0x00, 0x00, 0x05, 0x08, 0xA1, 0x33, 0xA9, 0x3C,
+0x2B, 0x54, 0xCD, 0x85, 0xEF, 0x9E, 0x71, 0x82, 0x9E, 0x91, 0x04, 0x8E, 0x30, 0x6D, 0x6E, 0x3C,
+0x4B, 0x3C, 0x2A, 0x1A, 0x05, 0x89, 0x00, 0x00, 0x88, 0x00, 0x00, 0x03, 0x08, 0xA2, 0x33, 0xEA,
+0x3C, 0x2B, 0x7D, 0xCF, 0x87, 0x9E, 0x71, 0x03, 0x96, 0x71, 0x65, 0x2D, 0x3C, 0x2B, 0x2A, 0xE7,
+0x88, 0x00, 0x00, 0x03, 0x08, 0xE2, 0x33, 0xEA, 0x44, 0x4B, 0x85, 0xEF, 0x87, 0x9E, 0x71, 0x03,
+0x96, 0x51, 0x5C, 0xED, 0x3C, 0x2B, 0x22, 0xA6, 0x88, 0x00, 0x00, 0x87, 0x00, 0x00, 0x03, 0x00,
+0x41, 0x33, 0xA9, 0x44, 0x4B, 0x8E, 0x10, 0x8A, 0x9E, 0x71, 0x02, 0x75, 0x6E, 0x3C, 0x2B, 0x22,
+0x66, 0x86, 0x00, 0x00, 0x03, 0x00, 0x81, 0x33, 0xEA, 0x44, 0x6B, 0x8E, 0x30, 0x8A, 0x9E, 0x71,
+0x02, 0x6D, 0x4E, 0x3C, 0x2B, 0x1A, 0x05, 0x87, 0x00, 0x00, 0x87, 0x00, 0x00, 0x02, 0x22, 0xC7,
+0x3C, 0x2B, 0x85, 0xF0, 0x83, 0x96, 0x71, 0x03, 0xA6, 0x92, 0xB6, 0xD4, 0xB6, 0xD5, 0xA6, 0xB3,
+0x83, 0x96, 0x71, 0x02, 0x65, 0x2D, 0x3C, 0x2B, 0x11, 0x23, 0x85, 0x00, 0x00, 0x02, 0x2B, 0x28,
+0x3C, 0x2B, 0x8E, 0x10, 0x82, 0x96, 0x71, 0x04, 0x9E, 0x71, 0xAE, 0xB4, 0xB6, 0xD5, 0xAE, 0xB4,
+0x9E, 0x71, 0x83, 0x96, 0x71, 0x02, 0x5D, 0x0D, 0x3C, 0x2A, 0x08, 0xC2, 0x86, 0x00, 0x00, 0x86,
+0x00, 0x00, 0x02, 0x08, 0xE2, 0x3C, 0x2B, 0x65, 0x4E, 0x82, 0x96, 0x51, 0x01, 0xAE, 0xB4, 0xE7,
+0x9C, 0x82, 0xFF, 0xFF, 0x01, 0xEF, 0xBD, 0xB6, 0xF5, 0x82, 0x96, 0x51, 0x01, 0x44, 0x6B, 0x33,
+0x69, 0x84, 0x00, 0x00, 0x02, 0x11, 0x23, 0x3C, 0x2B, 0x6D, 0x6E, 0x81, 0x96, 0x51, 0x01, 0x9E,
+0x72, 0xCF, 0x59, 0x83, 0xFF, 0xFF, 0x01, 0xCF, 0x39, 0x9E, 0x71, 0x81, 0x96, 0x51, 0x02, 0x8E,
+0x50, 0x3C, 0x4B, 0x2B, 0x28, 0x86, 0x00, 0x00, 0x86, 0x00, 0x00, 0x02, 0x22, 0x86, 0x3C, 0x2B,
+0x8E, 0x30, 0x81, 0x96, 0x51, 0x00, 0xBE, 0xF6, 0x86, 0xFF, 0xFF, 0x00, 0xCF, 0x59, 0x81, 0x96,
+0x51, 0x02, 0x75, 0x8E, 0x3C, 0x2B, 0x09, 0x02, 0x83, 0x00, 0x00, 0x02, 0x22, 0xE7, 0x44, 0x4B,
+0x96, 0x50, 0x80, 0x96, 0x51, 0x01, 0x9E, 0x92, 0xEF, 0xBD, 0x85, 0xFF, 0xFF, 0x01, 0xEF, 0xBD,
+0x9E, 0x92, 0x81, 0x96, 0x51, 0x02, 0x6D, 0x4E, 0x3C, 0x2B, 0x08, 0xA1, 0x85, 0x00, 0x00, 0x86,
+0x00, 0x00, 0x01, 0x33, 0xEA, 0x5C, 0xED, 0x81, 0x96, 0x50, 0x00, 0xAE, 0xB4, 0x88, 0xFF, 0xFF,
+0x00, 0xBF, 0x17, 0x80, 0x96, 0x50, 0x02, 0x8E, 0x30, 0x3C, 0x2B, 0x1A, 0x46, 0x82, 0x00, 0x00,
+0x02, 0x00, 0x20, 0x34, 0x0A, 0x65, 0x2D, 0x80, 0x96, 0x50, 0x01, 0x96, 0x51, 0xEF, 0xBD, 0x87,
+0xFF, 0xFF, 0x01, 0xEF, 0xBC, 0x96, 0x51, 0x80, 0x96, 0x50, 0x02, 0x8E, 0x10, 0x3C, 0x2B, 0x19,
+0xE5, 0x85, 0x00, 0x00, 0x85, 0x00, 0x00, 0x02, 0x08, 0x81, 0x3C, 0x2B, 0x6D, 0x6E, 0x81, 0x8E,
+0x50, 0x00, 0xE7, 0x9C, 0x81, 0xFF, 0xFF, 0x04, 0x9C, 0xF3, 0x52, 0xAA, 0x4A, 0x69, 0x8C, 0x51,
+0xF7, 0x9E, 0x80, 0xFF, 0xFF, 0x01, 0xFF, 0xFE, 0x96, 0x51, 0x80, 0x8E, 0x50, 0x01, 0x4C, 0xAC,
+0x2B, 0x28, 0x82, 0x00, 0x00, 0x02, 0x08, 0xE2, 0x3C, 0x2B, 0x75, 0xAF, 0x80, 0x8E, 0x50, 0x00,
+0xBE, 0xF6, 0x81, 0xFF, 0xFF, 0x04, 0xCE, 0x79, 0x6B, 0x4D, 0x4A, 0x49, 0x6B, 0x4D, 0xD6, 0x9A,
+0x81, 0xFF, 0xFF, 0x00, 0xBE, 0xF6, 0x81, 0x8E, 0x50, 0x01, 0x44, 0x6B, 0x22, 0xC7, 0x85, 0x00,
+0x00, 0x85, 0x00, 0x00, 0x02, 0x09, 0x02, 0x3C, 0x2B, 0x75, 0xAF, 0x80, 0x8E, 0x30, 0x00, 0x9E,
+0x72, 0x81, 0xFF, 0xFF, 0x00, 0x9C, 0xD3, 0x82, 0x42, 0x08, 0x00, 0x73, 0x8E, 0x81, 0xFF, 0xFF,
+0x00, 0xB6, 0xD6, 0x80, 0x8E, 0x30, 0x01, 0x54, 0xED, 0x33, 0xA9, 0x82, 0x00, 0x00, 0x02, 0x11,
+0x43, 0x3C, 0x2B, 0x7D, 0xCF, 0x80, 0x8E, 0x30, 0x00, 0xE7, 0x9C, 0x80, 0xFF, 0xFF, 0x01, 0xDE,
+0xFB, 0x42, 0x28, 0x81, 0x42, 0x08, 0x01, 0x42, 0x28, 0xE7, 0x1C, 0x80, 0xFF, 0xFF, 0x00, 0xE7,
+0x9B, 0x81, 0x8E, 0x30, 0x01, 0x54, 0xCC, 0x2B, 0x48, 0x85, 0x00, 0x00, 0x85, 0x00, 0x00, 0x02,
+0x11, 0x23, 0x3C, 0x2B, 0x7D, 0xCF, 0x80, 0x8E, 0x30, 0x00, 0xB6, 0xD5, 0x81, 0xFF, 0xFF, 0x00,
+0x4A, 0x69, 0x83, 0x42, 0x08, 0x00, 0xE7, 0x1C, 0x80, 0xFF, 0xFF, 0x00, 0xCF, 0x38, 0x80, 0x8E,
+0x30, 0x02, 0x65, 0x2D, 0x3C, 0x0A, 0x22, 0xE7, 0x80, 0x2B, 0x08, 0x03, 0x2A, 0xE7, 0x2B, 0x48,
+0x3C, 0x2B, 0x86, 0x10, 0x80, 0x8E, 0x30, 0x81, 0xFF, 0xFF, 0x00, 0x94, 0xB2, 0x83, 0x42, 0x08,
+0x00, 0x9C, 0xD3, 0x80, 0xFF, 0xFF, 0x00, 0xF7, 0xDE, 0x81, 0x8E, 0x30, 0x01, 0x54, 0xCC, 0x33,
+0x89, 0x85, 0x00, 0x00, 0x85, 0x00, 0x00, 0x02, 0x08, 0xE2, 0x3C, 0x2B, 0x75, 0x8F, 0x80, 0x8E,
+0x30, 0x00, 0xB6, 0xD5, 0x80, 0xFF, 0xFF, 0x01, 0xFF, 0xDF, 0x42, 0x28, 0x83, 0x42, 0x08, 0x00,
+0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xCF, 0x39, 0x80, 0x8E, 0x30, 0x04, 0x85, 0xF0, 0x54, 0xAC,
+0x44, 0x6B, 0x4C, 0x8C, 0x4C, 0xAC, 0x80, 0x44, 0x6B, 0x00, 0x65, 0x2E, 0x81, 0x8E, 0x30, 0x81,
+0xFF, 0xFF, 0x00, 0x84, 0x30, 0x83, 0x42, 0x08, 0x00, 0x8C, 0x51, 0x81, 0xFF, 0xFF, 0x81, 0x8E,
+0x30, 0x01, 0x4C, 0xAC, 0x2B, 0x28, 0x85, 0x00, 0x00, 0x85, 0x00, 0x00, 0x02, 0x00, 0x40, 0x3C,
+0x2A, 0x65, 0x2D, 0x80, 0x86, 0x10, 0x00, 0xA6, 0x94, 0x81, 0xFF, 0xFF, 0x00, 0x73, 0x8E, 0x82,
+0x42, 0x08, 0x01, 0x52, 0x8A, 0xF7, 0xBE, 0x80, 0xFF, 0xFF, 0x00, 0xBE, 0xF7, 0x8B, 0x86, 0x10,
+0x00, 0xEF, 0xBD, 0x80, 0xFF, 0xFF, 0x00, 0xBD, 0xD7, 0x83, 0x42, 0x08, 0x00, 0xBD, 0xF7, 0x80,
+0xFF, 0xFF, 0x00, 0xEF, 0xBD, 0x81, 0x86, 0x10, 0x01, 0x3C, 0x2B, 0x22, 0x86, 0x85, 0x00, 0x00,
+0x86, 0x00, 0x00, 0x01, 0x2B, 0x69, 0x4C, 0x8C, 0x80, 0x86, 0x10, 0x01, 0x8E, 0x10, 0xF7, 0xDE,
+0x80, 0xFF, 0xFF, 0x01, 0xE7, 0x3C, 0x5A, 0xEB, 0x80, 0x42, 0x08, 0x01, 0x4A, 0x69, 0xCE, 0x59,
+0x81, 0xFF, 0xFF, 0x00, 0x9E, 0x52, 0x8B, 0x86, 0x10, 0x00, 0xCF, 0x18, 0x81, 0xFF, 0xFF, 0x00,
+0x8C, 0x71, 0x81, 0x42, 0x08, 0x00, 0x94, 0x92, 0x81, 0xFF, 0xFF, 0x00, 0xC7, 0x18, 0x80, 0x86,
+0x10, 0x02, 0x75, 0x8F, 0x3C, 0x2B, 0x11, 0x63, 0x85, 0x00, 0x00, 0x86, 0x00, 0x00, 0x02, 0x19,
+0xC4, 0x3C, 0x2B, 0x75, 0xAF, 0x80, 0x86, 0x10, 0x00, 0xBE, 0xF7, 0x81, 0xFF, 0xFF, 0x03, 0xFF,
+0xDF, 0xCE, 0x79, 0xC6, 0x38, 0xF7, 0x9E, 0x81, 0xFF, 0xFF, 0x00, 0xD7, 0x5A, 0x8C, 0x86, 0x10,
+0x00, 0x96, 0x31, 0x82, 0xFF, 0xFF, 0x02, 0xE7, 0x1C, 0xC6, 0x18, 0xE7, 0x1C, 0x82, 0xFF, 0xFF,
+0x00, 0x96, 0x31, 0x80, 0x86, 0x10, 0x02, 0x54, 0xCC, 0x33, 0xEA, 0x00, 0x20, 0x85, 0x00, 0x00,
+0x86, 0x00, 0x00, 0x06, 0x00, 0x20, 0x33, 0xCA, 0x4C, 0x8C, 0x85, 0xEF, 0x85, 0xF0, 0x86, 0x10,
+0xDF, 0x7B, 0x86, 0xFF, 0xFF, 0x01, 0xEF, 0xBD, 0x8E, 0x31, 0x8D, 0x85, 0xF0, 0x00, 0xAE, 0xB5,
+0x87, 0xFF, 0xFF, 0x00, 0xAE, 0xB5, 0x80, 0x85, 0xF0, 0x02, 0x75, 0x8E, 0x3C, 0x2B, 0x1A, 0x25,
+0x86, 0x00, 0x00, 0x87, 0x00, 0x00, 0x02, 0x11, 0x84, 0x3C, 0x2B, 0x6D, 0x6E, 0x80, 0x85, 0xEF,
+0x01, 0x85, 0xF0, 0xC7, 0x18, 0x84, 0xFF, 0xFF, 0x01, 0xDF, 0x5B, 0x8E, 0x11, 0x8F, 0x85, 0xEF,
+0x01, 0xA6, 0x94, 0xF7, 0xDE, 0x83, 0xFF, 0xFF, 0x01, 0xF7, 0xBE, 0xA6, 0x94, 0x81, 0x85, 0xEF,
+0x02, 0x4C, 0x8C, 0x33, 0xA9, 0x00, 0x20, 0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x01, 0x34, 0x0A,
+0x5C, 0xED, 0x82, 0x7D, 0xEF, 0x05, 0x8E, 0x31, 0xBE, 0xD7, 0xCF, 0x39, 0xD7, 0x3A, 0xC6, 0xF8,
+0x9E, 0x53, 0x92, 0x7D, 0xEF, 0x06, 0x85, 0xF0, 0xAE, 0x95, 0xCF, 0x19, 0xD7, 0x5A, 0xCF, 0x19,
+0xAE, 0x95, 0x85, 0xF0, 0x81, 0x7D, 0xEF, 0x02, 0x7D, 0xCF, 0x3C, 0x2B, 0x19, 0xE5, 0x87, 0x00,
+0x00, 0x87, 0x00, 0x00, 0x02, 0x00, 0x40, 0x3C, 0x0A, 0x5D, 0x0D, 0xA7, 0x7D, 0xCF, 0x01, 0x3C,
+0x2B, 0x1A, 0x25, 0x87, 0x00, 0x00, 0x87, 0x00, 0x00, 0x02, 0x22, 0xC7, 0x3C, 0x2B, 0x75, 0x8E,
+0xA7, 0x7D, 0xCF, 0x02, 0x4C, 0xAC, 0x34, 0x0A, 0x08, 0xA1, 0x86, 0x00, 0x00, 0x86, 0x00, 0x00,
+0x02, 0x19, 0xE5, 0x3C, 0x2B, 0x5D, 0x0D, 0xA8, 0x7D, 0xCF, 0x03, 0x75, 0x8F, 0x3C, 0x4B, 0x33,
+0x89, 0x00, 0x40, 0x85, 0x00, 0x00, 0x85, 0x00, 0x00, 0x02, 0x09, 0x23, 0x34, 0x2A, 0x4C, 0xAC,
+0xAA, 0x75, 0xAF, 0x02, 0x6D, 0x4E, 0x3C, 0x2B, 0x22, 0xE7, 0x85, 0x00, 0x00, 0x84, 0x00, 0x00,
+0x02, 0x00, 0x20, 0x33, 0xCA, 0x44, 0x6B, 0xAC, 0x75, 0xAF, 0x02, 0x5D, 0x0D, 0x3C, 0x2B, 0x11,
+0x84, 0x84, 0x00, 0x00, 0x84, 0x00, 0x00, 0x02, 0x1A, 0x25, 0x3C, 0x2B, 0x65, 0x4E, 0x91, 0x75,
+0xAF, 0x02, 0x75, 0x8F, 0x64, 0x4C, 0x75, 0x6E, 0x81, 0x75, 0xAF, 0x01, 0x64, 0x8C, 0x6D, 0x2E,
+0x92, 0x75, 0xAF, 0x02, 0x44, 0x6B, 0x33, 0xCA, 0x00, 0x20, 0x83, 0x00, 0x00, 0x83, 0x00, 0x00,
+0x02, 0x00, 0x40, 0x33, 0xEA, 0x4C, 0x8C, 0x92, 0x75, 0x8F, 0x02, 0x5C, 0x0C, 0x42, 0x08, 0x53,
+0x6A, 0x80, 0x75, 0x8F, 0x02, 0x64, 0xCD, 0x42, 0x08, 0x4A, 0xC9, 0x92, 0x75, 0x8F, 0x02, 0x65,
+0x2D, 0x3C, 0x2B, 0x19, 0xC4, 0x83, 0x00, 0x00, 0x83, 0x00, 0x00, 0x02, 0x11, 0xC4, 0x3C, 0x2B,
+0x65, 0x4E, 0x92, 0x75, 0x8E, 0x02, 0x53, 0x6A, 0x42, 0x08, 0x4A, 0xC9, 0x80, 0x75, 0x8E, 0x02,
+0x5C, 0x2C, 0x42, 0x08, 0x42, 0x28, 0x93, 0x75, 0x8E, 0x01, 0x44, 0x6B, 0x33, 0x89, 0x83, 0x00,
+0x00, 0x83, 0x00, 0x00, 0x01, 0x2B, 0x48, 0x44, 0x6B, 0x93, 0x6D, 0x8E, 0x02, 0x5C, 0x2C, 0x42,
+0x08, 0x53, 0x8A, 0x80, 0x6D, 0x8E, 0x02, 0x64, 0xCD, 0x42, 0x08, 0x4A, 0xC9, 0x93, 0x6D, 0x8E,
+0x02, 0x54, 0xED, 0x3C, 0x2B, 0x08, 0xC2, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x02, 0x00, 0x40,
+0x34, 0x2A, 0x54, 0xCC, 0x93, 0x6D, 0x8E, 0x02, 0x6D, 0x6E, 0x5C, 0x6C, 0x6D, 0x4E, 0x81, 0x6D,
+0x8E, 0x01, 0x64, 0x8C, 0x6D, 0x2E, 0x93, 0x6D, 0x8E, 0x02, 0x65, 0x4E, 0x3C, 0x2B, 0x1A, 0x05,
+0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x02, 0x09, 0x02, 0x3C, 0x2B, 0x5D, 0x0D, 0xB1, 0x6D, 0x6E,
+0x01, 0x44, 0x4B, 0x22, 0xE7, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x02, 0x11, 0xA4, 0x3C, 0x2B,
+0x65, 0x4E, 0xB1, 0x6D, 0x6E, 0x01, 0x4C, 0x8C, 0x33, 0x89, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00,
+0x01, 0x1A, 0x05, 0x3C, 0x2B, 0xB2, 0x65, 0x6E, 0x01, 0x4C, 0xAC, 0x33, 0xEA, 0x82, 0x00, 0x00,
+0x82, 0x00, 0x00, 0x01, 0x1A, 0x25, 0x3C, 0x2B, 0x85, 0x65, 0x4E, 0x06, 0x8D, 0x92, 0xC6, 0x78,
+0xBE, 0x37, 0xA5, 0xD5, 0x8D, 0xB2, 0x7D, 0x90, 0x6D, 0x6F, 0x96, 0x65, 0x4E, 0x06, 0x6D, 0x6F,
+0x7D, 0x90, 0x8D, 0x92, 0xA5, 0xD5, 0xBE, 0x37, 0xC6, 0x78, 0x8D, 0xB2, 0x85, 0x65, 0x4E, 0x01,
+0x4C, 0xAC, 0x34, 0x0A, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x02, 0x19, 0xE5, 0x3C, 0x2B, 0x65,
+0x4D, 0x83, 0x65, 0x4E, 0x02, 0x65, 0x2E, 0xB5, 0xB6, 0xFF, 0xDF, 0x83, 0xFF, 0xFF, 0x0A, 0xFF,
+0xDF, 0xEF, 0x5D, 0xD6, 0xDA, 0xCE, 0x99, 0xC6, 0x58, 0xB6, 0x37, 0xAE, 0x16, 0xA5, 0xD5, 0xA5,
+0xF5, 0xA5, 0xD4, 0x9D, 0xB4, 0x80, 0x9D, 0xD4, 0x01, 0x9D, 0xB4, 0xA5, 0xD5, 0x80, 0xA5, 0xF5,
+0x06, 0xAE, 0x16, 0xB6, 0x37, 0xC6, 0x78, 0xCE, 0x99, 0xD6, 0xDA, 0xEF, 0x5D, 0xFF, 0xDF, 0x83,
+0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xB5, 0xB6, 0x65, 0x2E, 0x84, 0x65, 0x4E, 0x01, 0x4C, 0xAC, 0x33,
+0xCA, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x02, 0x11, 0xA4, 0x3C, 0x2B, 0x5D, 0x2D, 0x83, 0x65,
+0x4D, 0x04, 0x65, 0x2D, 0x42, 0x28, 0x4A, 0x69, 0x94, 0xB2, 0xDE, 0xDB, 0x9C, 0xFF, 0xFF, 0x04,
+0xDE, 0xDB, 0x94, 0xB2, 0x4A, 0x69, 0x42, 0x28, 0x65, 0x2D, 0x84, 0x65, 0x4D, 0x01, 0x44, 0x8B,
+0x2B, 0x89, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x02, 0x08, 0xE2, 0x3C, 0x2B, 0x54, 0xCD, 0x84,
+0x5D, 0x2D, 0x00, 0x4B, 0x2A, 0x81, 0x42, 0x08, 0x02, 0x5A, 0xEB, 0x9C, 0xF3, 0xD6, 0xBA, 0x96,
+0xFF, 0xFF, 0x02, 0xD6, 0xBA, 0x9C, 0xF3, 0x5A, 0xEB, 0x81, 0x42, 0x08, 0x00, 0x4B, 0x09, 0x85,
+0x5D, 0x2D, 0x01, 0x3C, 0x2B, 0x22, 0xA7, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x02, 0x00, 0x20,
+0x3C, 0x0A, 0x4C, 0x8C, 0x84, 0x5D, 0x2D, 0x00, 0x54, 0x4C, 0x84, 0x42, 0x08, 0x04, 0x4A, 0x69,
+0x7B, 0xCF, 0xA5, 0x34, 0xCE, 0x79, 0xEF, 0x7D, 0x8C, 0xFF, 0xFF, 0x04, 0xEF, 0x7D, 0xCE, 0x79,
+0xA5, 0x34, 0x7B, 0xCF, 0x4A, 0x69, 0x84, 0x42, 0x08, 0x00, 0x54, 0x2C, 0x84, 0x5D, 0x2D, 0x02,
+0x5D, 0x0D, 0x3C, 0x2B, 0x19, 0xC4, 0x82, 0x00, 0x00, 0x83, 0x00, 0x00, 0x01, 0x22, 0xE7, 0x3C,
+0x2B, 0x84, 0x5D, 0x2D, 0x01, 0x5D, 0x0D, 0x42, 0xC9, 0x88, 0x42, 0x08, 0x04, 0x4A, 0x69, 0x6B,
+0x4D, 0x7B, 0xCF, 0x8C, 0x71, 0x9C, 0xD3, 0x82, 0xA5, 0x34, 0x04, 0x9C, 0xD3, 0x8C, 0x71, 0x7B,
+0xCF, 0x6B, 0x4D, 0x4A, 0x69, 0x88, 0x42, 0x08, 0x01, 0x42, 0x89, 0x5D, 0x0D, 0x84, 0x5D, 0x2D,
+0x02, 0x4C, 0xAC, 0x3C, 0x2B, 0x08, 0x81, 0x82, 0x00, 0x00, 0x83, 0x00, 0x00, 0x02, 0x11, 0x84,
+0x3C, 0x2B, 0x54, 0xCC, 0x84, 0x5D, 0x0D, 0x00, 0x54, 0x8C, 0xA0, 0x42, 0x08, 0x00, 0x54, 0x2B,
+0x85, 0x5D, 0x0D, 0x01, 0x3C, 0x4B, 0x2B, 0x48, 0x83, 0x00, 0x00, 0x84, 0x00, 0x00, 0x01, 0x33,
+0xA9, 0x44, 0x4B, 0x85, 0x55, 0x0D, 0x00, 0x4B, 0x8A, 0x9E, 0x42, 0x08, 0x00, 0x4B, 0x2A, 0x85,
+0x55, 0x0D, 0x02, 0x4C, 0xCC, 0x3C, 0x2B, 0x11, 0x63, 0x83, 0x00, 0x00, 0x84, 0x00, 0x00, 0x02,
+0x19, 0xC4, 0x3C, 0x2B, 0x4C, 0xCC, 0x84, 0x55, 0x0D, 0x01, 0x54, 0xED, 0x43, 0x09, 0x9C, 0x42,
+0x08, 0x01, 0x42, 0xA9, 0x54, 0xED, 0x84, 0x55, 0x0D, 0x02, 0x54, 0xED, 0x3C, 0x4B, 0x33, 0x89,
+0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0x01, 0x2B, 0x69, 0x3C, 0x2B, 0x86, 0x54, 0xED, 0x00, 0x42,
+0xE9, 0x9A, 0x42, 0x08, 0x01, 0x42, 0x89, 0x54, 0xCC, 0x85, 0x54, 0xED, 0x02, 0x44, 0x8C, 0x3C,
+0x2B, 0x09, 0x02, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0x02, 0x08, 0xC2, 0x34, 0x0A, 0x3C, 0x4B,
+0x86, 0x54, 0xED, 0x00, 0x4B, 0x6A, 0x86, 0x42, 0x08, 0x03, 0x4A, 0x08, 0x82, 0x28, 0xA2, 0x49,
+0xC2, 0x49, 0x80, 0xCA, 0x49, 0x03, 0xC2, 0x49, 0xA2, 0x49, 0x7A, 0x28, 0x4A, 0x08, 0x86, 0x42,
+0x08, 0x01, 0x42, 0xC9, 0x54, 0xCC, 0x85, 0x54, 0xED, 0x02, 0x4C, 0xAC, 0x3C, 0x2B, 0x22, 0x86,
+0x85, 0x00, 0x00, 0x86, 0x00, 0x00, 0x02, 0x11, 0xA4, 0x3C, 0x2B, 0x44, 0x6B, 0x86, 0x4C, 0xEC,
+0x02, 0x4C, 0x0B, 0x42, 0x68, 0x39, 0xE7, 0x81, 0x42, 0x08, 0x01, 0x62, 0x08, 0xBA, 0x49, 0x88,
+0xFA, 0x69, 0x01, 0xBA, 0x49, 0x62, 0x08, 0x83, 0x42, 0x08, 0x01, 0x4B, 0x8A, 0x4C, 0xCC, 0x85,
+0x4C, 0xEC, 0x03, 0x4C, 0xCC, 0x3C, 0x2B, 0x2B, 0x48, 0x00, 0x20, 0x85, 0x00, 0x00, 0x87, 0x00,
+0x00, 0x02, 0x1A, 0x46, 0x3C, 0x2B, 0x44, 0x6B, 0x87, 0x4C, 0xCC, 0x03, 0x43, 0x6A, 0x42, 0x08,
+0x4A, 0x08, 0xB2, 0x49, 0x8C, 0xFA, 0x69, 0x00, 0xAA, 0x49, 0x80, 0x42, 0x08, 0x01, 0x42, 0xE9,
+0x4C, 0x8C, 0x86, 0x4C, 0xCC, 0x03, 0x4C, 0xAC, 0x3C, 0x2A, 0x33, 0xA9, 0x00, 0x61, 0x86, 0x00,
+0x00, 0x88, 0x00, 0x00, 0x02, 0x22, 0x66, 0x3C, 0x2B, 0x3C, 0x6B, 0x87, 0x4C, 0xCC, 0x02, 0x4C,
+0xAC, 0x8B, 0x4A, 0xE2, 0x69, 0x8D, 0xFA, 0x69, 0x01, 0xAA, 0xCA, 0x4C, 0x4B, 0x87, 0x4C, 0xCC,
+0x03, 0x44, 0xAC, 0x3C, 0x2A, 0x33, 0xA9, 0x00, 0x81, 0x87, 0x00, 0x00, 0x89, 0x00, 0x00, 0x03,
+0x1A, 0x05, 0x3C, 0x2B, 0x3C, 0x4B, 0x44, 0xAC, 0x88, 0x4C, 0xCC, 0x03, 0x6B, 0xEB, 0x9B, 0x2A,
+0xC2, 0xA9, 0xEA, 0x69, 0x84, 0xFA, 0x69, 0x04, 0xEA, 0x69, 0xD2, 0x89, 0xA3, 0x0A, 0x7B, 0xCB,
+0x54, 0x8C, 0x88, 0x4C, 0xCC, 0x03, 0x44, 0x6B, 0x3C, 0x2B, 0x2B, 0x48, 0x00, 0x61, 0x88, 0x00,
+0x00, 0x8A, 0x00, 0x00, 0x03, 0x11, 0x43, 0x33, 0xEA, 0x3C, 0x2B, 0x44, 0x6B, 0x8C, 0x44, 0xAC,
+0x04, 0x54, 0x8C, 0x5C, 0x4B, 0x5C, 0x2B, 0x5C, 0x6C, 0x4C, 0x8C, 0x8B, 0x44, 0xAC, 0x04, 0x44,
+0x8C, 0x3C, 0x4B, 0x3C, 0x2B, 0x22, 0xA7, 0x00, 0x20, 0x89, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x01,
+0x00, 0x61, 0x2A, 0xE7, 0x80, 0x3C, 0x2B, 0x00, 0x44, 0x8B, 0x9A, 0x44, 0xAC, 0x04, 0x44, 0x8C,
+0x3C, 0x4B, 0x3C, 0x2B, 0x33, 0xCA, 0x11, 0x43, 0x8B, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x01, 0x11,
+0x43, 0x33, 0x89, 0x80, 0x3C, 0x2B, 0x01, 0x3C, 0x6B, 0x44, 0x8C, 0x95, 0x44, 0xAC, 0x05, 0x44,
+0x8B, 0x3C, 0x4B, 0x3C, 0x2A, 0x34, 0x0A, 0x1A, 0x46, 0x00, 0x20, 0x8C, 0x00, 0x00, 0x8F, 0x00,
+0x00, 0x05, 0x11, 0x63, 0x2B, 0x69, 0x3C, 0x2B, 0x3C, 0x2A, 0x3C, 0x4B, 0x3C, 0x6B, 0x90, 0x44,
+0x8C, 0x80, 0x3C, 0x6B, 0x80, 0x3C, 0x2B, 0x02, 0x33, 0xEA, 0x1A, 0x46, 0x00, 0x61, 0x8E, 0x00,
+0x00, 0x91, 0x00, 0x00, 0x02, 0x08, 0xE2, 0x22, 0x86, 0x33, 0xEA, 0x81, 0x3C, 0x2B, 0x00, 0x3C,
+0x4B, 0x81, 0x3C, 0x6B, 0x85, 0x3C, 0x8B, 0x80, 0x3C, 0x6B, 0x80, 0x3C, 0x4B, 0x05, 0x3C, 0x2A,
+0x3C, 0x2B, 0x3C, 0x2A, 0x2B, 0x28, 0x11, 0x84, 0x00, 0x20, 0x90, 0x00, 0x00, 0x94, 0x00, 0x00,
+0x03, 0x09, 0x02, 0x1A, 0x25, 0x2B, 0x28, 0x33, 0xEA, 0x82, 0x3C, 0x2B, 0x00, 0x3C, 0x2A, 0x80,
+0x34, 0x2A, 0x00, 0x34, 0x2B, 0x82, 0x3C, 0x2B, 0x04, 0x34, 0x0A, 0x33, 0x89, 0x22, 0x86, 0x11,
+0x63, 0x00, 0x41, 0x93, 0x00, 0x00, 0x98, 0x00, 0x00, 0x0C, 0x08, 0x81, 0x09, 0x23, 0x11, 0x84,
+0x1A, 0x05, 0x1A, 0x25, 0x22, 0x66, 0x22, 0x86, 0x1A, 0x46, 0x1A, 0x25, 0x19, 0xC4, 0x11, 0x43,
+0x08, 0xC2, 0x00, 0x20, 0x97, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00,
+0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00,
+};
+static const uint16_t NotoFrog64_PACKED_ROWS[64] PROGMEM = {
+0x0000, 0x0003, 0x0006, 0x0009, 0x000C, 0x000F, 0x003C, 0x0079, 0x00B8, 0x00EB, 0x011A, 0x015F, 0x01A8, 0x01EF, 0x0234, 0x0291,
+0x02EC, 0x0344, 0x0399, 0x03E0, 0x042B, 0x0470, 0x04A3, 0x04DA, 0x0511, 0x0526, 0x053D, 0x0556, 0x056D, 0x0584, 0x05AD, 0x05D8,
+0x0601, 0x062A, 0x0653, 0x0668, 0x067D, 0x0690, 0x06C7, 0x0724, 0x0755, 0x078A, 0x07C9, 0x080A, 0x082B, 0x084C, 0x0873, 0x0896,
+0x08D3, 0x090E, 0x0941, 0x096C, 0x09A1, 0x09CC, 0x09EB, 0x0A0E, 0x0A31, 0x0A5D, 0x0A86, 0x0AA7, 0x0AAA, 0x0AAD, 0x0AB0, 0x0AB3,
+};
+const PackedImage NotoFrog64_PACKED = { 64, 64, PackedImage::Rle565, 0, 2742, nullptr, NotoFrog64_PACKED_ROWS, NotoFrog64_PACKED_DATA };
+
+// NotoGiraffe64: 64x64 rle565, 3537 bytes of flash
+static const uint8_t NotoGiraffe64_PACKED_DATA[3409] PROGMEM = {
+0xBE, 0x00, 0x00, 0x96, 0x00, 0x00, 0x02, 0x08, 0x20, 0x10, 0x40, 0x08, 0x20, 0x88, 0x00, 0x00,
+0x02, 0x08, 0x20, 0x10, 0x40, 0x08, 0x20, 0x96, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x28, 0xC1,
+0x81, 0x39, 0x01, 0x01, 0x30, 0xE1, 0x10, 0x40, 0x84, 0x00, 0x00, 0x01, 0x10, 0x40, 0x30, 0xE1,
+0x81, 0x39, 0x01, 0x00, 0x28, 0xC1, 0x95, 0x00, 0x00, 0x94, 0x00, 0x00, 0x04, 0x30, 0xE1, 0x39,
+0x01, 0x41, 0x21, 0x49, 0x42, 0x41, 0x22, 0x80, 0x39, 0x01, 0x00, 0x08, 0x40, 0x82, 0x00, 0x00,
+0x00, 0x08, 0x40, 0x80, 0x39, 0x01, 0x04, 0x41, 0x22, 0x49, 0x42, 0x41, 0x21, 0x39, 0x01, 0x30,
+0xE1, 0x94, 0x00, 0x00, 0x93, 0x00, 0x00, 0x02, 0x10, 0x60, 0x39, 0x01, 0x41, 0x22, 0x81, 0x69,
+0xE3, 0x02, 0x51, 0x62, 0x39, 0x01, 0x30, 0xE1, 0x82, 0x00, 0x00, 0x02, 0x30, 0xE1, 0x39, 0x01,
+0x51, 0x62, 0x81, 0x69, 0xE3, 0x02, 0x41, 0x42, 0x39, 0x01, 0x10, 0x60, 0x93, 0x00, 0x00, 0x93,
+0x00, 0x00, 0x02, 0x20, 0xA1, 0x39, 0x01, 0x51, 0x82, 0x82, 0x69, 0xE3, 0x01, 0x41, 0x21, 0x39,
+0x01, 0x82, 0x00, 0x00, 0x01, 0x39, 0x01, 0x41, 0x21, 0x82, 0x69, 0xE3, 0x02, 0x51, 0x82, 0x39,
+0x01, 0x20, 0x80, 0x93, 0x00, 0x00, 0x83, 0x00, 0x00, 0x02, 0x28, 0xC0, 0x39, 0x01, 0x10, 0x40,
+0x8B, 0x00, 0x00, 0x02, 0x20, 0x81, 0x39, 0x01, 0x51, 0x82, 0x82, 0x69, 0xE3, 0x02, 0x41, 0x22,
+0x39, 0x01, 0x00, 0x20, 0x80, 0x00, 0x00, 0x02, 0x08, 0x20, 0x39, 0x01, 0x41, 0x22, 0x82, 0x69,
+0xE3, 0x02, 0x51, 0x62, 0x39, 0x01, 0x20, 0x80, 0x8B, 0x00, 0x00, 0x02, 0x10, 0x40, 0x39, 0x01,
+0x28, 0xC0, 0x83, 0x00, 0x00, 0x81, 0x00, 0x00, 0x01, 0x10, 0x40, 0xED, 0x09, 0x81, 0xED, 0x0A,
+0x03, 0xEC, 0xE9, 0xCC, 0x26, 0x82, 0x63, 0x08, 0x20, 0x87, 0x00, 0x00, 0x03, 0x08, 0x40, 0x39,
+0x01, 0x39, 0x21, 0x61, 0xC3, 0x80, 0x69, 0xE3, 0x00, 0x59, 0xA2, 0x80, 0x39, 0x01, 0x82, 0x00,
+0x00, 0x80, 0x39, 0x01, 0x00, 0x59, 0xA2, 0x80, 0x69, 0xE3, 0x03, 0x61, 0xC3, 0x39, 0x21, 0x39,
+0x01, 0x08, 0x40, 0x87, 0x00, 0x00, 0x03, 0x08, 0x20, 0x82, 0x83, 0xCC, 0x26, 0xEC, 0xE9, 0x81,
+0xED, 0x0A, 0x01, 0xED, 0x09, 0x10, 0x40, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x01, 0x49, 0x82,
+0xED, 0x0A, 0x80, 0xED, 0x09, 0x82, 0xED, 0x0A, 0x02, 0xEC, 0xE9, 0xB3, 0x65, 0x10, 0x40, 0x86,
+0x00, 0x00, 0x00, 0x30, 0xE1, 0x80, 0x39, 0x01, 0x01, 0x41, 0x42, 0x41, 0x22, 0x80, 0x39, 0x01,
+0x00, 0x28, 0xC0, 0x82, 0x00, 0x00, 0x00, 0x28, 0xC0, 0x80, 0x39, 0x01, 0x01, 0x41, 0x22, 0x41,
+0x42, 0x80, 0x39, 0x01, 0x00, 0x38, 0xE1, 0x86, 0x00, 0x00, 0x02, 0x10, 0x40, 0xB3, 0x65, 0xEC,
+0xE9, 0x82, 0xED, 0x0A, 0x80, 0xED, 0x09, 0x01, 0xED, 0x0A, 0x49, 0x62, 0x81, 0x00, 0x00, 0x81,
+0x00, 0x00, 0x02, 0x7A, 0x84, 0xED, 0x0A, 0xDC, 0x66, 0x80, 0xFC, 0x20, 0x02, 0xFC, 0x62, 0xF4,
+0x84, 0xF4, 0xE8, 0x80, 0xED, 0x0A, 0x01, 0xEC, 0xC8, 0x31, 0x01, 0x85, 0x00, 0x00, 0x02, 0x28,
+0xC0, 0x82, 0x21, 0x41, 0x21, 0x80, 0x39, 0x01, 0x02, 0x49, 0x41, 0x92, 0x60, 0x28, 0xC0, 0x82,
+0x00, 0x00, 0x02, 0x28, 0xC0, 0x92, 0x60, 0x49, 0x41, 0x80, 0x39, 0x01, 0x02, 0x41, 0x21, 0x82,
+0x21, 0x28, 0xA0, 0x85, 0x00, 0x00, 0x01, 0x39, 0x01, 0xEC, 0xC8, 0x80, 0xED, 0x0A, 0x02, 0xF4,
+0xE8, 0xF4, 0xA4, 0xFC, 0x42, 0x80, 0xFC, 0x20, 0x02, 0xDC, 0x66, 0xED, 0x0A, 0x72, 0x64, 0x81,
+0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x93, 0x05, 0xED, 0x0A, 0xA3, 0x45, 0xA2, 0xA0, 0x82, 0xFC,
+0x20, 0x04, 0xFC, 0x62, 0xF4, 0xE8, 0xED, 0x0A, 0xEC, 0xC8, 0x10, 0x40, 0x84, 0x00, 0x00, 0x04,
+0x30, 0xC0, 0xCB, 0x40, 0xC3, 0x40, 0xBB, 0x83, 0xC3, 0xA3, 0x80, 0xCB, 0x40, 0x00, 0x39, 0x00,
+0x82, 0x00, 0x00, 0x00, 0x41, 0x00, 0x80, 0xCB, 0x40, 0x04, 0xC3, 0xA3, 0xBB, 0x83, 0xC3, 0x40,
+0xCB, 0x40, 0x28, 0xC0, 0x84, 0x00, 0x00, 0x04, 0x10, 0x60, 0xEC, 0xC8, 0xED, 0x0A, 0xF4, 0xE8,
+0xFC, 0x62, 0x82, 0xFC, 0x20, 0x03, 0x9A, 0x80, 0xA3, 0x45, 0xED, 0x0A, 0x93, 0x05, 0x81, 0x00,
+0x00, 0x81, 0x00, 0x00, 0x05, 0x9B, 0x25, 0xED, 0x0A, 0xA3, 0x45, 0x51, 0x61, 0x61, 0x80, 0xB2,
+0xE0, 0x81, 0xFC, 0x20, 0x03, 0xFC, 0x40, 0xF4, 0xE8, 0xED, 0x0A, 0xD4, 0x26, 0x84, 0x00, 0x00,
+0x02, 0x41, 0x20, 0xCB, 0x40, 0xCB, 0x60, 0x80, 0xE4, 0x43, 0x02, 0xD3, 0x80, 0xCB, 0x40, 0x59,
+0x60, 0x82, 0x00, 0x00, 0x02, 0x59, 0x60, 0xCB, 0x40, 0xD3, 0x80, 0x80, 0xE4, 0x43, 0x02, 0xCB,
+0x60, 0xCB, 0x40, 0x41, 0x00, 0x84, 0x00, 0x00, 0x03, 0xD4, 0x26, 0xED, 0x0A, 0xF4, 0xE8, 0xFC,
+0x40, 0x81, 0xFC, 0x20, 0x05, 0xB2, 0xC0, 0x61, 0x80, 0x51, 0x61, 0xA3, 0x65, 0xED, 0x0A, 0x93,
+0x25, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x0A, 0x93, 0x05, 0xED, 0x0A, 0xB3, 0x86, 0x59, 0xA1,
+0x51, 0x61, 0x49, 0x40, 0x51, 0x60, 0xA2, 0xA0, 0xFC, 0x00, 0xFC, 0x20, 0xFC, 0x41, 0x80, 0xED,
+0x0A, 0x00, 0x59, 0xC2, 0x83, 0x00, 0x00, 0x02, 0x61, 0xA0, 0xCB, 0x40, 0xD3, 0x81, 0x80, 0xE4,
+0x43, 0x02, 0xD3, 0xA1, 0xCB, 0x40, 0x82, 0x00, 0x82, 0x00, 0x00, 0x02, 0x82, 0x20, 0xCB, 0x40,
+0xD3, 0xA1, 0x80, 0xE4, 0x43, 0x02, 0xD3, 0x80, 0xCB, 0x40, 0x61, 0x80, 0x83, 0x00, 0x00, 0x00,
+0x61, 0xC2, 0x80, 0xED, 0x0A, 0x0A, 0xFC, 0x41, 0xFC, 0x20, 0xFC, 0x00, 0x9A, 0x80, 0x51, 0x60,
+0x49, 0x40, 0x51, 0x61, 0x59, 0xA1, 0xB3, 0xA6, 0xED, 0x0A, 0x93, 0x05, 0x81, 0x00, 0x00, 0x81,
+0x00, 0x00, 0x0D, 0x72, 0x44, 0xED, 0x0A, 0xC4, 0x07, 0x61, 0xC1, 0x59, 0xA1, 0x51, 0x61, 0x49,
+0x40, 0x41, 0x00, 0x49, 0x40, 0xBB, 0x00, 0xFC, 0x20, 0xF4, 0xA5, 0xED, 0x0A, 0xDC, 0x87, 0x83,
+0x00, 0x00, 0x06, 0x92, 0x60, 0xCB, 0x40, 0xD3, 0xA1, 0xE4, 0x64, 0xEC, 0xC7, 0xEC, 0xC8, 0xEC,
+0xE9, 0x80, 0xED, 0x09, 0x80, 0xED, 0x0A, 0x80, 0xE4, 0xE9, 0x06, 0xE4, 0xA8, 0xDC, 0x87, 0xDC,
+0x86, 0xE4, 0x44, 0xD3, 0xC1, 0xCB, 0x40, 0x92, 0x60, 0x83, 0x00, 0x00, 0x0D, 0xE4, 0x87, 0xED,
+0x0A, 0xF4, 0xA5, 0xFC, 0x20, 0xBB, 0x00, 0x49, 0x40, 0x41, 0x00, 0x49, 0x40, 0x51, 0x61, 0x59,
+0xA1, 0x61, 0xC1, 0xC4, 0x07, 0xED, 0x0A, 0x6A, 0x44, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x0E,
+0x39, 0x22, 0xED, 0x0A, 0xE4, 0xC9, 0x72, 0x01, 0x61, 0xC1, 0x59, 0xA1, 0x51, 0x61, 0x49, 0x40,
+0x41, 0x00, 0x38, 0xE0, 0x92, 0x40, 0xFC, 0x40, 0xED, 0x09, 0xED, 0x0A, 0x41, 0x41, 0x81, 0x00,
+0x00, 0x03, 0x10, 0x40, 0xCB, 0x60, 0xE4, 0x86, 0xED, 0x09, 0x8C, 0xED, 0x0A, 0x03, 0xDC, 0xA8,
+0xDC, 0x25, 0xC3, 0x40, 0x10, 0x40, 0x81, 0x00, 0x00, 0x0E, 0x49, 0x61, 0xED, 0x0A, 0xED, 0x09,
+0xFC, 0x40, 0x92, 0x40, 0x38, 0xE0, 0x41, 0x00, 0x49, 0x40, 0x51, 0x61, 0x59, 0xA1, 0x61, 0xC1,
+0x72, 0x02, 0xE4, 0xC9, 0xED, 0x0A, 0x31, 0x01, 0x81, 0x00, 0x00, 0x82, 0x00, 0x00, 0x0D, 0xD4,
+0x88, 0xED, 0x0A, 0x9B, 0x24, 0x69, 0xE1, 0x61, 0xC1, 0x59, 0xA1, 0x51, 0x61, 0x49, 0x40, 0x41,
+0x20, 0x38, 0xE0, 0xAA, 0xC0, 0xF4, 0xC6, 0xED, 0x0A, 0xBB, 0xA5, 0x80, 0x00, 0x00, 0x01, 0x00,
+0x20, 0xC4, 0x07, 0x81, 0xED, 0x0A, 0x03, 0xED, 0x09, 0xEC, 0xE8, 0xF4, 0xC7, 0xF4, 0xA5, 0x80,
+0xF4, 0x85, 0x06, 0xF4, 0x84, 0xC3, 0xA4, 0xB3, 0x63, 0xBB, 0x84, 0xC3, 0xC5, 0xCC, 0x27, 0xDC,
+0xA8, 0x81, 0xED, 0x0A, 0x01, 0xE4, 0xC9, 0xB3, 0x65, 0x81, 0x00, 0x00, 0x0D, 0xBB, 0xA5, 0xED,
+0x0A, 0xF4, 0xC6, 0xAA, 0xC0, 0x38, 0xE0, 0x41, 0x20, 0x49, 0x40, 0x51, 0x61, 0x59, 0xA1, 0x61,
+0xC1, 0x69, 0xE1, 0xA3, 0x25, 0xED, 0x0A, 0xD4, 0x88, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x10,
+0x7A, 0x84, 0xED, 0x0A, 0xE4, 0xC9, 0x82, 0x42, 0x69, 0xE1, 0x61, 0xC1, 0x59, 0xA1, 0x51, 0x61,
+0x49, 0x40, 0x41, 0x20, 0x41, 0x00, 0xF4, 0x43, 0xED, 0x0A, 0xEC, 0xE8, 0x00, 0x00, 0x20, 0xC1,
+0xE4, 0xE9, 0x80, 0xED, 0x0A, 0x01, 0xEC, 0xE8, 0xF4, 0xA6, 0x85, 0xF4, 0x84, 0x00, 0xDC, 0x24,
+0x83, 0xAB, 0x43, 0x02, 0xB3, 0x64, 0xCC, 0x06, 0xE4, 0xE9, 0x80, 0xED, 0x0A, 0x00, 0xD4, 0x68,
+0x80, 0x00, 0x00, 0x0D, 0xEC, 0xE8, 0xED, 0x0A, 0xF4, 0x43, 0x41, 0x00, 0x41, 0x20, 0x49, 0x40,
+0x51, 0x61, 0x59, 0xA1, 0x61, 0xC1, 0x69, 0xE1, 0x82, 0x62, 0xE4, 0xC9, 0xED, 0x0A, 0x7A, 0x84,
+0x82, 0x00, 0x00, 0x83, 0x00, 0x00, 0x0D, 0xCC, 0x48, 0xED, 0x0A, 0xDC, 0xA9, 0x82, 0x83, 0x69,
+0xE1, 0x61, 0xC1, 0x59, 0xA1, 0x51, 0x61, 0x49, 0x40, 0x41, 0x20, 0x9A, 0x80, 0xED, 0x09, 0xED,
+0x0A, 0x59, 0xE3, 0x80, 0xED, 0x0A, 0x03, 0xED, 0x09, 0xF4, 0xA6, 0xF4, 0x84, 0xF4, 0x64, 0x86,
+0xF4, 0x84, 0x00, 0xCB, 0xC3, 0x85, 0xAB, 0x43, 0x00, 0xCC, 0x26, 0x80, 0xED, 0x0A, 0x0E, 0xE4,
+0xC8, 0x49, 0x62, 0xED, 0x0A, 0xED, 0x09, 0x9A, 0x60, 0x41, 0x20, 0x49, 0x40, 0x51, 0x61, 0x59,
+0xA1, 0x61, 0xC1, 0x69, 0xE1, 0x82, 0x83, 0xDC, 0xA9, 0xED, 0x0A, 0xCC, 0x48, 0x83, 0x00, 0x00,
+0x83, 0x00, 0x00, 0x0B, 0x20, 0xA1, 0xDC, 0xA9, 0xED, 0x0A, 0xE4, 0xE9, 0xAB, 0x65, 0x72, 0x01,
+0x61, 0xC1, 0x59, 0xA1, 0x51, 0x61, 0x49, 0x40, 0x71, 0xC0, 0xF4, 0xC7, 0x81, 0xED, 0x0A, 0x07,
+0xEC, 0xE8, 0xEC, 0x64, 0xC3, 0xA3, 0xB3, 0x43, 0xAB, 0x43, 0xB3, 0x63, 0xD3, 0xE3, 0xF4, 0x64,
+0x84, 0xF4, 0x84, 0x00, 0xCB, 0xC3, 0x84, 0xAB, 0x43, 0x01, 0xC3, 0xA3, 0xEC, 0xA6, 0x80, 0xED,
+0x0A, 0x0D, 0xE4, 0xE9, 0xED, 0x0A, 0xF4, 0xC7, 0x69, 0xC0, 0x49, 0x40, 0x51, 0x61, 0x59, 0xA1,
+0x61, 0xC1, 0x72, 0x01, 0xAB, 0x65, 0xE4, 0xE9, 0xED, 0x0A, 0xDC, 0xA9, 0x20, 0xA1, 0x83, 0x00,
+0x00, 0x84, 0x00, 0x00, 0x01, 0x18, 0x81, 0xC4, 0x07, 0x80, 0xED, 0x0A, 0x0B, 0xDC, 0xA9, 0xA3,
+0x25, 0x72, 0x02, 0x59, 0xA1, 0x51, 0x61, 0x61, 0xA0, 0xF4, 0x85, 0xED, 0x2B, 0xED, 0x0A, 0xED,
+0x4B, 0xEC, 0xC7, 0xB3, 0x63, 0x83, 0xAB, 0x43, 0x01, 0xBB, 0x83, 0xF4, 0x64, 0x84, 0xF4, 0x84,
+0x01, 0xE4, 0x44, 0xCB, 0xC3, 0x80, 0xC3, 0xA3, 0x01, 0xCB, 0xC3, 0xE4, 0x44, 0x80, 0xF4, 0x84,
+0x0A, 0xF5, 0x08, 0xED, 0x2A, 0xED, 0x0A, 0xED, 0x4B, 0xF4, 0x84, 0x61, 0xA0, 0x51, 0x61, 0x59,
+0xA1, 0x72, 0x02, 0xA3, 0x25, 0xDC, 0xA9, 0x80, 0xED, 0x0A, 0x01, 0xC4, 0x07, 0x18, 0x81, 0x84,
+0x00, 0x00, 0x86, 0x00, 0x00, 0x01, 0x62, 0x23, 0xDC, 0xA9, 0x81, 0xED, 0x0A, 0x05, 0xCC, 0x48,
+0xB3, 0xA6, 0xAB, 0x65, 0xF4, 0xE8, 0xED, 0x0A, 0xED, 0x2B, 0x80, 0xED, 0xEF, 0x00, 0xD4, 0x67,
+0x84, 0xAB, 0x43, 0x00, 0xD3, 0xE3, 0x8B, 0xF4, 0x84, 0x08, 0xF5, 0x4A, 0xED, 0xF0, 0xED, 0x8D,
+0xED, 0x0A, 0xED, 0x2A, 0xF4, 0xE7, 0xAB, 0x65, 0xB3, 0xA6, 0xCC, 0x68, 0x81, 0xED, 0x0A, 0x01,
+0xDC, 0xA9, 0x62, 0x03, 0x86, 0x00, 0x00, 0x87, 0x00, 0x00, 0x02, 0x00, 0x20, 0x6A, 0x23, 0xCC,
+0x28, 0x82, 0xED, 0x0A, 0x02, 0xED, 0x2A, 0xED, 0x0A, 0xED, 0xAE, 0x81, 0xEE, 0x10, 0x00, 0xDC,
+0xC9, 0x83, 0xAB, 0x43, 0x00, 0xBB, 0x83, 0x83, 0xF4, 0x84, 0x00, 0xDC, 0x04, 0x80, 0xC3, 0xA3,
+0x01, 0xCB, 0xC3, 0xEC, 0x44, 0x80, 0xF4, 0x84, 0x00, 0xED, 0x6C, 0x81, 0xEE, 0x10, 0x02, 0xED,
+0x4C, 0xED, 0x0A, 0xED, 0x4B, 0x82, 0xED, 0x0A, 0x01, 0xC4, 0x28, 0x6A, 0x23, 0x88, 0x00, 0x00,
+0x8A, 0x00, 0x00, 0x05, 0x10, 0x60, 0x59, 0xE3, 0x82, 0xA4, 0xC4, 0x27, 0xED, 0x0A, 0xED, 0x4B,
+0x83, 0xEE, 0x10, 0x00, 0xD4, 0x67, 0x82, 0xAB, 0x43, 0x00, 0xB3, 0x43, 0x81, 0xF4, 0x84, 0x01,
+0xEC, 0x64, 0xBB, 0x83, 0x83, 0xAB, 0x43, 0x01, 0xDC, 0x24, 0xF5, 0x6B, 0x82, 0xEE, 0x10, 0x00,
+0xED, 0xCF, 0x80, 0xED, 0x2A, 0x03, 0xB3, 0xC6, 0x82, 0xA4, 0x59, 0xC3, 0x10, 0x60, 0x8A, 0x00,
+0x00, 0x8D, 0x00, 0x00, 0x02, 0xBC, 0x29, 0xED, 0x0A, 0xED, 0xAD, 0x84, 0xEE, 0x10, 0x00, 0xC3,
+0xC4, 0x81, 0xAB, 0x43, 0x00, 0xBB, 0x63, 0x81, 0xF4, 0x84, 0x00, 0xCB, 0xC3, 0x84, 0xAB, 0x43,
+0x00, 0xC3, 0xE5, 0x84, 0xEE, 0x10, 0x02, 0xED, 0x6C, 0xED, 0x0A, 0x9B, 0x88, 0x8D, 0x00, 0x00,
+0x8D, 0x00, 0x00, 0x80, 0xED, 0x0A, 0x00, 0xF6, 0x10, 0x84, 0xF6, 0x31, 0x01, 0xED, 0xCE, 0xB3,
+0x43, 0x80, 0xAB, 0x43, 0x00, 0xD3, 0xE3, 0x80, 0xF4, 0x84, 0x00, 0xEC, 0x64, 0x84, 0xAB, 0x43,
+0x01, 0xB3, 0x43, 0xED, 0xCE, 0x84, 0xF6, 0x31, 0x02, 0xED, 0xCE, 0xED, 0x0A, 0xDC, 0xEA, 0x8D,
+0x00, 0x00, 0x8C, 0x00, 0x00, 0x02, 0x28, 0xE1, 0xED, 0x0A, 0xED, 0x2B, 0x86, 0xF6, 0x31, 0x03,
+0xD4, 0x67, 0xAB, 0x43, 0xBB, 0x83, 0xEC, 0x64, 0x80, 0xF4, 0x84, 0x00, 0xEC, 0x44, 0x84, 0xAB,
+0x43, 0x00, 0xD4, 0x67, 0x85, 0xF6, 0x31, 0x03, 0xF6, 0x10, 0xED, 0x0A, 0xED, 0x2A, 0x08, 0x20,
+0x8C, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x05, 0x6A, 0x45, 0xED, 0x0A, 0xED, 0x6C, 0xF6, 0x51, 0xEE,
+0x31, 0xBC, 0xEF, 0x80, 0x8C, 0x0D, 0x05, 0xAC, 0xAE, 0xEE, 0x11, 0xF6, 0x51, 0xEE, 0x10, 0xCB,
+0xE4, 0xEC, 0x64, 0x81, 0xF4, 0x84, 0x00, 0xEC, 0x64, 0x83, 0xAB, 0x43, 0x0C, 0xB3, 0x63, 0xEE,
+0x10, 0xF6, 0x51, 0xEE, 0x11, 0xAC, 0xAE, 0x8C, 0x0D, 0x94, 0x0D, 0xBC, 0xEF, 0xEE, 0x31, 0xF6,
+0x51, 0xED, 0x4B, 0xED, 0x0A, 0x41, 0x83, 0x8C, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x04, 0x8B, 0x27,
+0xED, 0x0A, 0xED, 0xAD, 0xE6, 0x11, 0x7B, 0x8D, 0x82, 0x63, 0x0C, 0x03, 0x73, 0x8D, 0xEE, 0x31,
+0xF6, 0x51, 0xF5, 0x6A, 0x83, 0xF4, 0x84, 0x00, 0xBB, 0x83, 0x82, 0xAB, 0x43, 0x03, 0xCC, 0x47,
+0xF6, 0x51, 0xEE, 0x31, 0x73, 0x8D, 0x82, 0x63, 0x0C, 0x04, 0x7B, 0x8D, 0xE6, 0x11, 0xED, 0x6C,
+0xED, 0x0A, 0x72, 0xA6, 0x8C, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x03, 0x9B, 0x88, 0xED, 0x0A, 0xED,
+0xAE, 0x8C, 0x0E, 0x82, 0x63, 0x0C, 0x04, 0x52, 0x8A, 0x94, 0x0C, 0xEE, 0x51, 0xF6, 0x51, 0xF6,
+0x30, 0x83, 0xF4, 0x84, 0x01, 0xE4, 0x44, 0xB3, 0x43, 0x81, 0xAB, 0x43, 0x04, 0xED, 0xEF, 0xF6,
+0x51, 0xEE, 0x51, 0x8B, 0xEC, 0x52, 0x8A, 0x82, 0x63, 0x0C, 0x03, 0x8C, 0x0E, 0xED, 0x8D, 0xED,
+0x0A, 0x8B, 0x27, 0x8C, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x0A, 0xA3, 0xA8, 0xED, 0x0A, 0xE5, 0xAE,
+0x63, 0x2C, 0x63, 0x0C, 0x5A, 0xCB, 0x42, 0x28, 0x29, 0x45, 0x21, 0x24, 0x31, 0x85, 0xEE, 0x31,
+0x80, 0xF6, 0x72, 0x00, 0xF5, 0x08, 0x83, 0xF4, 0x84, 0x03, 0xEC, 0x44, 0xC3, 0xA3, 0xB3, 0x43,
+0xC3, 0xC4, 0x80, 0xF6, 0x72, 0x0A, 0xE6, 0x31, 0x31, 0x85, 0x21, 0x24, 0x29, 0x45, 0x42, 0x28,
+0x5A, 0xCB, 0x63, 0x0C, 0x63, 0x2C, 0xE5, 0x6D, 0xED, 0x0A, 0x8B, 0x47, 0x8C, 0x00, 0x00, 0x8C,
+0x00, 0x00, 0x04, 0x9B, 0x88, 0xED, 0x0A, 0xED, 0x8E, 0x6B, 0x2B, 0x31, 0xA6, 0x83, 0x21, 0x24,
+0x00, 0xB4, 0xCE, 0x80, 0xF6, 0x72, 0x00, 0xF5, 0xAC, 0x86, 0xF4, 0x84, 0x00, 0xF5, 0x8C, 0x80,
+0xF6, 0x72, 0x00, 0xB4, 0xCE, 0x83, 0x21, 0x24, 0x04, 0x39, 0xA6, 0x6B, 0x2B, 0xED, 0x6D, 0xED,
+0x0A, 0x8B, 0x47, 0x8C, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x04, 0x7A, 0xE6, 0xB3, 0xE8, 0x6A, 0xC7,
+0x6B, 0x09, 0x4A, 0x27, 0x83, 0x21, 0x24, 0x00, 0x93, 0xEB, 0x80, 0xF6, 0x92, 0x00, 0xF6, 0x0F,
+0x86, 0xF4, 0x84, 0x00, 0xF6, 0x0F, 0x80, 0xF6, 0x92, 0x00, 0x8B, 0xEB, 0x83, 0x21, 0x24, 0x04,
+0x4A, 0x27, 0x6B, 0x09, 0x6A, 0xC7, 0xB4, 0x08, 0x6A, 0x85, 0x8C, 0x00, 0x00, 0x8C, 0x00, 0x00,
+0x04, 0x49, 0xA3, 0xED, 0x0A, 0xED, 0x6C, 0xF6, 0x92, 0x9C, 0x2C, 0x83, 0x21, 0x24, 0x00, 0xA4,
+0x6D, 0x80, 0xF6, 0x92, 0x00, 0xF6, 0x71, 0x86, 0xF4, 0x84, 0x00, 0xF6, 0x71, 0x80, 0xF6, 0x92,
+0x00, 0x9C, 0x4C, 0x83, 0x21, 0x24, 0x04, 0x9C, 0x4C, 0xF6, 0x92, 0xED, 0x4B, 0xED, 0x0A, 0x31,
+0x43, 0x8C, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x05, 0x08, 0x40, 0xED, 0x2A, 0xED, 0x0A, 0xF6, 0x72,
+0xEE, 0x72, 0x4A, 0x47, 0x81, 0x21, 0x24, 0x01, 0x29, 0x45, 0xDE, 0x11, 0x80, 0xF6, 0x93, 0x00,
+0xF6, 0x72, 0x86, 0xF4, 0x84, 0x00, 0xF6, 0x72, 0x80, 0xF6, 0x93, 0x01, 0xDD, 0xF1, 0x29, 0x45,
+0x81, 0x21, 0x24, 0x04, 0x52, 0x47, 0xF6, 0x92, 0xF6, 0x72, 0xED, 0x0A, 0xED, 0x2A, 0x8D, 0x00,
+0x00, 0x8D, 0x00, 0x00, 0x08, 0xDC, 0xEB, 0xED, 0x0A, 0xF6, 0x10, 0xF6, 0xB3, 0xEE, 0x52, 0x73,
+0x2A, 0x29, 0x45, 0x31, 0xA5, 0xAC, 0xCE, 0x81, 0xF6, 0xB3, 0x00, 0xF6, 0x0E, 0x86, 0xF4, 0x84,
+0x00, 0xF6, 0x2F, 0x81, 0xF6, 0xB3, 0x08, 0xAC, 0xAE, 0x31, 0x85, 0x29, 0x45, 0x73, 0x4A, 0xEE,
+0x52, 0xF6, 0xB3, 0xF6, 0x0F, 0xED, 0x0A, 0xD4, 0xCB, 0x8D, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x02,
+0x9B, 0xA8, 0xED, 0x0A, 0xF5, 0xAD, 0x87, 0xF6, 0xB3, 0x00, 0xF4, 0xE6, 0x86, 0xF4, 0x84, 0x00,
+0xF5, 0x08, 0x87, 0xF6, 0xB3, 0x02, 0xF5, 0x8D, 0xED, 0x0A, 0x93, 0x88, 0x8D, 0x00, 0x00, 0x8D,
+0x00, 0x00, 0x02, 0x29, 0x02, 0xED, 0x0A, 0xED, 0x2A, 0x86, 0xF6, 0xB3, 0x00, 0xF6, 0x2F, 0x88,
+0xF4, 0x84, 0x00, 0xF6, 0x50, 0x86, 0xF6, 0xB3, 0x80, 0xED, 0x2A, 0x00, 0x28, 0xE2, 0x8D, 0x00,
+0x00, 0x8E, 0x00, 0x00, 0x02, 0xDD, 0x0B, 0xED, 0x0A, 0xF6, 0x10, 0x85, 0xF6, 0xD3, 0x00, 0xF4,
+0xC6, 0x88, 0xF4, 0x84, 0x00, 0xF4, 0xC6, 0x85, 0xF6, 0xD3, 0x02, 0xF6, 0x30, 0xED, 0x0A, 0xDD,
+0x0B, 0x8E, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x02, 0x93, 0xA9, 0xED, 0x0A, 0xED, 0x6C, 0x84, 0xF6,
+0xD3, 0x00, 0xF5, 0xCD, 0x8A, 0xF4, 0x64, 0x00, 0xF5, 0xEE, 0x84, 0xF6, 0xD3, 0x02, 0xF5, 0xAD,
+0xED, 0x0A, 0x93, 0x68, 0x8E, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x03, 0x18, 0xA2, 0xED, 0x2A, 0xED,
+0x0A, 0xF6, 0x92, 0x82, 0xF6, 0xD4, 0x01, 0xF6, 0xB3, 0xF4, 0xA5, 0x8A, 0xF4, 0x64, 0x01, 0xF4,
+0xA5, 0xF6, 0xD3, 0x82, 0xF6, 0xD4, 0x03, 0xF6, 0xB3, 0xED, 0x2A, 0xED, 0x0A, 0x18, 0xA1, 0x8E,
+0x00, 0x00, 0x8F, 0x00, 0x00, 0x02, 0xE5, 0x4C, 0xED, 0x0A, 0xF5, 0xCE, 0x82, 0xF6, 0xF4, 0x00,
+0xF5, 0x8C, 0x8C, 0xEC, 0x64, 0x00, 0xF5, 0xAC, 0x82, 0xF6, 0xF4, 0x02, 0xF6, 0x30, 0xED, 0x0A,
+0xD4, 0xCA, 0x8F, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x03, 0x7B, 0x08, 0xED, 0x0A, 0xED, 0x2B, 0xF6,
+0xD4, 0x80, 0xF6, 0xF4, 0x01, 0xF6, 0xD3, 0xEC, 0x64, 0x8C, 0xEC, 0x44, 0x01, 0xEC, 0x85, 0xF6,
+0xD3, 0x81, 0xF6, 0xF4, 0x02, 0xED, 0x6C, 0xED, 0x0A, 0x72, 0xA6, 0x8F, 0x00, 0x00, 0x90, 0x00,
+0x00, 0x02, 0xED, 0x4C, 0xED, 0x0A, 0xF6, 0x30, 0x80, 0xF6, 0xF4, 0x00, 0xF5, 0xAC, 0x8E, 0xEC,
+0x44, 0x00, 0xF5, 0xAC, 0x80, 0xF6, 0xF4, 0x03, 0xF6, 0x92, 0xED, 0x0A, 0xED, 0x2A, 0x00, 0x20,
+0x8F, 0x00, 0x00, 0x90, 0x00, 0x00, 0x05, 0xBC, 0x8C, 0xED, 0x0A, 0xED, 0x6C, 0xF7, 0x14, 0xF6,
+0xF4, 0xEC, 0x65, 0x8E, 0xEC, 0x23, 0x05, 0xEC, 0x65, 0xF6, 0xF4, 0xF7, 0x14, 0xF5, 0xCE, 0xED,
+0x0A, 0xAC, 0x09, 0x90, 0x00, 0x00, 0x90, 0x00, 0x00, 0x04, 0x18, 0xC2, 0xED, 0x2B, 0xED, 0x0A,
+0xF6, 0x92, 0xF6, 0x2F, 0x90, 0xE4, 0x23, 0x04, 0xF6, 0x0F, 0xF6, 0xF4, 0xED, 0x2B, 0xED, 0x0A,
+0x29, 0x02, 0x90, 0x00, 0x00, 0x91, 0x00, 0x00, 0x03, 0xBC, 0x8B, 0xED, 0x0A, 0xF5, 0xAD, 0xED,
+0x2A, 0x81, 0xE4, 0x03, 0x01, 0xE3, 0xE3, 0xB3, 0x44, 0x86, 0xE4, 0x03, 0x01, 0xB3, 0x44, 0xE3,
+0xE3, 0x81, 0xE4, 0x03, 0x03, 0xED, 0x09, 0xF6, 0x30, 0xED, 0x0A, 0xD4, 0xCA, 0x91, 0x00, 0x00,
+0x91, 0x00, 0x00, 0x03, 0x21, 0x02, 0xED, 0x2B, 0xED, 0x0A, 0xE4, 0x86, 0x81, 0xE3, 0xE3, 0x03,
+0xC3, 0x83, 0x49, 0xA5, 0x72, 0x45, 0xDB, 0xE3, 0x82, 0xE3, 0xE3, 0x03, 0xDB, 0xE3, 0x72, 0x25,
+0x49, 0xA5, 0xC3, 0x83, 0x81, 0xE3, 0xE3, 0x03, 0xE4, 0x24, 0xED, 0x4B, 0xED, 0x0A, 0x51, 0xE4,
+0x91, 0x00, 0x00, 0x92, 0x00, 0x00, 0x02, 0xCC, 0xEB, 0xED, 0x0A, 0xEC, 0xA8, 0x81, 0xE3, 0xE3,
+0x03, 0xDB, 0xE3, 0x59, 0xE5, 0x49, 0xA5, 0x82, 0x64, 0x82, 0xE3, 0xE3, 0x03, 0x82, 0x64, 0x49,
+0xA5, 0x59, 0xE5, 0xDB, 0xE3, 0x81, 0xE3, 0xE3, 0x02, 0xE4, 0x46, 0xED, 0x0A, 0xDD, 0x0B, 0x92,
+0x00, 0x00, 0x92, 0x00, 0x00, 0x03, 0x39, 0xA4, 0xED, 0x2A, 0xED, 0x0A, 0xDB, 0xE4, 0x81, 0xDB,
+0xC2, 0x00, 0xA2, 0xE4, 0x80, 0x49, 0xA5, 0x00, 0xAB, 0x03, 0x80, 0xDB, 0xC2, 0x00, 0xAB, 0x03,
+0x80, 0x49, 0xA5, 0x00, 0xA2, 0xE3, 0x82, 0xDB, 0xC2, 0x02, 0xEC, 0xE9, 0xED, 0x0A, 0x72, 0xA6,
+0x92, 0x00, 0x00, 0x93, 0x00, 0x00, 0x02, 0xDC, 0xEA, 0xED, 0x0A, 0xE4, 0x87, 0x81, 0xDB, 0xA2,
+0x03, 0xD3, 0x82, 0x72, 0x24, 0x49, 0xA5, 0x6A, 0x05, 0x80, 0xDB, 0xA2, 0x03, 0x6A, 0x05, 0x49,
+0xA5, 0x72, 0x24, 0xD3, 0x82, 0x81, 0xDB, 0xA2, 0x00, 0xDC, 0x04, 0x80, 0xED, 0x0A, 0x93, 0x00,
+0x00, 0x93, 0x00, 0x00, 0x02, 0x82, 0xC5, 0xED, 0x0A, 0xEC, 0xC8, 0x82, 0xD3, 0x82, 0x02, 0xCB,
+0x62, 0x6A, 0x04, 0x49, 0xA5, 0x80, 0xCB, 0x62, 0x02, 0x49, 0xA5, 0x6A, 0x04, 0xCB, 0x62, 0x82,
+0xD3, 0x82, 0x02, 0xDC, 0x25, 0xED, 0x0A, 0xB3, 0xC7, 0x93, 0x00, 0x00, 0x93, 0x00, 0x00, 0x02,
+0x61, 0xE2, 0xED, 0x0A, 0xE4, 0xA8, 0x83, 0xD3, 0x61, 0x01, 0xD3, 0x62, 0xB2, 0xE2, 0x80, 0xD3,
+0x61, 0x01, 0xB2, 0xE2, 0xD3, 0x62, 0x83, 0xD3, 0x61, 0x02, 0xDC, 0x25, 0xED, 0x0A, 0x93, 0x05,
+0x93, 0x00, 0x00, 0x93, 0x00, 0x00, 0x02, 0x41, 0x62, 0xED, 0x0A, 0xEC, 0xC9, 0x8E, 0xCB, 0x41,
+0x02, 0xDC, 0x26, 0xED, 0x0A, 0x7A, 0xA5, 0x93, 0x00, 0x00, 0x93, 0x00, 0x00, 0x02, 0x18, 0x80,
+0xED, 0x0A, 0xEC, 0xE9, 0x8E, 0xCB, 0x21, 0x02, 0xE4, 0x87, 0xED, 0x0A, 0x51, 0xC3, 0x93, 0x00,
+0x00, 0x94, 0x00, 0x00, 0x02, 0xDC, 0xA9, 0xED, 0x0A, 0xCB, 0x83, 0x8C, 0xC2, 0xE0, 0x00, 0xC3,
+0x01, 0x80, 0xED, 0x0A, 0x00, 0x18, 0x81, 0x93, 0x00, 0x00, 0x94, 0x00, 0x00, 0x02, 0x8A, 0xE6,
+0xED, 0x0A, 0xDC, 0x47, 0x8C, 0xC2, 0xC0, 0x02, 0xD3, 0xE6, 0xED, 0x0A, 0xB3, 0xC7, 0x94, 0x00,
+0x00, 0x94, 0x00, 0x00, 0x06, 0x20, 0xA1, 0xEC, 0xEA, 0xED, 0x0A, 0x9B, 0x26, 0x8A, 0x42, 0xA2,
+0x81, 0xB2, 0xA0, 0x84, 0xBA, 0xA0, 0x03, 0xB2, 0x80, 0x9A, 0x61, 0x8A, 0x42, 0x7A, 0xC6, 0x80,
+0xED, 0x0A, 0x00, 0x39, 0x42, 0x94, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x6A, 0x44, 0x80, 0xED,
+0x0A, 0x00, 0x93, 0x68, 0x80, 0x39, 0xC7, 0x00, 0x39, 0xC6, 0x82, 0x41, 0xC6, 0x00, 0x39, 0xC6,
+0x80, 0x39, 0xC7, 0x03, 0x6A, 0xA7, 0xE4, 0xEA, 0xED, 0x0A, 0x8B, 0x06, 0x95, 0x00, 0x00, 0x96,
+0x00, 0x00, 0x00, 0x7A, 0xA5, 0x80, 0xED, 0x0A, 0x01, 0xB4, 0x09, 0x41, 0xE7, 0x85, 0x39, 0xC7,
+0x00, 0x7B, 0x08, 0x80, 0xED, 0x0A, 0x00, 0x9B, 0x67, 0x96, 0x00, 0x00, 0x97, 0x00, 0x00, 0x04,
+0x49, 0x83, 0xDC, 0xC9, 0xED, 0x0A, 0xD4, 0xA9, 0x72, 0xC8, 0x82, 0x39, 0xC7, 0x01, 0x52, 0x47,
+0xB4, 0x09, 0x80, 0xED, 0x0A, 0x00, 0x7A, 0xA5, 0x97, 0x00, 0x00, 0x98, 0x00, 0x00, 0x01, 0x20,
+0xC1, 0xC4, 0x48, 0x80, 0xED, 0x0A, 0x00, 0xE4, 0xEA, 0x80, 0xC4, 0x49, 0x00, 0xD4, 0xAA, 0x80,
+0xED, 0x0A, 0x01, 0xE4, 0xEA, 0x5A, 0x04, 0x98, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x01, 0x62, 0x04,
+0xBC, 0x08, 0x82, 0xED, 0x0A, 0x02, 0xDC, 0xA9, 0x82, 0xE5, 0x18, 0x81, 0x99, 0x00, 0x00, 0x9C,
+0x00, 0x00, 0x03, 0x10, 0x60, 0x31, 0x02, 0x39, 0x22, 0x18, 0xA1, 0x9C, 0x00, 0x00, 0xBE, 0x00,
+0x00,
+};
+static const uint16_t NotoGiraffe64_PACKED_ROWS[64] PROGMEM = {
+0x0000, 0x0003, 0x001A, 0x0039, 0x0064, 0x008F, 0x00B6, 0x00F5, 0x014A, 0x019F, 0x0202, 0x0261, 0x02C4, 0x032F, 0x039C, 0x03FB,
+0x046C, 0x04D3, 0x0530, 0x0591, 0x05F2, 0x0637, 0x0680, 0x06C1, 0x06F0, 0x0722, 0x0753, 0x079A, 0x07D7, 0x0816, 0x085F, 0x0896,
+0x08CD, 0x0904, 0x0941, 0x097C, 0x099F, 0x09C1, 0x09E4, 0x0A07, 0x0A32, 0x0A55, 0x0A7E, 0x0AA3, 0x0AC6, 0x0AE5, 0x0B10, 0x0B43,
+0x0B72, 0x0BA3, 0x0BD1, 0x0BFC, 0x0C23, 0x0C3A, 0x0C51, 0x0C6A, 0x0C81, 0x0CA8, 0x0CCF, 0x0CEC, 0x0D0B, 0x0D2A, 0x0D3F, 0x0D4E,
+};
+const PackedImage NotoGiraffe64_PACKED = { 64, 64, PackedImage::Rle565, 0, 3409, nullptr, NotoGiraffe64_PACKED_ROWS, NotoGiraffe64_PACKED_DATA };
+
+// cat_paw: 16x16 rle565, 429 bytes of flash
+static const uint8_t cat_paw_PACKED_DATA[397] PROGMEM = {
+0x82, 0x00, 0x00, 0x01, 0x4A, 0x69, 0x7B, 0xCF, 0x81, 0x00, 0x00, 0x02, 0x21, 0x04, 0xA5, 0x14,
+0x9C, 0xF3, 0x82, 0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x63, 0x2C, 0xF7, 0xBE, 0xFF, 0xFF, 0xBD,
+0xF7, 0x80, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xB5, 0x96, 0x81, 0x00, 0x00,
+0x81, 0x00, 0x00, 0x00, 0xC6, 0x18, 0x80, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0x00, 0x00, 0x5A, 0xEB,
+0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0xD6, 0xBA, 0x81,
+0xFF, 0xFF, 0x01, 0x00, 0x00, 0x7B, 0xEF, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x81, 0x00, 0x00,
+0x81, 0x00, 0x00, 0x00, 0xBD, 0xF7, 0x80, 0xFF, 0xFF, 0x02, 0xF7, 0x9E, 0x00, 0x00, 0x31, 0x86,
+0x81, 0xFF, 0xFF, 0x00, 0xD6, 0xBA, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x63, 0x0C, 0xFF,
+0xDF, 0xFF, 0xFF, 0xD6, 0x9A, 0x80, 0x00, 0x00, 0x00, 0xDE, 0xDB, 0x80, 0xFF, 0xFF, 0x00, 0x84,
+0x10, 0x81, 0x00, 0x00, 0x00, 0x63, 0x0C, 0x80, 0xEF, 0x7D, 0x03, 0x63, 0x0C, 0x84, 0x10, 0xC6,
+0x38, 0x52, 0x8A, 0x80, 0x00, 0x00, 0x06, 0x63, 0x0C, 0xC6, 0x38, 0x94, 0x92, 0x00, 0x00, 0xAD,
+0x55, 0xFF, 0xDF, 0xC6, 0x38, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xD6, 0x9A, 0x86, 0x00,
+0x00, 0x00, 0x84, 0x30, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C,
+0x81, 0x00, 0x00, 0x80, 0x7B, 0xEF, 0x81, 0x00, 0x00, 0x00, 0xE7, 0x3C, 0x80, 0xFF, 0xFF, 0x00,
+0xFF, 0xDF, 0x00, 0xF7, 0xBE, 0x80, 0xFF, 0xFF, 0x00, 0xD6, 0xBA, 0x80, 0x00, 0x00, 0x00, 0xCE,
+0x59, 0x80, 0xFF, 0xFF, 0x02, 0xB5, 0xB6, 0x00, 0x00, 0x00, 0x20, 0x81, 0xFF, 0xFF, 0x00, 0xCE,
+0x59, 0x00, 0xB5, 0xB6, 0x80, 0xFF, 0xFF, 0x02, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x75, 0x82, 0xFF,
+0xFF, 0x05, 0x7B, 0xCF, 0x00, 0x00, 0xF7, 0x9E, 0xFF, 0xFF, 0xF7, 0x9E, 0x4A, 0x69, 0x04, 0x00,
+0x00, 0x94, 0xB2, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x55, 0x83, 0xFF, 0xFF, 0x05, 0xF7, 0x9E, 0x63,
+0x0C, 0x52, 0x8A, 0xA5, 0x34, 0x4A, 0x49, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0xBD, 0xD7, 0x85,
+0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xC6, 0x38, 0x39, 0xC7, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+0x08, 0x61, 0x88, 0xFF, 0xFF, 0x00, 0xC6, 0x38, 0x80, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0xF7,
+0x9E, 0x81, 0xFF, 0xFF, 0x01, 0xF7, 0xBE, 0xEF, 0x7D, 0x82, 0xFF, 0xFF, 0x00, 0xA5, 0x34, 0x80,
+0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x63, 0x0C, 0xAD, 0x75, 0xAD, 0x55, 0x6B, 0x6D, 0x80, 0x00,
+0x00, 0x03, 0x00, 0x20, 0x7B, 0xCF, 0x84, 0x10, 0x6B, 0x6D, 0x81, 0x00, 0x00,
+};
+static const uint16_t cat_paw_PACKED_ROWS[16] PROGMEM = {
+0x0000, 0x0015, 0x0030, 0x0049, 0x0060, 0x0079, 0x0094, 0x00B5, 0x00CA, 0x00E2, 0x0101, 0x011E, 0x0139, 0x014C, 0x015B, 0x0172,
+};
+const PackedImage cat_paw_PACKED = { 16, 16, PackedImage::Rle565, 0, 397, nullptr, cat_paw_PACKED_ROWS, cat_paw_PACKED_DATA };
+
+// CAT_WATCH_FACE: 92x92 rle565, 4073 bytes of flash
+static const uint8_t CAT_WATCH_FACE_PACKED_DATA[3889] PROGMEM = {
+0x89, 0x00, 0x00, 0xC4, 0xFF, 0xFF, 0x89, 0x00, 0x00, 0x87, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0x87,
+0x00, 0x00, 0x85, 0x00, 0x00, 0xCC, 0xFF, 0xFF, 0x85, 0x00, 0x00, 0x84, 0x00, 0x00, 0xCE, 0xFF,
+0xFF, 0x84, 0x00, 0x00, 0x83, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x83, 0x00, 0x00, 0x82, 0x00, 0x00,
+0xD2, 0xFF, 0xFF, 0x82, 0x00, 0x00, 0x81, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x80,
+0x00, 0x00, 0xD6, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0xD6, 0xFF, 0xFF, 0x80, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xD8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0xDA, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0xDA,
+0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0xDA, 0xFF,
+0xFF, 0xDA, 0xFF, 0xFF, 0xB6, 0xFF, 0xFF, 0x05, 0xFF, 0x7C, 0xF6, 0x55, 0xEC, 0xEB, 0xEC, 0x60,
+0xED, 0x6F, 0xFF, 0x9D, 0x9C, 0xFF, 0xFF, 0xB4, 0xFF, 0xFF, 0x07, 0xFF, 0x1A, 0xED, 0x6F, 0xEC,
+0xA1, 0xF5, 0x84, 0xFE, 0x25, 0xFE, 0x66, 0xF5, 0xA4, 0xED, 0x0C, 0x9C, 0xFF, 0xFF, 0xB2, 0xFF,
+0xFF, 0x03, 0xFF, 0x7C, 0xED, 0x6F, 0xEC, 0xC1, 0xF5, 0xC4, 0x83, 0xFE, 0x86, 0x01, 0xEC, 0xC1,
+0xFF, 0x3B, 0x9B, 0xFF, 0xFF, 0xB1, 0xFF, 0xFF, 0x02, 0xF6, 0x97, 0xEC, 0xA3, 0xF5, 0xA4, 0x82,
+0xFE, 0x86, 0x04, 0xFE, 0x66, 0xF5, 0x84, 0xEC, 0xA1, 0xEC, 0x80, 0xF6, 0x97, 0x9B, 0xFF, 0xFF,
+0xA7, 0xFF, 0xFF, 0x03, 0xFF, 0xDE, 0xFF, 0x3B, 0xF6, 0xD9, 0xF6, 0x56, 0x80, 0xF6, 0x35, 0x05,
+0xF6, 0x55, 0xF6, 0xD8, 0xFF, 0x3B, 0xF5, 0xF3, 0xEC, 0xE2, 0xFE, 0x45, 0x82, 0xFE, 0x86, 0x01,
+0xFD, 0xE5, 0xEC, 0xA0, 0x81, 0xEC, 0x60, 0x00, 0xF5, 0xF3, 0x9B, 0xFF, 0xFF, 0x99, 0xFF, 0xFF,
+0x00, 0xFF, 0xDF, 0x88, 0xFF, 0xFF, 0x0F, 0xFF, 0x9D, 0xF6, 0x97, 0xED, 0x4E, 0xEC, 0x60, 0xEC,
+0xE2, 0xF5, 0x43, 0xEC, 0x80, 0xEC, 0x60, 0xF5, 0x23, 0xF5, 0x83, 0xF5, 0x63, 0xEC, 0xE2, 0xEC,
+0x80, 0xEC, 0xC1, 0xF5, 0x84, 0xFE, 0x45, 0x80, 0xFE, 0x86, 0x00, 0xF5, 0xC4, 0x83, 0xEC, 0x60,
+0x00, 0xED, 0x6F, 0x9B, 0xFF, 0xFF, 0x96, 0xFF, 0xFF, 0x01, 0xF6, 0x34, 0xEC, 0x85, 0x81, 0xEC,
+0x60, 0x04, 0xEC, 0x81, 0xED, 0x0B, 0xF5, 0xB1, 0xF6, 0x76, 0xFF, 0x3B, 0x80, 0xFF, 0xFF, 0x02,
+0xFF, 0x5C, 0xF5, 0xB1, 0xEC, 0x80, 0x80, 0xEC, 0x60, 0x00, 0xFE, 0x25, 0x80, 0xFE, 0x86, 0x02,
+0xEC, 0xE2, 0xEC, 0x60, 0xF5, 0x84, 0x81, 0xFE, 0x86, 0x05, 0xFE, 0x66, 0xFE, 0x05, 0xF5, 0x43,
+0xEC, 0x80, 0xF5, 0x43, 0xF5, 0xC4, 0x84, 0xEC, 0x60, 0x00, 0xEC, 0xA7, 0x9B, 0xFF, 0xFF, 0x95,
+0xFF, 0xFF, 0x02, 0xF6, 0x55, 0xF5, 0x02, 0xFE, 0x45, 0x81, 0xFE, 0x86, 0x09, 0xFE, 0x66, 0xFE,
+0x25, 0xF5, 0xE4, 0xF5, 0x63, 0xEC, 0xC1, 0xEC, 0xC9, 0xF5, 0x90, 0xEC, 0xA1, 0xF5, 0xA4, 0xFE,
+0x66, 0x80, 0xEC, 0x60, 0x00, 0xFD, 0xE5, 0x80, 0xFE, 0x86, 0x02, 0xF5, 0x63, 0xEC, 0x60, 0xF5,
+0x22, 0x84, 0xFE, 0x86, 0x02, 0xFE, 0x66, 0xF5, 0x63, 0xEC, 0x80, 0x85, 0xEC, 0x60, 0x9B, 0xFF,
+0xFF, 0x95, 0xFF, 0xFF, 0x01, 0xEC, 0xEA, 0xFE, 0x25, 0x86, 0xFE, 0x86, 0x03, 0xFE, 0x05, 0xEC,
+0x80, 0xF5, 0x63, 0xFE, 0x66, 0x80, 0xFE, 0x86, 0x02, 0xEC, 0xC1, 0xEC, 0x60, 0xF5, 0x84, 0x80,
+0xFE, 0x86, 0x02, 0xF5, 0xA4, 0xEC, 0x60, 0xEC, 0xA1, 0x86, 0xFE, 0x86, 0x01, 0xFE, 0x25, 0xEC,
+0xE2, 0x84, 0xEC, 0x60, 0x9B, 0xFF, 0xFF, 0x95, 0xFF, 0xFF, 0x05, 0xEC, 0xEA, 0xF5, 0xA4, 0xF5,
+0x63, 0xF5, 0xA4, 0xFD, 0xE5, 0xFE, 0x66, 0x81, 0xFE, 0x86, 0x02, 0xF5, 0xC4, 0xEC, 0x80, 0xFE,
+0x05, 0x82, 0xFE, 0x86, 0x02, 0xF5, 0x43, 0xEC, 0x60, 0xF5, 0x23, 0x80, 0xFE, 0x86, 0x00, 0xFE,
+0x05, 0x80, 0xEC, 0x60, 0x00, 0xFE, 0x66, 0x86, 0xFE, 0x86, 0x01, 0xFE, 0x66, 0xF5, 0x23, 0x83,
+0xEC, 0x60, 0x9B, 0xFF, 0xFF, 0x95, 0xFF, 0xFF, 0x00, 0xF5, 0x90, 0x82, 0xEC, 0x60, 0x05, 0xEC,
+0x80, 0xF5, 0x43, 0xFE, 0x45, 0xF5, 0xC4, 0xEC, 0xA1, 0xFE, 0x25, 0x83, 0xFE, 0x86, 0x02, 0xF5,
+0xA4, 0xEC, 0x60, 0xEC, 0xC1, 0x80, 0xFE, 0x86, 0x00, 0xFE, 0x66, 0x80, 0xEC, 0x60, 0x00, 0xFE,
+0x05, 0x88, 0xFE, 0x86, 0x00, 0xF5, 0x23, 0x81, 0xEC, 0x60, 0x00, 0xEC, 0x84, 0x9B, 0xFF, 0xFF,
+0x95, 0xFF, 0xFF, 0x00, 0xF6, 0x35, 0x84, 0xEC, 0x60, 0x80, 0xEC, 0x80, 0x00, 0xFE, 0x25, 0x84,
+0xFE, 0x86, 0x00, 0xFE, 0x05, 0x80, 0xEC, 0x60, 0x00, 0xFE, 0x66, 0x80, 0xFE, 0x86, 0x02, 0xEC,
+0xA1, 0xEC, 0x60, 0xF5, 0xA4, 0x88, 0xFE, 0x86, 0x01, 0xFE, 0x66, 0xEC, 0xE2, 0x80, 0xEC, 0x60,
+0x00, 0xED, 0x4E, 0x9B, 0xFF, 0xFF, 0x95, 0xFF, 0xFF, 0x00, 0xFE, 0xF9, 0x85, 0xEC, 0x60, 0x00,
+0xFD, 0xE5, 0x85, 0xFE, 0x86, 0x00, 0xFE, 0x45, 0x80, 0xEC, 0x60, 0x00, 0xFE, 0x25, 0x80, 0xFE,
+0x86, 0x02, 0xF5, 0x22, 0xEC, 0x60, 0xF5, 0x63, 0x89, 0xFE, 0x86, 0x03, 0xFE, 0x45, 0xEC, 0x80,
+0xEC, 0x60, 0xF6, 0x14, 0x9B, 0xFF, 0xFF, 0x95, 0xFF, 0xFF, 0x00, 0xFF, 0xBE, 0x84, 0xEC, 0x60,
+0x00, 0xF5, 0x43, 0x87, 0xFE, 0x86, 0x02, 0xEC, 0xA0, 0xEC, 0x60, 0xF5, 0xE5, 0x80, 0xFE, 0x86,
+0x02, 0xFE, 0x25, 0xF5, 0x63, 0xFE, 0x45, 0x8A, 0xFE, 0x86, 0x02, 0xF5, 0x84, 0xEC, 0x60, 0xFF,
+0x1A, 0x9B, 0xFF, 0xFF, 0x96, 0xFF, 0xFF, 0x00, 0xED, 0x2D, 0x82, 0xEC, 0x60, 0x01, 0xEC, 0x80,
+0xFE, 0x46, 0x87, 0xFE, 0x86, 0x02, 0xFE, 0x05, 0xF5, 0x84, 0xFE, 0x66, 0x8F, 0xFE, 0x86, 0x02,
+0xFE, 0x66, 0xEC, 0xA0, 0xFF, 0x7C, 0x9B, 0xFF, 0xFF, 0x96, 0xFF, 0xFF, 0x00, 0xF6, 0x97, 0x82,
+0xEC, 0x60, 0x00, 0xF5, 0x63, 0x94, 0xFE, 0x86, 0x03, 0xCD, 0x47, 0x8B, 0xA7, 0x93, 0xE7, 0xDD,
+0xA6, 0x83, 0xFE, 0x86, 0x01, 0xF5, 0x64, 0xF6, 0x35, 0x9B, 0xFF, 0xFF, 0x96, 0xFF, 0xFF, 0x01,
+0xFF, 0xBE, 0xEC, 0x81, 0x81, 0xEC, 0x60, 0x00, 0xFE, 0x25, 0x93, 0xFE, 0x86, 0x00, 0xCD, 0x47,
+0x82, 0x42, 0x08, 0x00, 0xDD, 0xA6, 0x82, 0xFE, 0x86, 0x01, 0xFE, 0x25, 0xEC, 0xC9, 0x9B, 0xFF,
+0xFF, 0x97, 0xFF, 0xFF, 0x00, 0xF6, 0x13, 0x80, 0xEC, 0x60, 0x00, 0xEC, 0xA1, 0x94, 0xFE, 0x86,
+0x00, 0x73, 0x27, 0x82, 0x42, 0x08, 0x00, 0x8B, 0xC7, 0x83, 0xFE, 0x86, 0x01, 0xEC, 0xC1, 0xFF,
+0x5C, 0x9A, 0xFF, 0xFF, 0x97, 0xFF, 0xFF, 0x03, 0xFF, 0x9D, 0xEC, 0xA6, 0xEC, 0x80, 0xF5, 0x23,
+0x83, 0xFE, 0x86, 0x03, 0xFE, 0x66, 0xC5, 0x07, 0xAC, 0x87, 0xD5, 0x87, 0x8B, 0xFE, 0x86, 0x00,
+0x4A, 0x28, 0x82, 0x42, 0x08, 0x00, 0x4A, 0x48, 0x83, 0xFE, 0x86, 0x01, 0xF5, 0x43, 0xF6, 0xB8,
+0x9A, 0xFF, 0xFF, 0x98, 0xFF, 0xFF, 0x02, 0xF6, 0xD9, 0xEC, 0x60, 0xF5, 0x84, 0x82, 0xFE, 0x86,
+0x01, 0xFE, 0x66, 0x83, 0x67, 0x81, 0x42, 0x08, 0x00, 0xB4, 0xC7, 0x8A, 0xFE, 0x86, 0x00, 0x93,
+0xC7, 0x82, 0x42, 0x08, 0x00, 0x7B, 0x47, 0x83, 0xFE, 0x86, 0x01, 0xF5, 0xC4, 0xF6, 0x14, 0x9A,
+0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x01, 0xF5, 0xB1, 0xF5, 0xC4, 0x82, 0xFE, 0x86, 0x00, 0xD5, 0x87,
+0x83, 0x42, 0x08, 0x00, 0xF6, 0x26, 0x89, 0xFE, 0x86, 0x01, 0xE5, 0xC6, 0x42, 0x28, 0x81, 0x42,
+0x08, 0x00, 0xCD, 0x47, 0x83, 0xFE, 0x86, 0x01, 0xFE, 0x05, 0xED, 0x6F, 0x9A, 0xFF, 0xFF, 0x99,
+0xFF, 0xFF, 0x01, 0xF5, 0x90, 0xF5, 0xC4, 0x82, 0xFE, 0x86, 0x00, 0xBC, 0xC7, 0x83, 0x42, 0x08,
+0x00, 0xCD, 0x67, 0x84, 0xFE, 0x86, 0x02, 0xF6, 0x46, 0xED, 0xE6, 0xFE, 0x66, 0x81, 0xFE, 0x86,
+0x03, 0xE5, 0xC6, 0x9C, 0x07, 0x8B, 0xC7, 0xD5, 0x47, 0x83, 0xFE, 0x86, 0x04, 0xFE, 0x66, 0xFE,
+0x25, 0xE4, 0xEC, 0xBD, 0xF7, 0xC6, 0x38, 0x98, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x01, 0xF5, 0xB1,
+0xF5, 0xC4, 0x82, 0xFE, 0x86, 0x00, 0xD5, 0x67, 0x83, 0x42, 0x08, 0x00, 0xDD, 0x86, 0x81, 0xFE,
+0x86, 0x02, 0xCD, 0x27, 0xAB, 0xE7, 0x8A, 0xE7, 0x80, 0x72, 0x07, 0x00, 0xC4, 0xC6, 0x85, 0xFE,
+0x86, 0x83, 0xFE, 0x66, 0x04, 0xED, 0xE6, 0xAC, 0x47, 0x4A, 0x27, 0x63, 0x2C, 0xD6, 0x9A, 0x98,
+0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x01, 0xF6, 0x14, 0xF5, 0xC4, 0x82, 0xFE, 0x86, 0x01, 0xFE, 0x66,
+0x6A, 0xE7, 0x81, 0x42, 0x08, 0x01, 0x62, 0xC7, 0xFE, 0x66, 0x80, 0xFE, 0x86, 0x07, 0xFE, 0x46,
+0x69, 0xE6, 0x61, 0xC6, 0x61, 0xA6, 0x59, 0x85, 0x51, 0x65, 0xCD, 0x25, 0xFE, 0x86, 0x87, 0xFE,
+0x66, 0x04, 0xDD, 0x86, 0x93, 0xC7, 0x42, 0x08, 0x7A, 0xE7, 0xC4, 0x09, 0x9A, 0xFF, 0xFF, 0x99,
+0xFF, 0xFF, 0x01, 0xF6, 0x55, 0xF5, 0x84, 0x83, 0xFE, 0x86, 0x04, 0xEE, 0x06, 0x8B, 0xC7, 0x42,
+0x08, 0x83, 0x87, 0xE5, 0xE6, 0x82, 0xFE, 0x86, 0x04, 0xC4, 0xC5, 0x49, 0x24, 0x41, 0x03, 0x40,
+0xE3, 0x83, 0x03, 0x87, 0xFE, 0x66, 0x06, 0xF6, 0x26, 0x7B, 0x47, 0x42, 0x08, 0x93, 0xC7, 0xDD,
+0x66, 0xFD, 0xE5, 0xED, 0x4E, 0x9A, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x01, 0xF6, 0xD9, 0xF5, 0x23,
+0x88, 0xFE, 0x86, 0x83, 0xFE, 0x66, 0x03, 0xDD, 0x85, 0x49, 0xA2, 0x28, 0x41, 0xDD, 0x85, 0x82,
+0xFE, 0x66, 0x83, 0xFE, 0x46, 0x02, 0xF6, 0x06, 0xBC, 0xA7, 0xED, 0xA6, 0x80, 0xFE, 0x25, 0x01,
+0xF5, 0xA4, 0xF5, 0xB1, 0x9A, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x01, 0xFF, 0x7C, 0xEC, 0xA1, 0x82,
+0xFE, 0x86, 0x8A, 0xFE, 0x66, 0x02, 0xF6, 0x05, 0x62, 0x87, 0xCD, 0x07, 0x83, 0xFE, 0x46, 0x00,
+0xED, 0xE6, 0x82, 0xFE, 0x25, 0x08, 0xE5, 0x86, 0xC4, 0xC6, 0xBC, 0x87, 0xAC, 0x47, 0xAB, 0xC6,
+0xA4, 0x4F, 0xA5, 0x34, 0x9C, 0xF3, 0xD6, 0x9A, 0x97, 0xFF, 0xFF, 0x9A, 0xFF, 0xFF, 0x01, 0xEC,
+0xC8, 0xFE, 0x25, 0x89, 0xFE, 0x66, 0x82, 0xFE, 0x46, 0x03, 0xF6, 0x06, 0x42, 0x08, 0x52, 0x47,
+0xDD, 0x46, 0x81, 0xFE, 0x25, 0x01, 0xC4, 0xE6, 0x6A, 0xC7, 0x81, 0xFE, 0x05, 0x09, 0xFD, 0xE5,
+0xB4, 0x47, 0x7B, 0x07, 0x83, 0x47, 0x83, 0x27, 0x82, 0xC7, 0x94, 0x91, 0xAD, 0x55, 0xAD, 0x75,
+0xDE, 0xDB, 0x97, 0xFF, 0xFF, 0x98, 0xFF, 0xFF, 0x08, 0xDE, 0xFB, 0x7B, 0xCF, 0x7B, 0x09, 0x83,
+0x47, 0x9C, 0x27, 0xAC, 0x67, 0xAC, 0x87, 0xBC, 0xC7, 0xCD, 0x47, 0x85, 0xFE, 0x46, 0x81, 0xFE,
+0x25, 0x00, 0xA4, 0x07, 0x81, 0x42, 0x08, 0x05, 0x73, 0x07, 0x93, 0xA7, 0x6A, 0xE7, 0x8B, 0x67,
+0xED, 0x85, 0xFD, 0xE5, 0x81, 0xFD, 0xC5, 0x81, 0xFD, 0xA5, 0x02, 0xFD, 0x84, 0xEC, 0xA6, 0xFF,
+0xDF, 0x9A, 0xFF, 0xFF, 0x98, 0xFF, 0xFF, 0x05, 0xF7, 0x9E, 0xCE, 0x79, 0xB5, 0x75, 0xA3, 0x46,
+0xAC, 0x47, 0x93, 0xC7, 0x80, 0x83, 0x67, 0x02, 0x7B, 0x47, 0xF6, 0x06, 0xFE, 0x26, 0x81, 0xFE,
+0x25, 0x04, 0xAC, 0x47, 0xBC, 0xA7, 0xE5, 0x66, 0xD5, 0x06, 0x8B, 0x67, 0x84, 0x42, 0x08, 0x01,
+0x83, 0x47, 0xFD, 0xC5, 0x81, 0xFD, 0xA5, 0x80, 0xFD, 0x85, 0x04, 0x93, 0x87, 0x72, 0xC7, 0xB4,
+0x06, 0xD4, 0x64, 0xF6, 0x14, 0x9B, 0xFF, 0xFF, 0x9B, 0xFF, 0xFF, 0x01, 0xED, 0x0C, 0xF5, 0xC4,
+0x81, 0xFE, 0x25, 0x01, 0xF6, 0x05, 0xFE, 0x25, 0x82, 0xFE, 0x05, 0x02, 0xED, 0x86, 0xB4, 0x47,
+0x83, 0x47, 0x86, 0x42, 0x08, 0x00, 0x8B, 0x47, 0x80, 0xFD, 0x85, 0x80, 0xFD, 0x64, 0x08, 0xFD,
+0x44, 0xF5, 0x44, 0xE4, 0xE5, 0xB3, 0xE6, 0x72, 0xA7, 0x42, 0x08, 0x63, 0x2C, 0xAD, 0x75, 0xDE,
+0xFB, 0x99, 0xFF, 0xFF, 0x9B, 0xFF, 0xFF, 0x06, 0xF6, 0xF9, 0xEC, 0xC1, 0xF5, 0xE5, 0xCD, 0x06,
+0x9B, 0xC7, 0x42, 0x28, 0xCC, 0xC6, 0x80, 0xFD, 0xE5, 0x82, 0xFD, 0xC5, 0x01, 0xF5, 0x85, 0x52,
+0x47, 0x80, 0x42, 0x08, 0x06, 0x92, 0xAA, 0xC3, 0x2C, 0xCB, 0x4C, 0xAA, 0xEB, 0x52, 0x28, 0xBC,
+0x06, 0xF5, 0x44, 0x82, 0xF5, 0x24, 0x81, 0xF5, 0x04, 0x06, 0xEC, 0xA2, 0xE5, 0xB3, 0xC6, 0x18,
+0x8C, 0x51, 0x42, 0x08, 0x52, 0xAA, 0xCE, 0x59, 0x97, 0xFF, 0xFF, 0x9A, 0xFF, 0xFF, 0x07, 0xF7,
+0xBE, 0xCE, 0x79, 0x8B, 0x07, 0x42, 0x08, 0x4A, 0x27, 0x9B, 0xA7, 0xD4, 0xC6, 0xF5, 0xA5, 0x81,
+0xFD, 0xA5, 0x81, 0xFD, 0x85, 0x03, 0xFD, 0x84, 0xBC, 0x26, 0x42, 0x08, 0xBB, 0x2B, 0x82, 0xEB,
+0xAE, 0x01, 0xD3, 0x8C, 0xEC, 0xE4, 0x85, 0xF5, 0x04, 0x02, 0xF4, 0xE3, 0xEC, 0xEA, 0xFF, 0xDE,
+0x80, 0xFF, 0xFF, 0x02, 0xF7, 0xBE, 0xCE, 0x79, 0xE7, 0x1C, 0x97, 0xFF, 0xFF, 0x99, 0xFF, 0xFF,
+0x09, 0xCE, 0x59, 0x42, 0x28, 0x52, 0xAA, 0xA5, 0x14, 0xC4, 0x08, 0xF5, 0x44, 0xFD, 0xA5, 0xED,
+0x45, 0x8B, 0x67, 0xDC, 0xE5, 0x81, 0xFD, 0x64, 0x01, 0xFD, 0x44, 0xF5, 0x44, 0x80, 0xF5, 0x24,
+0x01, 0xC3, 0xE7, 0xE3, 0xAD, 0x80, 0xEB, 0xAD, 0x02, 0xE3, 0xAD, 0xDB, 0xCC, 0xF4, 0xC7, 0x85,
+0xF5, 0x04, 0x02, 0xF4, 0xE3, 0xEC, 0x80, 0xEE, 0x35, 0x9D, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x09,
+0xEF, 0x7D, 0xDE, 0xDB, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0xFA, 0xEC, 0x80, 0xD4, 0x85, 0x52, 0x47,
+0x83, 0x07, 0xED, 0x05, 0x82, 0xF5, 0x24, 0x82, 0xF5, 0x04, 0x03, 0xF4, 0xE6, 0xEC, 0x89, 0xE4,
+0x69, 0xEC, 0xA8, 0x86, 0xF5, 0x04, 0x04, 0xF4, 0xE3, 0xEC, 0x80, 0xF5, 0x44, 0xDC, 0x41, 0xEE,
+0x57, 0x9C, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0x02, 0xB4, 0xD1, 0x42, 0x08, 0xAB, 0x86, 0x93, 0xF5,
+0x04, 0x06, 0xF4, 0xC3, 0xEC, 0x80, 0xF5, 0x84, 0xFE, 0x06, 0xF5, 0xA5, 0xD4, 0x00, 0xEE, 0x15,
+0x9B, 0xFF, 0xFF, 0x9C, 0xFF, 0xFF, 0x05, 0xF7, 0xBE, 0x94, 0x92, 0x52, 0xAA, 0xCD, 0xF6, 0xEC,
+0xA7, 0xF4, 0xC2, 0x91, 0xF5, 0x04, 0x05, 0xEC, 0xA2, 0xEC, 0xA1, 0xFD, 0xC5, 0xFE, 0x06, 0xF5,
+0xA5, 0xDC, 0x40, 0x80, 0xD4, 0x00, 0x00, 0xEE, 0x15, 0x9A, 0xFF, 0xFF, 0x9B, 0xFF, 0xFF, 0x08,
+0xE7, 0x3C, 0x6B, 0x6D, 0x73, 0xAE, 0xEF, 0x5D, 0xFF, 0xFF, 0xFF, 0x9D, 0xED, 0x6F, 0xEC, 0x81,
+0xF4, 0xE3, 0x8D, 0xF5, 0x04, 0x06, 0xF4, 0xC2, 0xEC, 0x80, 0xF5, 0x23, 0xFE, 0x05, 0xFE, 0x06,
+0xF5, 0xA5, 0xDC, 0x20, 0x82, 0xD4, 0x00, 0x00, 0xE6, 0x14, 0x99, 0xFF, 0xFF, 0x9B, 0xFF, 0xFF,
+0x02, 0x8C, 0x71, 0x9C, 0xF3, 0xFF, 0xDF, 0x82, 0xFF, 0xFF, 0x04, 0xFE, 0xFA, 0xED, 0x4E, 0xEC,
+0x80, 0xF4, 0xC2, 0xF4, 0xE3, 0x86, 0xF5, 0x04, 0x05, 0xF4, 0xE3, 0xF4, 0xC3, 0xEC, 0xA1, 0xEC,
+0x80, 0xF5, 0x23, 0xFD, 0xE5, 0x80, 0xFE, 0x06, 0x01, 0xF5, 0x85, 0xDC, 0x20, 0x81, 0xD4, 0x00,
+0x03, 0xD4, 0x20, 0xF5, 0x44, 0xDC, 0x62, 0xE5, 0xF4, 0x98, 0xFF, 0xFF, 0xA4, 0xFF, 0xFF, 0x04,
+0xFF, 0x5C, 0xF6, 0x55, 0xED, 0x2C, 0xEC, 0x60, 0xEC, 0x80, 0x82, 0xEC, 0xA1, 0x05, 0xEC, 0x81,
+0xEC, 0x60, 0xEC, 0xC6, 0xF5, 0x03, 0xF5, 0x84, 0xFE, 0x05, 0x81, 0xFE, 0x06, 0x01, 0xF5, 0x85,
+0xDC, 0x20, 0x81, 0xD4, 0x00, 0x05, 0xE4, 0xA2, 0xF5, 0x85, 0xFD, 0xA5, 0xF5, 0x85, 0xD4, 0x20,
+0xE5, 0xF4, 0x97, 0xFF, 0xFF, 0xA6, 0xFF, 0xFF, 0x03, 0xF7, 0x1B, 0xE5, 0x2B, 0xFE, 0xF4, 0xFE,
+0x92, 0x80, 0xF6, 0x71, 0x03, 0xFE, 0x92, 0xFE, 0xD3, 0xFF, 0x35, 0xFF, 0x55, 0x83, 0xFE, 0x06,
+0x09, 0xFD, 0xE6, 0xDC, 0x82, 0xD4, 0x00, 0xDC, 0x41, 0xED, 0x03, 0xF5, 0x85, 0xFD, 0xC5, 0xFD,
+0xA5, 0xF5, 0x65, 0xDC, 0x41, 0x80, 0xD4, 0x00, 0x00, 0xE5, 0xF4, 0x96, 0xFF, 0xFF, 0xA6, 0xFF,
+0xFF, 0x01, 0xF7, 0x1A, 0xE5, 0x6D, 0x85, 0xFF, 0x76, 0x00, 0xFF, 0x34, 0x81, 0xFE, 0x06, 0x81,
+0xFD, 0xE6, 0x01, 0xF5, 0x85, 0xF5, 0x65, 0x80, 0xFD, 0xC5, 0x80, 0xFD, 0xA5, 0x01, 0xF5, 0x65,
+0xDC, 0x20, 0x82, 0xD4, 0x00, 0x00, 0xE5, 0xF4, 0x95, 0xFF, 0xFF, 0xA6, 0xFF, 0xFF, 0x01, 0xF7,
+0x5C, 0xE5, 0x6D, 0x85, 0xFF, 0x76, 0x00, 0xFF, 0x34, 0x80, 0xFE, 0x06, 0x81, 0xFD, 0xE6, 0x00,
+0xFD, 0xE5, 0x81, 0xFD, 0xC5, 0x80, 0xFD, 0xA5, 0x01, 0xFD, 0x85, 0xDC, 0x41, 0x82, 0xD4, 0x00,
+0x02, 0xE4, 0x82, 0xDC, 0x41, 0xE6, 0x15, 0x94, 0xFF, 0xFF, 0xA6, 0xFF, 0xFF, 0x01, 0xFF, 0x7D,
+0xE5, 0x0A, 0x85, 0xFF, 0x76, 0x00, 0xFF, 0x34, 0x80, 0xFD, 0xE5, 0x80, 0xFD, 0xE6, 0x82, 0xFD,
+0xC5, 0x03, 0xFD, 0xA5, 0xF5, 0x65, 0xFD, 0x85, 0xE4, 0xC3, 0x81, 0xD4, 0x00, 0x05, 0xE4, 0x62,
+0xF5, 0x04, 0xFD, 0x65, 0xF5, 0x45, 0xDC, 0x41, 0xEE, 0x15, 0x93, 0xFF, 0xFF, 0xA7, 0xFF, 0xFF,
+0x00, 0xDC, 0x88, 0x85, 0xFF, 0x76, 0x03, 0xFF, 0x34, 0xDC, 0x82, 0xF5, 0x85, 0xFD, 0xE5, 0x81,
+0xFD, 0xC5, 0x81, 0xFD, 0xA5, 0x01, 0xDC, 0x62, 0xF5, 0x24, 0x80, 0xDC, 0x41, 0x02, 0xE4, 0xC3,
+0xF5, 0x25, 0xFD, 0x65, 0x81, 0xFD, 0x45, 0x02, 0xF5, 0x25, 0xDC, 0x41, 0xEE, 0x35, 0x86, 0xFF,
+0xFF, 0x03, 0xEE, 0xB8, 0xDC, 0x89, 0xDD, 0x0E, 0xF7, 0x7C, 0x86, 0xFF, 0xFF, 0xA7, 0xFF, 0xFF,
+0x01, 0xE5, 0x50, 0xFF, 0x14, 0x84, 0xFF, 0x76, 0x05, 0xFF, 0x34, 0xDC, 0x82, 0xED, 0x03, 0xF5,
+0x44, 0xF5, 0x64, 0xF5, 0x85, 0x81, 0xFD, 0xA5, 0x03, 0xFD, 0x85, 0xDC, 0x61, 0xF5, 0x44, 0xFD,
+0x85, 0x81, 0xFD, 0x65, 0x81, 0xFD, 0x45, 0x80, 0xFD, 0x25, 0x02, 0xF5, 0x05, 0xDC, 0x21, 0xEE,
+0xB9, 0x84, 0xFF, 0xFF, 0x00, 0xFF, 0xDE, 0x81, 0xD4, 0x00, 0x01, 0xDC, 0x8A, 0xFF, 0xDE, 0x85,
+0xFF, 0xFF, 0xA7, 0xFF, 0xFF, 0x01, 0xEE, 0x98, 0xEE, 0x10, 0x84, 0xFF, 0x76, 0x01, 0xFF, 0x35,
+0xE4, 0xC3, 0x82, 0xD4, 0x00, 0x01, 0xDC, 0x41, 0xF5, 0x44, 0x80, 0xFD, 0x85, 0x01, 0xDC, 0x20,
+0xF5, 0x45, 0x81, 0xFD, 0x65, 0x81, 0xFD, 0x45, 0x81, 0xFD, 0x25, 0x03, 0xFD, 0x05, 0xF4, 0xE4,
+0xDC, 0x45, 0xFF, 0x7D, 0x84, 0xFF, 0xFF, 0x00, 0xDC, 0x47, 0x81, 0xD4, 0x00, 0x00, 0xEE, 0x56,
+0x85, 0xFF, 0xFF, 0xA7, 0xFF, 0xFF, 0x02, 0xFF, 0xDE, 0xDC, 0x66, 0xFF, 0x35, 0x83, 0xFF, 0x76,
+0x01, 0xFF, 0x56, 0xE4, 0xC3, 0x83, 0xD4, 0x00, 0x00, 0xE4, 0xC3, 0x80, 0xFD, 0x85, 0x02, 0xD4,
+0x00, 0xF5, 0x45, 0xFD, 0x65, 0x82, 0xFD, 0x45, 0x81, 0xFD, 0x25, 0x81, 0xFD, 0x05, 0x01, 0xEC,
+0x83, 0xDD, 0x2F, 0x84, 0xFF, 0xFF, 0x00, 0xE5, 0xD4, 0x81, 0xD4, 0x00, 0x00, 0xDC, 0xAA, 0x85,
+0xFF, 0xFF, 0xA8, 0xFF, 0xFF, 0x02, 0xDD, 0x0E, 0xE5, 0x4C, 0xFF, 0x56, 0x83, 0xFF, 0x76, 0x00,
+0xE4, 0xE4, 0x81, 0xD4, 0x00, 0x05, 0xDC, 0x20, 0xE4, 0xC3, 0xFD, 0x65, 0xFD, 0x85, 0xFD, 0x65,
+0xD4, 0x00, 0x80, 0xFD, 0x45, 0x01, 0xF5, 0x25, 0xFD, 0x45, 0x82, 0xFD, 0x25, 0x06, 0xFD, 0x05,
+0xEC, 0xA3, 0xDC, 0x42, 0xD4, 0x00, 0xE4, 0x62, 0xDC, 0x21, 0xF6, 0xD9, 0x83, 0xFF, 0xFF, 0x05,
+0xF7, 0x3B, 0xD4, 0x00, 0xE4, 0xE3, 0xED, 0x84, 0xDC, 0x40, 0xFF, 0x7D, 0x84, 0xFF, 0xFF, 0xA8,
+0xFF, 0xFF, 0x03, 0xEE, 0x15, 0xD4, 0x00, 0xE5, 0x6C, 0xFF, 0x56, 0x82, 0xFF, 0x76, 0x03, 0xED,
+0x69, 0xE4, 0xA3, 0xF5, 0x65, 0xFD, 0x65, 0x82, 0xFD, 0x85, 0x05, 0xFD, 0x45, 0xD4, 0x00, 0xFD,
+0x45, 0xE4, 0xA3, 0xD4, 0x00, 0xF5, 0x05, 0x80, 0xFD, 0x25, 0x02, 0xFD, 0x05, 0xEC, 0xA3, 0xDC,
+0x20, 0x83, 0xD4, 0x00, 0x00, 0xDD, 0x0E, 0x84, 0xFF, 0xFF, 0x04, 0xDC, 0x8A, 0xF5, 0xC5, 0xFE,
+0x26, 0xE4, 0xA2, 0xF6, 0xFA, 0x84, 0xFF, 0xFF, 0xA8, 0xFF, 0xFF, 0x04, 0xF6, 0xFA, 0xE4, 0x80,
+0xE4, 0xC1, 0xE5, 0x0B, 0xFF, 0x35, 0x81, 0xFF, 0x76, 0x02, 0xED, 0x8B, 0xE4, 0xA3, 0xFD, 0xA5,
+0x82, 0xFD, 0x85, 0x09, 0xFD, 0x65, 0xF5, 0x45, 0xDC, 0x20, 0xE4, 0xA3, 0xD4, 0x00, 0xE4, 0x62,
+0xF5, 0x05, 0xFD, 0x25, 0xF5, 0x05, 0xDC, 0x41, 0x85, 0xD4, 0x00, 0x01, 0xDC, 0x00, 0xF7, 0x7C,
+0x83, 0xFF, 0xFF, 0x04, 0xE5, 0xD3, 0xED, 0x44, 0xFE, 0x06, 0xE5, 0x03, 0xEE, 0xB8, 0x84, 0xFF,
+0xFF, 0xA8, 0xFF, 0xFF, 0x05, 0xFF, 0xBE, 0xDC, 0x20, 0xFE, 0x03, 0xED, 0x42, 0xDC, 0x86, 0xF6,
+0x92, 0x80, 0xFF, 0x76, 0x04, 0xED, 0xEE, 0xDC, 0x62, 0xF5, 0x24, 0xED, 0x04, 0xF5, 0x25, 0x81,
+0xFD, 0x85, 0x03, 0xF5, 0x25, 0xD4, 0x20, 0xD4, 0x00, 0xE4, 0x62, 0x80, 0xFD, 0x25, 0x01, 0xFD,
+0x05, 0xE4, 0x62, 0x86, 0xD4, 0x00, 0x01, 0xDC, 0x21, 0xEE, 0x77, 0x83, 0xFF, 0xFF, 0x04, 0xEE,
+0x35, 0xE4, 0xE3, 0xFE, 0x06, 0xE4, 0xE3, 0xEE, 0x97, 0x84, 0xFF, 0xFF, 0xA9, 0xFF, 0xFF, 0x01,
+0xDC, 0xAB, 0xF5, 0xC2, 0x80, 0xFE, 0x03, 0x03, 0xED, 0x42, 0xE5, 0x4B, 0xFE, 0xF4, 0xF6, 0x30,
+0x82, 0xD4, 0x00, 0x00, 0xE4, 0x83, 0x80, 0xFD, 0x86, 0x00, 0xF5, 0x25, 0x80, 0xD4, 0x00, 0x00,
+0xF5, 0x04, 0x81, 0xFD, 0x05, 0x00, 0xE4, 0x42, 0x85, 0xD4, 0x00, 0x80, 0xEC, 0x63, 0x00, 0xE5,
+0x71, 0x83, 0xFF, 0xFF, 0x04, 0xE5, 0xF4, 0xE4, 0xC3, 0xFD, 0xE5, 0xE4, 0xE3, 0xEE, 0xB9, 0x84,
+0xFF, 0xFF, 0xA9, 0xFF, 0xFF, 0x07, 0xE5, 0xB3, 0xDC, 0x80, 0xED, 0x01, 0xF5, 0xA2, 0xFE, 0x03,
+0xFD, 0xE3, 0xEC, 0xE1, 0xDC, 0x86, 0x82, 0xD4, 0x00, 0x00, 0xDC, 0x41, 0x80, 0xFD, 0x86, 0x02,
+0xF5, 0x04, 0xD4, 0x00, 0xDC, 0x41, 0x81, 0xFD, 0x05, 0x02, 0xFC, 0xE5, 0xF4, 0xE5, 0xEC, 0x83,
+0x80, 0xE4, 0x63, 0x80, 0xEC, 0x63, 0x04, 0xEC, 0x84, 0xF4, 0xA4, 0xFC, 0xA5, 0xF4, 0x84, 0xDC,
+0xCC, 0x82, 0xFF, 0xFF, 0x05, 0xFF, 0xDE, 0xDC, 0x89, 0xD4, 0x00, 0xE4, 0xC3, 0xDC, 0x61, 0xF7,
+0x1A, 0x84, 0xFF, 0xFF, 0xA9, 0xFF, 0xFF, 0x00, 0xEE, 0x98, 0x81, 0xD4, 0x00, 0x00, 0xE4, 0xC1,
+0x80, 0xFD, 0xE3, 0x00, 0xE4, 0xE1, 0x81, 0xD4, 0x00, 0x01, 0xE4, 0x82, 0xF5, 0x65, 0x80, 0xFD,
+0x86, 0x02, 0xED, 0x04, 0xD4, 0x00, 0xDC, 0x41, 0x80, 0xFD, 0x05, 0x81, 0xFC, 0xE5, 0x82, 0xFC,
+0xC5, 0x05, 0xF4, 0xA4, 0xEC, 0x63, 0xE4, 0x42, 0xDC, 0x21, 0xDC, 0x20, 0xD4, 0x24, 0x81, 0xFF,
+0xFF, 0x03, 0xFF, 0x9D, 0xDD, 0x2F, 0xE4, 0xA3, 0xE4, 0xA2, 0x80, 0xD4, 0x00, 0x00, 0xFF, 0xBE,
+0x84, 0xFF, 0xFF, 0xA9, 0xFF, 0xFF, 0x00, 0xF7, 0x5C, 0x81, 0xD4, 0x00, 0x00, 0xE4, 0x81, 0x80,
+0xFD, 0xC3, 0x03, 0xE4, 0xC1, 0xD4, 0x00, 0xF5, 0x46, 0xFD, 0x65, 0x82, 0xFD, 0xA6, 0x02, 0xED,
+0x04, 0xD4, 0x00, 0xDC, 0x20, 0x82, 0xFC, 0xE5, 0x81, 0xFC, 0xC5, 0x01, 0xF4, 0x84, 0xE4, 0x42,
+0x83, 0xD4, 0x00, 0x09, 0xD4, 0x22, 0xF6, 0xFA, 0xF6, 0xD9, 0xE5, 0xB3, 0xD4, 0x22, 0xD4, 0x00,
+0xED, 0x04, 0xFD, 0x85, 0xEC, 0xE3, 0xE5, 0x70, 0x85, 0xFF, 0xFF, 0xA7, 0xFF, 0xFF, 0x06, 0xFF,
+0x9D, 0xF7, 0x1B, 0xF7, 0x3B, 0xD4, 0x01, 0xE4, 0xA1, 0xED, 0x22, 0xFD, 0xA3, 0x80, 0xF5, 0x63,
+0x01, 0xE4, 0x81, 0xD4, 0x00, 0x84, 0xFD, 0xA6, 0x04, 0xEC, 0xE4, 0xDC, 0x20, 0xD4, 0x00, 0xEC,
+0x83, 0xFC, 0xE5, 0x82, 0xFC, 0xC5, 0x00, 0xF4, 0x84, 0x86, 0xD4, 0x00, 0x08, 0xDC, 0x41, 0xD4,
+0x00, 0xE4, 0x62, 0xF5, 0x25, 0xD4, 0x00, 0xE4, 0x82, 0xF5, 0x65, 0xDC, 0x20, 0xF7, 0x3B, 0x85,
+0xFF, 0xFF, 0xA5, 0xFF, 0xFF, 0x05, 0xF7, 0x5C, 0xDC, 0xED, 0xDC, 0x20, 0xDC, 0x61, 0xDC, 0x60,
+0xD4, 0x00, 0x80, 0xF5, 0x22, 0x80, 0xDC, 0x20, 0x00, 0xDC, 0x41, 0x80, 0xD4, 0x00, 0x00, 0xFD,
+0x45, 0x83, 0xFD, 0x86, 0x04, 0xE4, 0xA3, 0xE4, 0x83, 0xDC, 0x21, 0xDC, 0x00, 0xF4, 0xA4, 0x80,
+0xFC, 0xC5, 0x80, 0xFC, 0xA5, 0x00, 0xEC, 0x84, 0x85, 0xD4, 0x00, 0x08, 0xDC, 0x42, 0xF4, 0xE4,
+0xD4, 0x00, 0xE4, 0x83, 0xFD, 0x45, 0xEC, 0xA3, 0xD4, 0x00, 0xDC, 0x20, 0xEE, 0x35, 0x86, 0xFF,
+0xFF, 0xA4, 0xFF, 0xFF, 0x02, 0xFF, 0xBE, 0xDC, 0x47, 0xED, 0x02, 0x82, 0xFD, 0x83, 0x02, 0xF5,
+0x02, 0xDC, 0x20, 0xF5, 0x04, 0x81, 0xFD, 0x45, 0x01, 0xF5, 0x05, 0xFD, 0x25, 0x83, 0xFD, 0x45,
+0x02, 0xE4, 0x83, 0xE4, 0x62, 0xDC, 0x21, 0x80, 0xD4, 0x00, 0x00, 0xFC, 0xC5, 0x81, 0xFC, 0xA5,
+0x04, 0xFC, 0x85, 0xF4, 0x84, 0xEC, 0x63, 0xE4, 0x43, 0xE4, 0x22, 0x80, 0xEC, 0x43, 0x02, 0xE4,
+0x22, 0xE4, 0x62, 0xFC, 0xE5, 0x80, 0xDC, 0x20, 0x03, 0xF4, 0xE4, 0xE4, 0xA3, 0xD4, 0x22, 0xEE,
+0x57, 0x87, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xA3, 0xFF, 0xFF, 0x02, 0xEE, 0x56, 0xE4, 0xA1, 0xFD,
+0x83, 0x82, 0xFD, 0x63, 0x01, 0xE4, 0x81, 0xEC, 0xA4, 0x89, 0xFD, 0x25, 0x04, 0xE4, 0x62, 0xD4,
+0x00, 0xDC, 0x00, 0xE4, 0x63, 0xEC, 0x84, 0x81, 0xFC, 0xA5, 0x00, 0xFC, 0x85, 0x80, 0xFC, 0x84,
+0x82, 0xFC, 0x64, 0x02, 0xF4, 0x44, 0xDC, 0x00, 0xDC, 0x89, 0x81, 0xD4, 0x00, 0x02, 0xDC, 0x8A,
+0xE5, 0xF4, 0xFF, 0x7D, 0x87, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0xFF, 0xFF,
+0x01, 0xE5, 0x92, 0xEC, 0xE2, 0x81, 0xFD, 0x43, 0x80, 0xFD, 0x23, 0x01, 0xDC, 0x41, 0xF4, 0xC4,
+0x89, 0xFC, 0xE5, 0x02, 0xDC, 0x42, 0xD4, 0x00, 0xF4, 0xA4, 0x82, 0xFC, 0xA5, 0x81, 0xFC, 0x84,
+0x81, 0xFC, 0x64, 0x80, 0xF4, 0x44, 0x01, 0xEC, 0x23, 0xDD, 0x0E, 0x80, 0xFF, 0xFF, 0x01, 0xFF,
+0x9D, 0xFF, 0xDF, 0x8A, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xA2, 0xFF, 0xFF, 0x01,
+0xE5, 0x71, 0xEC, 0xC2, 0x80, 0xFD, 0x24, 0x80, 0xFD, 0x04, 0x02, 0xFC, 0xE4, 0xDC, 0x21, 0xF4,
+0x84, 0x89, 0xFC, 0xA5, 0x01, 0xD4, 0x00, 0xE4, 0x42, 0x81, 0xFC, 0xA5, 0x00, 0xFC, 0x85, 0x81,
+0xFC, 0x84, 0x81, 0xFC, 0x64, 0x81, 0xF4, 0x44, 0x01, 0xDC, 0x00, 0xF7, 0x3B, 0x8D, 0xFF, 0xFF,
+0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0xA2, 0xFF, 0xFF, 0x01, 0xEE, 0x77, 0xE4, 0x61, 0x81, 0xFC,
+0xE4, 0x80, 0xFC, 0xC4, 0x80, 0xE4, 0x42, 0x88, 0xFC, 0x85, 0x02, 0xEC, 0x43, 0xD4, 0x00, 0xE4,
+0x42, 0x80, 0xFC, 0xA5, 0x00, 0xFC, 0x85, 0x80, 0xFC, 0x84, 0x82, 0xFC, 0x64, 0x80, 0xF4, 0x44,
+0x02, 0xF4, 0x24, 0xDC, 0x00, 0xEE, 0x77, 0x8E, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x81, 0x00, 0x00,
+0xA1, 0xFF, 0xFF, 0x04, 0xFF, 0xDF, 0xDD, 0x2F, 0xDC, 0x21, 0xEC, 0x62, 0xEC, 0x83, 0x80, 0xEC,
+0x63, 0x05, 0xE4, 0x42, 0xD4, 0x00, 0xE4, 0x22, 0xEC, 0x43, 0xF4, 0x44, 0xFC, 0x44, 0x82, 0xF4,
+0x44, 0x05, 0xEC, 0x44, 0xE4, 0x23, 0xDC, 0x89, 0xDC, 0xED, 0xDC, 0x20, 0xEC, 0x63, 0x80, 0xF4,
+0x84, 0x00, 0xFC, 0x84, 0x80, 0xF4, 0x64, 0x81, 0xF4, 0x44, 0x03, 0xEC, 0x23, 0xE4, 0x22, 0xDC,
+0x01, 0xEE, 0x98, 0x8E, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x82, 0x00, 0x00, 0xA2, 0xFF, 0xFF, 0x04,
+0xF6, 0xDA, 0xE5, 0xD4, 0xE5, 0x50, 0xE5, 0x71, 0xE5, 0xD3, 0x80, 0xEE, 0x15, 0x02, 0xEE, 0x35,
+0xDD, 0x2F, 0xD4, 0x23, 0x80, 0xD4, 0x00, 0x04, 0xD4, 0x24, 0xDC, 0x89, 0xDD, 0x0E, 0xDD, 0x2F,
+0xE5, 0xD3, 0x80, 0xFF, 0x9D, 0x02, 0xF6, 0xFA, 0xE5, 0x50, 0xD4, 0x45, 0x81, 0xD4, 0x00, 0x06,
+0xD4, 0x22, 0xDC, 0x47, 0xDC, 0xAB, 0xDD, 0x0E, 0xE5, 0x50, 0xEE, 0x35, 0xFF, 0x7D, 0x8E, 0xFF,
+0xFF, 0x82, 0x00, 0x00, 0x83, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x83, 0x00, 0x00, 0x84, 0x00, 0x00,
+0xCE, 0xFF, 0xFF, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0xCC, 0xFF, 0xFF, 0x85, 0x00, 0x00, 0x87,
+0x00, 0x00, 0xC8, 0xFF, 0xFF, 0x87, 0x00, 0x00, 0x89, 0x00, 0x00, 0xC4, 0xFF, 0xFF, 0x89, 0x00,
+0x00,
+};
+static const uint16_t CAT_WATCH_FACE_PACKED_ROWS[92] PROGMEM = {
+0x0000, 0x0009, 0x0012, 0x001B, 0x0024, 0x002D, 0x0036, 0x003F, 0x0048, 0x0051, 0x005A, 0x0063, 0x0066, 0x0069, 0x006C, 0x006F,
+0x0072, 0x0075, 0x0078, 0x007B, 0x007E, 0x0081, 0x0084, 0x0097, 0x00AE, 0x00C5, 0x00E0, 0x010D, 0x0146, 0x018F, 0x01D1, 0x0207,
+0x0245, 0x0280, 0x02B6, 0x02E7, 0x0314, 0x0339, 0x035C, 0x0381, 0x03A4, 0x03D3, 0x0402, 0x042F, 0x046A, 0x04A2, 0x04DF, 0x0518,
+0x0547, 0x057B, 0x05B5, 0x05F4, 0x0638, 0x0674, 0x06BB, 0x06FD, 0x073C, 0x0774, 0x0793, 0x07BC, 0x07ED, 0x082C, 0x0865, 0x089E,
+0x08CB, 0x08FA, 0x092D, 0x096D, 0x09B2, 0x09F3, 0x0A32, 0x0A7F, 0x0AC8, 0x0B11, 0x0B5C, 0x0BA2, 0x0BF4, 0x0C43, 0x0C8B, 0x0CD2,
+0x0D21, 0x0D74, 0x0DBA, 0x0DF9, 0x0E33, 0x0E6D, 0x0EB9, 0x0F04, 0x0F0D, 0x0F16, 0x0F1F, 0x0F28,
+};
+const PackedImage CAT_WATCH_FACE_PACKED = { 92, 92, PackedImage::Rle565, 0, 3889, nullptr, CAT_WATCH_FACE_PACKED_ROWS, CAT_WATCH_FACE_PACKED_DATA };
+
+#endif
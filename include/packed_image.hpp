@@ -0,0 +1,38 @@
+#ifndef __PACKED_IMAGE_H
+#define __PACKED_IMAGE_H
+#include <Arduino.h>
+
+// An RGB565 image in flash, run length encoded per row so any row can be
+// decoded on its own straight into a band, without an image sized buffer.
+// Written by tools/convert_images.py into include/packed-images.h, and by
+// tools/bake_face.py into include/cat-watch-face-dial-packed.h.
+//
+// A row is a sequence of packets, each starting with a control byte c:
+//   c < 128:  c + 1 literal items follow
+//   c >= 128: one item follows, repeated c - 126 times (2 to 129)
+// An item is a pixel, high byte first (Rle565), or a palette index
+// (PaletteRle). Packets never cross a row.
+struct PackedImage {
+    enum Encoding: uint8_t {
+        Rle565,
+        PaletteRle,
+    };
+    static constexpr uint8_t RUN = 128;
+    static constexpr uint8_t MAX_PACKET = 128; // literals, runs take 129
+
+    int16_t width, height;
+    Encoding encoding;
+    uint16_t colors;         // in the palette
+    uint16_t bytes;          // of data
+    const uint16_t *palette; // RGB565, PaletteRle only
+    const uint16_t *rows;    // offset of each row into data
+    const uint8_t *data;
+
+    // decode w pixels of row y starting at x into to[0..w), byte swapped
+    // the way TFT_eSprite memory and the lcd want them
+    void decodeRow(int16_t y, int16_t x, int16_t w, uint16_t *to) const;
+    // flash used by the rows, the offsets and the palette
+    uint32_t size() const;
+};
+
+#endif
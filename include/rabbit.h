@@ -1,10 +1,9 @@
-// Generated by   : ImageConverter 565 Online
-// Generated from : rabbit.png
-// Time generated : Thu, 31 Dec 20 11:13:59 +0100  (Server timezone: CET)
-// Image Size     : 92x92 pixels
+// Generated by   : tools/convert_images.py, do not edit
+// Generated from : assets/rabbit.png
 // Memory usage   : 16928 bytes
 
-
+#ifndef __RABBIT_H
+#define __RABBIT_H
 #if defined(__AVR__)
     #include <avr/pgmspace.h>
 #elif defined(__PIC32MX__)
@@ -13,6 +12,7 @@
     #define PROGMEM
 #endif
 
+// rabbit: 92x92 raw565, 16928 bytes of flash
 const unsigned short rabbit[8464] PROGMEM={
 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB5B6, 0xB596, 0xAD75,   // 0x0010 (16) pixels
 0xAD75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0020 (32) pixels
@@ -544,3 +544,5 @@ const unsigned short rabbit[8464] PROGMEM={
 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2100 (8448) pixels
 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2110 (8464) pixels
 };
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef __SCHEDULE_H
+#define __SCHEDULE_H
+#include <Arduino.h>
+
+// times in minutes of the day, the transition in minutes
+struct DaySchedule {
+    uint16_t sleepTime;
+    uint16_t awakeTime;
+    uint16_t awakeTransition;
+
+    bool operator==(const DaySchedule &other) const {
+        return sleepTime == other.sleepTime && awakeTime == other.awakeTime && awakeTransition == other.awakeTransition;
+    }
+};
+
+// A schedule per weekday plus exceptions for single dates. Every distinct
+// day schedule is kept once, the weekdays and exceptions point into that
+// table, and the exceptions are sorted by date for a binary search.
+//
+// Stored as the 6 bytes of the first day schedule, which is all
+// /config.bin used to hold, followed by a version byte, the other day
+// schedules, the 7 weekday indexes and the exceptions as 3 bytes each.
+// Firmware from before reads it as that first schedule, and a 6 byte
+// file reads as that schedule on every day.
+class WeekSchedule {
+public:
+    static constexpr uint8_t MAX_SCHEDULES = 16;
+    static constexpr uint8_t MAX_EXCEPTIONS = 64;
+    static constexpr size_t MAX_BYTES = 6 + 2 + ((MAX_SCHEDULES - 1) * 6) + 7 + 1 + (MAX_EXCEPTIONS * 3);
+
+    struct Exception {
+        uint16_t day;     // days since 1970-01-01
+        uint8_t schedule; // index in the table
+    };
+
+    WeekSchedule() { clear({ 19 * 60, 7 * 60, 5 }); }
+    // the same schedule every day, no exceptions
+    void clear(const DaySchedule &everyDay);
+    // false when the table is full; 0 is Sunday
+    bool setWeekday(uint8_t weekday, const DaySchedule &schedule);
+    // replaces an exception on the same day, false when full
+    bool setException(uint16_t day, const DaySchedule &schedule);
+
+    const DaySchedule &weekday(uint8_t weekday) const { return schedules[weekdays[weekday]]; }
+    uint8_t exceptionCount() const { return exceptionsUsed; }
+    uint16_t exceptionDay(uint8_t i) const { return exceptions[i].day; }
+    const DaySchedule &exception(uint8_t i) const { return schedules[exceptions[i].schedule]; }
+    // the schedule of a day, in days since 1970-01-01
+    const DaySchedule &forDay(uint16_t day) const;
+
+    size_t write(uint8_t *out) const; // MAX_BYTES at most
+    bool read(const uint8_t *data, size_t size);
+
+    // Exceptions as the settings page edits them, a line per date:
+    // "2026-12-24 20:30 5 08:00" is the date, sleep time, transition and
+    // awake time. Lines that do not parse or are for a day before today
+    // are skipped, false when the table or the exceptions are full.
+    bool parseExceptions(const String &text, uint16_t today = 0);
+    // the line of exception i, as parseExceptions() reads it
+    size_t formatException(uint8_t i, char *out, size_t size) const;
+
+    // days since 1970-01-01 of a date in the Gregorian calendar, and back
+    static int32_t dayNumber(int32_t year, uint32_t month, uint32_t day);
+    static void date(uint16_t day, int32_t &year, uint32_t &month, uint32_t &dayOfMonth);
+private:
+    static constexpr uint8_t VERSION = 1;
+    DaySchedule schedules[MAX_SCHEDULES];
+    uint8_t schedulesUsed;
+    uint8_t weekdays[7];
+    Exception exceptions[MAX_EXCEPTIONS];
+    uint8_t exceptionsUsed;
+    int16_t intern(const DaySchedule &schedule);
+    const Exception *find(uint16_t day) const;
+};
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef __SCHEDULER_H
+#define __SCHEDULER_H
+#include <Arduino.h>
+
+// Cooperative scheduler for loop(). A task returns how long until it has
+// to run again, run() calls the tasks that are due and then sleeps until
+// the earliest deadline, or until an event callback calls wake(). It keeps
+// how late every task ran and how the time was split between running and
+// sleeping, so tick latency and idle time can be checked on the device
+// (PROFILE_SCHEDULER) and in the emulator.
+class Scheduler {
+public:
+    typedef uint32_t (*Task)();              // micros until the next run
+    static constexpr uint32_t NEVER = UINT32_MAX; // wait for wake()
+    static constexpr uint8_t MAX_TASKS = 8;
+    // longest sleep, so a task waiting for wake() can not stop the loop
+    static constexpr uint32_t MAX_SLEEP = 1000000;
+
+    struct TaskStats {
+        const char *name;
+        uint32_t runs;
+        uint64_t late;    // micros past the deadline, summed
+        uint32_t maxLate;
+    };
+
+    // the task is due at once, returns its id for wake()
+    uint8_t add(const char *name, Task task);
+    // run the task as soon as possible, also from WiFi event callbacks
+    void wake(uint8_t task);
+    // one pass of loop(): run the due tasks and sleep until the next one
+    void run();
+
+    uint8_t size() const { return count; }
+    const TaskStats &stats(uint8_t task) const { return tasks[task].stats; }
+    uint64_t busyMicros = 0; // running tasks
+    uint64_t idleMicros = 0; // sleeping
+    void resetStats();
+private:
+    struct Entry {
+        Task task;
+        uint32_t deadline; // micros()
+        bool waiting;      // for wake()
+        TaskStats stats;
+    };
+    Entry tasks[MAX_TASKS];
+    uint8_t count = 0;
+    volatile bool woken = false;
+    void sleep(uint32_t us);
+};
+
+#endif
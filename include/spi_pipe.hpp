@@ -0,0 +1,53 @@
+#ifndef __SPI_PIPE_H
+#define __SPI_PIPE_H
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "damage.hpp"
+
+// Pixels on their way to the lcd. A band is copied in here once composed,
+// and fed to the SPI FIFO 64 bytes at a time by pump() while the next band
+// is composed in the sprite, so composing and sending overlap. Costs one
+// band of pixels, 2.5 KB.
+class SpiPipe {
+public:
+    static constexpr uint16_t CAPACITY = 160 * 8; // pixels
+    static constexpr uint8_t WINDOW_BYTES = 11;   // CASET + RASET + RAMWR
+
+    explicit SpiPipe(TFT_eSPI &lcd): lcd(lcd) {}
+
+    // wait until everything queued went out, after which the pipe is empty
+    void wait();
+    // the pixels queued after this go to a new lcd window
+    void window(const Rect &area);
+    // queue w x h pixels (stored the way the lcd wants them), the caller
+    // makes sure they fit by calling wait() first
+    void rows(const uint16_t *pixels, int16_t stride, int16_t w, int16_t h);
+    // keep the SPI busy, never waits for it
+    void pump();
+
+    // cycles spent waiting on the SPI and bytes sent, the caller resets them
+    uint32_t stallCycles = 0;
+    uint32_t sentBytes = 0;
+private:
+    struct Command {
+        Rect window;    // empty: continue in the current window
+        uint16_t count; // pixels following it
+    };
+    static constexpr uint8_t COMMANDS = 12;
+
+    TFT_eSPI &lcd;
+    uint16_t pixels[CAPACITY];
+    Command commands[COMMANDS];
+    uint8_t queued = 0; // commands
+    uint8_t current = 0;
+    uint16_t stored = 0; // pixels
+    uint16_t sent = 0;
+    uint16_t done = 0;   // pixels of the current command
+    bool started = false; // its window is set
+
+    bool busy() const;
+    void send(const uint16_t *pixels, uint8_t count);
+    uint32_t feed();
+};
+
+#endif
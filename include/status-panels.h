@@ -0,0 +1,1265 @@
+// Generated by   : tools/bake_status.py, do not edit
+// Generated from : texts.hpp labels + cat-paw.h + Noto*64-flatten.h
+// Memory usage   : 20012 bytes
+
+#ifndef __STATUS_PANELS_H
+#define __STATUS_PANELS_H
+#if defined(__AVR__)
+    #include <avr/pgmspace.h>
+#elif defined(__PIC32MX__)
+    #define PROGMEM
+#elif defined(__arm__)
+    #define PROGMEM
+#endif
+#include "packed_image.hpp"
+
+// STATUS_SLEEPING: 64x128 rle565, 7632 bytes of flash
+static const uint8_t STATUS_SLEEPING_PACKED_DATA[7376] PROGMEM = {
+0x8E, 0x00, 0x00, 0x02, 0x40, 0x00, 0x58, 0x00, 0x20, 0x00, 0xAB, 0x00, 0x00, 0x87, 0x00, 0x00,
+0x09, 0x78, 0x00, 0xB8, 0x00, 0xE0, 0x00, 0xB0, 0x00, 0x80, 0x00, 0x20, 0x00, 0x00, 0x00, 0xB8,
+0x00, 0xF8, 0x00, 0x58, 0x00, 0xAB, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x83, 0xF8,
+0x00, 0x04, 0x60, 0x00, 0x00, 0x00, 0xB8, 0x00, 0xF8, 0x00, 0x58, 0x00, 0xAB, 0x00, 0x00, 0x85,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0xF8, 0x00, 0x03, 0x48, 0x00, 0x00, 0x00, 0x28, 0x00, 0x78,
+0x00, 0x80, 0x00, 0x00, 0x02, 0xB8, 0x00, 0xF8, 0x00, 0x58, 0x00, 0x81, 0x00, 0x00, 0x03, 0x08,
+0x00, 0x48, 0x00, 0x50, 0x00, 0x48, 0x00, 0x82, 0x00, 0x00, 0x05, 0x30, 0x00, 0x38, 0x00, 0x00,
+0x00, 0x18, 0x00, 0x48, 0x00, 0x38, 0x00, 0x84, 0x00, 0x00, 0x02, 0x30, 0x00, 0x50, 0x00, 0x40,
+0x00, 0x82, 0x00, 0x00, 0x03, 0x30, 0x00, 0x38, 0x00, 0x00, 0x00, 0x18, 0x00, 0x80, 0x48, 0x00,
+0x87, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x28, 0x00, 0x80, 0xF8, 0x00, 0x00, 0x20, 0x00, 0x83,
+0x00, 0x00, 0x02, 0xB8, 0x00, 0xF8, 0x00, 0x58, 0x00, 0x80, 0x00, 0x00, 0x01, 0x50, 0x00, 0xF0,
+0x00, 0x81, 0xF8, 0x00, 0x01, 0xE0, 0x00, 0x38, 0x00, 0x80, 0x00, 0x00, 0x03, 0xB8, 0x00, 0xF8,
+0x00, 0x70, 0x00, 0xF0, 0x00, 0x80, 0xF8, 0x00, 0x00, 0xA8, 0x00, 0x81, 0x00, 0x00, 0x01, 0x18,
+0x00, 0xC8, 0x00, 0x81, 0xF8, 0x00, 0x01, 0xD8, 0x00, 0x28, 0x00, 0x80, 0x00, 0x00, 0x03, 0xB8,
+0x00, 0xF8, 0x00, 0x68, 0x00, 0xF0, 0x00, 0x80, 0xF8, 0x00, 0x01, 0xD8, 0x00, 0x20, 0x00, 0x85,
+0x00, 0x00, 0x86, 0x00, 0x00, 0x04, 0xD8, 0x00, 0xF8, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x08, 0x00,
+0x81, 0x00, 0x00, 0x02, 0xB8, 0x00, 0xF8, 0x00, 0x58, 0x00, 0x80, 0x00, 0x00, 0x06, 0x18, 0x00,
+0xB0, 0x00, 0x60, 0x00, 0x50, 0x00, 0xB0, 0x00, 0xF8, 0x00, 0xC0, 0x00, 0x80, 0x00, 0x00, 0x04,
+0xB8, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x80, 0x00, 0x80, 0xF8, 0x00, 0x00, 0x60, 0x00,
+0x80, 0x00, 0x00, 0x06, 0xB8, 0x00, 0xF8, 0x00, 0xA8, 0x00, 0x48, 0x00, 0x88, 0x00, 0xF8, 0x00,
+0xC8, 0x00, 0x80, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x80, 0xF8, 0x00, 0x04, 0x88, 0x00, 0x70, 0x00,
+0xE8, 0x00, 0xF8, 0x00, 0x88, 0x00, 0x85, 0x00, 0x00, 0x86, 0x00, 0x00, 0x01, 0x28, 0x00, 0xD8,
+0x00, 0x80, 0xF8, 0x00, 0x01, 0xE0, 0x00, 0x48, 0x00, 0x80, 0x00, 0x00, 0x02, 0xB8, 0x00, 0xF8,
+0x00, 0x58, 0x00, 0x84, 0x00, 0x00, 0x02, 0x50, 0x00, 0xF8, 0x00, 0xE8, 0x00, 0x80, 0x00, 0x00,
+0x02, 0xB8, 0x00, 0xF8, 0x00, 0x88, 0x00, 0x80, 0x00, 0x00, 0x04, 0xA0, 0x00, 0xF8, 0x00, 0xA8,
+0x00, 0x00, 0x00, 0x20, 0x00, 0x80, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x06, 0xF0,
+0x00, 0xF8, 0x00, 0x20, 0x00, 0x00, 0x00, 0xB8, 0x00, 0xF8, 0x00, 0xA0, 0x00, 0x80, 0x00, 0x00,
+0x02, 0x98, 0x00, 0xF8, 0x00, 0xA8, 0x00, 0x85, 0x00, 0x00, 0x87, 0x00, 0x00, 0x02, 0x08, 0x00,
+0x70, 0x00, 0xE0, 0x00, 0x80, 0xF8, 0x00, 0x04, 0x38, 0x00, 0x00, 0x00, 0xB8, 0x00, 0xF8, 0x00,
+0x58, 0x00, 0x80, 0x00, 0x00, 0x02, 0x48, 0x00, 0xC0, 0x00, 0xF0, 0x00, 0x81, 0xF8, 0x00, 0x00,
+0xE8, 0x00, 0x80, 0x00, 0x00, 0x02, 0xB8, 0x00, 0xF8, 0x00, 0x58, 0x00, 0x80, 0x00, 0x00, 0x04,
+0x68, 0x00, 0xF8, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x48, 0x00, 0x85, 0xF8, 0x00, 0x04, 0x40, 0x00,
+0x00, 0x00, 0xB8, 0x00, 0xF8, 0x00, 0x60, 0x00, 0x80, 0x00, 0x00, 0x02, 0x68, 0x00, 0xF8, 0x00,
+0xA8, 0x00, 0x85, 0x00, 0x00, 0x89, 0x00, 0x00, 0x09, 0x08, 0x00, 0xC0, 0x00, 0xF8, 0x00, 0x98,
+0x00, 0x00, 0x00, 0xB8, 0x00, 0xF8, 0x00, 0x58, 0x00, 0x00, 0x00, 0x28, 0x00, 0x80, 0xF8, 0x00,
+0x04, 0x88, 0x00, 0x48, 0x00, 0x78, 0x00, 0xF8, 0x00, 0xE8, 0x00, 0x80, 0x00, 0x00, 0x02, 0xB8,
+0x00, 0xF8, 0x00, 0x60, 0x00, 0x80, 0x00, 0x00, 0x06, 0x70, 0x00, 0xF8, 0x00, 0xB0, 0x00, 0x00,
+0x00, 0x48, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0x83, 0x60, 0x00, 0x04, 0x18, 0x00, 0x00, 0x00, 0xB8,
+0x00, 0xF8, 0x00, 0x58, 0x00, 0x80, 0x00, 0x00, 0x02, 0x68, 0x00, 0xF8, 0x00, 0xA8, 0x00, 0x85,
+0x00, 0x00, 0x85, 0x00, 0x00, 0x01, 0x28, 0x00, 0x40, 0x00, 0x81, 0x00, 0x00, 0x0A, 0xA8, 0x00,
+0xF8, 0x00, 0x98, 0x00, 0x00, 0x00, 0xB8, 0x00, 0xF8, 0x00, 0x58, 0x00, 0x00, 0x00, 0x58, 0x00,
+0xF8, 0x00, 0xF0, 0x00, 0x80, 0x00, 0x00, 0x02, 0x68, 0x00, 0xF8, 0x00, 0xE8, 0x00, 0x80, 0x00,
+0x00, 0x02, 0xB8, 0x00, 0xF8, 0x00, 0xB0, 0x00, 0x80, 0x00, 0x00, 0x04, 0xB8, 0x00, 0xF8, 0x00,
+0xA0, 0x00, 0x00, 0x00, 0x18, 0x00, 0x80, 0xF8, 0x00, 0x00, 0x30, 0x00, 0x84, 0x00, 0x00, 0x02,
+0xB8, 0x00, 0xF8, 0x00, 0x58, 0x00, 0x80, 0x00, 0x00, 0x02, 0x68, 0x00, 0xF8, 0x00, 0xA8, 0x00,
+0x85, 0x00, 0x00, 0x85, 0x00, 0x00, 0x04, 0x50, 0x00, 0xF8, 0x00, 0xE8, 0x00, 0xA8, 0x00, 0xC0,
+0x00, 0x80, 0xF8, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0xB8, 0x00, 0xF8, 0x00, 0x58, 0x00, 0x00,
+0x00, 0x38, 0x00, 0x80, 0xF8, 0x00, 0x04, 0x98, 0x00, 0x88, 0x00, 0xE8, 0x00, 0xF8, 0x00, 0xE8,
+0x00, 0x80, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x80, 0xF8, 0x00, 0x01, 0xB8, 0x00, 0xC0, 0x00, 0x80,
+0xF8, 0x00, 0x00, 0x38, 0x00, 0x80, 0x00, 0x00, 0x04, 0x98, 0x00, 0xF8, 0x00, 0xE0, 0x00, 0x98,
+0x00, 0x90, 0x00, 0x80, 0xA8, 0x00, 0x80, 0x00, 0x00, 0x02, 0xB8, 0x00, 0xF8, 0x00, 0x58, 0x00,
+0x80, 0x00, 0x00, 0x02, 0x68, 0x00, 0xF8, 0x00, 0xA8, 0x00, 0x85, 0x00, 0x00, 0x85, 0x00, 0x00,
+0x01, 0x30, 0x00, 0xC8, 0x00, 0x81, 0xF8, 0x00, 0x01, 0xD8, 0x00, 0x58, 0x00, 0x80, 0x00, 0x00,
+0x02, 0xB8, 0x00, 0xF8, 0x00, 0x58, 0x00, 0x80, 0x00, 0x00, 0x00, 0x90, 0x00, 0x80, 0xF8, 0x00,
+0x03, 0xE0, 0x00, 0x48, 0x00, 0xC8, 0x00, 0xE8, 0x00, 0x80, 0x00, 0x00, 0x06, 0xB8, 0x00, 0xF8,
+0x00, 0x80, 0x00, 0xE0, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x82, 0x00, 0x00, 0x01, 0x88,
+0x00, 0xF0, 0x00, 0x80, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x78, 0x00, 0x80, 0x00, 0x00, 0x02, 0xB8,
+0x00, 0xF8, 0x00, 0x58, 0x00, 0x80, 0x00, 0x00, 0x02, 0x68, 0x00, 0xF8, 0x00, 0xA8, 0x00, 0x85,
+0x00, 0x00, 0x88, 0x00, 0x00, 0x80, 0x08, 0x00, 0x88, 0x00, 0x00, 0x80, 0x08, 0x00, 0x84, 0x00,
+0x00, 0x04, 0xB8, 0x00, 0xF8, 0x00, 0x58, 0x00, 0x00, 0x00, 0x08, 0x00, 0x86, 0x00, 0x00, 0x80,
+0x08, 0x00, 0x91, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x02, 0xB8, 0x00, 0xF8, 0x00, 0x58, 0x00, 0x9D,
+0x00, 0x00, 0x9C, 0x00, 0x00, 0x02, 0xB8, 0x00, 0xF8, 0x00, 0x58, 0x00, 0x9D, 0x00, 0x00, 0x89,
+0x00, 0x00, 0x01, 0x4A, 0x69, 0x7B, 0xCF, 0x81, 0x00, 0x00, 0x02, 0x21, 0x04, 0xA5, 0x14, 0x9C,
+0xF3, 0x88, 0x00, 0x00, 0x01, 0x4A, 0x69, 0x7B, 0xCF, 0x81, 0x00, 0x00, 0x02, 0x21, 0x04, 0xA5,
+0x14, 0x9C, 0xF3, 0x88, 0x00, 0x00, 0x01, 0x4A, 0x69, 0x7B, 0xCF, 0x81, 0x00, 0x00, 0x02, 0x21,
+0x04, 0xA5, 0x14, 0x9C, 0xF3, 0x87, 0x00, 0x00, 0x88, 0x00, 0x00, 0x03, 0x63, 0x2C, 0xF7, 0xBE,
+0xFF, 0xFF, 0xBD, 0xF7, 0x80, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xB5, 0x96,
+0x86, 0x00, 0x00, 0x03, 0x63, 0x2C, 0xF7, 0xBE, 0xFF, 0xFF, 0xBD, 0xF7, 0x80, 0x00, 0x00, 0x00,
+0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xB5, 0x96, 0x86, 0x00, 0x00, 0x03, 0x63, 0x2C, 0xF7, 0xBE,
+0xFF, 0xFF, 0xBD, 0xF7, 0x80, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xB5, 0x96,
+0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xC6, 0x18, 0x80, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0x00,
+0x00, 0x5A, 0xEB, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x86, 0x00, 0x00, 0x00, 0xC6, 0x18, 0x80,
+0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0x00, 0x00, 0x5A, 0xEB, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x86,
+0x00, 0x00, 0x00, 0xC6, 0x18, 0x80, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0x00, 0x00, 0x5A, 0xEB, 0x81,
+0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xD6, 0xBA, 0x81, 0xFF,
+0xFF, 0x01, 0x00, 0x00, 0x7B, 0xEF, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x86, 0x00, 0x00, 0x00,
+0xD6, 0xBA, 0x81, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x7B, 0xEF, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C,
+0x86, 0x00, 0x00, 0x00, 0xD6, 0xBA, 0x81, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x7B, 0xEF, 0x81, 0xFF,
+0xFF, 0x00, 0xE7, 0x3C, 0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xBD, 0xF7, 0x80, 0xFF, 0xFF,
+0x02, 0xF7, 0x9E, 0x00, 0x00, 0x31, 0x86, 0x81, 0xFF, 0xFF, 0x00, 0xD6, 0xBA, 0x86, 0x00, 0x00,
+0x00, 0xBD, 0xF7, 0x80, 0xFF, 0xFF, 0x02, 0xF7, 0x9E, 0x00, 0x00, 0x31, 0x86, 0x81, 0xFF, 0xFF,
+0x00, 0xD6, 0xBA, 0x86, 0x00, 0x00, 0x00, 0xBD, 0xF7, 0x80, 0xFF, 0xFF, 0x02, 0xF7, 0x9E, 0x00,
+0x00, 0x31, 0x86, 0x81, 0xFF, 0xFF, 0x00, 0xD6, 0xBA, 0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x03,
+0x63, 0x0C, 0xFF, 0xDF, 0xFF, 0xFF, 0xD6, 0x9A, 0x80, 0x00, 0x00, 0x00, 0xDE, 0xDB, 0x80, 0xFF,
+0xFF, 0x00, 0x84, 0x10, 0x86, 0x00, 0x00, 0x03, 0x63, 0x0C, 0xFF, 0xDF, 0xFF, 0xFF, 0xD6, 0x9A,
+0x80, 0x00, 0x00, 0x00, 0xDE, 0xDB, 0x80, 0xFF, 0xFF, 0x00, 0x84, 0x10, 0x86, 0x00, 0x00, 0x03,
+0x63, 0x0C, 0xFF, 0xDF, 0xFF, 0xFF, 0xD6, 0x9A, 0x80, 0x00, 0x00, 0x00, 0xDE, 0xDB, 0x80, 0xFF,
+0xFF, 0x00, 0x84, 0x10, 0x86, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x63, 0x0C, 0x80, 0xEF, 0x7D,
+0x03, 0x63, 0x0C, 0x84, 0x10, 0xC6, 0x38, 0x52, 0x8A, 0x80, 0x00, 0x00, 0x06, 0x63, 0x0C, 0xC6,
+0x38, 0x94, 0x92, 0x00, 0x00, 0xAD, 0x55, 0xFF, 0xDF, 0xC6, 0x38, 0x80, 0x00, 0x00, 0x00, 0x63,
+0x0C, 0x80, 0xEF, 0x7D, 0x03, 0x63, 0x0C, 0x84, 0x10, 0xC6, 0x38, 0x52, 0x8A, 0x80, 0x00, 0x00,
+0x06, 0x63, 0x0C, 0xC6, 0x38, 0x94, 0x92, 0x00, 0x00, 0xAD, 0x55, 0xFF, 0xDF, 0xC6, 0x38, 0x80,
+0x00, 0x00, 0x00, 0x63, 0x0C, 0x80, 0xEF, 0x7D, 0x03, 0x63, 0x0C, 0x84, 0x10, 0xC6, 0x38, 0x52,
+0x8A, 0x80, 0x00, 0x00, 0x06, 0x63, 0x0C, 0xC6, 0x38, 0x94, 0x92, 0x00, 0x00, 0xAD, 0x55, 0xFF,
+0xDF, 0xC6, 0x38, 0x83, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00,
+0xD6, 0x9A, 0x86, 0x00, 0x00, 0x00, 0x84, 0x30, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x80, 0x00,
+0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xD6, 0x9A, 0x86, 0x00, 0x00, 0x00, 0x84, 0x30,
+0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x80, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00,
+0xD6, 0x9A, 0x86, 0x00, 0x00, 0x00, 0x84, 0x30, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x83, 0x00,
+0x00, 0x85, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x81, 0x00, 0x00, 0x80, 0x7B, 0xEF,
+0x81, 0x00, 0x00, 0x00, 0xE7, 0x3C, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x80, 0x00, 0x00, 0x81,
+0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x81, 0x00, 0x00, 0x80, 0x7B, 0xEF, 0x81, 0x00, 0x00, 0x00, 0xE7,
+0x3C, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x80, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C,
+0x81, 0x00, 0x00, 0x80, 0x7B, 0xEF, 0x81, 0x00, 0x00, 0x00, 0xE7, 0x3C, 0x80, 0xFF, 0xFF, 0x00,
+0xFF, 0xDF, 0x83, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0xF7, 0xBE, 0x80, 0xFF, 0xFF, 0x00, 0xD6,
+0xBA, 0x80, 0x00, 0x00, 0x00, 0xCE, 0x59, 0x80, 0xFF, 0xFF, 0x02, 0xB5, 0xB6, 0x00, 0x00, 0x00,
+0x20, 0x81, 0xFF, 0xFF, 0x00, 0xCE, 0x59, 0x80, 0x00, 0x00, 0x00, 0xF7, 0xBE, 0x80, 0xFF, 0xFF,
+0x00, 0xD6, 0xBA, 0x80, 0x00, 0x00, 0x00, 0xCE, 0x59, 0x80, 0xFF, 0xFF, 0x02, 0xB5, 0xB6, 0x00,
+0x00, 0x00, 0x20, 0x81, 0xFF, 0xFF, 0x00, 0xCE, 0x59, 0x80, 0x00, 0x00, 0x00, 0xF7, 0xBE, 0x80,
+0xFF, 0xFF, 0x00, 0xD6, 0xBA, 0x80, 0x00, 0x00, 0x00, 0xCE, 0x59, 0x80, 0xFF, 0xFF, 0x02, 0xB5,
+0xB6, 0x00, 0x00, 0x00, 0x20, 0x81, 0xFF, 0xFF, 0x00, 0xCE, 0x59, 0x83, 0x00, 0x00, 0x85, 0x00,
+0x00, 0x00, 0xB5, 0xB6, 0x80, 0xFF, 0xFF, 0x02, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x75, 0x82, 0xFF,
+0xFF, 0x05, 0x7B, 0xCF, 0x00, 0x00, 0xF7, 0x9E, 0xFF, 0xFF, 0xF7, 0x9E, 0x4A, 0x69, 0x80, 0x00,
+0x00, 0x00, 0xB5, 0xB6, 0x80, 0xFF, 0xFF, 0x02, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x75, 0x82, 0xFF,
+0xFF, 0x05, 0x7B, 0xCF, 0x00, 0x00, 0xF7, 0x9E, 0xFF, 0xFF, 0xF7, 0x9E, 0x4A, 0x69, 0x80, 0x00,
+0x00, 0x00, 0xB5, 0xB6, 0x80, 0xFF, 0xFF, 0x02, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x75, 0x82, 0xFF,
+0xFF, 0x05, 0x7B, 0xCF, 0x00, 0x00, 0xF7, 0x9E, 0xFF, 0xFF, 0xF7, 0x9E, 0x4A, 0x69, 0x83, 0x00,
+0x00, 0x86, 0x00, 0x00, 0x03, 0x94, 0xB2, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x55, 0x83, 0xFF, 0xFF,
+0x04, 0xF7, 0x9E, 0x63, 0x0C, 0x52, 0x8A, 0xA5, 0x34, 0x4A, 0x49, 0x82, 0x00, 0x00, 0x03, 0x94,
+0xB2, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x55, 0x83, 0xFF, 0xFF, 0x04, 0xF7, 0x9E, 0x63, 0x0C, 0x52,
+0x8A, 0xA5, 0x34, 0x4A, 0x49, 0x82, 0x00, 0x00, 0x03, 0x94, 0xB2, 0x84, 0x10, 0x00, 0x00, 0xAD,
+0x55, 0x83, 0xFF, 0xFF, 0x04, 0xF7, 0x9E, 0x63, 0x0C, 0x52, 0x8A, 0xA5, 0x34, 0x4A, 0x49, 0x84,
+0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xBD, 0xD7, 0x85, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xC6, 0x38,
+0x39, 0xC7, 0x85, 0x00, 0x00, 0x00, 0xBD, 0xD7, 0x85, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xC6, 0x38,
+0x39, 0xC7, 0x85, 0x00, 0x00, 0x00, 0xBD, 0xD7, 0x85, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xC6, 0x38,
+0x39, 0xC7, 0x85, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x08, 0x61, 0x88, 0xFF, 0xFF, 0x00, 0xC6,
+0x38, 0x84, 0x00, 0x00, 0x00, 0x08, 0x61, 0x88, 0xFF, 0xFF, 0x00, 0xC6, 0x38, 0x84, 0x00, 0x00,
+0x00, 0x08, 0x61, 0x88, 0xFF, 0xFF, 0x00, 0xC6, 0x38, 0x85, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+0xF7, 0x9E, 0x81, 0xFF, 0xFF, 0x01, 0xF7, 0xBE, 0xEF, 0x7D, 0x82, 0xFF, 0xFF, 0x00, 0xA5, 0x34,
+0x85, 0x00, 0x00, 0x00, 0xF7, 0x9E, 0x81, 0xFF, 0xFF, 0x01, 0xF7, 0xBE, 0xEF, 0x7D, 0x82, 0xFF,
+0xFF, 0x00, 0xA5, 0x34, 0x85, 0x00, 0x00, 0x00, 0xF7, 0x9E, 0x81, 0xFF, 0xFF, 0x01, 0xF7, 0xBE,
+0xEF, 0x7D, 0x82, 0xFF, 0xFF, 0x00, 0xA5, 0x34, 0x85, 0x00, 0x00, 0x88, 0x00, 0x00, 0x03, 0x63,
+0x0C, 0xAD, 0x75, 0xAD, 0x55, 0x6B, 0x6D, 0x80, 0x00, 0x00, 0x03, 0x00, 0x20, 0x7B, 0xCF, 0x84,
+0x10, 0x6B, 0x6D, 0x86, 0x00, 0x00, 0x03, 0x63, 0x0C, 0xAD, 0x75, 0xAD, 0x55, 0x6B, 0x6D, 0x80,
+0x00, 0x00, 0x03, 0x00, 0x20, 0x7B, 0xCF, 0x84, 0x10, 0x6B, 0x6D, 0x86, 0x00, 0x00, 0x03, 0x63,
+0x0C, 0xAD, 0x75, 0xAD, 0x55, 0x6B, 0x6D, 0x80, 0x00, 0x00, 0x03, 0x00, 0x20, 0x7B, 0xCF, 0x84,
+0x10, 0x6B, 0x6D, 0x86, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x89, 0x00, 0x00, 0x01,
+0x4A, 0x69, 0x7B, 0xCF, 0x81, 0x00, 0x00, 0x02, 0x21, 0x04, 0xA5, 0x14, 0x9C, 0xF3, 0x88, 0x00,
+0x00, 0x01, 0x4A, 0x69, 0x7B, 0xCF, 0x81, 0x00, 0x00, 0x02, 0x21, 0x04, 0xA5, 0x14, 0x9C, 0xF3,
+0x88, 0x00, 0x00, 0x01, 0x4A, 0x69, 0x7B, 0xCF, 0x81, 0x00, 0x00, 0x02, 0x21, 0x04, 0xA5, 0x14,
+0x9C, 0xF3, 0x87, 0x00, 0x00, 0x88, 0x00, 0x00, 0x03, 0x63, 0x2C, 0xF7, 0xBE, 0xFF, 0xFF, 0xBD,
+0xF7, 0x80, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xB5, 0x96, 0x86, 0x00, 0x00,
+0x03, 0x63, 0x2C, 0xF7, 0xBE, 0xFF, 0xFF, 0xBD, 0xF7, 0x80, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80,
+0xFF, 0xFF, 0x00, 0xB5, 0x96, 0x86, 0x00, 0x00, 0x03, 0x63, 0x2C, 0xF7, 0xBE, 0xFF, 0xFF, 0xBD,
+0xF7, 0x80, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xB5, 0x96, 0x86, 0x00, 0x00,
+0x88, 0x00, 0x00, 0x00, 0xC6, 0x18, 0x80, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0x00, 0x00, 0x5A, 0xEB,
+0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x86, 0x00, 0x00, 0x00, 0xC6, 0x18, 0x80, 0xFF, 0xFF, 0x02,
+0xFF, 0xDF, 0x00, 0x00, 0x5A, 0xEB, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x86, 0x00, 0x00, 0x00,
+0xC6, 0x18, 0x80, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0x00, 0x00, 0x5A, 0xEB, 0x81, 0xFF, 0xFF, 0x00,
+0xE7, 0x3C, 0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xD6, 0xBA, 0x81, 0xFF, 0xFF, 0x01, 0x00,
+0x00, 0x7B, 0xEF, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x86, 0x00, 0x00, 0x00, 0xD6, 0xBA, 0x81,
+0xFF, 0xFF, 0x01, 0x00, 0x00, 0x7B, 0xEF, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x86, 0x00, 0x00,
+0x00, 0xD6, 0xBA, 0x81, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x7B, 0xEF, 0x81, 0xFF, 0xFF, 0x00, 0xE7,
+0x3C, 0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xBD, 0xF7, 0x80, 0xFF, 0xFF, 0x02, 0xF7, 0x9E,
+0x00, 0x00, 0x31, 0x86, 0x81, 0xFF, 0xFF, 0x00, 0xD6, 0xBA, 0x86, 0x00, 0x00, 0x00, 0xBD, 0xF7,
+0x80, 0xFF, 0xFF, 0x02, 0xF7, 0x9E, 0x00, 0x00, 0x31, 0x86, 0x81, 0xFF, 0xFF, 0x00, 0xD6, 0xBA,
+0x86, 0x00, 0x00, 0x00, 0xBD, 0xF7, 0x80, 0xFF, 0xFF, 0x02, 0xF7, 0x9E, 0x00, 0x00, 0x31, 0x86,
+0x81, 0xFF, 0xFF, 0x00, 0xD6, 0xBA, 0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x03, 0x63, 0x0C, 0xFF,
+0xDF, 0xFF, 0xFF, 0xD6, 0x9A, 0x80, 0x00, 0x00, 0x00, 0xDE, 0xDB, 0x80, 0xFF, 0xFF, 0x00, 0x84,
+0x10, 0x86, 0x00, 0x00, 0x03, 0x63, 0x0C, 0xFF, 0xDF, 0xFF, 0xFF, 0xD6, 0x9A, 0x80, 0x00, 0x00,
+0x00, 0xDE, 0xDB, 0x80, 0xFF, 0xFF, 0x00, 0x84, 0x10, 0x86, 0x00, 0x00, 0x03, 0x63, 0x0C, 0xFF,
+0xDF, 0xFF, 0xFF, 0xD6, 0x9A, 0x80, 0x00, 0x00, 0x00, 0xDE, 0xDB, 0x80, 0xFF, 0xFF, 0x00, 0x84,
+0x10, 0x86, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x63, 0x0C, 0x80, 0xEF, 0x7D, 0x03, 0x63, 0x0C,
+0x84, 0x10, 0xC6, 0x38, 0x52, 0x8A, 0x80, 0x00, 0x00, 0x06, 0x63, 0x0C, 0xC6, 0x38, 0x94, 0x92,
+0x00, 0x00, 0xAD, 0x55, 0xFF, 0xDF, 0xC6, 0x38, 0x80, 0x00, 0x00, 0x00, 0x63, 0x0C, 0x80, 0xEF,
+0x7D, 0x03, 0x63, 0x0C, 0x84, 0x10, 0xC6, 0x38, 0x52, 0x8A, 0x80, 0x00, 0x00, 0x06, 0x63, 0x0C,
+0xC6, 0x38, 0x94, 0x92, 0x00, 0x00, 0xAD, 0x55, 0xFF, 0xDF, 0xC6, 0x38, 0x80, 0x00, 0x00, 0x00,
+0x63, 0x0C, 0x80, 0xEF, 0x7D, 0x03, 0x63, 0x0C, 0x84, 0x10, 0xC6, 0x38, 0x52, 0x8A, 0x80, 0x00,
+0x00, 0x06, 0x63, 0x0C, 0xC6, 0x38, 0x94, 0x92, 0x00, 0x00, 0xAD, 0x55, 0xFF, 0xDF, 0xC6, 0x38,
+0x83, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xD6, 0x9A, 0x86,
+0x00, 0x00, 0x00, 0x84, 0x30, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x80, 0x00, 0x00, 0x00, 0xD6,
+0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xD6, 0x9A, 0x86, 0x00, 0x00, 0x00, 0x84, 0x30, 0x80, 0xFF, 0xFF,
+0x00, 0xFF, 0xDF, 0x80, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xD6, 0x9A, 0x86,
+0x00, 0x00, 0x00, 0x84, 0x30, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x83, 0x00, 0x00, 0x85, 0x00,
+0x00, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x81, 0x00, 0x00, 0x80, 0x7B, 0xEF, 0x81, 0x00, 0x00,
+0x00, 0xE7, 0x3C, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x80, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x00,
+0xE7, 0x3C, 0x81, 0x00, 0x00, 0x80, 0x7B, 0xEF, 0x81, 0x00, 0x00, 0x00, 0xE7, 0x3C, 0x80, 0xFF,
+0xFF, 0x00, 0xFF, 0xDF, 0x80, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x81, 0x00, 0x00,
+0x80, 0x7B, 0xEF, 0x81, 0x00, 0x00, 0x00, 0xE7, 0x3C, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x83,
+0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0xF7, 0xBE, 0x80, 0xFF, 0xFF, 0x00, 0xD6, 0xBA, 0x80, 0x00,
+0x00, 0x00, 0xCE, 0x59, 0x80, 0xFF, 0xFF, 0x02, 0xB5, 0xB6, 0x00, 0x00, 0x00, 0x20, 0x81, 0xFF,
+0xFF, 0x00, 0xCE, 0x59, 0x80, 0x00, 0x00, 0x00, 0xF7, 0xBE, 0x80, 0xFF, 0xFF, 0x00, 0xD6, 0xBA,
+0x80, 0x00, 0x00, 0x00, 0xCE, 0x59, 0x80, 0xFF, 0xFF, 0x02, 0xB5, 0xB6, 0x00, 0x00, 0x00, 0x20,
+0x81, 0xFF, 0xFF, 0x00, 0xCE, 0x59, 0x80, 0x00, 0x00, 0x00, 0xF7, 0xBE, 0x80, 0xFF, 0xFF, 0x00,
+0xD6, 0xBA, 0x80, 0x00, 0x00, 0x00, 0xCE, 0x59, 0x80, 0xFF, 0xFF, 0x02, 0xB5, 0xB6, 0x00, 0x00,
+0x00, 0x20, 0x81, 0xFF, 0xFF, 0x00, 0xCE, 0x59, 0x83, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0xB5,
+0xB6, 0x80, 0xFF, 0xFF, 0x02, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x75, 0x82, 0xFF, 0xFF, 0x05, 0x7B,
+0xCF, 0x00, 0x00, 0xF7, 0x9E, 0xFF, 0xFF, 0xF7, 0x9E, 0x4A, 0x69, 0x80, 0x00, 0x00, 0x00, 0xB5,
+0xB6, 0x80, 0xFF, 0xFF, 0x02, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x75, 0x82, 0xFF, 0xFF, 0x05, 0x7B,
+0xCF, 0x00, 0x00, 0xF7, 0x9E, 0xFF, 0xFF, 0xF7, 0x9E, 0x4A, 0x69, 0x80, 0x00, 0x00, 0x00, 0xB5,
+0xB6, 0x80, 0xFF, 0xFF, 0x02, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x75, 0x82, 0xFF, 0xFF, 0x05, 0x7B,
+0xCF, 0x00, 0x00, 0xF7, 0x9E, 0xFF, 0xFF, 0xF7, 0x9E, 0x4A, 0x69, 0x83, 0x00, 0x00, 0x86, 0x00,
+0x00, 0x03, 0x94, 0xB2, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x55, 0x83, 0xFF, 0xFF, 0x04, 0xF7, 0x9E,
+0x63, 0x0C, 0x52, 0x8A, 0xA5, 0x34, 0x4A, 0x49, 0x82, 0x00, 0x00, 0x03, 0x94, 0xB2, 0x84, 0x10,
+0x00, 0x00, 0xAD, 0x55, 0x83, 0xFF, 0xFF, 0x04, 0xF7, 0x9E, 0x63, 0x0C, 0x52, 0x8A, 0xA5, 0x34,
+0x4A, 0x49, 0x82, 0x00, 0x00, 0x03, 0x94, 0xB2, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x55, 0x83, 0xFF,
+0xFF, 0x04, 0xF7, 0x9E, 0x63, 0x0C, 0x52, 0x8A, 0xA5, 0x34, 0x4A, 0x49, 0x84, 0x00, 0x00, 0x88,
+0x00, 0x00, 0x00, 0xBD, 0xD7, 0x85, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xC6, 0x38, 0x39, 0xC7, 0x85,
+0x00, 0x00, 0x00, 0xBD, 0xD7, 0x85, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xC6, 0x38, 0x39, 0xC7, 0x85,
+0x00, 0x00, 0x00, 0xBD, 0xD7, 0x85, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xC6, 0x38, 0x39, 0xC7, 0x85,
+0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x08, 0x61, 0x88, 0xFF, 0xFF, 0x00, 0xC6, 0x38, 0x84, 0x00,
+0x00, 0x00, 0x08, 0x61, 0x88, 0xFF, 0xFF, 0x00, 0xC6, 0x38, 0x84, 0x00, 0x00, 0x00, 0x08, 0x61,
+0x88, 0xFF, 0xFF, 0x00, 0xC6, 0x38, 0x85, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xF7, 0x9E, 0x81,
+0xFF, 0xFF, 0x01, 0xF7, 0xBE, 0xEF, 0x7D, 0x82, 0xFF, 0xFF, 0x00, 0xA5, 0x34, 0x85, 0x00, 0x00,
+0x00, 0xF7, 0x9E, 0x81, 0xFF, 0xFF, 0x01, 0xF7, 0xBE, 0xEF, 0x7D, 0x82, 0xFF, 0xFF, 0x00, 0xA5,
+0x34, 0x85, 0x00, 0x00, 0x00, 0xF7, 0x9E, 0x81, 0xFF, 0xFF, 0x01, 0xF7, 0xBE, 0xEF, 0x7D, 0x82,
+0xFF, 0xFF, 0x00, 0xA5, 0x34, 0x85, 0x00, 0x00, 0x88, 0x00, 0x00, 0x03, 0x63, 0x0C, 0xAD, 0x75,
+0xAD, 0x55, 0x6B, 0x6D, 0x80, 0x00, 0x00, 0x03, 0x00, 0x20, 0x7B, 0xCF, 0x84, 0x10, 0x6B, 0x6D,
+0x86, 0x00, 0x00, 0x03, 0x63, 0x0C, 0xAD, 0x75, 0xAD, 0x55, 0x6B, 0x6D, 0x80, 0x00, 0x00, 0x03,
+0x00, 0x20, 0x7B, 0xCF, 0x84, 0x10, 0x6B, 0x6D, 0x86, 0x00, 0x00, 0x03, 0x63, 0x0C, 0xAD, 0x75,
+0xAD, 0x55, 0x6B, 0x6D, 0x80, 0x00, 0x00, 0x03, 0x00, 0x20, 0x7B, 0xCF, 0x84, 0x10, 0x6B, 0x6D,
+0x86, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x89, 0x00, 0x00, 0x01, 0x4A, 0x69, 0x7B,
+0xCF, 0x81, 0x00, 0x00, 0x02, 0x21, 0x04, 0xA5, 0x14, 0x9C, 0xF3, 0x88, 0x00, 0x00, 0x01, 0x4A,
+0x69, 0x7B, 0xCF, 0x81, 0x00, 0x00, 0x02, 0x21, 0x04, 0xA5, 0x14, 0x9C, 0xF3, 0x88, 0x00, 0x00,
+0x01, 0x4A, 0x69, 0x7B, 0xCF, 0x81, 0x00, 0x00, 0x02, 0x21, 0x04, 0xA5, 0x14, 0x9C, 0xF3, 0x87,
+0x00, 0x00, 0x88, 0x00, 0x00, 0x03, 0x63, 0x2C, 0xF7, 0xBE, 0xFF, 0xFF, 0xBD, 0xF7, 0x80, 0x00,
+0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xB5, 0x96, 0x86, 0x00, 0x00, 0x03, 0x63, 0x2C,
+0xF7, 0xBE, 0xFF, 0xFF, 0xBD, 0xF7, 0x80, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00,
+0xB5, 0x96, 0x86, 0x00, 0x00, 0x03, 0x63, 0x2C, 0xF7, 0xBE, 0xFF, 0xFF, 0xBD, 0xF7, 0x80, 0x00,
+0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xB5, 0x96, 0x86, 0x00, 0x00, 0x88, 0x00, 0x00,
+0x00, 0xC6, 0x18, 0x80, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0x00, 0x00, 0x5A, 0xEB, 0x81, 0xFF, 0xFF,
+0x00, 0xE7, 0x3C, 0x86, 0x00, 0x00, 0x00, 0xC6, 0x18, 0x80, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0x00,
+0x00, 0x5A, 0xEB, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x86, 0x00, 0x00, 0x00, 0xC6, 0x18, 0x80,
+0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0x00, 0x00, 0x5A, 0xEB, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x86,
+0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xD6, 0xBA, 0x81, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x7B, 0xEF,
+0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x86, 0x00, 0x00, 0x00, 0xD6, 0xBA, 0x81, 0xFF, 0xFF, 0x01,
+0x00, 0x00, 0x7B, 0xEF, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x86, 0x00, 0x00, 0x00, 0xD6, 0xBA,
+0x81, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x7B, 0xEF, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x86, 0x00,
+0x00, 0x88, 0x00, 0x00, 0x00, 0xBD, 0xF7, 0x80, 0xFF, 0xFF, 0x02, 0xF7, 0x9E, 0x00, 0x00, 0x31,
+0x86, 0x81, 0xFF, 0xFF, 0x00, 0xD6, 0xBA, 0x86, 0x00, 0x00, 0x00, 0xBD, 0xF7, 0x80, 0xFF, 0xFF,
+0x02, 0xF7, 0x9E, 0x00, 0x00, 0x31, 0x86, 0x81, 0xFF, 0xFF, 0x00, 0xD6, 0xBA, 0x86, 0x00, 0x00,
+0x00, 0xBD, 0xF7, 0x80, 0xFF, 0xFF, 0x02, 0xF7, 0x9E, 0x00, 0x00, 0x31, 0x86, 0x81, 0xFF, 0xFF,
+0x00, 0xD6, 0xBA, 0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x03, 0x63, 0x0C, 0xFF, 0xDF, 0xFF, 0xFF,
+0xD6, 0x9A, 0x80, 0x00, 0x00, 0x00, 0xDE, 0xDB, 0x80, 0xFF, 0xFF, 0x00, 0x84, 0x10, 0x86, 0x00,
+0x00, 0x03, 0x63, 0x0C, 0xFF, 0xDF, 0xFF, 0xFF, 0xD6, 0x9A, 0x80, 0x00, 0x00, 0x00, 0xDE, 0xDB,
+0x80, 0xFF, 0xFF, 0x00, 0x84, 0x10, 0x86, 0x00, 0x00, 0x03, 0x63, 0x0C, 0xFF, 0xDF, 0xFF, 0xFF,
+0xD6, 0x9A, 0x80, 0x00, 0x00, 0x00, 0xDE, 0xDB, 0x80, 0xFF, 0xFF, 0x00, 0x84, 0x10, 0x86, 0x00,
+0x00, 0x85, 0x00, 0x00, 0x00, 0x63, 0x0C, 0x80, 0xEF, 0x7D, 0x03, 0x63, 0x0C, 0x84, 0x10, 0xC6,
+0x38, 0x52, 0x8A, 0x80, 0x00, 0x00, 0x06, 0x63, 0x0C, 0xC6, 0x38, 0x94, 0x92, 0x00, 0x00, 0xAD,
+0x55, 0xFF, 0xDF, 0xC6, 0x38, 0x80, 0x00, 0x00, 0x00, 0x63, 0x0C, 0x80, 0xEF, 0x7D, 0x03, 0x63,
+0x0C, 0x84, 0x10, 0xC6, 0x38, 0x52, 0x8A, 0x80, 0x00, 0x00, 0x06, 0x63, 0x0C, 0xC6, 0x38, 0x94,
+0x92, 0x00, 0x00, 0xAD, 0x55, 0xFF, 0xDF, 0xC6, 0x38, 0x80, 0x00, 0x00, 0x00, 0x63, 0x0C, 0x80,
+0xEF, 0x7D, 0x03, 0x63, 0x0C, 0x84, 0x10, 0xC6, 0x38, 0x52, 0x8A, 0x80, 0x00, 0x00, 0x06, 0x63,
+0x0C, 0xC6, 0x38, 0x94, 0x92, 0x00, 0x00, 0xAD, 0x55, 0xFF, 0xDF, 0xC6, 0x38, 0x83, 0x00, 0x00,
+0x85, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xD6, 0x9A, 0x86, 0x00, 0x00, 0x00,
+0x84, 0x30, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x80, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF,
+0xFF, 0x00, 0xD6, 0x9A, 0x86, 0x00, 0x00, 0x00, 0x84, 0x30, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF,
+0x80, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xD6, 0x9A, 0x86, 0x00, 0x00, 0x00,
+0x84, 0x30, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x83, 0x00, 0x00, 0x85, 0x00, 0x00, 0x81, 0xFF,
+0xFF, 0x00, 0xE7, 0x3C, 0x81, 0x00, 0x00, 0x80, 0x7B, 0xEF, 0x81, 0x00, 0x00, 0x00, 0xE7, 0x3C,
+0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x80, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x81,
+0x00, 0x00, 0x80, 0x7B, 0xEF, 0x81, 0x00, 0x00, 0x00, 0xE7, 0x3C, 0x80, 0xFF, 0xFF, 0x00, 0xFF,
+0xDF, 0x80, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x81, 0x00, 0x00, 0x80, 0x7B, 0xEF,
+0x81, 0x00, 0x00, 0x00, 0xE7, 0x3C, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x83, 0x00, 0x00, 0x85,
+0x00, 0x00, 0x00, 0xF7, 0xBE, 0x80, 0xFF, 0xFF, 0x00, 0xD6, 0xBA, 0x80, 0x00, 0x00, 0x00, 0xCE,
+0x59, 0x80, 0xFF, 0xFF, 0x02, 0xB5, 0xB6, 0x00, 0x00, 0x00, 0x20, 0x81, 0xFF, 0xFF, 0x00, 0xCE,
+0x59, 0x80, 0x00, 0x00, 0x00, 0xF7, 0xBE, 0x80, 0xFF, 0xFF, 0x00, 0xD6, 0xBA, 0x80, 0x00, 0x00,
+0x00, 0xCE, 0x59, 0x80, 0xFF, 0xFF, 0x02, 0xB5, 0xB6, 0x00, 0x00, 0x00, 0x20, 0x81, 0xFF, 0xFF,
+0x00, 0xCE, 0x59, 0x80, 0x00, 0x00, 0x00, 0xF7, 0xBE, 0x80, 0xFF, 0xFF, 0x00, 0xD6, 0xBA, 0x80,
+0x00, 0x00, 0x00, 0xCE, 0x59, 0x80, 0xFF, 0xFF, 0x02, 0xB5, 0xB6, 0x00, 0x00, 0x00, 0x20, 0x81,
+0xFF, 0xFF, 0x00, 0xCE, 0x59, 0x83, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0xB5, 0xB6, 0x80, 0xFF,
+0xFF, 0x02, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x75, 0x82, 0xFF, 0xFF, 0x05, 0x7B, 0xCF, 0x00, 0x00,
+0xF7, 0x9E, 0xFF, 0xFF, 0xF7, 0x9E, 0x4A, 0x69, 0x80, 0x00, 0x00, 0x00, 0xB5, 0xB6, 0x80, 0xFF,
+0xFF, 0x02, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x75, 0x82, 0xFF, 0xFF, 0x05, 0x7B, 0xCF, 0x00, 0x00,
+0xF7, 0x9E, 0xFF, 0xFF, 0xF7, 0x9E, 0x4A, 0x69, 0x80, 0x00, 0x00, 0x00, 0xB5, 0xB6, 0x80, 0xFF,
+0xFF, 0x02, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x75, 0x82, 0xFF, 0xFF, 0x05, 0x7B, 0xCF, 0x00, 0x00,
+0xF7, 0x9E, 0xFF, 0xFF, 0xF7, 0x9E, 0x4A, 0x69, 0x83, 0x00, 0x00, 0x86, 0x00, 0x00, 0x03, 0x94,
+0xB2, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x55, 0x83, 0xFF, 0xFF, 0x04, 0xF7, 0x9E, 0x63, 0x0C, 0x52,
+0x8A, 0xA5, 0x34, 0x4A, 0x49, 0x82, 0x00, 0x00, 0x03, 0x94, 0xB2, 0x84, 0x10, 0x00, 0x00, 0xAD,
+0x55, 0x83, 0xFF, 0xFF, 0x04, 0xF7, 0x9E, 0x63, 0x0C, 0x52, 0x8A, 0xA5, 0x34, 0x4A, 0x49, 0x82,
+0x00, 0x00, 0x03, 0x94, 0xB2, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x55, 0x83, 0xFF, 0xFF, 0x04, 0xF7,
+0x9E, 0x63, 0x0C, 0x52, 0x8A, 0xA5, 0x34, 0x4A, 0x49, 0x84, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+0xBD, 0xD7, 0x85, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xC6, 0x38, 0x39, 0xC7, 0x85, 0x00, 0x00, 0x00,
+0xBD, 0xD7, 0x85, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xC6, 0x38, 0x39, 0xC7, 0x85, 0x00, 0x00, 0x00,
+0xBD, 0xD7, 0x85, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xC6, 0x38, 0x39, 0xC7, 0x85, 0x00, 0x00, 0xBE,
+0x00, 0x00, 0xBE, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x08, 0x00, 0xB2, 0x00, 0x00, 0x00, 0x08,
+0x00, 0x83, 0x00, 0x00, 0x83, 0x00, 0x00, 0x03, 0xC1, 0xE1, 0xCA, 0x02, 0x91, 0x81, 0x20, 0x60,
+0xAC, 0x00, 0x00, 0x03, 0x20, 0x60, 0x91, 0x81, 0xCA, 0x01, 0xC2, 0x02, 0x83, 0x00, 0x00, 0x82,
+0x00, 0x00, 0x00, 0x08, 0x20, 0x81, 0xC9, 0xE1, 0x02, 0xD2, 0x01, 0xC2, 0x02, 0x61, 0x01, 0xA8,
+0x00, 0x00, 0x02, 0x69, 0x21, 0xC1, 0xE1, 0xCA, 0x01, 0x80, 0xC9, 0xE1, 0x00, 0xD2, 0x01, 0x83,
+0x00, 0x00, 0x82, 0x00, 0x00, 0x04, 0x58, 0xE1, 0xC9, 0xE1, 0xEA, 0xA3, 0xF2, 0xA3, 0xDA, 0x42,
+0x80, 0xC9, 0xE1, 0x02, 0xD2, 0x01, 0x81, 0x61, 0x08, 0x20, 0xA2, 0x00, 0x00, 0x09, 0x08, 0x00,
+0x81, 0x61, 0xCA, 0x01, 0xC9, 0xE1, 0xCA, 0x01, 0xE2, 0x42, 0xF2, 0xA3, 0xEA, 0x62, 0xC9, 0xE1,
+0x38, 0xA0, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x02, 0x91, 0x81, 0xC9, 0xE1, 0xFA, 0xC3, 0x80,
+0xFA, 0xE4, 0x05, 0xFA, 0xE3, 0xE2, 0x62, 0xD2, 0x01, 0xC9, 0xE1, 0xD2, 0x01, 0x79, 0x41, 0xA0,
+0x00, 0x00, 0x04, 0x81, 0x61, 0xD2, 0x01, 0xC9, 0xE1, 0xD2, 0x01, 0xEA, 0x82, 0x81, 0xFA, 0xE4,
+0x02, 0xF2, 0xA3, 0xC9, 0xE1, 0x81, 0x61, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x0C, 0xB1, 0xC1,
+0xD2, 0x01, 0xFA, 0xE4, 0xDA, 0x43, 0xD2, 0x22, 0xFA, 0xC4, 0xFA, 0xE4, 0xFA, 0xE3, 0xEA, 0x82,
+0xD2, 0x01, 0xC9, 0xE1, 0xCA, 0x02, 0x50, 0xE1, 0x9C, 0x00, 0x00, 0x04, 0x58, 0xE1, 0xCA, 0x01,
+0xC9, 0xE1, 0xD2, 0x21, 0xEA, 0x83, 0x80, 0xFA, 0xE4, 0x05, 0xFA, 0xC3, 0xD2, 0x22, 0xDA, 0x43,
+0xFA, 0xE4, 0xC9, 0xE1, 0xA9, 0xC1, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x07, 0xC1, 0xE1, 0xDA,
+0x21, 0xFA, 0xE4, 0xA9, 0x81, 0x88, 0xE0, 0x89, 0x00, 0xB9, 0xC2, 0xEA, 0xA3, 0x80, 0xFA, 0xE4,
+0x00, 0xE2, 0x62, 0x80, 0xCA, 0x01, 0x01, 0xB1, 0xE2, 0x08, 0x00, 0x98, 0x00, 0x00, 0x04, 0x08,
+0x20, 0xB1, 0xC1, 0xC9, 0xE1, 0xD2, 0x01, 0xEA, 0x83, 0x80, 0xFA, 0xE4, 0x07, 0xEA, 0xA3, 0xB9,
+0xC2, 0x89, 0x00, 0x88, 0xE0, 0xA9, 0x81, 0xFA, 0xE4, 0xD2, 0x01, 0xC1, 0xE1, 0x82, 0x00, 0x00,
+0x82, 0x00, 0x00, 0x03, 0xCA, 0x01, 0xDA, 0x42, 0xFA, 0xE4, 0x99, 0x41, 0x82, 0x88, 0xE0, 0x07,
+0xB1, 0xA1, 0xF2, 0xA3, 0xFA, 0xE4, 0xFA, 0xC3, 0xDA, 0x42, 0xC9, 0xE1, 0xCA, 0x02, 0x28, 0x60,
+0x96, 0x00, 0x00, 0x07, 0x30, 0x80, 0xCA, 0x01, 0xC9, 0xE1, 0xE2, 0x42, 0xFA, 0xE3, 0xFA, 0xE4,
+0xF2, 0xA3, 0xB1, 0xA1, 0x82, 0x88, 0xE0, 0x03, 0x99, 0x41, 0xFA, 0xE4, 0xD2, 0x21, 0xCA, 0x01,
+0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x02, 0xC9, 0xE1, 0xE2, 0x62, 0xFA, 0xE4, 0x84, 0x88, 0xE0,
+0x01, 0x89, 0x00, 0xD2, 0x22, 0x80, 0xFA, 0xE4, 0x03, 0xEA, 0x82, 0xC9, 0xE1, 0xD2, 0x21, 0x48,
+0xC1, 0x94, 0x00, 0x00, 0x00, 0x50, 0xE1, 0x80, 0xD2, 0x01, 0x00, 0xF2, 0xA3, 0x80, 0xFA, 0xE4,
+0x01, 0xCA, 0x22, 0x89, 0x00, 0x83, 0x88, 0xE0, 0x03, 0x89, 0x00, 0xFA, 0xE4, 0xDA, 0x42, 0xD2,
+0x01, 0x82, 0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x18, 0x40, 0xC9, 0xE1, 0xEA, 0x82, 0xF2, 0xC3,
+0x86, 0x88, 0xE0, 0x00, 0xB1, 0xA2, 0x80, 0xFA, 0xE4, 0x03, 0xF2, 0xA3, 0xCA, 0x01, 0xD2, 0x01,
+0x38, 0xA0, 0x84, 0x00, 0x00, 0x06, 0x08, 0x20, 0x10, 0x20, 0x20, 0x60, 0x28, 0x80, 0x20, 0x60,
+0x10, 0x40, 0x08, 0x00, 0x85, 0x00, 0x00, 0x03, 0x48, 0xC0, 0xCA, 0x01, 0xD2, 0x01, 0xF2, 0xC3,
+0x80, 0xFA, 0xE4, 0x00, 0xB1, 0xA2, 0x86, 0x88, 0xE0, 0x02, 0xF2, 0xC3, 0xE2, 0x62, 0xD2, 0x01,
+0x82, 0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x30, 0x80, 0xC9, 0xE1, 0xEA, 0x83, 0xF2, 0xA3, 0x87,
+0x88, 0xE0, 0x00, 0xB9, 0xC2, 0x80, 0xFA, 0xE4, 0x07, 0xF2, 0xA3, 0xC9, 0xE1, 0xD2, 0x01, 0x10,
+0x40, 0x50, 0xE1, 0x99, 0xA1, 0xB9, 0xE1, 0xCA, 0x01, 0x80, 0xD2, 0x01, 0x83, 0xC9, 0xE1, 0x00,
+0xCA, 0x01, 0x80, 0xD2, 0x01, 0x07, 0xC1, 0xE1, 0xA1, 0xC1, 0x79, 0x41, 0x20, 0x60, 0x10, 0x40,
+0xCA, 0x01, 0xD2, 0x01, 0xFA, 0xC3, 0x80, 0xFA, 0xE4, 0x00, 0xB9, 0xC2, 0x87, 0x88, 0xE0, 0x03,
+0xF2, 0xA3, 0xE2, 0x62, 0xC9, 0xE1, 0x10, 0x20, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x30,
+0x80, 0xC9, 0xE1, 0xEA, 0xA3, 0xF2, 0xA3, 0x88, 0x88, 0xE0, 0x00, 0xE2, 0x63, 0x80, 0xFA, 0xE4,
+0x02, 0xEA, 0x83, 0xC9, 0xE1, 0xD2, 0x01, 0x81, 0xC9, 0xE1, 0x02, 0xD2, 0x21, 0xDA, 0x42, 0xE2,
+0x42, 0x84, 0xE2, 0x62, 0x02, 0xDA, 0x42, 0xDA, 0x22, 0xD2, 0x01, 0x81, 0xC9, 0xE1, 0x02, 0xD2,
+0x01, 0xC9, 0xE1, 0xF2, 0xA3, 0x80, 0xFA, 0xE4, 0x00, 0xE2, 0x63, 0x88, 0x88, 0xE0, 0x03, 0xF2,
+0xA3, 0xE2, 0x62, 0xC9, 0xE1, 0x10, 0x20, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x28, 0x60,
+0xC9, 0xE1, 0xEA, 0xA3, 0xFA, 0xC3, 0x88, 0x88, 0xE0, 0x00, 0xB9, 0xC2, 0x81, 0xFA, 0xE4, 0x03,
+0xEA, 0x82, 0xDA, 0x42, 0xEA, 0x82, 0xF2, 0xC3, 0x8B, 0xFA, 0xE4, 0x04, 0xFA, 0xC3, 0xF2, 0xA3,
+0xE2, 0x62, 0xDA, 0x22, 0xEA, 0xA3, 0x81, 0xFA, 0xE4, 0x00, 0xB1, 0xA1, 0x88, 0x88, 0xE0, 0x03,
+0xFA, 0xC3, 0xE2, 0x62, 0xC9, 0xE1, 0x10, 0x20, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x04, 0x20,
+0x40, 0xC9, 0xE1, 0xEA, 0x83, 0xFA, 0xE4, 0x91, 0x01, 0x86, 0x88, 0xE0, 0x01, 0xB9, 0xC2, 0xFA,
+0xC3, 0x9A, 0xFA, 0xE4, 0x01, 0xEA, 0xA3, 0xB1, 0x81, 0x86, 0x88, 0xE0, 0x04, 0x91, 0x20, 0xFA,
+0xE4, 0xE2, 0x62, 0xC9, 0xE1, 0x08, 0x00, 0x81, 0x00, 0x00, 0x82, 0x00, 0x00, 0x03, 0xC9, 0xE1,
+0xEA, 0x62, 0xFA, 0xE4, 0xA9, 0x81, 0x84, 0x88, 0xE0, 0x01, 0x99, 0x41, 0xEA, 0xA3, 0x9E, 0xFA,
+0xE4, 0x01, 0xD2, 0x42, 0x89, 0x00, 0x84, 0x88, 0xE0, 0x03, 0xB1, 0x81, 0xFA, 0xE4, 0xDA, 0x42,
+0xD2, 0x01, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x03, 0xC9, 0xE1, 0xE2, 0x42, 0xFA, 0xE4, 0xDA,
+0x43, 0x83, 0x88, 0xE0, 0x01, 0xB1, 0x81, 0xFA, 0xC3, 0xA0, 0xFA, 0xE4, 0x01, 0xEA, 0xA3, 0x99,
+0x41, 0x83, 0x88, 0xE0, 0x03, 0xDA, 0x43, 0xFA, 0xE4, 0xD2, 0x21, 0xCA, 0x01, 0x82, 0x00, 0x00,
+0x82, 0x00, 0x00, 0x01, 0xC1, 0xE1, 0xD2, 0x21, 0x80, 0xFA, 0xE4, 0x00, 0xA9, 0x81, 0x81, 0x88,
+0xE0, 0x00, 0xB1, 0xA1, 0xA3, 0xFA, 0xE4, 0x01, 0xF2, 0xC3, 0xA1, 0x41, 0x81, 0x88, 0xE0, 0x00,
+0xA9, 0x61, 0x80, 0xFA, 0xE4, 0x01, 0xCA, 0x01, 0xB9, 0xE1, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00,
+0x07, 0x99, 0x81, 0xC9, 0xE1, 0xFA, 0xE3, 0xFA, 0xE4, 0xF2, 0xC3, 0x99, 0x21, 0x88, 0xE0, 0xB1,
+0x81, 0xA5, 0xFA, 0xE4, 0x08, 0xF2, 0xC3, 0x99, 0x41, 0x88, 0xE0, 0x99, 0x21, 0xF2, 0xC3, 0xFA,
+0xE4, 0xF2, 0xA3, 0xC9, 0xE1, 0x89, 0x61, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x02, 0x40, 0xA0,
+0xC9, 0xE1, 0xEA, 0x83, 0x80, 0xFA, 0xE4, 0x02, 0xF2, 0xA3, 0xB1, 0xA1, 0xFA, 0xC3, 0xA6, 0xFA,
+0xE3, 0x02, 0xEA, 0xA3, 0xA9, 0x61, 0xF2, 0xA3, 0x80, 0xFA, 0xE4, 0x02, 0xE2, 0x62, 0xC9, 0xE1,
+0x28, 0x60, 0x82, 0x00, 0x00, 0x83, 0x00, 0x00, 0x01, 0xC9, 0xE1, 0xD2, 0x21, 0x82, 0xFA, 0xE4,
+0xA9, 0xFA, 0xE3, 0x81, 0xFA, 0xE4, 0x01, 0xD2, 0x01, 0xC2, 0x01, 0x83, 0x00, 0x00, 0x83, 0x00,
+0x00, 0x02, 0x61, 0x01, 0xC9, 0xE1, 0xEA, 0x62, 0x80, 0xFA, 0xE4, 0xAA, 0xF2, 0xC3, 0x80, 0xFA,
+0xE4, 0x02, 0xDA, 0x42, 0xC9, 0xE1, 0x48, 0xC1, 0x83, 0x00, 0x00, 0x84, 0x00, 0x00, 0x02, 0xB1,
+0xC1, 0xC9, 0xE1, 0xEA, 0x83, 0xAB, 0xF2, 0xC3, 0x03, 0xF2, 0xC4, 0xE2, 0x62, 0xC9, 0xE1, 0xA1,
+0xA1, 0x84, 0x00, 0x00, 0x84, 0x00, 0x00, 0x03, 0x08, 0x00, 0xB9, 0xE1, 0xC9, 0xE1, 0xEA, 0xA3,
+0xAA, 0xF2, 0xC3, 0x02, 0xE2, 0x83, 0xC9, 0xE1, 0xB9, 0xE1, 0x85, 0x00, 0x00, 0x85, 0x00, 0x00,
+0x02, 0x89, 0x61, 0xC9, 0xE1, 0xE2, 0x83, 0xAA, 0xF2, 0xC3, 0x02, 0xE2, 0x62, 0xC9, 0xE1, 0x58,
+0xE1, 0x85, 0x00, 0x00, 0x84, 0x00, 0x00, 0x02, 0x28, 0x60, 0xC9, 0xE1, 0xD2, 0x21, 0xAB, 0xEA,
+0xC3, 0x03, 0xEA, 0xA3, 0xD2, 0x01, 0xCA, 0x01, 0x10, 0x20, 0x84, 0x00, 0x00, 0x84, 0x00, 0x00,
+0x02, 0xC1, 0xE1, 0xC9, 0xE1, 0xEA, 0x83, 0xAC, 0xEA, 0xA3, 0x02, 0xE2, 0x83, 0xC9, 0xE1, 0xB1,
+0xC1, 0x84, 0x00, 0x00, 0x83, 0x00, 0x00, 0x02, 0x89, 0x81, 0xC9, 0xE1, 0xDA, 0x62, 0xAE, 0xEA,
+0xA3, 0x02, 0xDA, 0x42, 0xC9, 0xE1, 0x71, 0x21, 0x83, 0x00, 0x00, 0x82, 0x00, 0x00, 0x02, 0x40,
+0xA0, 0xC9, 0xE1, 0xD2, 0x22, 0xB0, 0xEA, 0xA3, 0x02, 0xD2, 0x01, 0xCA, 0x01, 0x28, 0x60, 0x82,
+0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x10, 0x20, 0x80, 0xCA, 0x01, 0x00, 0xE2, 0x83, 0x84, 0xEA,
+0xA3, 0x04, 0xE2, 0xA3, 0xE2, 0x83, 0xDA, 0x42, 0xD2, 0x21, 0xD2, 0x01, 0x80, 0xC9, 0xE1, 0x03,
+0xCA, 0x01, 0xD2, 0x01, 0xDA, 0x42, 0xE2, 0x83, 0x8E, 0xEA, 0xA3, 0x02, 0xDA, 0x62, 0xD2, 0x22,
+0xD2, 0x01, 0x80, 0xC9, 0xE1, 0x04, 0xCA, 0x01, 0xD2, 0x01, 0xD2, 0x42, 0xDA, 0x62, 0xE2, 0x83,
+0x85, 0xEA, 0xA3, 0x02, 0xE2, 0x83, 0xC9, 0xE1, 0xC2, 0x01, 0x82, 0x00, 0x00, 0x81, 0x00, 0x00,
+0x02, 0xB1, 0xC1, 0xC9, 0xE1, 0xDA, 0x62, 0x83, 0xE2, 0xA3, 0x02, 0xE2, 0x63, 0xD2, 0x22, 0xCA,
+0x01, 0x80, 0xC9, 0xE1, 0x05, 0xD2, 0x63, 0xDB, 0x26, 0xDB, 0xA8, 0xDB, 0xA9, 0xDB, 0x47, 0xD2,
+0x63, 0x80, 0xC9, 0xE1, 0x00, 0xDA, 0x42, 0x8B, 0xE2, 0xA3, 0x09, 0xE2, 0x83, 0xD2, 0x01, 0xC9,
+0xE1, 0xCA, 0x01, 0xDB, 0x06, 0xDB, 0xA8, 0xDB, 0xA9, 0xDB, 0x47, 0xD2, 0xA4, 0xCA, 0x01, 0x80,
+0xC9, 0xE1, 0x01, 0xD2, 0x21, 0xDA, 0x62, 0x84, 0xE2, 0xA3, 0x02, 0xDA, 0x42, 0xC9, 0xE1, 0xA1,
+0xA1, 0x81, 0x00, 0x00, 0x80, 0x00, 0x00, 0x0D, 0x81, 0x61, 0xC9, 0xE1, 0xCA, 0x01, 0xDA, 0x42,
+0xDA, 0x62, 0xE2, 0x83, 0xE2, 0xA3, 0xDA, 0x62, 0xD2, 0x01, 0xC9, 0xE1, 0xCA, 0x01, 0xDB, 0x47,
+0xED, 0x50, 0xFF, 0x7A, 0x84, 0xFF, 0xDC, 0x04, 0xF6, 0xD7, 0xDB, 0x26, 0xC9, 0xE1, 0xD2, 0x01,
+0xE2, 0x83, 0x88, 0xE2, 0xA3, 0x00, 0xE2, 0x83, 0x80, 0xCA, 0x01, 0x01, 0xEC, 0xCE, 0xFF, 0xBB,
+0x83, 0xFF, 0xDC, 0x03, 0xFF, 0xBB, 0xF6, 0x34, 0xE3, 0xEA, 0xD2, 0x42, 0x80, 0xC9, 0xE1, 0x05,
+0xD2, 0x22, 0xE2, 0x83, 0xE2, 0xA3, 0xE2, 0x83, 0xDA, 0x62, 0xDA, 0x42, 0x80, 0xC9, 0xE1, 0x00,
+0x69, 0x21, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x08, 0x00, 0xB9, 0xC1, 0x82, 0xC9, 0xE1, 0x80,
+0xCA, 0x01, 0x03, 0xC9, 0xE1, 0xD2, 0x43, 0xE4, 0x8D, 0xFF, 0x7A, 0x89, 0xFF, 0xDC, 0x02, 0xE4,
+0xAD, 0xC9, 0xE1, 0xD2, 0x22, 0x88, 0xE2, 0x83, 0x02, 0xCA, 0x01, 0xCA, 0x22, 0xF6, 0xB6, 0x89,
+0xFF, 0xDC, 0x04, 0xF5, 0xF3, 0xDB, 0x26, 0xCA, 0x01, 0xC9, 0xE1, 0xD2, 0x21, 0x82, 0xC9, 0xE1,
+0x01, 0xC1, 0xE1, 0xA1, 0xA1, 0x80, 0x00, 0x00, 0x83, 0x00, 0x00, 0x05, 0x20, 0x60, 0xCA, 0x42,
+0xC9, 0xE1, 0xD2, 0x42, 0xED, 0x50, 0xFF, 0xBC, 0x8C, 0xFF, 0xDC, 0x02, 0xE4, 0x0B, 0xC9, 0xE1,
+0xDA, 0x42, 0x86, 0xE2, 0x83, 0x02, 0xD2, 0x22, 0xC9, 0xE1, 0xF6, 0x14, 0x8C, 0xFF, 0xDC, 0x05,
+0xFF, 0x39, 0xDB, 0xA9, 0xCA, 0x01, 0xC9, 0xE1, 0xBA, 0x64, 0x08, 0x20, 0x83, 0x00, 0x00, 0x82,
+0x00, 0x00, 0x04, 0x18, 0x60, 0xCA, 0x43, 0xCA, 0x01, 0xDC, 0xAD, 0xFF, 0xBC, 0x83, 0xFF, 0xDC,
+0x06, 0xE6, 0xF9, 0x94, 0x70, 0x73, 0x8C, 0x63, 0x0B, 0x84, 0x0E, 0xC5, 0xF5, 0xFF, 0xBC, 0x82,
+0xFF, 0xDC, 0x02, 0xFF, 0xBC, 0xD2, 0x84, 0xC9, 0xE1, 0x85, 0xDA, 0x83, 0x02, 0xDA, 0x63, 0xC9,
+0xE1, 0xE3, 0xEA, 0x83, 0xFF, 0xDC, 0x06, 0xFF, 0xBC, 0xC6, 0x15, 0x84, 0x0E, 0x63, 0x2B, 0x73,
+0x8C, 0x8C, 0x4F, 0xDE, 0xB8, 0x83, 0xFF, 0xDC, 0x03, 0xFF, 0x39, 0xD3, 0x47, 0xC9, 0xE1, 0xBA,
+0x43, 0x83, 0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x28, 0x80, 0xCA, 0x22, 0xD3, 0x27, 0xE6, 0xB7,
+0x84, 0xFF, 0xDC, 0x01, 0xA5, 0x12, 0x00, 0x20, 0x83, 0x00, 0x00, 0x01, 0x29, 0x44, 0xB5, 0x94,
+0x82, 0xFF, 0xDC, 0x02, 0xF6, 0x75, 0xC9, 0xE1, 0xD2, 0x22, 0x84, 0xDA, 0x83, 0x02, 0xD2, 0x01,
+0xD2, 0x22, 0xFF, 0x9B, 0x82, 0xFF, 0xDC, 0x01, 0xBD, 0xB4, 0x29, 0x44, 0x84, 0x00, 0x00, 0x00,
+0x9C, 0xD1, 0x84, 0xFF, 0xDC, 0x03, 0xDD, 0xD3, 0xCA, 0x84, 0xC2, 0x22, 0x10, 0x40, 0x81, 0x00,
+0x00, 0x80, 0x00, 0x00, 0x03, 0x30, 0xA0, 0xC2, 0x63, 0xD5, 0x30, 0xEF, 0x18, 0x85, 0xFF, 0xDC,
+0x00, 0x52, 0x89, 0x86, 0x00, 0x00, 0x00, 0x8C, 0x2F, 0x82, 0xFF, 0xDC, 0x01, 0xDB, 0x06, 0xC9,
+0xE1, 0x83, 0xDA, 0x83, 0x02, 0xDA, 0x63, 0xC9, 0xE1, 0xE4, 0x4C, 0x82, 0xFF, 0xDC, 0x00, 0x8C,
+0x4F, 0x86, 0x00, 0x00, 0x00, 0x52, 0x68, 0x84, 0xFF, 0xDC, 0x04, 0xFF, 0xBB, 0xDE, 0x97, 0xCC,
+0xAE, 0xBA, 0x22, 0x20, 0x60, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x08, 0x20, 0xA3, 0x69, 0xCE,
+0x35, 0xEE, 0xF8, 0x86, 0xFF, 0xDC, 0x04, 0xD6, 0x57, 0x5A, 0xC9, 0x5A, 0xCA, 0x52, 0x89, 0x29,
+0x65, 0x83, 0x00, 0x00, 0x00, 0x94, 0x90, 0x81, 0xFF, 0xDC, 0x02, 0xF6, 0x55, 0xC9, 0xE1, 0xD2,
+0x42, 0x82, 0xDA, 0x83, 0x02, 0xD2, 0x22, 0xCA, 0x01, 0xFF, 0x7A, 0x81, 0xFF, 0xDC, 0x00, 0x9C,
+0xD1, 0x83, 0x00, 0x00, 0x01, 0x29, 0x24, 0x4A, 0x68, 0x80, 0x52, 0x89, 0x00, 0xD6, 0x77, 0x85,
+0xFF, 0xDC, 0x05, 0xFF, 0xBC, 0xDE, 0xB7, 0xCE, 0x14, 0x9A, 0xE7, 0x00, 0x20, 0x00, 0x00, 0x04,
+0x00, 0x00, 0x08, 0x41, 0xBD, 0x93, 0xD6, 0x56, 0xFF, 0xBC, 0x8B, 0xFF, 0xDC, 0x02, 0xE6, 0xF8,
+0x73, 0xAD, 0x08, 0x40, 0x80, 0x00, 0x00, 0x01, 0x08, 0x61, 0xEF, 0x5A, 0x81, 0xFF, 0xDC, 0x01,
+0xD2, 0x63, 0xCA, 0x01, 0x81, 0xDA, 0x83, 0x02, 0xDA, 0x63, 0xC9, 0xE1, 0xDB, 0x26, 0x81, 0xFF,
+0xDC, 0x01, 0xF7, 0x5A, 0x10, 0x82, 0x80, 0x00, 0x00, 0x02, 0x08, 0x40, 0x73, 0x8C, 0xDE, 0xD8,
+0x8B, 0xFF, 0xDC, 0x04, 0xFF, 0xBC, 0xD6, 0x56, 0xC5, 0xD4, 0x08, 0x61, 0x00, 0x00, 0x80, 0x00,
+0x00, 0x02, 0x39, 0xC6, 0xCE, 0x35, 0xE6, 0xF8, 0x8D, 0xFF, 0xDC, 0x01, 0xD6, 0x97, 0x29, 0x24,
+0x80, 0x00, 0x00, 0x00, 0xCE, 0x36, 0x81, 0xFF, 0xDC, 0x02, 0xE4, 0x6C, 0xC9, 0xE1, 0xD2, 0x42,
+0x80, 0xD2, 0x63, 0x02, 0xD2, 0x42, 0xC9, 0xE1, 0xED, 0xD2, 0x81, 0xFF, 0xDC, 0x00, 0xCE, 0x36,
+0x80, 0x00, 0x00, 0x01, 0x21, 0x24, 0xD6, 0x97, 0x8D, 0xFF, 0xDC, 0x02, 0xEF, 0x19, 0xCE, 0x35,
+0x4A, 0x48, 0x80, 0x00, 0x00, 0x81, 0x00, 0x00, 0x02, 0x7B, 0xAC, 0xCE, 0x35, 0xF7, 0x5A, 0x8D,
+0xFF, 0xDC, 0x03, 0xE7, 0x19, 0x5A, 0xA9, 0x73, 0x8C, 0xFF, 0xBB, 0x81, 0xFF, 0xDC, 0x02, 0xFF,
+0x5A, 0xC9, 0xE1, 0xD2, 0x22, 0x80, 0xD2, 0x63, 0x01, 0xCA, 0x01, 0xCA, 0x22, 0x82, 0xFF, 0xDC,
+0x03, 0xFF, 0xBB, 0x6B, 0x4B, 0x52, 0x89, 0xE7, 0x19, 0x8D, 0xFF, 0xDC, 0x02, 0xF7, 0x9B, 0xCE,
+0x35, 0x94, 0x6F, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x08, 0x40, 0xAD, 0x31, 0xD6, 0x35,
+0xFF, 0x9B, 0x94, 0xFF, 0xDC, 0x01, 0xD2, 0xA4, 0xCA, 0x01, 0x80, 0xD2, 0x63, 0x01, 0xC9, 0xE1,
+0xDB, 0x47, 0x94, 0xFF, 0xDC, 0x03, 0xFF, 0xBB, 0xD6, 0x56, 0xBD, 0xB3, 0x10, 0xA2, 0x81, 0x00,
+0x00, 0x82, 0x00, 0x00, 0x03, 0x18, 0xC2, 0xC5, 0xD4, 0xD6, 0x76, 0xFF, 0xBB, 0x93, 0xFF, 0xBC,
+0x05, 0xE4, 0x4B, 0xC9, 0xE1, 0xD2, 0x43, 0xD2, 0x42, 0xC9, 0xE1, 0xED, 0x50, 0x94, 0xFF, 0xBC,
+0x02, 0xDE, 0xB7, 0xCE, 0x35, 0x31, 0x85, 0x82, 0x00, 0x00, 0x83, 0x00, 0x00, 0x03, 0x31, 0x65,
+0xCE, 0x15, 0xDE, 0xB7, 0xFF, 0xBB, 0x92, 0xFF, 0xBC, 0x01, 0xF6, 0xD7, 0xC9, 0xE1, 0x80, 0xCA,
+0x22, 0x01, 0xC9, 0xE1, 0xFF, 0x7A, 0x93, 0xFF, 0xBC, 0x02, 0xE6, 0xF8, 0xCE, 0x35, 0x52, 0x88,
+0x83, 0x00, 0x00, 0x84, 0x00, 0x00, 0x02, 0x5A, 0xA9, 0xCE, 0x35, 0xE6, 0xF8, 0x93, 0xFF, 0xBB,
+0x00, 0xCA, 0x22, 0x80, 0xCA, 0x01, 0x00, 0xD2, 0x83, 0x93, 0xFF, 0xBB, 0x02, 0xEF, 0x39, 0xCE,
+0x35, 0x83, 0xED, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0x02, 0x7B, 0xAC, 0xCE, 0x35, 0xEF, 0x19,
+0x92, 0xFF, 0xBB, 0x00, 0xD3, 0x06, 0x80, 0xC9, 0xE1, 0x00, 0xDB, 0x88, 0x92, 0xFF, 0xBB, 0x03,
+0xF7, 0x5A, 0xCE, 0x35, 0xA4, 0xF0, 0x00, 0x20, 0x84, 0x00, 0x00, 0x86, 0x00, 0x00, 0x02, 0x83,
+0xED, 0xCE, 0x35, 0xEF, 0x39, 0x8E, 0xFF, 0xBB, 0x01, 0xE7, 0x19, 0x63, 0x2C, 0x84, 0x4A, 0x69,
+0x01, 0x63, 0x2C, 0xE7, 0x19, 0x8E, 0xFF, 0xBB, 0x03, 0xF7, 0x7A, 0xD6, 0x35, 0xB5, 0x72, 0x10,
+0x81, 0x85, 0x00, 0x00, 0x87, 0x00, 0x00, 0x02, 0x8C, 0x4E, 0xCE, 0x35, 0xEF, 0x19, 0x8D, 0xFF,
+0x9B, 0x00, 0xB5, 0x94, 0x86, 0x42, 0x08, 0x00, 0xB5, 0x94, 0x8D, 0xFF, 0x9B, 0x03, 0xF7, 0x5A,
+0xD6, 0x35, 0xBD, 0xB3, 0x18, 0xC2, 0x86, 0x00, 0x00, 0x87, 0x00, 0x00, 0x03, 0x00, 0x20, 0x9C,
+0xB0, 0xCE, 0x35, 0xEF, 0x19, 0x8C, 0xF7, 0x7B, 0x01, 0xEF, 0x19, 0x39, 0xC6, 0x84, 0x29, 0x65,
+0x01, 0x31, 0xA6, 0xE6, 0xF9, 0x8C, 0xF7, 0x7B, 0x03, 0xF7, 0x5A, 0xD6, 0x35, 0xC5, 0xD3, 0x21,
+0x03, 0x87, 0x00, 0x00, 0x88, 0x00, 0x00, 0x03, 0x08, 0x41, 0xA4, 0xF1, 0xCE, 0x35, 0xEF, 0x19,
+0x8C, 0xF7, 0x7A, 0x00, 0x94, 0x90, 0x84, 0x18, 0xE3, 0x00, 0x94, 0x90, 0x8C, 0xF7, 0x7A, 0x03,
+0xEF, 0x5A, 0xD6, 0x55, 0xC5, 0xF4, 0x29, 0x24, 0x88, 0x00, 0x00, 0x89, 0x00, 0x00, 0x03, 0x08,
+0x61, 0xAD, 0x31, 0xCE, 0x35, 0xE6, 0xF8, 0x8C, 0xF7, 0x5A, 0x01, 0x84, 0x0E, 0x10, 0x82, 0x80,
+0x08, 0x41, 0x01, 0x10, 0xA2, 0x84, 0x0E, 0x8C, 0xF7, 0x5A, 0x03, 0xEF, 0x39, 0xD6, 0x55, 0xC5,
+0xF4, 0x29, 0x44, 0x89, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x03, 0x08, 0x61, 0xA4, 0xF0, 0xCE, 0x35,
+0xDE, 0xB7, 0x8C, 0xEF, 0x3A, 0x03, 0xCE, 0x56, 0x31, 0x86, 0x49, 0xE7, 0xE6, 0xD8, 0x8C, 0xEF,
+0x3A, 0x03, 0xE6, 0xF9, 0xD6, 0x35, 0xC5, 0xF4, 0x31, 0x64, 0x8A, 0x00, 0x00, 0x8B, 0x00, 0x00,
+0x04, 0x08, 0x41, 0x8C, 0x2E, 0xCE, 0x35, 0xD6, 0x76, 0xE7, 0x19, 0x8A, 0xEF, 0x19, 0x03, 0xA4,
+0xF2, 0x42, 0x08, 0x4A, 0x48, 0xE6, 0xF9, 0x8B, 0xEF, 0x19, 0x03, 0xE6, 0xD8, 0xCE, 0x35, 0xBD,
+0xB3, 0x21, 0x03, 0x8B, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x03, 0x62, 0xE9, 0xCE, 0x14, 0xCE, 0x35,
+0xDE, 0xB8, 0x88, 0xE6, 0xF9, 0x04, 0xC6, 0x16, 0x4A, 0x49, 0x62, 0xEA, 0x42, 0x08, 0x83, 0xEE,
+0x89, 0xE6, 0xF9, 0x04, 0xE6, 0xF8, 0xD6, 0x76, 0xCE, 0x35, 0xA4, 0xD0, 0x10, 0x82, 0x8C, 0x00,
+0x00, 0x8E, 0x00, 0x00, 0x04, 0x21, 0x03, 0xA4, 0xF0, 0xCE, 0x35, 0xD6, 0x76, 0xDE, 0xB8, 0x83,
+0xE6, 0xD8, 0x0A, 0xDE, 0x97, 0xBD, 0xB5, 0x8C, 0x50, 0x42, 0x28, 0x52, 0x8A, 0xCE, 0x57, 0x94,
+0x70, 0x42, 0x08, 0x63, 0x0B, 0xAD, 0x33, 0xCE, 0x16, 0x85, 0xE6, 0xD8, 0x04, 0xDE, 0xB7, 0xCE,
+0x35, 0xCE, 0x14, 0x63, 0x0A, 0x00, 0x20, 0x8D, 0x00, 0x00, 0x90, 0x00, 0x00, 0x04, 0x5A, 0xA9,
+0xC5, 0xD4, 0xCE, 0x35, 0xD6, 0x56, 0xDE, 0xB7, 0x81, 0xDE, 0xB8, 0x00, 0x63, 0x2B, 0x80, 0x42,
+0x08, 0x01, 0x73, 0x8D, 0xCE, 0x56, 0x80, 0xDE, 0xB8, 0x01, 0xA5, 0x12, 0x52, 0x89, 0x80, 0x42,
+0x08, 0x00, 0xB5, 0x94, 0x82, 0xDE, 0xB8, 0x00, 0xDE, 0x97, 0x80, 0xCE, 0x35, 0x01, 0xA4, 0xD0,
+0x21, 0x03, 0x8F, 0x00, 0x00, 0x91, 0x00, 0x00, 0x02, 0x08, 0x61, 0x63, 0x0A, 0xC5, 0xD4, 0x80,
+0xCE, 0x35, 0x04, 0xD6, 0x77, 0xD6, 0x97, 0xBD, 0xD5, 0xAD, 0x53, 0xCE, 0x36, 0x83, 0xDE, 0x97,
+0x06, 0xD6, 0x97, 0xBD, 0xB4, 0xAD, 0x33, 0xD6, 0x97, 0xDE, 0x97, 0xD6, 0x97, 0xD6, 0x76, 0x80,
+0xCE, 0x35, 0x01, 0xB5, 0x52, 0x4A, 0x47, 0x91, 0x00, 0x00, 0x93, 0x00, 0x00, 0x02, 0x08, 0x61,
+0x5A, 0xC9, 0xB5, 0x52, 0x80, 0xCE, 0x35, 0x01, 0xD6, 0x55, 0xD6, 0x56, 0x87, 0xD6, 0x77, 0x01,
+0xD6, 0x56, 0xD6, 0x55, 0x80, 0xCE, 0x35, 0x01, 0xAD, 0x11, 0x42, 0x27, 0x93, 0x00, 0x00, 0x96,
+0x00, 0x00, 0x02, 0x31, 0x65, 0x7B, 0xAC, 0xBD, 0xB3, 0x81, 0xCE, 0x35, 0x00, 0xCE, 0x55, 0x80,
+0xCE, 0x56, 0x00, 0xCE, 0x36, 0x82, 0xCE, 0x35, 0x02, 0xBD, 0x93, 0x73, 0x6B, 0x21, 0x23, 0x95,
+0x00, 0x00, 0x99, 0x00, 0x00, 0x03, 0x29, 0x44, 0x62, 0xE9, 0x94, 0x4E, 0xBD, 0xB3, 0x80, 0xCE,
+0x35, 0x04, 0xCE, 0x15, 0xAD, 0x32, 0x84, 0x0D, 0x5A, 0xA9, 0x21, 0x03, 0x98, 0x00, 0x00, 0x9D,
+0x00, 0x00, 0x01, 0x08, 0x61, 0x10, 0x82, 0x9D, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00,
+};
+static const uint16_t STATUS_SLEEPING_PACKED_ROWS[128] PROGMEM = {
+0x0000, 0x000D, 0x0028, 0x003F, 0x0093, 0x00F2, 0x0159, 0x01BA, 0x0215, 0x0272, 0x02D3, 0x033D, 0x03A2, 0x03C5, 0x03D2, 0x03DF,
+0x0418, 0x0463, 0x04A8, 0x04E7, 0x052C, 0x0577, 0x05E6, 0x0631, 0x0685, 0x06EE, 0x0751, 0x07A2, 0x07D5, 0x07FC, 0x083B, 0x0886,
+0x0889, 0x088C, 0x08C5, 0x0910, 0x0955, 0x0994, 0x09D9, 0x0A24, 0x0A93, 0x0ADE, 0x0B32, 0x0B9B, 0x0BFE, 0x0C4F, 0x0C82, 0x0CA9,
+0x0CE8, 0x0D33, 0x0D36, 0x0D39, 0x0D72, 0x0DBD, 0x0E02, 0x0E41, 0x0E86, 0x0ED1, 0x0F40, 0x0F8B, 0x0FDF, 0x1048, 0x10AB, 0x10FC,
+0x112F, 0x1132, 0x1135, 0x1144, 0x115F, 0x1182, 0x11B5, 0x11EA, 0x1229, 0x1270, 0x12B3, 0x12F4, 0x1343, 0x139B, 0x13EA, 0x142B,
+0x145A, 0x1485, 0x14B0, 0x14DD, 0x150A, 0x1535, 0x154E, 0x156B, 0x1584, 0x159D, 0x15B4, 0x15CD, 0x15E4, 0x15FB, 0x1612, 0x165D,
+0x16B4, 0x1715, 0x1758, 0x178F, 0x17E4, 0x1831, 0x1878, 0x18CF, 0x191E, 0x1965, 0x19A6, 0x19D1, 0x19FA, 0x1A23, 0x1A46, 0x1A6B,
+0x1A94, 0x1AB9, 0x1AE4, 0x1B0B, 0x1B36, 0x1B5D, 0x1B86, 0x1BB1, 0x1BEA, 0x1C25, 0x1C5A, 0x1C7F, 0x1CA2, 0x1CBF, 0x1CCA, 0x1CCD,
+};
+const PackedImage STATUS_SLEEPING_PACKED = { 64, 128, PackedImage::Rle565, 0, 7376, nullptr, STATUS_SLEEPING_PACKED_ROWS, STATUS_SLEEPING_PACKED_DATA };
+
+// STATUS_WAKING_UP: 64x128 rle565, 8098 bytes of flash
+static const uint8_t STATUS_WAKING_UP_PACKED_DATA[7842] PROGMEM = {
+0xA9, 0x00, 0x00, 0x02, 0x29, 0x60, 0x52, 0xA0, 0x08, 0x60, 0x90, 0x00, 0x00, 0x87, 0x00, 0x00,
+0x00, 0x73, 0x80, 0x80, 0xAD, 0x60, 0x03, 0xAD, 0x40, 0xA5, 0x20, 0x73, 0x80, 0x18, 0xC0, 0x99,
+0x00, 0x00, 0x02, 0xE7, 0x00, 0xFF, 0xE0, 0x73, 0xA0, 0x90, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00,
+0xA5, 0x20, 0x83, 0xFF, 0xE0, 0x01, 0xE7, 0x40, 0x29, 0x20, 0x92, 0x00, 0x00, 0x01, 0xDE, 0xE0,
+0x9C, 0xC0, 0x82, 0x00, 0x00, 0x02, 0x7B, 0xC0, 0xB5, 0x80, 0x31, 0x60, 0x90, 0x00, 0x00, 0x87,
+0x00, 0x00, 0x07, 0xA5, 0x20, 0xFF, 0xE0, 0xA5, 0x20, 0x21, 0x00, 0x4A, 0x60, 0xDF, 0x00, 0xFF,
+0xE0, 0x9C, 0xE0, 0x80, 0x00, 0x00, 0x02, 0x39, 0xC0, 0x39, 0xE0, 0x18, 0xA0, 0x80, 0x00, 0x00,
+0x02, 0x21, 0x00, 0x39, 0xE0, 0x29, 0x40, 0x81, 0x00, 0x00, 0x00, 0x29, 0x20, 0x80, 0x4A, 0x60,
+0x00, 0x29, 0x20, 0x80, 0x00, 0x00, 0x04, 0x52, 0x80, 0xFF, 0xE0, 0xB5, 0xA0, 0x39, 0xE0, 0x39,
+0xC0, 0x80, 0x00, 0x00, 0x02, 0x31, 0x60, 0x39, 0xE0, 0x18, 0xC0, 0x81, 0x00, 0x00, 0x06, 0x10,
+0x80, 0x4A, 0x60, 0x42, 0x20, 0x00, 0x00, 0x21, 0x20, 0x39, 0xE0, 0x10, 0xA0, 0x86, 0x00, 0x00,
+0x87, 0x00, 0x00, 0x02, 0xA5, 0x20, 0xFF, 0xE0, 0x9D, 0x00, 0x80, 0x00, 0x00, 0x02, 0x9C, 0xC0,
+0xFF, 0xE0, 0xAD, 0x60, 0x80, 0x00, 0x00, 0x02, 0xE7, 0x40, 0xFF, 0xE0, 0x5A, 0xA0, 0x80, 0x00,
+0x00, 0x02, 0x94, 0x80, 0xFF, 0xE0, 0xA5, 0x20, 0x80, 0x00, 0x00, 0x00, 0xAD, 0x40, 0x82, 0xFF,
+0xE0, 0x02, 0x94, 0x80, 0x63, 0x20, 0xF7, 0xC0, 0x81, 0xFF, 0xE0, 0x00, 0xEF, 0x80, 0x80, 0x00,
+0x00, 0x02, 0xBD, 0xC0, 0xFF, 0xE0, 0x5A, 0xE0, 0x80, 0x00, 0x00, 0x01, 0x39, 0xE0, 0xEF, 0x60,
+0x80, 0xFF, 0xE0, 0x03, 0xC6, 0x20, 0xB5, 0xA0, 0xFF, 0xE0, 0x52, 0x80, 0x86, 0x00, 0x00, 0x87,
+0x00, 0x00, 0x07, 0xA5, 0x20, 0xFF, 0xE0, 0x9D, 0x00, 0x00, 0x00, 0x18, 0xE0, 0xD6, 0x80, 0xFF,
+0xE0, 0x8C, 0x40, 0x80, 0x00, 0x00, 0x02, 0xE7, 0x40, 0xFF, 0xE0, 0x5A, 0xA0, 0x80, 0x00, 0x00,
+0x10, 0x94, 0x80, 0xFF, 0xE0, 0xA5, 0x20, 0x00, 0x00, 0x42, 0x20, 0xFF, 0xE0, 0xF7, 0xA0, 0x52,
+0xA0, 0x5A, 0xC0, 0xA5, 0x00, 0x42, 0x20, 0x42, 0x00, 0xBD, 0xE0, 0xFF, 0xE0, 0xC6, 0x00, 0x63,
+0x00, 0x62, 0xE0, 0x80, 0x00, 0x00, 0x02, 0xBD, 0xC0, 0xFF, 0xE0, 0x5A, 0xE0, 0x80, 0x00, 0x00,
+0x04, 0xDE, 0xC0, 0xFF, 0xE0, 0xD6, 0xA0, 0x73, 0xA0, 0xC6, 0x00, 0x80, 0xFF, 0xE0, 0x00, 0x52,
+0x80, 0x86, 0x00, 0x00, 0x87, 0x00, 0x00, 0x03, 0xA5, 0x20, 0xFF, 0xE0, 0xFF, 0xC0, 0xF7, 0xA0,
+0x80, 0xFF, 0xE0, 0x01, 0xCE, 0x60, 0x10, 0xA0, 0x80, 0x00, 0x00, 0x02, 0xE7, 0x40, 0xFF, 0xE0,
+0x5A, 0xA0, 0x80, 0x00, 0x00, 0x04, 0x94, 0x80, 0xFF, 0xE0, 0xA5, 0x20, 0x00, 0x00, 0x42, 0x00,
+0x80, 0xFF, 0xE0, 0x01, 0x7B, 0xC0, 0x08, 0x60, 0x81, 0x00, 0x00, 0x02, 0x9C, 0xC0, 0xFF, 0xE0,
+0x9D, 0x00, 0x82, 0x00, 0x00, 0x04, 0xBD, 0xC0, 0xFF, 0xE0, 0x5A, 0xE0, 0x00, 0x00, 0x31, 0x80,
+0x80, 0xFF, 0xE0, 0x00, 0x29, 0x40, 0x80, 0x00, 0x00, 0x02, 0xEF, 0x80, 0xFF, 0xE0, 0x52, 0x80,
+0x86, 0x00, 0x00, 0x87, 0x00, 0x00, 0x06, 0xA5, 0x20, 0xFF, 0xE0, 0xF7, 0xA0, 0xEF, 0x60, 0xFF,
+0xE0, 0xEF, 0x60, 0x08, 0x40, 0x81, 0x00, 0x00, 0x02, 0xE7, 0x40, 0xFF, 0xE0, 0x5A, 0xA0, 0x80,
+0x00, 0x00, 0x02, 0x94, 0xA0, 0xFF, 0xE0, 0xA5, 0x20, 0x80, 0x00, 0x00, 0x00, 0xB5, 0x80, 0x80,
+0xFF, 0xE0, 0x06, 0xF7, 0xA0, 0x84, 0x20, 0x08, 0x40, 0x00, 0x00, 0x9C, 0xC0, 0xFF, 0xE0, 0x9D,
+0x00, 0x82, 0x00, 0x00, 0x06, 0xBD, 0xC0, 0xFF, 0xE0, 0x5A, 0xE0, 0x00, 0x00, 0x4A, 0x60, 0xFF,
+0xE0, 0xF7, 0xC0, 0x81, 0x00, 0x00, 0x02, 0xB5, 0xA0, 0xFF, 0xE0, 0x52, 0x80, 0x86, 0x00, 0x00,
+0x87, 0x00, 0x00, 0x06, 0xA5, 0x20, 0xFF, 0xE0, 0x9D, 0x00, 0x00, 0x00, 0xC6, 0x00, 0xFF, 0xE0,
+0x84, 0x20, 0x81, 0x00, 0x00, 0x02, 0xE7, 0x40, 0xFF, 0xE0, 0x5A, 0xA0, 0x80, 0x00, 0x00, 0x02,
+0x9D, 0x00, 0xFF, 0xE0, 0xA5, 0x20, 0x81, 0x00, 0x00, 0x01, 0x4A, 0x60, 0xC6, 0x00, 0x80, 0xFF,
+0xE0, 0x04, 0x9C, 0xC0, 0x00, 0x00, 0x9C, 0xC0, 0xFF, 0xE0, 0x9D, 0x00, 0x82, 0x00, 0x00, 0x06,
+0xBD, 0xC0, 0xFF, 0xE0, 0x5A, 0xE0, 0x00, 0x00, 0x4A, 0x60, 0xFF, 0xE0, 0xF7, 0xC0, 0x81, 0x00,
+0x00, 0x02, 0xB5, 0x80, 0xFF, 0xE0, 0x52, 0x80, 0x86, 0x00, 0x00, 0x87, 0x00, 0x00, 0x04, 0xA5,
+0x20, 0xFF, 0xE0, 0x9D, 0x00, 0x00, 0x00, 0x29, 0x40, 0x80, 0xFF, 0xC0, 0x00, 0x31, 0xA0, 0x80,
+0x00, 0x00, 0x02, 0xDE, 0xE0, 0xFF, 0xE0, 0x7B, 0xC0, 0x80, 0x00, 0x00, 0x04, 0xD6, 0xA0, 0xFF,
+0xE0, 0xA5, 0x20, 0x00, 0x00, 0x00, 0x20, 0x81, 0x00, 0x00, 0x06, 0x73, 0xA0, 0xFF, 0xE0, 0xE7,
+0x40, 0x00, 0x00, 0x9C, 0xC0, 0xFF, 0xE0, 0xA5, 0x20, 0x82, 0x00, 0x00, 0x04, 0xBD, 0xC0, 0xFF,
+0xE0, 0x5A, 0xE0, 0x00, 0x00, 0x21, 0x20, 0x80, 0xFF, 0xE0, 0x05, 0x31, 0xA0, 0x00, 0x00, 0x08,
+0x20, 0xEF, 0x60, 0xFF, 0xE0, 0x52, 0x80, 0x86, 0x00, 0x00, 0x87, 0x00, 0x00, 0x02, 0xA5, 0x20,
+0xFF, 0xE0, 0x9D, 0x00, 0x80, 0x00, 0x00, 0x09, 0x84, 0x20, 0xFF, 0xE0, 0xD6, 0xA0, 0x08, 0x20,
+0x00, 0x00, 0x9C, 0xE0, 0xFF, 0xE0, 0xF7, 0xA0, 0xA5, 0x20, 0xCE, 0x40, 0x80, 0xFF, 0xE0, 0x0E,
+0xA5, 0x20, 0x00, 0x00, 0x52, 0x80, 0xD6, 0xA0, 0x9C, 0xE0, 0x7B, 0xE0, 0xC6, 0x20, 0xFF, 0xE0,
+0xAD, 0x60, 0x00, 0x00, 0x73, 0x80, 0xFF, 0xE0, 0xF7, 0xC0, 0xA5, 0x20, 0xB5, 0xA0, 0x80, 0x00,
+0x00, 0x02, 0xBD, 0xC0, 0xFF, 0xE0, 0x5A, 0xE0, 0x80, 0x00, 0x00, 0x04, 0xCE, 0x40, 0xFF, 0xE0,
+0xE7, 0x20, 0xA5, 0x00, 0xCE, 0x80, 0x80, 0xFF, 0xE0, 0x00, 0x52, 0x80, 0x86, 0x00, 0x00, 0x87,
+0x00, 0x00, 0x02, 0xA5, 0x20, 0xFF, 0xE0, 0x9D, 0x00, 0x80, 0x00, 0x00, 0x06, 0x08, 0x40, 0xDE,
+0xE0, 0xFF, 0xE0, 0x8C, 0x40, 0x00, 0x00, 0x18, 0xC0, 0xCE, 0x40, 0x80, 0xFF, 0xE0, 0x06, 0xCE,
+0x80, 0x4A, 0x60, 0xFF, 0xE0, 0xA5, 0x20, 0x00, 0x00, 0x39, 0xC0, 0xE7, 0x20, 0x81, 0xFF, 0xE0,
+0x04, 0xBD, 0xE0, 0x18, 0xE0, 0x00, 0x00, 0x10, 0x80, 0xC6, 0x20, 0x80, 0xFF, 0xE0, 0x00, 0xEF,
+0x60, 0x80, 0x00, 0x00, 0x02, 0xBD, 0xC0, 0xFF, 0xE0, 0x5A, 0xE0, 0x80, 0x00, 0x00, 0x07, 0x21,
+0x20, 0xD6, 0xA0, 0xFF, 0xE0, 0xFF, 0xC0, 0x84, 0x20, 0xEF, 0x60, 0xFF, 0xE0, 0x52, 0x80, 0x86,
+0x00, 0x00, 0x93, 0x00, 0x00, 0x80, 0x08, 0x40, 0x85, 0x00, 0x00, 0x02, 0x08, 0x40, 0x08, 0x60,
+0x08, 0x20, 0x83, 0x00, 0x00, 0x80, 0x08, 0x40, 0x88, 0x00, 0x00, 0x05, 0x08, 0x40, 0x08, 0x20,
+0x00, 0x00, 0xF7, 0xA0, 0xFF, 0xE0, 0x4A, 0x60, 0x86, 0x00, 0x00, 0xAE, 0x00, 0x00, 0x07, 0x5A,
+0xE0, 0x42, 0x20, 0x08, 0x40, 0x00, 0x20, 0x6B, 0x40, 0xFF, 0xE0, 0xF7, 0xC0, 0x10, 0xA0, 0x86,
+0x00, 0x00, 0xAE, 0x00, 0x00, 0x00, 0xBD, 0xC0, 0x83, 0xFF, 0xE0, 0x00, 0x63, 0x20, 0x87, 0x00,
+0x00, 0x89, 0x00, 0x00, 0x01, 0x4A, 0x69, 0x7B, 0xCF, 0x81, 0x00, 0x00, 0x02, 0x21, 0x04, 0xA5,
+0x14, 0x9C, 0xF3, 0x88, 0x00, 0x00, 0x01, 0x4A, 0x69, 0x7B, 0xCF, 0x81, 0x00, 0x00, 0x02, 0x21,
+0x04, 0xA5, 0x14, 0x9C, 0xF3, 0x88, 0x00, 0x00, 0x01, 0x4A, 0x69, 0x7B, 0xCF, 0x81, 0x00, 0x00,
+0x02, 0x21, 0x04, 0xA5, 0x14, 0x9C, 0xF3, 0x87, 0x00, 0x00, 0x88, 0x00, 0x00, 0x03, 0x63, 0x2C,
+0xF7, 0xBE, 0xFF, 0xFF, 0xBD, 0xF7, 0x80, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00,
+0xB5, 0x96, 0x86, 0x00, 0x00, 0x03, 0x63, 0x2C, 0xF7, 0xBE, 0xFF, 0xFF, 0xBD, 0xF7, 0x80, 0x00,
+0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xB5, 0x96, 0x86, 0x00, 0x00, 0x03, 0x63, 0x2C,
+0xF7, 0xBE, 0xFF, 0xFF, 0xBD, 0xF7, 0x80, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00,
+0xB5, 0x96, 0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xC6, 0x18, 0x80, 0xFF, 0xFF, 0x02, 0xFF,
+0xDF, 0x00, 0x00, 0x5A, 0xEB, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x86, 0x00, 0x00, 0x00, 0xC6,
+0x18, 0x80, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0x00, 0x00, 0x5A, 0xEB, 0x81, 0xFF, 0xFF, 0x00, 0xE7,
+0x3C, 0x86, 0x00, 0x00, 0x00, 0xC6, 0x18, 0x80, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0x00, 0x00, 0x5A,
+0xEB, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xD6, 0xBA,
+0x81, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x7B, 0xEF, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x86, 0x00,
+0x00, 0x00, 0xD6, 0xBA, 0x81, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x7B, 0xEF, 0x81, 0xFF, 0xFF, 0x00,
+0xE7, 0x3C, 0x86, 0x00, 0x00, 0x00, 0xD6, 0xBA, 0x81, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x7B, 0xEF,
+0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xBD, 0xF7, 0x80,
+0xFF, 0xFF, 0x02, 0xF7, 0x9E, 0x00, 0x00, 0x31, 0x86, 0x81, 0xFF, 0xFF, 0x00, 0xD6, 0xBA, 0x86,
+0x00, 0x00, 0x00, 0xBD, 0xF7, 0x80, 0xFF, 0xFF, 0x02, 0xF7, 0x9E, 0x00, 0x00, 0x31, 0x86, 0x81,
+0xFF, 0xFF, 0x00, 0xD6, 0xBA, 0x86, 0x00, 0x00, 0x00, 0xBD, 0xF7, 0x80, 0xFF, 0xFF, 0x02, 0xF7,
+0x9E, 0x00, 0x00, 0x31, 0x86, 0x81, 0xFF, 0xFF, 0x00, 0xD6, 0xBA, 0x86, 0x00, 0x00, 0x88, 0x00,
+0x00, 0x03, 0x63, 0x0C, 0xFF, 0xDF, 0xFF, 0xFF, 0xD6, 0x9A, 0x80, 0x00, 0x00, 0x00, 0xDE, 0xDB,
+0x80, 0xFF, 0xFF, 0x00, 0x84, 0x10, 0x86, 0x00, 0x00, 0x03, 0x63, 0x0C, 0xFF, 0xDF, 0xFF, 0xFF,
+0xD6, 0x9A, 0x80, 0x00, 0x00, 0x00, 0xDE, 0xDB, 0x80, 0xFF, 0xFF, 0x00, 0x84, 0x10, 0x86, 0x00,
+0x00, 0x03, 0x63, 0x0C, 0xFF, 0xDF, 0xFF, 0xFF, 0xD6, 0x9A, 0x80, 0x00, 0x00, 0x00, 0xDE, 0xDB,
+0x80, 0xFF, 0xFF, 0x00, 0x84, 0x10, 0x86, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x63, 0x0C, 0x80,
+0xEF, 0x7D, 0x03, 0x63, 0x0C, 0x84, 0x10, 0xC6, 0x38, 0x52, 0x8A, 0x80, 0x00, 0x00, 0x06, 0x63,
+0x0C, 0xC6, 0x38, 0x94, 0x92, 0x00, 0x00, 0xAD, 0x55, 0xFF, 0xDF, 0xC6, 0x38, 0x80, 0x00, 0x00,
+0x00, 0x63, 0x0C, 0x80, 0xEF, 0x7D, 0x03, 0x63, 0x0C, 0x84, 0x10, 0xC6, 0x38, 0x52, 0x8A, 0x80,
+0x00, 0x00, 0x06, 0x63, 0x0C, 0xC6, 0x38, 0x94, 0x92, 0x00, 0x00, 0xAD, 0x55, 0xFF, 0xDF, 0xC6,
+0x38, 0x80, 0x00, 0x00, 0x00, 0x63, 0x0C, 0x80, 0xEF, 0x7D, 0x03, 0x63, 0x0C, 0x84, 0x10, 0xC6,
+0x38, 0x52, 0x8A, 0x80, 0x00, 0x00, 0x06, 0x63, 0x0C, 0xC6, 0x38, 0x94, 0x92, 0x00, 0x00, 0xAD,
+0x55, 0xFF, 0xDF, 0xC6, 0x38, 0x83, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF,
+0xFF, 0x00, 0xD6, 0x9A, 0x86, 0x00, 0x00, 0x00, 0x84, 0x30, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF,
+0x80, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xD6, 0x9A, 0x86, 0x00, 0x00, 0x00,
+0x84, 0x30, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x80, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF,
+0xFF, 0x00, 0xD6, 0x9A, 0x86, 0x00, 0x00, 0x00, 0x84, 0x30, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF,
+0x83, 0x00, 0x00, 0x85, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x81, 0x00, 0x00, 0x80,
+0x7B, 0xEF, 0x81, 0x00, 0x00, 0x00, 0xE7, 0x3C, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x80, 0x00,
+0x00, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x81, 0x00, 0x00, 0x80, 0x7B, 0xEF, 0x81, 0x00, 0x00,
+0x00, 0xE7, 0x3C, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x80, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x00,
+0xE7, 0x3C, 0x81, 0x00, 0x00, 0x80, 0x7B, 0xEF, 0x81, 0x00, 0x00, 0x00, 0xE7, 0x3C, 0x80, 0xFF,
+0xFF, 0x00, 0xFF, 0xDF, 0x83, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0xF7, 0xBE, 0x80, 0xFF, 0xFF,
+0x00, 0xD6, 0xBA, 0x80, 0x00, 0x00, 0x00, 0xCE, 0x59, 0x80, 0xFF, 0xFF, 0x02, 0xB5, 0xB6, 0x00,
+0x00, 0x00, 0x20, 0x81, 0xFF, 0xFF, 0x00, 0xCE, 0x59, 0x80, 0x00, 0x00, 0x00, 0xF7, 0xBE, 0x80,
+0xFF, 0xFF, 0x00, 0xD6, 0xBA, 0x80, 0x00, 0x00, 0x00, 0xCE, 0x59, 0x80, 0xFF, 0xFF, 0x02, 0xB5,
+0xB6, 0x00, 0x00, 0x00, 0x20, 0x81, 0xFF, 0xFF, 0x00, 0xCE, 0x59, 0x80, 0x00, 0x00, 0x00, 0xF7,
+0xBE, 0x80, 0xFF, 0xFF, 0x00, 0xD6, 0xBA, 0x80, 0x00, 0x00, 0x00, 0xCE, 0x59, 0x80, 0xFF, 0xFF,
+0x02, 0xB5, 0xB6, 0x00, 0x00, 0x00, 0x20, 0x81, 0xFF, 0xFF, 0x00, 0xCE, 0x59, 0x83, 0x00, 0x00,
+0x85, 0x00, 0x00, 0x00, 0xB5, 0xB6, 0x80, 0xFF, 0xFF, 0x02, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x75,
+0x82, 0xFF, 0xFF, 0x05, 0x7B, 0xCF, 0x00, 0x00, 0xF7, 0x9E, 0xFF, 0xFF, 0xF7, 0x9E, 0x4A, 0x69,
+0x80, 0x00, 0x00, 0x00, 0xB5, 0xB6, 0x80, 0xFF, 0xFF, 0x02, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x75,
+0x82, 0xFF, 0xFF, 0x05, 0x7B, 0xCF, 0x00, 0x00, 0xF7, 0x9E, 0xFF, 0xFF, 0xF7, 0x9E, 0x4A, 0x69,
+0x80, 0x00, 0x00, 0x00, 0xB5, 0xB6, 0x80, 0xFF, 0xFF, 0x02, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x75,
+0x82, 0xFF, 0xFF, 0x05, 0x7B, 0xCF, 0x00, 0x00, 0xF7, 0x9E, 0xFF, 0xFF, 0xF7, 0x9E, 0x4A, 0x69,
+0x83, 0x00, 0x00, 0x86, 0x00, 0x00, 0x03, 0x94, 0xB2, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x55, 0x83,
+0xFF, 0xFF, 0x04, 0xF7, 0x9E, 0x63, 0x0C, 0x52, 0x8A, 0xA5, 0x34, 0x4A, 0x49, 0x82, 0x00, 0x00,
+0x03, 0x94, 0xB2, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x55, 0x83, 0xFF, 0xFF, 0x04, 0xF7, 0x9E, 0x63,
+0x0C, 0x52, 0x8A, 0xA5, 0x34, 0x4A, 0x49, 0x82, 0x00, 0x00, 0x03, 0x94, 0xB2, 0x84, 0x10, 0x00,
+0x00, 0xAD, 0x55, 0x83, 0xFF, 0xFF, 0x04, 0xF7, 0x9E, 0x63, 0x0C, 0x52, 0x8A, 0xA5, 0x34, 0x4A,
+0x49, 0x84, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xBD, 0xD7, 0x85, 0xFF, 0xFF, 0x02, 0xFF, 0xDF,
+0xC6, 0x38, 0x39, 0xC7, 0x85, 0x00, 0x00, 0x00, 0xBD, 0xD7, 0x85, 0xFF, 0xFF, 0x02, 0xFF, 0xDF,
+0xC6, 0x38, 0x39, 0xC7, 0x85, 0x00, 0x00, 0x00, 0xBD, 0xD7, 0x85, 0xFF, 0xFF, 0x02, 0xFF, 0xDF,
+0xC6, 0x38, 0x39, 0xC7, 0x85, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x08, 0x61, 0x88, 0xFF, 0xFF,
+0x00, 0xC6, 0x38, 0x84, 0x00, 0x00, 0x00, 0x08, 0x61, 0x88, 0xFF, 0xFF, 0x00, 0xC6, 0x38, 0x84,
+0x00, 0x00, 0x00, 0x08, 0x61, 0x88, 0xFF, 0xFF, 0x00, 0xC6, 0x38, 0x85, 0x00, 0x00, 0x88, 0x00,
+0x00, 0x00, 0xF7, 0x9E, 0x81, 0xFF, 0xFF, 0x01, 0xF7, 0xBE, 0xEF, 0x7D, 0x82, 0xFF, 0xFF, 0x00,
+0xA5, 0x34, 0x85, 0x00, 0x00, 0x00, 0xF7, 0x9E, 0x81, 0xFF, 0xFF, 0x01, 0xF7, 0xBE, 0xEF, 0x7D,
+0x82, 0xFF, 0xFF, 0x00, 0xA5, 0x34, 0x85, 0x00, 0x00, 0x00, 0xF7, 0x9E, 0x81, 0xFF, 0xFF, 0x01,
+0xF7, 0xBE, 0xEF, 0x7D, 0x82, 0xFF, 0xFF, 0x00, 0xA5, 0x34, 0x85, 0x00, 0x00, 0x88, 0x00, 0x00,
+0x03, 0x63, 0x0C, 0xAD, 0x75, 0xAD, 0x55, 0x6B, 0x6D, 0x80, 0x00, 0x00, 0x03, 0x00, 0x20, 0x7B,
+0xCF, 0x84, 0x10, 0x6B, 0x6D, 0x86, 0x00, 0x00, 0x03, 0x63, 0x0C, 0xAD, 0x75, 0xAD, 0x55, 0x6B,
+0x6D, 0x80, 0x00, 0x00, 0x03, 0x00, 0x20, 0x7B, 0xCF, 0x84, 0x10, 0x6B, 0x6D, 0x86, 0x00, 0x00,
+0x03, 0x63, 0x0C, 0xAD, 0x75, 0xAD, 0x55, 0x6B, 0x6D, 0x80, 0x00, 0x00, 0x03, 0x00, 0x20, 0x7B,
+0xCF, 0x84, 0x10, 0x6B, 0x6D, 0x86, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x89, 0x00,
+0x00, 0x01, 0x4A, 0x69, 0x7B, 0xCF, 0x81, 0x00, 0x00, 0x02, 0x21, 0x04, 0xA5, 0x14, 0x9C, 0xF3,
+0x88, 0x00, 0x00, 0x01, 0x4A, 0x69, 0x7B, 0xCF, 0x81, 0x00, 0x00, 0x02, 0x21, 0x04, 0xA5, 0x14,
+0x9C, 0xF3, 0x88, 0x00, 0x00, 0x01, 0x4A, 0x69, 0x7B, 0xCF, 0x81, 0x00, 0x00, 0x02, 0x21, 0x04,
+0xA5, 0x14, 0x9C, 0xF3, 0x87, 0x00, 0x00, 0x88, 0x00, 0x00, 0x03, 0x63, 0x2C, 0xF7, 0xBE, 0xFF,
+0xFF, 0xBD, 0xF7, 0x80, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xB5, 0x96, 0x86,
+0x00, 0x00, 0x03, 0x63, 0x2C, 0xF7, 0xBE, 0xFF, 0xFF, 0xBD, 0xF7, 0x80, 0x00, 0x00, 0x00, 0xD6,
+0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xB5, 0x96, 0x86, 0x00, 0x00, 0x03, 0x63, 0x2C, 0xF7, 0xBE, 0xFF,
+0xFF, 0xBD, 0xF7, 0x80, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xB5, 0x96, 0x86,
+0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xC6, 0x18, 0x80, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0x00, 0x00,
+0x5A, 0xEB, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x86, 0x00, 0x00, 0x00, 0xC6, 0x18, 0x80, 0xFF,
+0xFF, 0x02, 0xFF, 0xDF, 0x00, 0x00, 0x5A, 0xEB, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x86, 0x00,
+0x00, 0x00, 0xC6, 0x18, 0x80, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0x00, 0x00, 0x5A, 0xEB, 0x81, 0xFF,
+0xFF, 0x00, 0xE7, 0x3C, 0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xD6, 0xBA, 0x81, 0xFF, 0xFF,
+0x01, 0x00, 0x00, 0x7B, 0xEF, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x86, 0x00, 0x00, 0x00, 0xD6,
+0xBA, 0x81, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x7B, 0xEF, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x86,
+0x00, 0x00, 0x00, 0xD6, 0xBA, 0x81, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x7B, 0xEF, 0x81, 0xFF, 0xFF,
+0x00, 0xE7, 0x3C, 0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xBD, 0xF7, 0x80, 0xFF, 0xFF, 0x02,
+0xF7, 0x9E, 0x00, 0x00, 0x31, 0x86, 0x81, 0xFF, 0xFF, 0x00, 0xD6, 0xBA, 0x86, 0x00, 0x00, 0x00,
+0xBD, 0xF7, 0x80, 0xFF, 0xFF, 0x02, 0xF7, 0x9E, 0x00, 0x00, 0x31, 0x86, 0x81, 0xFF, 0xFF, 0x00,
+0xD6, 0xBA, 0x86, 0x00, 0x00, 0x00, 0xBD, 0xF7, 0x80, 0xFF, 0xFF, 0x02, 0xF7, 0x9E, 0x00, 0x00,
+0x31, 0x86, 0x81, 0xFF, 0xFF, 0x00, 0xD6, 0xBA, 0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x03, 0x63,
+0x0C, 0xFF, 0xDF, 0xFF, 0xFF, 0xD6, 0x9A, 0x80, 0x00, 0x00, 0x00, 0xDE, 0xDB, 0x80, 0xFF, 0xFF,
+0x00, 0x84, 0x10, 0x86, 0x00, 0x00, 0x03, 0x63, 0x0C, 0xFF, 0xDF, 0xFF, 0xFF, 0xD6, 0x9A, 0x80,
+0x00, 0x00, 0x00, 0xDE, 0xDB, 0x80, 0xFF, 0xFF, 0x00, 0x84, 0x10, 0x86, 0x00, 0x00, 0x03, 0x63,
+0x0C, 0xFF, 0xDF, 0xFF, 0xFF, 0xD6, 0x9A, 0x80, 0x00, 0x00, 0x00, 0xDE, 0xDB, 0x80, 0xFF, 0xFF,
+0x00, 0x84, 0x10, 0x86, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x63, 0x0C, 0x80, 0xEF, 0x7D, 0x03,
+0x63, 0x0C, 0x84, 0x10, 0xC6, 0x38, 0x52, 0x8A, 0x80, 0x00, 0x00, 0x06, 0x63, 0x0C, 0xC6, 0x38,
+0x94, 0x92, 0x00, 0x00, 0xAD, 0x55, 0xFF, 0xDF, 0xC6, 0x38, 0x80, 0x00, 0x00, 0x00, 0x63, 0x0C,
+0x80, 0xEF, 0x7D, 0x03, 0x63, 0x0C, 0x84, 0x10, 0xC6, 0x38, 0x52, 0x8A, 0x80, 0x00, 0x00, 0x06,
+0x63, 0x0C, 0xC6, 0x38, 0x94, 0x92, 0x00, 0x00, 0xAD, 0x55, 0xFF, 0xDF, 0xC6, 0x38, 0x80, 0x00,
+0x00, 0x00, 0x63, 0x0C, 0x80, 0xEF, 0x7D, 0x03, 0x63, 0x0C, 0x84, 0x10, 0xC6, 0x38, 0x52, 0x8A,
+0x80, 0x00, 0x00, 0x06, 0x63, 0x0C, 0xC6, 0x38, 0x94, 0x92, 0x00, 0x00, 0xAD, 0x55, 0xFF, 0xDF,
+0xC6, 0x38, 0x83, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xD6,
+0x9A, 0x86, 0x00, 0x00, 0x00, 0x84, 0x30, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x80, 0x00, 0x00,
+0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xD6, 0x9A, 0x86, 0x00, 0x00, 0x00, 0x84, 0x30, 0x80,
+0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x80, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xD6,
+0x9A, 0x86, 0x00, 0x00, 0x00, 0x84, 0x30, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x83, 0x00, 0x00,
+0x85, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x81, 0x00, 0x00, 0x80, 0x7B, 0xEF, 0x81,
+0x00, 0x00, 0x00, 0xE7, 0x3C, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x80, 0x00, 0x00, 0x81, 0xFF,
+0xFF, 0x00, 0xE7, 0x3C, 0x81, 0x00, 0x00, 0x80, 0x7B, 0xEF, 0x81, 0x00, 0x00, 0x00, 0xE7, 0x3C,
+0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x80, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x81,
+0x00, 0x00, 0x80, 0x7B, 0xEF, 0x81, 0x00, 0x00, 0x00, 0xE7, 0x3C, 0x80, 0xFF, 0xFF, 0x00, 0xFF,
+0xDF, 0x83, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0xF7, 0xBE, 0x80, 0xFF, 0xFF, 0x00, 0xD6, 0xBA,
+0x80, 0x00, 0x00, 0x00, 0xCE, 0x59, 0x80, 0xFF, 0xFF, 0x02, 0xB5, 0xB6, 0x00, 0x00, 0x00, 0x20,
+0x81, 0xFF, 0xFF, 0x00, 0xCE, 0x59, 0x80, 0x00, 0x00, 0x00, 0xF7, 0xBE, 0x80, 0xFF, 0xFF, 0x00,
+0xD6, 0xBA, 0x80, 0x00, 0x00, 0x00, 0xCE, 0x59, 0x80, 0xFF, 0xFF, 0x02, 0xB5, 0xB6, 0x00, 0x00,
+0x00, 0x20, 0x81, 0xFF, 0xFF, 0x00, 0xCE, 0x59, 0x80, 0x00, 0x00, 0x00, 0xF7, 0xBE, 0x80, 0xFF,
+0xFF, 0x00, 0xD6, 0xBA, 0x80, 0x00, 0x00, 0x00, 0xCE, 0x59, 0x80, 0xFF, 0xFF, 0x02, 0xB5, 0xB6,
+0x00, 0x00, 0x00, 0x20, 0x81, 0xFF, 0xFF, 0x00, 0xCE, 0x59, 0x83, 0x00, 0x00, 0x85, 0x00, 0x00,
+0x00, 0xB5, 0xB6, 0x80, 0xFF, 0xFF, 0x02, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x75, 0x82, 0xFF, 0xFF,
+0x05, 0x7B, 0xCF, 0x00, 0x00, 0xF7, 0x9E, 0xFF, 0xFF, 0xF7, 0x9E, 0x4A, 0x69, 0x80, 0x00, 0x00,
+0x00, 0xB5, 0xB6, 0x80, 0xFF, 0xFF, 0x02, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x75, 0x82, 0xFF, 0xFF,
+0x05, 0x7B, 0xCF, 0x00, 0x00, 0xF7, 0x9E, 0xFF, 0xFF, 0xF7, 0x9E, 0x4A, 0x69, 0x80, 0x00, 0x00,
+0x00, 0xB5, 0xB6, 0x80, 0xFF, 0xFF, 0x02, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x75, 0x82, 0xFF, 0xFF,
+0x05, 0x7B, 0xCF, 0x00, 0x00, 0xF7, 0x9E, 0xFF, 0xFF, 0xF7, 0x9E, 0x4A, 0x69, 0x83, 0x00, 0x00,
+0x86, 0x00, 0x00, 0x03, 0x94, 0xB2, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x55, 0x83, 0xFF, 0xFF, 0x04,
+0xF7, 0x9E, 0x63, 0x0C, 0x52, 0x8A, 0xA5, 0x34, 0x4A, 0x49, 0x82, 0x00, 0x00, 0x03, 0x94, 0xB2,
+0x84, 0x10, 0x00, 0x00, 0xAD, 0x55, 0x83, 0xFF, 0xFF, 0x04, 0xF7, 0x9E, 0x63, 0x0C, 0x52, 0x8A,
+0xA5, 0x34, 0x4A, 0x49, 0x82, 0x00, 0x00, 0x03, 0x94, 0xB2, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x55,
+0x83, 0xFF, 0xFF, 0x04, 0xF7, 0x9E, 0x63, 0x0C, 0x52, 0x8A, 0xA5, 0x34, 0x4A, 0x49, 0x84, 0x00,
+0x00, 0x88, 0x00, 0x00, 0x00, 0xBD, 0xD7, 0x85, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xC6, 0x38, 0x39,
+0xC7, 0x85, 0x00, 0x00, 0x00, 0xBD, 0xD7, 0x85, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xC6, 0x38, 0x39,
+0xC7, 0x85, 0x00, 0x00, 0x00, 0xBD, 0xD7, 0x85, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xC6, 0x38, 0x39,
+0xC7, 0x85, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x08, 0x61, 0x88, 0xFF, 0xFF, 0x00, 0xC6, 0x38,
+0x84, 0x00, 0x00, 0x00, 0x08, 0x61, 0x88, 0xFF, 0xFF, 0x00, 0xC6, 0x38, 0x84, 0x00, 0x00, 0x00,
+0x08, 0x61, 0x88, 0xFF, 0xFF, 0x00, 0xC6, 0x38, 0x85, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xF7,
+0x9E, 0x81, 0xFF, 0xFF, 0x01, 0xF7, 0xBE, 0xEF, 0x7D, 0x82, 0xFF, 0xFF, 0x00, 0xA5, 0x34, 0x85,
+0x00, 0x00, 0x00, 0xF7, 0x9E, 0x81, 0xFF, 0xFF, 0x01, 0xF7, 0xBE, 0xEF, 0x7D, 0x82, 0xFF, 0xFF,
+0x00, 0xA5, 0x34, 0x85, 0x00, 0x00, 0x00, 0xF7, 0x9E, 0x81, 0xFF, 0xFF, 0x01, 0xF7, 0xBE, 0xEF,
+0x7D, 0x82, 0xFF, 0xFF, 0x00, 0xA5, 0x34, 0x85, 0x00, 0x00, 0x88, 0x00, 0x00, 0x03, 0x63, 0x0C,
+0xAD, 0x75, 0xAD, 0x55, 0x6B, 0x6D, 0x80, 0x00, 0x00, 0x03, 0x00, 0x20, 0x7B, 0xCF, 0x84, 0x10,
+0x6B, 0x6D, 0x86, 0x00, 0x00, 0x03, 0x63, 0x0C, 0xAD, 0x75, 0xAD, 0x55, 0x6B, 0x6D, 0x80, 0x00,
+0x00, 0x03, 0x00, 0x20, 0x7B, 0xCF, 0x84, 0x10, 0x6B, 0x6D, 0x86, 0x00, 0x00, 0x03, 0x63, 0x0C,
+0xAD, 0x75, 0xAD, 0x55, 0x6B, 0x6D, 0x80, 0x00, 0x00, 0x03, 0x00, 0x20, 0x7B, 0xCF, 0x84, 0x10,
+0x6B, 0x6D, 0x86, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x89, 0x00, 0x00, 0x01, 0x4A,
+0x69, 0x7B, 0xCF, 0x81, 0x00, 0x00, 0x02, 0x21, 0x04, 0xA5, 0x14, 0x9C, 0xF3, 0x88, 0x00, 0x00,
+0x01, 0x4A, 0x69, 0x7B, 0xCF, 0x81, 0x00, 0x00, 0x02, 0x21, 0x04, 0xA5, 0x14, 0x9C, 0xF3, 0x88,
+0x00, 0x00, 0x01, 0x4A, 0x69, 0x7B, 0xCF, 0x81, 0x00, 0x00, 0x02, 0x21, 0x04, 0xA5, 0x14, 0x9C,
+0xF3, 0x87, 0x00, 0x00, 0x88, 0x00, 0x00, 0x03, 0x63, 0x2C, 0xF7, 0xBE, 0xFF, 0xFF, 0xBD, 0xF7,
+0x80, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xB5, 0x96, 0x86, 0x00, 0x00, 0x03,
+0x63, 0x2C, 0xF7, 0xBE, 0xFF, 0xFF, 0xBD, 0xF7, 0x80, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF,
+0xFF, 0x00, 0xB5, 0x96, 0x86, 0x00, 0x00, 0x03, 0x63, 0x2C, 0xF7, 0xBE, 0xFF, 0xFF, 0xBD, 0xF7,
+0x80, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xB5, 0x96, 0x86, 0x00, 0x00, 0x88,
+0x00, 0x00, 0x00, 0xC6, 0x18, 0x80, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0x00, 0x00, 0x5A, 0xEB, 0x81,
+0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x86, 0x00, 0x00, 0x00, 0xC6, 0x18, 0x80, 0xFF, 0xFF, 0x02, 0xFF,
+0xDF, 0x00, 0x00, 0x5A, 0xEB, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x86, 0x00, 0x00, 0x00, 0xC6,
+0x18, 0x80, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0x00, 0x00, 0x5A, 0xEB, 0x81, 0xFF, 0xFF, 0x00, 0xE7,
+0x3C, 0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xD6, 0xBA, 0x81, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+0x7B, 0xEF, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x86, 0x00, 0x00, 0x00, 0xD6, 0xBA, 0x81, 0xFF,
+0xFF, 0x01, 0x00, 0x00, 0x7B, 0xEF, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x86, 0x00, 0x00, 0x00,
+0xD6, 0xBA, 0x81, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x7B, 0xEF, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C,
+0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xBD, 0xF7, 0x80, 0xFF, 0xFF, 0x02, 0xF7, 0x9E, 0x00,
+0x00, 0x31, 0x86, 0x81, 0xFF, 0xFF, 0x00, 0xD6, 0xBA, 0x86, 0x00, 0x00, 0x00, 0xBD, 0xF7, 0x80,
+0xFF, 0xFF, 0x02, 0xF7, 0x9E, 0x00, 0x00, 0x31, 0x86, 0x81, 0xFF, 0xFF, 0x00, 0xD6, 0xBA, 0x86,
+0x00, 0x00, 0x00, 0xBD, 0xF7, 0x80, 0xFF, 0xFF, 0x02, 0xF7, 0x9E, 0x00, 0x00, 0x31, 0x86, 0x81,
+0xFF, 0xFF, 0x00, 0xD6, 0xBA, 0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x03, 0x63, 0x0C, 0xFF, 0xDF,
+0xFF, 0xFF, 0xD6, 0x9A, 0x80, 0x00, 0x00, 0x00, 0xDE, 0xDB, 0x80, 0xFF, 0xFF, 0x00, 0x84, 0x10,
+0x86, 0x00, 0x00, 0x03, 0x63, 0x0C, 0xFF, 0xDF, 0xFF, 0xFF, 0xD6, 0x9A, 0x80, 0x00, 0x00, 0x00,
+0xDE, 0xDB, 0x80, 0xFF, 0xFF, 0x00, 0x84, 0x10, 0x86, 0x00, 0x00, 0x03, 0x63, 0x0C, 0xFF, 0xDF,
+0xFF, 0xFF, 0xD6, 0x9A, 0x80, 0x00, 0x00, 0x00, 0xDE, 0xDB, 0x80, 0xFF, 0xFF, 0x00, 0x84, 0x10,
+0x86, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x63, 0x0C, 0x80, 0xEF, 0x7D, 0x03, 0x63, 0x0C, 0x84,
+0x10, 0xC6, 0x38, 0x52, 0x8A, 0x80, 0x00, 0x00, 0x06, 0x63, 0x0C, 0xC6, 0x38, 0x94, 0x92, 0x00,
+0x00, 0xAD, 0x55, 0xFF, 0xDF, 0xC6, 0x38, 0x80, 0x00, 0x00, 0x00, 0x63, 0x0C, 0x80, 0xEF, 0x7D,
+0x03, 0x63, 0x0C, 0x84, 0x10, 0xC6, 0x38, 0x52, 0x8A, 0x80, 0x00, 0x00, 0x06, 0x63, 0x0C, 0xC6,
+0x38, 0x94, 0x92, 0x00, 0x00, 0xAD, 0x55, 0xFF, 0xDF, 0xC6, 0x38, 0x80, 0x00, 0x00, 0x00, 0x63,
+0x0C, 0x80, 0xEF, 0x7D, 0x03, 0x63, 0x0C, 0x84, 0x10, 0xC6, 0x38, 0x52, 0x8A, 0x80, 0x00, 0x00,
+0x06, 0x63, 0x0C, 0xC6, 0x38, 0x94, 0x92, 0x00, 0x00, 0xAD, 0x55, 0xFF, 0xDF, 0xC6, 0x38, 0x83,
+0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xD6, 0x9A, 0x86, 0x00,
+0x00, 0x00, 0x84, 0x30, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x80, 0x00, 0x00, 0x00, 0xD6, 0x9A,
+0x80, 0xFF, 0xFF, 0x00, 0xD6, 0x9A, 0x86, 0x00, 0x00, 0x00, 0x84, 0x30, 0x80, 0xFF, 0xFF, 0x00,
+0xFF, 0xDF, 0x80, 0x00, 0x00, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xD6, 0x9A, 0x86, 0x00,
+0x00, 0x00, 0x84, 0x30, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x83, 0x00, 0x00, 0x85, 0x00, 0x00,
+0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x81, 0x00, 0x00, 0x80, 0x7B, 0xEF, 0x81, 0x00, 0x00, 0x00,
+0xE7, 0x3C, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x80, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x00, 0xE7,
+0x3C, 0x81, 0x00, 0x00, 0x80, 0x7B, 0xEF, 0x81, 0x00, 0x00, 0x00, 0xE7, 0x3C, 0x80, 0xFF, 0xFF,
+0x00, 0xFF, 0xDF, 0x80, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x81, 0x00, 0x00, 0x80,
+0x7B, 0xEF, 0x81, 0x00, 0x00, 0x00, 0xE7, 0x3C, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x83, 0x00,
+0x00, 0x85, 0x00, 0x00, 0x00, 0xF7, 0xBE, 0x80, 0xFF, 0xFF, 0x00, 0xD6, 0xBA, 0x80, 0x00, 0x00,
+0x00, 0xCE, 0x59, 0x80, 0xFF, 0xFF, 0x02, 0xB5, 0xB6, 0x00, 0x00, 0x00, 0x20, 0x81, 0xFF, 0xFF,
+0x00, 0xCE, 0x59, 0x80, 0x00, 0x00, 0x00, 0xF7, 0xBE, 0x80, 0xFF, 0xFF, 0x00, 0xD6, 0xBA, 0x80,
+0x00, 0x00, 0x00, 0xCE, 0x59, 0x80, 0xFF, 0xFF, 0x02, 0xB5, 0xB6, 0x00, 0x00, 0x00, 0x20, 0x81,
+0xFF, 0xFF, 0x00, 0xCE, 0x59, 0x80, 0x00, 0x00, 0x00, 0xF7, 0xBE, 0x80, 0xFF, 0xFF, 0x00, 0xD6,
+0xBA, 0x80, 0x00, 0x00, 0x00, 0xCE, 0x59, 0x80, 0xFF, 0xFF, 0x02, 0xB5, 0xB6, 0x00, 0x00, 0x00,
+0x20, 0x81, 0xFF, 0xFF, 0x00, 0xCE, 0x59, 0x83, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0xB5, 0xB6,
+0x80, 0xFF, 0xFF, 0x02, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x75, 0x82, 0xFF, 0xFF, 0x05, 0x7B, 0xCF,
+0x00, 0x00, 0xF7, 0x9E, 0xFF, 0xFF, 0xF7, 0x9E, 0x4A, 0x69, 0x80, 0x00, 0x00, 0x00, 0xB5, 0xB6,
+0x80, 0xFF, 0xFF, 0x02, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x75, 0x82, 0xFF, 0xFF, 0x05, 0x7B, 0xCF,
+0x00, 0x00, 0xF7, 0x9E, 0xFF, 0xFF, 0xF7, 0x9E, 0x4A, 0x69, 0x80, 0x00, 0x00, 0x00, 0xB5, 0xB6,
+0x80, 0xFF, 0xFF, 0x02, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x75, 0x82, 0xFF, 0xFF, 0x05, 0x7B, 0xCF,
+0x00, 0x00, 0xF7, 0x9E, 0xFF, 0xFF, 0xF7, 0x9E, 0x4A, 0x69, 0x83, 0x00, 0x00, 0x86, 0x00, 0x00,
+0x03, 0x94, 0xB2, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x55, 0x83, 0xFF, 0xFF, 0x04, 0xF7, 0x9E, 0x63,
+0x0C, 0x52, 0x8A, 0xA5, 0x34, 0x4A, 0x49, 0x82, 0x00, 0x00, 0x03, 0x94, 0xB2, 0x84, 0x10, 0x00,
+0x00, 0xAD, 0x55, 0x83, 0xFF, 0xFF, 0x04, 0xF7, 0x9E, 0x63, 0x0C, 0x52, 0x8A, 0xA5, 0x34, 0x4A,
+0x49, 0x82, 0x00, 0x00, 0x03, 0x94, 0xB2, 0x84, 0x10, 0x00, 0x00, 0xAD, 0x55, 0x83, 0xFF, 0xFF,
+0x04, 0xF7, 0x9E, 0x63, 0x0C, 0x52, 0x8A, 0xA5, 0x34, 0x4A, 0x49, 0x84, 0x00, 0x00, 0x88, 0x00,
+0x00, 0x00, 0xBD, 0xD7, 0x85, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xC6, 0x38, 0x39, 0xC7, 0x85, 0x00,
+0x00, 0x00, 0xBD, 0xD7, 0x85, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xC6, 0x38, 0x39, 0xC7, 0x85, 0x00,
+0x00, 0x00, 0xBD, 0xD7, 0x85, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xC6, 0x38, 0x39, 0xC7, 0x85, 0x00,
+0x00, 0xBE, 0x00, 0x00, 0x96, 0x00, 0x00, 0x02, 0x08, 0x20, 0x10, 0x40, 0x08, 0x20, 0x88, 0x00,
+0x00, 0x02, 0x08, 0x20, 0x10, 0x40, 0x08, 0x20, 0x96, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x28,
+0xC1, 0x81, 0x39, 0x01, 0x01, 0x30, 0xE1, 0x10, 0x40, 0x84, 0x00, 0x00, 0x01, 0x10, 0x40, 0x30,
+0xE1, 0x81, 0x39, 0x01, 0x00, 0x28, 0xC1, 0x95, 0x00, 0x00, 0x94, 0x00, 0x00, 0x04, 0x30, 0xE1,
+0x39, 0x01, 0x41, 0x21, 0x49, 0x42, 0x41, 0x22, 0x80, 0x39, 0x01, 0x00, 0x08, 0x40, 0x82, 0x00,
+0x00, 0x00, 0x08, 0x40, 0x80, 0x39, 0x01, 0x04, 0x41, 0x22, 0x49, 0x42, 0x41, 0x21, 0x39, 0x01,
+0x30, 0xE1, 0x94, 0x00, 0x00, 0x93, 0x00, 0x00, 0x02, 0x10, 0x60, 0x39, 0x01, 0x41, 0x22, 0x81,
+0x69, 0xE3, 0x02, 0x51, 0x62, 0x39, 0x01, 0x30, 0xE1, 0x82, 0x00, 0x00, 0x02, 0x30, 0xE1, 0x39,
+0x01, 0x51, 0x62, 0x81, 0x69, 0xE3, 0x02, 0x41, 0x42, 0x39, 0x01, 0x10, 0x60, 0x93, 0x00, 0x00,
+0x93, 0x00, 0x00, 0x02, 0x20, 0xA1, 0x39, 0x01, 0x51, 0x82, 0x82, 0x69, 0xE3, 0x01, 0x41, 0x21,
+0x39, 0x01, 0x82, 0x00, 0x00, 0x01, 0x39, 0x01, 0x41, 0x21, 0x82, 0x69, 0xE3, 0x02, 0x51, 0x82,
+0x39, 0x01, 0x20, 0x80, 0x93, 0x00, 0x00, 0x83, 0x00, 0x00, 0x02, 0x28, 0xC0, 0x39, 0x01, 0x10,
+0x40, 0x8B, 0x00, 0x00, 0x02, 0x20, 0x81, 0x39, 0x01, 0x51, 0x82, 0x82, 0x69, 0xE3, 0x02, 0x41,
+0x22, 0x39, 0x01, 0x00, 0x20, 0x80, 0x00, 0x00, 0x02, 0x08, 0x20, 0x39, 0x01, 0x41, 0x22, 0x82,
+0x69, 0xE3, 0x02, 0x51, 0x62, 0x39, 0x01, 0x20, 0x80, 0x8B, 0x00, 0x00, 0x02, 0x10, 0x40, 0x39,
+0x01, 0x28, 0xC0, 0x83, 0x00, 0x00, 0x81, 0x00, 0x00, 0x01, 0x10, 0x40, 0xED, 0x09, 0x81, 0xED,
+0x0A, 0x03, 0xEC, 0xE9, 0xCC, 0x26, 0x82, 0x63, 0x08, 0x20, 0x87, 0x00, 0x00, 0x03, 0x08, 0x40,
+0x39, 0x01, 0x39, 0x21, 0x61, 0xC3, 0x80, 0x69, 0xE3, 0x00, 0x59, 0xA2, 0x80, 0x39, 0x01, 0x82,
+0x00, 0x00, 0x80, 0x39, 0x01, 0x00, 0x59, 0xA2, 0x80, 0x69, 0xE3, 0x03, 0x61, 0xC3, 0x39, 0x21,
+0x39, 0x01, 0x08, 0x40, 0x87, 0x00, 0x00, 0x03, 0x08, 0x20, 0x82, 0x83, 0xCC, 0x26, 0xEC, 0xE9,
+0x81, 0xED, 0x0A, 0x01, 0xED, 0x09, 0x10, 0x40, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x01, 0x49,
+0x82, 0xED, 0x0A, 0x80, 0xED, 0x09, 0x82, 0xED, 0x0A, 0x02, 0xEC, 0xE9, 0xB3, 0x65, 0x10, 0x40,
+0x86, 0x00, 0x00, 0x00, 0x30, 0xE1, 0x80, 0x39, 0x01, 0x01, 0x41, 0x42, 0x41, 0x22, 0x80, 0x39,
+0x01, 0x00, 0x28, 0xC0, 0x82, 0x00, 0x00, 0x00, 0x28, 0xC0, 0x80, 0x39, 0x01, 0x01, 0x41, 0x22,
+0x41, 0x42, 0x80, 0x39, 0x01, 0x00, 0x38, 0xE1, 0x86, 0x00, 0x00, 0x02, 0x10, 0x40, 0xB3, 0x65,
+0xEC, 0xE9, 0x82, 0xED, 0x0A, 0x80, 0xED, 0x09, 0x01, 0xED, 0x0A, 0x49, 0x62, 0x81, 0x00, 0x00,
+0x81, 0x00, 0x00, 0x02, 0x7A, 0x84, 0xED, 0x0A, 0xDC, 0x66, 0x80, 0xFC, 0x20, 0x02, 0xFC, 0x62,
+0xF4, 0x84, 0xF4, 0xE8, 0x80, 0xED, 0x0A, 0x01, 0xEC, 0xC8, 0x31, 0x01, 0x85, 0x00, 0x00, 0x02,
+0x28, 0xC0, 0x82, 0x21, 0x41, 0x21, 0x80, 0x39, 0x01, 0x02, 0x49, 0x41, 0x92, 0x60, 0x28, 0xC0,
+0x82, 0x00, 0x00, 0x02, 0x28, 0xC0, 0x92, 0x60, 0x49, 0x41, 0x80, 0x39, 0x01, 0x02, 0x41, 0x21,
+0x82, 0x21, 0x28, 0xA0, 0x85, 0x00, 0x00, 0x01, 0x39, 0x01, 0xEC, 0xC8, 0x80, 0xED, 0x0A, 0x02,
+0xF4, 0xE8, 0xF4, 0xA4, 0xFC, 0x42, 0x80, 0xFC, 0x20, 0x02, 0xDC, 0x66, 0xED, 0x0A, 0x72, 0x64,
+0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x93, 0x05, 0xED, 0x0A, 0xA3, 0x45, 0xA2, 0xA0, 0x82,
+0xFC, 0x20, 0x04, 0xFC, 0x62, 0xF4, 0xE8, 0xED, 0x0A, 0xEC, 0xC8, 0x10, 0x40, 0x84, 0x00, 0x00,
+0x04, 0x30, 0xC0, 0xCB, 0x40, 0xC3, 0x40, 0xBB, 0x83, 0xC3, 0xA3, 0x80, 0xCB, 0x40, 0x00, 0x39,
+0x00, 0x82, 0x00, 0x00, 0x00, 0x41, 0x00, 0x80, 0xCB, 0x40, 0x04, 0xC3, 0xA3, 0xBB, 0x83, 0xC3,
+0x40, 0xCB, 0x40, 0x28, 0xC0, 0x84, 0x00, 0x00, 0x04, 0x10, 0x60, 0xEC, 0xC8, 0xED, 0x0A, 0xF4,
+0xE8, 0xFC, 0x62, 0x82, 0xFC, 0x20, 0x03, 0x9A, 0x80, 0xA3, 0x45, 0xED, 0x0A, 0x93, 0x05, 0x81,
+0x00, 0x00, 0x81, 0x00, 0x00, 0x05, 0x9B, 0x25, 0xED, 0x0A, 0xA3, 0x45, 0x51, 0x61, 0x61, 0x80,
+0xB2, 0xE0, 0x81, 0xFC, 0x20, 0x03, 0xFC, 0x40, 0xF4, 0xE8, 0xED, 0x0A, 0xD4, 0x26, 0x84, 0x00,
+0x00, 0x02, 0x41, 0x20, 0xCB, 0x40, 0xCB, 0x60, 0x80, 0xE4, 0x43, 0x02, 0xD3, 0x80, 0xCB, 0x40,
+0x59, 0x60, 0x82, 0x00, 0x00, 0x02, 0x59, 0x60, 0xCB, 0x40, 0xD3, 0x80, 0x80, 0xE4, 0x43, 0x02,
+0xCB, 0x60, 0xCB, 0x40, 0x41, 0x00, 0x84, 0x00, 0x00, 0x03, 0xD4, 0x26, 0xED, 0x0A, 0xF4, 0xE8,
+0xFC, 0x40, 0x81, 0xFC, 0x20, 0x05, 0xB2, 0xC0, 0x61, 0x80, 0x51, 0x61, 0xA3, 0x65, 0xED, 0x0A,
+0x93, 0x25, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x0A, 0x93, 0x05, 0xED, 0x0A, 0xB3, 0x86, 0x59,
+0xA1, 0x51, 0x61, 0x49, 0x40, 0x51, 0x60, 0xA2, 0xA0, 0xFC, 0x00, 0xFC, 0x20, 0xFC, 0x41, 0x80,
+0xED, 0x0A, 0x00, 0x59, 0xC2, 0x83, 0x00, 0x00, 0x02, 0x61, 0xA0, 0xCB, 0x40, 0xD3, 0x81, 0x80,
+0xE4, 0x43, 0x02, 0xD3, 0xA1, 0xCB, 0x40, 0x82, 0x00, 0x82, 0x00, 0x00, 0x02, 0x82, 0x20, 0xCB,
+0x40, 0xD3, 0xA1, 0x80, 0xE4, 0x43, 0x02, 0xD3, 0x80, 0xCB, 0x40, 0x61, 0x80, 0x83, 0x00, 0x00,
+0x00, 0x61, 0xC2, 0x80, 0xED, 0x0A, 0x0A, 0xFC, 0x41, 0xFC, 0x20, 0xFC, 0x00, 0x9A, 0x80, 0x51,
+0x60, 0x49, 0x40, 0x51, 0x61, 0x59, 0xA1, 0xB3, 0xA6, 0xED, 0x0A, 0x93, 0x05, 0x81, 0x00, 0x00,
+0x81, 0x00, 0x00, 0x0D, 0x72, 0x44, 0xED, 0x0A, 0xC4, 0x07, 0x61, 0xC1, 0x59, 0xA1, 0x51, 0x61,
+0x49, 0x40, 0x41, 0x00, 0x49, 0x40, 0xBB, 0x00, 0xFC, 0x20, 0xF4, 0xA5, 0xED, 0x0A, 0xDC, 0x87,
+0x83, 0x00, 0x00, 0x06, 0x92, 0x60, 0xCB, 0x40, 0xD3, 0xA1, 0xE4, 0x64, 0xEC, 0xC7, 0xEC, 0xC8,
+0xEC, 0xE9, 0x80, 0xED, 0x09, 0x80, 0xED, 0x0A, 0x80, 0xE4, 0xE9, 0x06, 0xE4, 0xA8, 0xDC, 0x87,
+0xDC, 0x86, 0xE4, 0x44, 0xD3, 0xC1, 0xCB, 0x40, 0x92, 0x60, 0x83, 0x00, 0x00, 0x0D, 0xE4, 0x87,
+0xED, 0x0A, 0xF4, 0xA5, 0xFC, 0x20, 0xBB, 0x00, 0x49, 0x40, 0x41, 0x00, 0x49, 0x40, 0x51, 0x61,
+0x59, 0xA1, 0x61, 0xC1, 0xC4, 0x07, 0xED, 0x0A, 0x6A, 0x44, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00,
+0x0E, 0x39, 0x22, 0xED, 0x0A, 0xE4, 0xC9, 0x72, 0x01, 0x61, 0xC1, 0x59, 0xA1, 0x51, 0x61, 0x49,
+0x40, 0x41, 0x00, 0x38, 0xE0, 0x92, 0x40, 0xFC, 0x40, 0xED, 0x09, 0xED, 0x0A, 0x41, 0x41, 0x81,
+0x00, 0x00, 0x03, 0x10, 0x40, 0xCB, 0x60, 0xE4, 0x86, 0xED, 0x09, 0x8C, 0xED, 0x0A, 0x03, 0xDC,
+0xA8, 0xDC, 0x25, 0xC3, 0x40, 0x10, 0x40, 0x81, 0x00, 0x00, 0x0E, 0x49, 0x61, 0xED, 0x0A, 0xED,
+0x09, 0xFC, 0x40, 0x92, 0x40, 0x38, 0xE0, 0x41, 0x00, 0x49, 0x40, 0x51, 0x61, 0x59, 0xA1, 0x61,
+0xC1, 0x72, 0x02, 0xE4, 0xC9, 0xED, 0x0A, 0x31, 0x01, 0x81, 0x00, 0x00, 0x82, 0x00, 0x00, 0x0D,
+0xD4, 0x88, 0xED, 0x0A, 0x9B, 0x24, 0x69, 0xE1, 0x61, 0xC1, 0x59, 0xA1, 0x51, 0x61, 0x49, 0x40,
+0x41, 0x20, 0x38, 0xE0, 0xAA, 0xC0, 0xF4, 0xC6, 0xED, 0x0A, 0xBB, 0xA5, 0x80, 0x00, 0x00, 0x01,
+0x00, 0x20, 0xC4, 0x07, 0x81, 0xED, 0x0A, 0x03, 0xED, 0x09, 0xEC, 0xE8, 0xF4, 0xC7, 0xF4, 0xA5,
+0x80, 0xF4, 0x85, 0x06, 0xF4, 0x84, 0xC3, 0xA4, 0xB3, 0x63, 0xBB, 0x84, 0xC3, 0xC5, 0xCC, 0x27,
+0xDC, 0xA8, 0x81, 0xED, 0x0A, 0x01, 0xE4, 0xC9, 0xB3, 0x65, 0x81, 0x00, 0x00, 0x0D, 0xBB, 0xA5,
+0xED, 0x0A, 0xF4, 0xC6, 0xAA, 0xC0, 0x38, 0xE0, 0x41, 0x20, 0x49, 0x40, 0x51, 0x61, 0x59, 0xA1,
+0x61, 0xC1, 0x69, 0xE1, 0xA3, 0x25, 0xED, 0x0A, 0xD4, 0x88, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00,
+0x10, 0x7A, 0x84, 0xED, 0x0A, 0xE4, 0xC9, 0x82, 0x42, 0x69, 0xE1, 0x61, 0xC1, 0x59, 0xA1, 0x51,
+0x61, 0x49, 0x40, 0x41, 0x20, 0x41, 0x00, 0xF4, 0x43, 0xED, 0x0A, 0xEC, 0xE8, 0x00, 0x00, 0x20,
+0xC1, 0xE4, 0xE9, 0x80, 0xED, 0x0A, 0x01, 0xEC, 0xE8, 0xF4, 0xA6, 0x85, 0xF4, 0x84, 0x00, 0xDC,
+0x24, 0x83, 0xAB, 0x43, 0x02, 0xB3, 0x64, 0xCC, 0x06, 0xE4, 0xE9, 0x80, 0xED, 0x0A, 0x00, 0xD4,
+0x68, 0x80, 0x00, 0x00, 0x0D, 0xEC, 0xE8, 0xED, 0x0A, 0xF4, 0x43, 0x41, 0x00, 0x41, 0x20, 0x49,
+0x40, 0x51, 0x61, 0x59, 0xA1, 0x61, 0xC1, 0x69, 0xE1, 0x82, 0x62, 0xE4, 0xC9, 0xED, 0x0A, 0x7A,
+0x84, 0x82, 0x00, 0x00, 0x83, 0x00, 0x00, 0x0D, 0xCC, 0x48, 0xED, 0x0A, 0xDC, 0xA9, 0x82, 0x83,
+0x69, 0xE1, 0x61, 0xC1, 0x59, 0xA1, 0x51, 0x61, 0x49, 0x40, 0x41, 0x20, 0x9A, 0x80, 0xED, 0x09,
+0xED, 0x0A, 0x59, 0xE3, 0x80, 0xED, 0x0A, 0x03, 0xED, 0x09, 0xF4, 0xA6, 0xF4, 0x84, 0xF4, 0x64,
+0x86, 0xF4, 0x84, 0x00, 0xCB, 0xC3, 0x85, 0xAB, 0x43, 0x00, 0xCC, 0x26, 0x80, 0xED, 0x0A, 0x0E,
+0xE4, 0xC8, 0x49, 0x62, 0xED, 0x0A, 0xED, 0x09, 0x9A, 0x60, 0x41, 0x20, 0x49, 0x40, 0x51, 0x61,
+0x59, 0xA1, 0x61, 0xC1, 0x69, 0xE1, 0x82, 0x83, 0xDC, 0xA9, 0xED, 0x0A, 0xCC, 0x48, 0x83, 0x00,
+0x00, 0x83, 0x00, 0x00, 0x0B, 0x20, 0xA1, 0xDC, 0xA9, 0xED, 0x0A, 0xE4, 0xE9, 0xAB, 0x65, 0x72,
+0x01, 0x61, 0xC1, 0x59, 0xA1, 0x51, 0x61, 0x49, 0x40, 0x71, 0xC0, 0xF4, 0xC7, 0x81, 0xED, 0x0A,
+0x07, 0xEC, 0xE8, 0xEC, 0x64, 0xC3, 0xA3, 0xB3, 0x43, 0xAB, 0x43, 0xB3, 0x63, 0xD3, 0xE3, 0xF4,
+0x64, 0x84, 0xF4, 0x84, 0x00, 0xCB, 0xC3, 0x84, 0xAB, 0x43, 0x01, 0xC3, 0xA3, 0xEC, 0xA6, 0x80,
+0xED, 0x0A, 0x0D, 0xE4, 0xE9, 0xED, 0x0A, 0xF4, 0xC7, 0x69, 0xC0, 0x49, 0x40, 0x51, 0x61, 0x59,
+0xA1, 0x61, 0xC1, 0x72, 0x01, 0xAB, 0x65, 0xE4, 0xE9, 0xED, 0x0A, 0xDC, 0xA9, 0x20, 0xA1, 0x83,
+0x00, 0x00, 0x84, 0x00, 0x00, 0x01, 0x18, 0x81, 0xC4, 0x07, 0x80, 0xED, 0x0A, 0x0B, 0xDC, 0xA9,
+0xA3, 0x25, 0x72, 0x02, 0x59, 0xA1, 0x51, 0x61, 0x61, 0xA0, 0xF4, 0x85, 0xED, 0x2B, 0xED, 0x0A,
+0xED, 0x4B, 0xEC, 0xC7, 0xB3, 0x63, 0x83, 0xAB, 0x43, 0x01, 0xBB, 0x83, 0xF4, 0x64, 0x84, 0xF4,
+0x84, 0x01, 0xE4, 0x44, 0xCB, 0xC3, 0x80, 0xC3, 0xA3, 0x01, 0xCB, 0xC3, 0xE4, 0x44, 0x80, 0xF4,
+0x84, 0x0A, 0xF5, 0x08, 0xED, 0x2A, 0xED, 0x0A, 0xED, 0x4B, 0xF4, 0x84, 0x61, 0xA0, 0x51, 0x61,
+0x59, 0xA1, 0x72, 0x02, 0xA3, 0x25, 0xDC, 0xA9, 0x80, 0xED, 0x0A, 0x01, 0xC4, 0x07, 0x18, 0x81,
+0x84, 0x00, 0x00, 0x86, 0x00, 0x00, 0x01, 0x62, 0x23, 0xDC, 0xA9, 0x81, 0xED, 0x0A, 0x05, 0xCC,
+0x48, 0xB3, 0xA6, 0xAB, 0x65, 0xF4, 0xE8, 0xED, 0x0A, 0xED, 0x2B, 0x80, 0xED, 0xEF, 0x00, 0xD4,
+0x67, 0x84, 0xAB, 0x43, 0x00, 0xD3, 0xE3, 0x8B, 0xF4, 0x84, 0x08, 0xF5, 0x4A, 0xED, 0xF0, 0xED,
+0x8D, 0xED, 0x0A, 0xED, 0x2A, 0xF4, 0xE7, 0xAB, 0x65, 0xB3, 0xA6, 0xCC, 0x68, 0x81, 0xED, 0x0A,
+0x01, 0xDC, 0xA9, 0x62, 0x03, 0x86, 0x00, 0x00, 0x87, 0x00, 0x00, 0x02, 0x00, 0x20, 0x6A, 0x23,
+0xCC, 0x28, 0x82, 0xED, 0x0A, 0x02, 0xED, 0x2A, 0xED, 0x0A, 0xED, 0xAE, 0x81, 0xEE, 0x10, 0x00,
+0xDC, 0xC9, 0x83, 0xAB, 0x43, 0x00, 0xBB, 0x83, 0x83, 0xF4, 0x84, 0x00, 0xDC, 0x04, 0x80, 0xC3,
+0xA3, 0x01, 0xCB, 0xC3, 0xEC, 0x44, 0x80, 0xF4, 0x84, 0x00, 0xED, 0x6C, 0x81, 0xEE, 0x10, 0x02,
+0xED, 0x4C, 0xED, 0x0A, 0xED, 0x4B, 0x82, 0xED, 0x0A, 0x01, 0xC4, 0x28, 0x6A, 0x23, 0x88, 0x00,
+0x00, 0x8A, 0x00, 0x00, 0x05, 0x10, 0x60, 0x59, 0xE3, 0x82, 0xA4, 0xC4, 0x27, 0xED, 0x0A, 0xED,
+0x4B, 0x83, 0xEE, 0x10, 0x00, 0xD4, 0x67, 0x82, 0xAB, 0x43, 0x00, 0xB3, 0x43, 0x81, 0xF4, 0x84,
+0x01, 0xEC, 0x64, 0xBB, 0x83, 0x83, 0xAB, 0x43, 0x01, 0xDC, 0x24, 0xF5, 0x6B, 0x82, 0xEE, 0x10,
+0x00, 0xED, 0xCF, 0x80, 0xED, 0x2A, 0x03, 0xB3, 0xC6, 0x82, 0xA4, 0x59, 0xC3, 0x10, 0x60, 0x8A,
+0x00, 0x00, 0x8D, 0x00, 0x00, 0x02, 0xBC, 0x29, 0xED, 0x0A, 0xED, 0xAD, 0x84, 0xEE, 0x10, 0x00,
+0xC3, 0xC4, 0x81, 0xAB, 0x43, 0x00, 0xBB, 0x63, 0x81, 0xF4, 0x84, 0x00, 0xCB, 0xC3, 0x84, 0xAB,
+0x43, 0x00, 0xC3, 0xE5, 0x84, 0xEE, 0x10, 0x02, 0xED, 0x6C, 0xED, 0x0A, 0x9B, 0x88, 0x8D, 0x00,
+0x00, 0x8D, 0x00, 0x00, 0x80, 0xED, 0x0A, 0x00, 0xF6, 0x10, 0x84, 0xF6, 0x31, 0x01, 0xED, 0xCE,
+0xB3, 0x43, 0x80, 0xAB, 0x43, 0x00, 0xD3, 0xE3, 0x80, 0xF4, 0x84, 0x00, 0xEC, 0x64, 0x84, 0xAB,
+0x43, 0x01, 0xB3, 0x43, 0xED, 0xCE, 0x84, 0xF6, 0x31, 0x02, 0xED, 0xCE, 0xED, 0x0A, 0xDC, 0xEA,
+0x8D, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x02, 0x28, 0xE1, 0xED, 0x0A, 0xED, 0x2B, 0x86, 0xF6, 0x31,
+0x03, 0xD4, 0x67, 0xAB, 0x43, 0xBB, 0x83, 0xEC, 0x64, 0x80, 0xF4, 0x84, 0x00, 0xEC, 0x44, 0x84,
+0xAB, 0x43, 0x00, 0xD4, 0x67, 0x85, 0xF6, 0x31, 0x03, 0xF6, 0x10, 0xED, 0x0A, 0xED, 0x2A, 0x08,
+0x20, 0x8C, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x05, 0x6A, 0x45, 0xED, 0x0A, 0xED, 0x6C, 0xF6, 0x51,
+0xEE, 0x31, 0xBC, 0xEF, 0x80, 0x8C, 0x0D, 0x05, 0xAC, 0xAE, 0xEE, 0x11, 0xF6, 0x51, 0xEE, 0x10,
+0xCB, 0xE4, 0xEC, 0x64, 0x81, 0xF4, 0x84, 0x00, 0xEC, 0x64, 0x83, 0xAB, 0x43, 0x0C, 0xB3, 0x63,
+0xEE, 0x10, 0xF6, 0x51, 0xEE, 0x11, 0xAC, 0xAE, 0x8C, 0x0D, 0x94, 0x0D, 0xBC, 0xEF, 0xEE, 0x31,
+0xF6, 0x51, 0xED, 0x4B, 0xED, 0x0A, 0x41, 0x83, 0x8C, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x04, 0x8B,
+0x27, 0xED, 0x0A, 0xED, 0xAD, 0xE6, 0x11, 0x7B, 0x8D, 0x82, 0x63, 0x0C, 0x03, 0x73, 0x8D, 0xEE,
+0x31, 0xF6, 0x51, 0xF5, 0x6A, 0x83, 0xF4, 0x84, 0x00, 0xBB, 0x83, 0x82, 0xAB, 0x43, 0x03, 0xCC,
+0x47, 0xF6, 0x51, 0xEE, 0x31, 0x73, 0x8D, 0x82, 0x63, 0x0C, 0x04, 0x7B, 0x8D, 0xE6, 0x11, 0xED,
+0x6C, 0xED, 0x0A, 0x72, 0xA6, 0x8C, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x03, 0x9B, 0x88, 0xED, 0x0A,
+0xED, 0xAE, 0x8C, 0x0E, 0x82, 0x63, 0x0C, 0x04, 0x52, 0x8A, 0x94, 0x0C, 0xEE, 0x51, 0xF6, 0x51,
+0xF6, 0x30, 0x83, 0xF4, 0x84, 0x01, 0xE4, 0x44, 0xB3, 0x43, 0x81, 0xAB, 0x43, 0x04, 0xED, 0xEF,
+0xF6, 0x51, 0xEE, 0x51, 0x8B, 0xEC, 0x52, 0x8A, 0x82, 0x63, 0x0C, 0x03, 0x8C, 0x0E, 0xED, 0x8D,
+0xED, 0x0A, 0x8B, 0x27, 0x8C, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x0A, 0xA3, 0xA8, 0xED, 0x0A, 0xE5,
+0xAE, 0x63, 0x2C, 0x63, 0x0C, 0x5A, 0xCB, 0x42, 0x28, 0x29, 0x45, 0x21, 0x24, 0x31, 0x85, 0xEE,
+0x31, 0x80, 0xF6, 0x72, 0x00, 0xF5, 0x08, 0x83, 0xF4, 0x84, 0x03, 0xEC, 0x44, 0xC3, 0xA3, 0xB3,
+0x43, 0xC3, 0xC4, 0x80, 0xF6, 0x72, 0x0A, 0xE6, 0x31, 0x31, 0x85, 0x21, 0x24, 0x29, 0x45, 0x42,
+0x28, 0x5A, 0xCB, 0x63, 0x0C, 0x63, 0x2C, 0xE5, 0x6D, 0xED, 0x0A, 0x8B, 0x47, 0x8C, 0x00, 0x00,
+0x8C, 0x00, 0x00, 0x04, 0x9B, 0x88, 0xED, 0x0A, 0xED, 0x8E, 0x6B, 0x2B, 0x31, 0xA6, 0x83, 0x21,
+0x24, 0x00, 0xB4, 0xCE, 0x80, 0xF6, 0x72, 0x00, 0xF5, 0xAC, 0x86, 0xF4, 0x84, 0x00, 0xF5, 0x8C,
+0x80, 0xF6, 0x72, 0x00, 0xB4, 0xCE, 0x83, 0x21, 0x24, 0x04, 0x39, 0xA6, 0x6B, 0x2B, 0xED, 0x6D,
+0xED, 0x0A, 0x8B, 0x47, 0x8C, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x04, 0x7A, 0xE6, 0xB3, 0xE8, 0x6A,
+0xC7, 0x6B, 0x09, 0x4A, 0x27, 0x83, 0x21, 0x24, 0x00, 0x93, 0xEB, 0x80, 0xF6, 0x92, 0x00, 0xF6,
+0x0F, 0x86, 0xF4, 0x84, 0x00, 0xF6, 0x0F, 0x80, 0xF6, 0x92, 0x00, 0x8B, 0xEB, 0x83, 0x21, 0x24,
+0x04, 0x4A, 0x27, 0x6B, 0x09, 0x6A, 0xC7, 0xB4, 0x08, 0x6A, 0x85, 0x8C, 0x00, 0x00, 0x8C, 0x00,
+0x00, 0x04, 0x49, 0xA3, 0xED, 0x0A, 0xED, 0x6C, 0xF6, 0x92, 0x9C, 0x2C, 0x83, 0x21, 0x24, 0x00,
+0xA4, 0x6D, 0x80, 0xF6, 0x92, 0x00, 0xF6, 0x71, 0x86, 0xF4, 0x84, 0x00, 0xF6, 0x71, 0x80, 0xF6,
+0x92, 0x00, 0x9C, 0x4C, 0x83, 0x21, 0x24, 0x04, 0x9C, 0x4C, 0xF6, 0x92, 0xED, 0x4B, 0xED, 0x0A,
+0x31, 0x43, 0x8C, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x05, 0x08, 0x40, 0xED, 0x2A, 0xED, 0x0A, 0xF6,
+0x72, 0xEE, 0x72, 0x4A, 0x47, 0x81, 0x21, 0x24, 0x01, 0x29, 0x45, 0xDE, 0x11, 0x80, 0xF6, 0x93,
+0x00, 0xF6, 0x72, 0x86, 0xF4, 0x84, 0x00, 0xF6, 0x72, 0x80, 0xF6, 0x93, 0x01, 0xDD, 0xF1, 0x29,
+0x45, 0x81, 0x21, 0x24, 0x04, 0x52, 0x47, 0xF6, 0x92, 0xF6, 0x72, 0xED, 0x0A, 0xED, 0x2A, 0x8D,
+0x00, 0x00, 0x8D, 0x00, 0x00, 0x08, 0xDC, 0xEB, 0xED, 0x0A, 0xF6, 0x10, 0xF6, 0xB3, 0xEE, 0x52,
+0x73, 0x2A, 0x29, 0x45, 0x31, 0xA5, 0xAC, 0xCE, 0x81, 0xF6, 0xB3, 0x00, 0xF6, 0x0E, 0x86, 0xF4,
+0x84, 0x00, 0xF6, 0x2F, 0x81, 0xF6, 0xB3, 0x08, 0xAC, 0xAE, 0x31, 0x85, 0x29, 0x45, 0x73, 0x4A,
+0xEE, 0x52, 0xF6, 0xB3, 0xF6, 0x0F, 0xED, 0x0A, 0xD4, 0xCB, 0x8D, 0x00, 0x00, 0x8D, 0x00, 0x00,
+0x02, 0x9B, 0xA8, 0xED, 0x0A, 0xF5, 0xAD, 0x87, 0xF6, 0xB3, 0x00, 0xF4, 0xE6, 0x86, 0xF4, 0x84,
+0x00, 0xF5, 0x08, 0x87, 0xF6, 0xB3, 0x02, 0xF5, 0x8D, 0xED, 0x0A, 0x93, 0x88, 0x8D, 0x00, 0x00,
+0x8D, 0x00, 0x00, 0x02, 0x29, 0x02, 0xED, 0x0A, 0xED, 0x2A, 0x86, 0xF6, 0xB3, 0x00, 0xF6, 0x2F,
+0x88, 0xF4, 0x84, 0x00, 0xF6, 0x50, 0x86, 0xF6, 0xB3, 0x80, 0xED, 0x2A, 0x00, 0x28, 0xE2, 0x8D,
+0x00, 0x00, 0x8E, 0x00, 0x00, 0x02, 0xDD, 0x0B, 0xED, 0x0A, 0xF6, 0x10, 0x85, 0xF6, 0xD3, 0x00,
+0xF4, 0xC6, 0x88, 0xF4, 0x84, 0x00, 0xF4, 0xC6, 0x85, 0xF6, 0xD3, 0x02, 0xF6, 0x30, 0xED, 0x0A,
+0xDD, 0x0B, 0x8E, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x02, 0x93, 0xA9, 0xED, 0x0A, 0xED, 0x6C, 0x84,
+0xF6, 0xD3, 0x00, 0xF5, 0xCD, 0x8A, 0xF4, 0x64, 0x00, 0xF5, 0xEE, 0x84, 0xF6, 0xD3, 0x02, 0xF5,
+0xAD, 0xED, 0x0A, 0x93, 0x68, 0x8E, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x03, 0x18, 0xA2, 0xED, 0x2A,
+0xED, 0x0A, 0xF6, 0x92, 0x82, 0xF6, 0xD4, 0x01, 0xF6, 0xB3, 0xF4, 0xA5, 0x8A, 0xF4, 0x64, 0x01,
+0xF4, 0xA5, 0xF6, 0xD3, 0x82, 0xF6, 0xD4, 0x03, 0xF6, 0xB3, 0xED, 0x2A, 0xED, 0x0A, 0x18, 0xA1,
+0x8E, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x02, 0xE5, 0x4C, 0xED, 0x0A, 0xF5, 0xCE, 0x82, 0xF6, 0xF4,
+0x00, 0xF5, 0x8C, 0x8C, 0xEC, 0x64, 0x00, 0xF5, 0xAC, 0x82, 0xF6, 0xF4, 0x02, 0xF6, 0x30, 0xED,
+0x0A, 0xD4, 0xCA, 0x8F, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x03, 0x7B, 0x08, 0xED, 0x0A, 0xED, 0x2B,
+0xF6, 0xD4, 0x80, 0xF6, 0xF4, 0x01, 0xF6, 0xD3, 0xEC, 0x64, 0x8C, 0xEC, 0x44, 0x01, 0xEC, 0x85,
+0xF6, 0xD3, 0x81, 0xF6, 0xF4, 0x02, 0xED, 0x6C, 0xED, 0x0A, 0x72, 0xA6, 0x8F, 0x00, 0x00, 0x90,
+0x00, 0x00, 0x02, 0xED, 0x4C, 0xED, 0x0A, 0xF6, 0x30, 0x80, 0xF6, 0xF4, 0x00, 0xF5, 0xAC, 0x8E,
+0xEC, 0x44, 0x00, 0xF5, 0xAC, 0x80, 0xF6, 0xF4, 0x03, 0xF6, 0x92, 0xED, 0x0A, 0xED, 0x2A, 0x00,
+0x20, 0x8F, 0x00, 0x00, 0x90, 0x00, 0x00, 0x05, 0xBC, 0x8C, 0xED, 0x0A, 0xED, 0x6C, 0xF7, 0x14,
+0xF6, 0xF4, 0xEC, 0x65, 0x8E, 0xEC, 0x23, 0x05, 0xEC, 0x65, 0xF6, 0xF4, 0xF7, 0x14, 0xF5, 0xCE,
+0xED, 0x0A, 0xAC, 0x09, 0x90, 0x00, 0x00, 0x90, 0x00, 0x00, 0x04, 0x18, 0xC2, 0xED, 0x2B, 0xED,
+0x0A, 0xF6, 0x92, 0xF6, 0x2F, 0x90, 0xE4, 0x23, 0x04, 0xF6, 0x0F, 0xF6, 0xF4, 0xED, 0x2B, 0xED,
+0x0A, 0x29, 0x02, 0x90, 0x00, 0x00, 0x91, 0x00, 0x00, 0x03, 0xBC, 0x8B, 0xED, 0x0A, 0xF5, 0xAD,
+0xED, 0x2A, 0x81, 0xE4, 0x03, 0x01, 0xE3, 0xE3, 0xB3, 0x44, 0x86, 0xE4, 0x03, 0x01, 0xB3, 0x44,
+0xE3, 0xE3, 0x81, 0xE4, 0x03, 0x03, 0xED, 0x09, 0xF6, 0x30, 0xED, 0x0A, 0xD4, 0xCA, 0x91, 0x00,
+0x00, 0x91, 0x00, 0x00, 0x03, 0x21, 0x02, 0xED, 0x2B, 0xED, 0x0A, 0xE4, 0x86, 0x81, 0xE3, 0xE3,
+0x03, 0xC3, 0x83, 0x49, 0xA5, 0x72, 0x45, 0xDB, 0xE3, 0x82, 0xE3, 0xE3, 0x03, 0xDB, 0xE3, 0x72,
+0x25, 0x49, 0xA5, 0xC3, 0x83, 0x81, 0xE3, 0xE3, 0x03, 0xE4, 0x24, 0xED, 0x4B, 0xED, 0x0A, 0x51,
+0xE4, 0x91, 0x00, 0x00, 0x92, 0x00, 0x00, 0x02, 0xCC, 0xEB, 0xED, 0x0A, 0xEC, 0xA8, 0x81, 0xE3,
+0xE3, 0x03, 0xDB, 0xE3, 0x59, 0xE5, 0x49, 0xA5, 0x82, 0x64, 0x82, 0xE3, 0xE3, 0x03, 0x82, 0x64,
+0x49, 0xA5, 0x59, 0xE5, 0xDB, 0xE3, 0x81, 0xE3, 0xE3, 0x02, 0xE4, 0x46, 0xED, 0x0A, 0xDD, 0x0B,
+0x92, 0x00, 0x00, 0x92, 0x00, 0x00, 0x03, 0x39, 0xA4, 0xED, 0x2A, 0xED, 0x0A, 0xDB, 0xE4, 0x81,
+0xDB, 0xC2, 0x00, 0xA2, 0xE4, 0x80, 0x49, 0xA5, 0x00, 0xAB, 0x03, 0x80, 0xDB, 0xC2, 0x00, 0xAB,
+0x03, 0x80, 0x49, 0xA5, 0x00, 0xA2, 0xE3, 0x82, 0xDB, 0xC2, 0x02, 0xEC, 0xE9, 0xED, 0x0A, 0x72,
+0xA6, 0x92, 0x00, 0x00, 0x93, 0x00, 0x00, 0x02, 0xDC, 0xEA, 0xED, 0x0A, 0xE4, 0x87, 0x81, 0xDB,
+0xA2, 0x03, 0xD3, 0x82, 0x72, 0x24, 0x49, 0xA5, 0x6A, 0x05, 0x80, 0xDB, 0xA2, 0x03, 0x6A, 0x05,
+0x49, 0xA5, 0x72, 0x24, 0xD3, 0x82, 0x81, 0xDB, 0xA2, 0x00, 0xDC, 0x04, 0x80, 0xED, 0x0A, 0x93,
+0x00, 0x00, 0x93, 0x00, 0x00, 0x02, 0x82, 0xC5, 0xED, 0x0A, 0xEC, 0xC8, 0x82, 0xD3, 0x82, 0x02,
+0xCB, 0x62, 0x6A, 0x04, 0x49, 0xA5, 0x80, 0xCB, 0x62, 0x02, 0x49, 0xA5, 0x6A, 0x04, 0xCB, 0x62,
+0x82, 0xD3, 0x82, 0x02, 0xDC, 0x25, 0xED, 0x0A, 0xB3, 0xC7, 0x93, 0x00, 0x00, 0x93, 0x00, 0x00,
+0x02, 0x61, 0xE2, 0xED, 0x0A, 0xE4, 0xA8, 0x83, 0xD3, 0x61, 0x01, 0xD3, 0x62, 0xB2, 0xE2, 0x80,
+0xD3, 0x61, 0x01, 0xB2, 0xE2, 0xD3, 0x62, 0x83, 0xD3, 0x61, 0x02, 0xDC, 0x25, 0xED, 0x0A, 0x93,
+0x05, 0x93, 0x00, 0x00, 0x93, 0x00, 0x00, 0x02, 0x41, 0x62, 0xED, 0x0A, 0xEC, 0xC9, 0x8E, 0xCB,
+0x41, 0x02, 0xDC, 0x26, 0xED, 0x0A, 0x7A, 0xA5, 0x93, 0x00, 0x00, 0x93, 0x00, 0x00, 0x02, 0x18,
+0x80, 0xED, 0x0A, 0xEC, 0xE9, 0x8E, 0xCB, 0x21, 0x02, 0xE4, 0x87, 0xED, 0x0A, 0x51, 0xC3, 0x93,
+0x00, 0x00, 0x94, 0x00, 0x00, 0x02, 0xDC, 0xA9, 0xED, 0x0A, 0xCB, 0x83, 0x8C, 0xC2, 0xE0, 0x00,
+0xC3, 0x01, 0x80, 0xED, 0x0A, 0x00, 0x18, 0x81, 0x93, 0x00, 0x00, 0x94, 0x00, 0x00, 0x02, 0x8A,
+0xE6, 0xED, 0x0A, 0xDC, 0x47, 0x8C, 0xC2, 0xC0, 0x02, 0xD3, 0xE6, 0xED, 0x0A, 0xB3, 0xC7, 0x94,
+0x00, 0x00, 0x94, 0x00, 0x00, 0x06, 0x20, 0xA1, 0xEC, 0xEA, 0xED, 0x0A, 0x9B, 0x26, 0x8A, 0x42,
+0xA2, 0x81, 0xB2, 0xA0, 0x84, 0xBA, 0xA0, 0x03, 0xB2, 0x80, 0x9A, 0x61, 0x8A, 0x42, 0x7A, 0xC6,
+0x80, 0xED, 0x0A, 0x00, 0x39, 0x42, 0x94, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x6A, 0x44, 0x80,
+0xED, 0x0A, 0x00, 0x93, 0x68, 0x80, 0x39, 0xC7, 0x00, 0x39, 0xC6, 0x82, 0x41, 0xC6, 0x00, 0x39,
+0xC6, 0x80, 0x39, 0xC7, 0x03, 0x6A, 0xA7, 0xE4, 0xEA, 0xED, 0x0A, 0x8B, 0x06, 0x95, 0x00, 0x00,
+0x96, 0x00, 0x00, 0x00, 0x7A, 0xA5, 0x80, 0xED, 0x0A, 0x01, 0xB4, 0x09, 0x41, 0xE7, 0x85, 0x39,
+0xC7, 0x00, 0x7B, 0x08, 0x80, 0xED, 0x0A, 0x00, 0x9B, 0x67, 0x96, 0x00, 0x00, 0x97, 0x00, 0x00,
+0x04, 0x49, 0x83, 0xDC, 0xC9, 0xED, 0x0A, 0xD4, 0xA9, 0x72, 0xC8, 0x82, 0x39, 0xC7, 0x01, 0x52,
+0x47, 0xB4, 0x09, 0x80, 0xED, 0x0A, 0x00, 0x7A, 0xA5, 0x97, 0x00, 0x00, 0x98, 0x00, 0x00, 0x01,
+0x20, 0xC1, 0xC4, 0x48, 0x80, 0xED, 0x0A, 0x00, 0xE4, 0xEA, 0x80, 0xC4, 0x49, 0x00, 0xD4, 0xAA,
+0x80, 0xED, 0x0A, 0x01, 0xE4, 0xEA, 0x5A, 0x04, 0x98, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x01, 0x62,
+0x04, 0xBC, 0x08, 0x82, 0xED, 0x0A, 0x02, 0xDC, 0xA9, 0x82, 0xE5, 0x18, 0x81, 0x99, 0x00, 0x00,
+0x9C, 0x00, 0x00, 0x03, 0x10, 0x60, 0x31, 0x02, 0x39, 0x22, 0x18, 0xA1, 0x9C, 0x00, 0x00, 0xBE,
+0x00, 0x00,
+};
+static const uint16_t STATUS_WAKING_UP_PACKED_ROWS[128] PROGMEM = {
+0x0000, 0x000D, 0x002C, 0x004F, 0x00B0, 0x010F, 0x0174, 0x01D3, 0x0230, 0x028B, 0x02EA, 0x034F, 0x03B2, 0x03DB, 0x03F2, 0x0401,
+0x043A, 0x0485, 0x04CA, 0x0509, 0x054E, 0x0599, 0x0608, 0x0653, 0x06A7, 0x0710, 0x0773, 0x07C4, 0x07F7, 0x081E, 0x085D, 0x08A8,
+0x08AB, 0x08AE, 0x08E7, 0x0932, 0x0977, 0x09B6, 0x09FB, 0x0A46, 0x0AB5, 0x0B00, 0x0B54, 0x0BBD, 0x0C20, 0x0C71, 0x0CA4, 0x0CCB,
+0x0D0A, 0x0D55, 0x0D58, 0x0D5B, 0x0D94, 0x0DDF, 0x0E24, 0x0E63, 0x0EA8, 0x0EF3, 0x0F62, 0x0FAD, 0x1001, 0x106A, 0x10CD, 0x111E,
+0x1151, 0x1154, 0x116B, 0x118A, 0x11B5, 0x11E0, 0x1207, 0x1246, 0x129B, 0x12F0, 0x1353, 0x13B2, 0x1415, 0x1480, 0x14ED, 0x154C,
+0x15BD, 0x1624, 0x1681, 0x16E2, 0x1743, 0x1788, 0x17D1, 0x1812, 0x1841, 0x1873, 0x18A4, 0x18EB, 0x1928, 0x1967, 0x19B0, 0x19E7,
+0x1A1E, 0x1A55, 0x1A92, 0x1ACD, 0x1AF0, 0x1B12, 0x1B35, 0x1B58, 0x1B83, 0x1BA6, 0x1BCF, 0x1BF4, 0x1C17, 0x1C36, 0x1C61, 0x1C94,
+0x1CC3, 0x1CF4, 0x1D22, 0x1D4D, 0x1D74, 0x1D8B, 0x1DA2, 0x1DBB, 0x1DD2, 0x1DF9, 0x1E20, 0x1E3D, 0x1E5C, 0x1E7B, 0x1E90, 0x1E9F,
+};
+const PackedImage STATUS_WAKING_UP_PACKED = { 64, 128, PackedImage::Rle565, 0, 7842, nullptr, STATUS_WAKING_UP_PACKED_ROWS, STATUS_WAKING_UP_PACKED_DATA };
+
+// STATUS_AWAKE: 64x128 rle565, 4282 bytes of flash
+static const uint8_t STATUS_AWAKE_PACKED_DATA[4026] PROGMEM = {
+0x9A, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x60, 0x00, 0x80, 0x84, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x01, 0x60, 0x00, 0x80, 0x96, 0x00, 0x00, 0x81, 0x00, 0x00, 0x02, 0x02, 0x60, 0x02, 0xA0, 0x00,
+0xE0, 0x81, 0x00, 0x00, 0x02, 0x02, 0x60, 0x02, 0xA0, 0x01, 0x00, 0x81, 0x00, 0x00, 0x02, 0x02,
+0x20, 0x02, 0xA0, 0x01, 0x00, 0x88, 0x00, 0x00, 0x02, 0x02, 0xE0, 0x03, 0xE0, 0x01, 0x60, 0x84,
+0x00, 0x00, 0x02, 0x02, 0xE0, 0x03, 0xE0, 0x01, 0x60, 0x96, 0x00, 0x00, 0x81, 0x00, 0x00, 0x02,
+0x02, 0xA0, 0x03, 0xE0, 0x01, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x60, 0x80, 0x03, 0xE0, 0x00,
+0x02, 0x60, 0x81, 0x00, 0x00, 0x02, 0x03, 0xC0, 0x03, 0xE0, 0x00, 0xC0, 0x88, 0x00, 0x00, 0x02,
+0x02, 0xE0, 0x03, 0xE0, 0x01, 0x60, 0x84, 0x00, 0x00, 0x02, 0x02, 0xE0, 0x03, 0xE0, 0x01, 0x60,
+0x96, 0x00, 0x00, 0x81, 0x00, 0x00, 0x02, 0x01, 0xA0, 0x03, 0xE0, 0x02, 0xC0, 0x80, 0x00, 0x00,
+0x00, 0x01, 0x60, 0x80, 0x03, 0xE0, 0x00, 0x03, 0x60, 0x80, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03,
+0xE0, 0x03, 0xA0, 0x81, 0x00, 0x00, 0x03, 0x00, 0x20, 0x01, 0x20, 0x01, 0x40, 0x01, 0x20, 0x82,
+0x00, 0x00, 0x02, 0x02, 0xE0, 0x03, 0xE0, 0x01, 0x60, 0x80, 0x00, 0x00, 0x00, 0x00, 0x60, 0x80,
+0x00, 0xE0, 0x03, 0x00, 0x00, 0x02, 0xE0, 0x03, 0xE0, 0x01, 0x60, 0x80, 0x00, 0x00, 0x00, 0x00,
+0x60, 0x80, 0x00, 0xE0, 0x81, 0x00, 0x00, 0x02, 0x00, 0xC0, 0x01, 0x40, 0x01, 0x00, 0x82, 0x00,
+0x00, 0x05, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x40, 0x01, 0x20, 0x00, 0x80, 0x81, 0x00,
+0x00, 0x81, 0x00, 0x00, 0x02, 0x00, 0xA0, 0x03, 0xE0, 0x03, 0xC0, 0x80, 0x00, 0x00, 0x08, 0x02,
+0x80, 0x03, 0xE0, 0x03, 0x00, 0x03, 0xE0, 0x00, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x03, 0xE0, 0x02,
+0x80, 0x80, 0x00, 0x00, 0x01, 0x01, 0x40, 0x03, 0xC0, 0x81, 0x03, 0xE0, 0x01, 0x03, 0x80, 0x00,
+0xE0, 0x80, 0x00, 0x00, 0x13, 0x02, 0xE0, 0x03, 0xE0, 0x01, 0x60, 0x00, 0x00, 0x00, 0x80, 0x03,
+0x80, 0x03, 0xE0, 0x01, 0xC0, 0x00, 0x00, 0x02, 0xE0, 0x03, 0xE0, 0x01, 0x60, 0x00, 0x00, 0x00,
+0x80, 0x03, 0x80, 0x03, 0xE0, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x60, 0x03, 0x20, 0x81, 0x03, 0xE0,
+0x01, 0x03, 0x60, 0x00, 0xA0, 0x80, 0x00, 0x00, 0x05, 0x02, 0xE0, 0x03, 0xC0, 0x00, 0xC0, 0x03,
+0x80, 0x03, 0xE0, 0x01, 0x80, 0x81, 0x00, 0x00, 0x82, 0x00, 0x00, 0x0C, 0x03, 0x80, 0x03, 0xE0,
+0x00, 0xC0, 0x00, 0x00, 0x03, 0x80, 0x03, 0xC0, 0x01, 0xA0, 0x03, 0xE0, 0x01, 0x80, 0x00, 0x00,
+0x02, 0xA0, 0x03, 0xE0, 0x01, 0xA0, 0x80, 0x00, 0x00, 0x06, 0x00, 0x60, 0x02, 0xC0, 0x01, 0x80,
+0x01, 0x40, 0x02, 0xC0, 0x03, 0xE0, 0x03, 0x00, 0x80, 0x00, 0x00, 0x06, 0x02, 0xE0, 0x03, 0xE0,
+0x01, 0x60, 0x00, 0x60, 0x03, 0x60, 0x03, 0xE0, 0x02, 0x00, 0x80, 0x00, 0x00, 0x06, 0x02, 0xE0,
+0x03, 0xE0, 0x01, 0x60, 0x00, 0x60, 0x03, 0x60, 0x03, 0xE0, 0x02, 0x00, 0x80, 0x00, 0x00, 0x06,
+0x02, 0xE0, 0x03, 0xE0, 0x02, 0xA0, 0x01, 0x20, 0x02, 0x20, 0x03, 0xE0, 0x03, 0x20, 0x80, 0x00,
+0x00, 0x01, 0x02, 0xE0, 0x03, 0xE0, 0x80, 0x03, 0xC0, 0x01, 0x02, 0xC0, 0x00, 0xE0, 0x81, 0x00,
+0x00, 0x82, 0x00, 0x00, 0x0C, 0x02, 0x80, 0x03, 0xE0, 0x01, 0xA0, 0x00, 0xA0, 0x03, 0xE0, 0x02,
+0xA0, 0x00, 0xE0, 0x03, 0xE0, 0x02, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xE0, 0x00, 0xA0, 0x84,
+0x00, 0x00, 0x02, 0x01, 0x40, 0x03, 0xE0, 0x03, 0xA0, 0x80, 0x00, 0x00, 0x05, 0x02, 0xE0, 0x03,
+0xE0, 0x01, 0x80, 0x03, 0x20, 0x03, 0xE0, 0x02, 0x60, 0x81, 0x00, 0x00, 0x05, 0x02, 0xE0, 0x03,
+0xE0, 0x01, 0x80, 0x03, 0x20, 0x03, 0xE0, 0x02, 0x60, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80,
+0x03, 0xE0, 0x00, 0x00, 0x40, 0x80, 0x00, 0x00, 0x07, 0x03, 0xC0, 0x03, 0xE0, 0x00, 0x80, 0x00,
+0x00, 0x02, 0xE0, 0x03, 0xE0, 0x03, 0x20, 0x00, 0x20, 0x83, 0x00, 0x00, 0x82, 0x00, 0x00, 0x0B,
+0x01, 0x80, 0x03, 0xE0, 0x02, 0x80, 0x01, 0x80, 0x03, 0xE0, 0x01, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+0x03, 0xA0, 0x00, 0xA0, 0x03, 0xE0, 0x03, 0x80, 0x81, 0x00, 0x00, 0x02, 0x01, 0x20, 0x03, 0x00,
+0x03, 0xC0, 0x81, 0x03, 0xE0, 0x00, 0x03, 0xA0, 0x80, 0x00, 0x00, 0x02, 0x02, 0xE0, 0x03, 0xE0,
+0x03, 0x60, 0x80, 0x03, 0xE0, 0x00, 0x00, 0x40, 0x81, 0x00, 0x00, 0x02, 0x02, 0xE0, 0x03, 0xE0,
+0x03, 0x60, 0x80, 0x03, 0xE0, 0x00, 0x00, 0x40, 0x80, 0x00, 0x00, 0x00, 0x01, 0x20, 0x85, 0x03,
+0xE0, 0x04, 0x01, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x03, 0xE0, 0x01, 0x80, 0x84, 0x00, 0x00, 0x82,
+0x00, 0x00, 0x0B, 0x00, 0xA0, 0x03, 0xE0, 0x03, 0x60, 0x02, 0x80, 0x03, 0xE0, 0x00, 0xC0, 0x00,
+0x00, 0x02, 0xA0, 0x03, 0xE0, 0x01, 0xE0, 0x03, 0xE0, 0x02, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
+0xA0, 0x80, 0x03, 0xE0, 0x04, 0x02, 0x20, 0x01, 0x20, 0x01, 0xE0, 0x03, 0xE0, 0x03, 0xA0, 0x80,
+0x00, 0x00, 0x00, 0x02, 0xE0, 0x80, 0x03, 0xE0, 0x02, 0x03, 0x60, 0x03, 0xE0, 0x02, 0xA0, 0x81,
+0x00, 0x00, 0x00, 0x02, 0xE0, 0x80, 0x03, 0xE0, 0x02, 0x03, 0x60, 0x03, 0xE0, 0x02, 0xA0, 0x80,
+0x00, 0x00, 0x02, 0x01, 0x20, 0x03, 0xE0, 0x03, 0xC0, 0x83, 0x01, 0x80, 0x04, 0x00, 0x60, 0x00,
+0x00, 0x02, 0xE0, 0x03, 0xE0, 0x01, 0x60, 0x84, 0x00, 0x00, 0x83, 0x00, 0x00, 0x03, 0x03, 0x80,
+0x03, 0xE0, 0x03, 0x20, 0x03, 0xC0, 0x80, 0x00, 0x00, 0x04, 0x01, 0xA0, 0x03, 0xE0, 0x03, 0x80,
+0x03, 0xE0, 0x01, 0x80, 0x80, 0x00, 0x00, 0x02, 0x01, 0x60, 0x03, 0xE0, 0x03, 0xC0, 0x80, 0x00,
+0x00, 0x02, 0x01, 0xA0, 0x03, 0xE0, 0x03, 0xA0, 0x80, 0x00, 0x00, 0x06, 0x02, 0xE0, 0x03, 0xE0,
+0x01, 0xE0, 0x00, 0x60, 0x03, 0xA0, 0x03, 0xE0, 0x01, 0xA0, 0x80, 0x00, 0x00, 0x08, 0x02, 0xE0,
+0x03, 0xE0, 0x01, 0xE0, 0x00, 0x60, 0x03, 0xA0, 0x03, 0xE0, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x60,
+0x80, 0x03, 0xE0, 0x00, 0x00, 0xC0, 0x84, 0x00, 0x00, 0x02, 0x02, 0xE0, 0x03, 0xE0, 0x01, 0x60,
+0x84, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x02, 0x80, 0x80, 0x03, 0xE0, 0x00, 0x02, 0xA0, 0x80,
+0x00, 0x00, 0x00, 0x00, 0xC0, 0x81, 0x03, 0xE0, 0x00, 0x00, 0xA0, 0x80, 0x00, 0x00, 0x00, 0x00,
+0xE0, 0x80, 0x03, 0xE0, 0x04, 0x02, 0x60, 0x02, 0x20, 0x03, 0xA0, 0x03, 0xE0, 0x03, 0xA0, 0x80,
+0x00, 0x00, 0x16, 0x02, 0xE0, 0x03, 0xE0, 0x01, 0x60, 0x00, 0x00, 0x01, 0x40, 0x03, 0xE0, 0x03,
+0xC0, 0x00, 0xC0, 0x00, 0x00, 0x02, 0xE0, 0x03, 0xE0, 0x01, 0x60, 0x00, 0x00, 0x01, 0x40, 0x03,
+0xE0, 0x03, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x02, 0x60, 0x03, 0xE0, 0x03, 0x80, 0x02, 0x60, 0x02,
+0x40, 0x80, 0x02, 0xA0, 0x80, 0x00, 0x00, 0x02, 0x02, 0xE0, 0x03, 0xE0, 0x01, 0x60, 0x84, 0x00,
+0x00, 0x83, 0x00, 0x00, 0x00, 0x01, 0x60, 0x80, 0x03, 0xE0, 0x00, 0x01, 0xA0, 0x81, 0x00, 0x00,
+0x02, 0x03, 0xA0, 0x03, 0xE0, 0x03, 0x80, 0x82, 0x00, 0x00, 0x00, 0x02, 0x40, 0x80, 0x03, 0xE0,
+0x03, 0x03, 0x80, 0x01, 0x20, 0x03, 0x20, 0x03, 0xA0, 0x80, 0x00, 0x00, 0x02, 0x02, 0xE0, 0x03,
+0xE0, 0x01, 0x60, 0x80, 0x00, 0x00, 0x06, 0x02, 0x60, 0x03, 0xE0, 0x03, 0x40, 0x00, 0x20, 0x02,
+0xE0, 0x03, 0xE0, 0x01, 0x60, 0x80, 0x00, 0x00, 0x06, 0x02, 0x60, 0x03, 0xE0, 0x03, 0x40, 0x00,
+0x20, 0x00, 0x00, 0x02, 0x20, 0x03, 0xC0, 0x80, 0x03, 0xE0, 0x01, 0x03, 0xC0, 0x01, 0xE0, 0x80,
+0x00, 0x00, 0x02, 0x02, 0xE0, 0x03, 0xE0, 0x01, 0x60, 0x84, 0x00, 0x00, 0x92, 0x00, 0x00, 0x80,
+0x00, 0x20, 0x99, 0x00, 0x00, 0x80, 0x00, 0x20, 0x8B, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00,
+0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00,
+0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE,
+0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00,
+0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00,
+0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE,
+0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00,
+0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00,
+0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE,
+0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00,
+0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00,
+0xBE, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x07, 0x09, 0x23, 0x22, 0x46, 0x22, 0xE7, 0x2B, 0x48, 0x2B,
+0x28, 0x22, 0xC7, 0x19, 0xE5, 0x08, 0xA1, 0x90, 0x00, 0x00, 0x08, 0x00, 0x20, 0x11, 0x23, 0x22,
+0x66, 0x22, 0xE7, 0x2B, 0x48, 0x2B, 0x28, 0x22, 0xA7, 0x19, 0xC4, 0x00, 0x81, 0x8C, 0x00, 0x00,
+0x8B, 0x00, 0x00, 0x01, 0x19, 0xC4, 0x33, 0xEA, 0x80, 0x3C, 0x2B, 0x03, 0x4C, 0x8C, 0x54, 0xCC,
+0x54, 0xAC, 0x44, 0x6B, 0x80, 0x3C, 0x2B, 0x01, 0x2B, 0x48, 0x08, 0xE2, 0x8C, 0x00, 0x00, 0x02,
+0x00, 0x20, 0x19, 0xE5, 0x33, 0xEA, 0x80, 0x3C, 0x2B, 0x03, 0x4C, 0x8C, 0x54, 0xCC, 0x54, 0xAC,
+0x44, 0x6B, 0x80, 0x3C, 0x2B, 0x01, 0x2B, 0x08, 0x08, 0xC2, 0x8A, 0x00, 0x00, 0x89, 0x00, 0x00,
+0x05, 0x00, 0x81, 0x2B, 0x69, 0x3C, 0x2B, 0x54, 0xCC, 0x7D, 0xCF, 0x9E, 0x71, 0x82, 0x9E, 0x91,
+0x04, 0x96, 0x51, 0x75, 0x8E, 0x44, 0x4B, 0x3C, 0x2B, 0x1A, 0x46, 0x8A, 0x00, 0x00, 0x05, 0x08,
+0xA1, 0x33, 0xA9, 0x3C, 0x2B, 0x54, 0xCD, 0x85, 0xEF, 0x9E, 0x71, 0x82, 0x9E, 0x91, 0x04, 0x8E,
+0x30, 0x6D, 0x6E, 0x3C, 0x4B, 0x3C, 0x2A, 0x1A, 0x05, 0x89, 0x00, 0x00, 0x88, 0x00, 0x00, 0x03,
+0x08, 0xA2, 0x33, 0xEA, 0x3C, 0x2B, 0x7D, 0xCF, 0x87, 0x9E, 0x71, 0x03, 0x96, 0x71, 0x65, 0x2D,
+0x3C, 0x2B, 0x2A, 0xE7, 0x88, 0x00, 0x00, 0x03, 0x08, 0xE2, 0x33, 0xEA, 0x44, 0x4B, 0x85, 0xEF,
+0x87, 0x9E, 0x71, 0x03, 0x96, 0x51, 0x5C, 0xED, 0x3C, 0x2B, 0x22, 0xA6, 0x88, 0x00, 0x00, 0x87,
+0x00, 0x00, 0x03, 0x00, 0x41, 0x33, 0xA9, 0x44, 0x4B, 0x8E, 0x10, 0x8A, 0x9E, 0x71, 0x02, 0x75,
+0x6E, 0x3C, 0x2B, 0x22, 0x66, 0x86, 0x00, 0x00, 0x03, 0x00, 0x81, 0x33, 0xEA, 0x44, 0x6B, 0x8E,
+0x30, 0x8A, 0x9E, 0x71, 0x02, 0x6D, 0x4E, 0x3C, 0x2B, 0x1A, 0x05, 0x87, 0x00, 0x00, 0x87, 0x00,
+0x00, 0x02, 0x22, 0xC7, 0x3C, 0x2B, 0x85, 0xF0, 0x83, 0x96, 0x71, 0x03, 0xA6, 0x92, 0xB6, 0xD4,
+0xB6, 0xD5, 0xA6, 0xB3, 0x83, 0x96, 0x71, 0x02, 0x65, 0x2D, 0x3C, 0x2B, 0x11, 0x23, 0x85, 0x00,
+0x00, 0x02, 0x2B, 0x28, 0x3C, 0x2B, 0x8E, 0x10, 0x82, 0x96, 0x71, 0x04, 0x9E, 0x71, 0xAE, 0xB4,
+0xB6, 0xD5, 0xAE, 0xB4, 0x9E, 0x71, 0x83, 0x96, 0x71, 0x02, 0x5D, 0x0D, 0x3C, 0x2A, 0x08, 0xC2,
+0x86, 0x00, 0x00, 0x86, 0x00, 0x00, 0x02, 0x08, 0xE2, 0x3C, 0x2B, 0x65, 0x4E, 0x82, 0x96, 0x51,
+0x01, 0xAE, 0xB4, 0xE7, 0x9C, 0x82, 0xFF, 0xFF, 0x01, 0xEF, 0xBD, 0xB6, 0xF5, 0x82, 0x96, 0x51,
+0x01, 0x44, 0x6B, 0x33, 0x69, 0x84, 0x00, 0x00, 0x02, 0x11, 0x23, 0x3C, 0x2B, 0x6D, 0x6E, 0x81,
+0x96, 0x51, 0x01, 0x9E, 0x72, 0xCF, 0x59, 0x83, 0xFF, 0xFF, 0x01, 0xCF, 0x39, 0x9E, 0x71, 0x81,
+0x96, 0x51, 0x02, 0x8E, 0x50, 0x3C, 0x4B, 0x2B, 0x28, 0x86, 0x00, 0x00, 0x86, 0x00, 0x00, 0x02,
+0x22, 0x86, 0x3C, 0x2B, 0x8E, 0x30, 0x81, 0x96, 0x51, 0x00, 0xBE, 0xF6, 0x86, 0xFF, 0xFF, 0x00,
+0xCF, 0x59, 0x81, 0x96, 0x51, 0x02, 0x75, 0x8E, 0x3C, 0x2B, 0x09, 0x02, 0x83, 0x00, 0x00, 0x02,
+0x22, 0xE7, 0x44, 0x4B, 0x96, 0x50, 0x80, 0x96, 0x51, 0x01, 0x9E, 0x92, 0xEF, 0xBD, 0x85, 0xFF,
+0xFF, 0x01, 0xEF, 0xBD, 0x9E, 0x92, 0x81, 0x96, 0x51, 0x02, 0x6D, 0x4E, 0x3C, 0x2B, 0x08, 0xA1,
+0x85, 0x00, 0x00, 0x86, 0x00, 0x00, 0x01, 0x33, 0xEA, 0x5C, 0xED, 0x81, 0x96, 0x50, 0x00, 0xAE,
+0xB4, 0x88, 0xFF, 0xFF, 0x00, 0xBF, 0x17, 0x80, 0x96, 0x50, 0x02, 0x8E, 0x30, 0x3C, 0x2B, 0x1A,
+0x46, 0x82, 0x00, 0x00, 0x02, 0x00, 0x20, 0x34, 0x0A, 0x65, 0x2D, 0x80, 0x96, 0x50, 0x01, 0x96,
+0x51, 0xEF, 0xBD, 0x87, 0xFF, 0xFF, 0x01, 0xEF, 0xBC, 0x96, 0x51, 0x80, 0x96, 0x50, 0x02, 0x8E,
+0x10, 0x3C, 0x2B, 0x19, 0xE5, 0x85, 0x00, 0x00, 0x85, 0x00, 0x00, 0x02, 0x08, 0x81, 0x3C, 0x2B,
+0x6D, 0x6E, 0x81, 0x8E, 0x50, 0x00, 0xE7, 0x9C, 0x81, 0xFF, 0xFF, 0x04, 0x9C, 0xF3, 0x52, 0xAA,
+0x4A, 0x69, 0x8C, 0x51, 0xF7, 0x9E, 0x80, 0xFF, 0xFF, 0x01, 0xFF, 0xFE, 0x96, 0x51, 0x80, 0x8E,
+0x50, 0x01, 0x4C, 0xAC, 0x2B, 0x28, 0x82, 0x00, 0x00, 0x02, 0x08, 0xE2, 0x3C, 0x2B, 0x75, 0xAF,
+0x80, 0x8E, 0x50, 0x00, 0xBE, 0xF6, 0x81, 0xFF, 0xFF, 0x04, 0xCE, 0x79, 0x6B, 0x4D, 0x4A, 0x49,
+0x6B, 0x4D, 0xD6, 0x9A, 0x81, 0xFF, 0xFF, 0x00, 0xBE, 0xF6, 0x81, 0x8E, 0x50, 0x01, 0x44, 0x6B,
+0x22, 0xC7, 0x85, 0x00, 0x00, 0x85, 0x00, 0x00, 0x02, 0x09, 0x02, 0x3C, 0x2B, 0x75, 0xAF, 0x80,
+0x8E, 0x30, 0x00, 0x9E, 0x72, 0x81, 0xFF, 0xFF, 0x00, 0x9C, 0xD3, 0x82, 0x42, 0x08, 0x00, 0x73,
+0x8E, 0x81, 0xFF, 0xFF, 0x00, 0xB6, 0xD6, 0x80, 0x8E, 0x30, 0x01, 0x54, 0xED, 0x33, 0xA9, 0x82,
+0x00, 0x00, 0x02, 0x11, 0x43, 0x3C, 0x2B, 0x7D, 0xCF, 0x80, 0x8E, 0x30, 0x00, 0xE7, 0x9C, 0x80,
+0xFF, 0xFF, 0x01, 0xDE, 0xFB, 0x42, 0x28, 0x81, 0x42, 0x08, 0x01, 0x42, 0x28, 0xE7, 0x1C, 0x80,
+0xFF, 0xFF, 0x00, 0xE7, 0x9B, 0x81, 0x8E, 0x30, 0x01, 0x54, 0xCC, 0x2B, 0x48, 0x85, 0x00, 0x00,
+0x85, 0x00, 0x00, 0x02, 0x11, 0x23, 0x3C, 0x2B, 0x7D, 0xCF, 0x80, 0x8E, 0x30, 0x00, 0xB6, 0xD5,
+0x81, 0xFF, 0xFF, 0x00, 0x4A, 0x69, 0x83, 0x42, 0x08, 0x00, 0xE7, 0x1C, 0x80, 0xFF, 0xFF, 0x00,
+0xCF, 0x38, 0x80, 0x8E, 0x30, 0x02, 0x65, 0x2D, 0x3C, 0x0A, 0x22, 0xE7, 0x80, 0x2B, 0x08, 0x03,
+0x2A, 0xE7, 0x2B, 0x48, 0x3C, 0x2B, 0x86, 0x10, 0x80, 0x8E, 0x30, 0x81, 0xFF, 0xFF, 0x00, 0x94,
+0xB2, 0x83, 0x42, 0x08, 0x00, 0x9C, 0xD3, 0x80, 0xFF, 0xFF, 0x00, 0xF7, 0xDE, 0x81, 0x8E, 0x30,
+0x01, 0x54, 0xCC, 0x33, 0x89, 0x85, 0x00, 0x00, 0x85, 0x00, 0x00, 0x02, 0x08, 0xE2, 0x3C, 0x2B,
+0x75, 0x8F, 0x80, 0x8E, 0x30, 0x00, 0xB6, 0xD5, 0x80, 0xFF, 0xFF, 0x01, 0xFF, 0xDF, 0x42, 0x28,
+0x83, 0x42, 0x08, 0x00, 0xD6, 0x9A, 0x80, 0xFF, 0xFF, 0x00, 0xCF, 0x39, 0x80, 0x8E, 0x30, 0x04,
+0x85, 0xF0, 0x54, 0xAC, 0x44, 0x6B, 0x4C, 0x8C, 0x4C, 0xAC, 0x80, 0x44, 0x6B, 0x00, 0x65, 0x2E,
+0x81, 0x8E, 0x30, 0x81, 0xFF, 0xFF, 0x00, 0x84, 0x30, 0x83, 0x42, 0x08, 0x00, 0x8C, 0x51, 0x81,
+0xFF, 0xFF, 0x81, 0x8E, 0x30, 0x01, 0x4C, 0xAC, 0x2B, 0x28, 0x85, 0x00, 0x00, 0x85, 0x00, 0x00,
+0x02, 0x00, 0x40, 0x3C, 0x2A, 0x65, 0x2D, 0x80, 0x86, 0x10, 0x00, 0xA6, 0x94, 0x81, 0xFF, 0xFF,
+0x00, 0x73, 0x8E, 0x82, 0x42, 0x08, 0x01, 0x52, 0x8A, 0xF7, 0xBE, 0x80, 0xFF, 0xFF, 0x00, 0xBE,
+0xF7, 0x8B, 0x86, 0x10, 0x00, 0xEF, 0xBD, 0x80, 0xFF, 0xFF, 0x00, 0xBD, 0xD7, 0x83, 0x42, 0x08,
+0x00, 0xBD, 0xF7, 0x80, 0xFF, 0xFF, 0x00, 0xEF, 0xBD, 0x81, 0x86, 0x10, 0x01, 0x3C, 0x2B, 0x22,
+0x86, 0x85, 0x00, 0x00, 0x86, 0x00, 0x00, 0x01, 0x2B, 0x69, 0x4C, 0x8C, 0x80, 0x86, 0x10, 0x01,
+0x8E, 0x10, 0xF7, 0xDE, 0x80, 0xFF, 0xFF, 0x01, 0xE7, 0x3C, 0x5A, 0xEB, 0x80, 0x42, 0x08, 0x01,
+0x4A, 0x69, 0xCE, 0x59, 0x81, 0xFF, 0xFF, 0x00, 0x9E, 0x52, 0x8B, 0x86, 0x10, 0x00, 0xCF, 0x18,
+0x81, 0xFF, 0xFF, 0x00, 0x8C, 0x71, 0x81, 0x42, 0x08, 0x00, 0x94, 0x92, 0x81, 0xFF, 0xFF, 0x00,
+0xC7, 0x18, 0x80, 0x86, 0x10, 0x02, 0x75, 0x8F, 0x3C, 0x2B, 0x11, 0x63, 0x85, 0x00, 0x00, 0x86,
+0x00, 0x00, 0x02, 0x19, 0xC4, 0x3C, 0x2B, 0x75, 0xAF, 0x80, 0x86, 0x10, 0x00, 0xBE, 0xF7, 0x81,
+0xFF, 0xFF, 0x03, 0xFF, 0xDF, 0xCE, 0x79, 0xC6, 0x38, 0xF7, 0x9E, 0x81, 0xFF, 0xFF, 0x00, 0xD7,
+0x5A, 0x8C, 0x86, 0x10, 0x00, 0x96, 0x31, 0x82, 0xFF, 0xFF, 0x02, 0xE7, 0x1C, 0xC6, 0x18, 0xE7,
+0x1C, 0x82, 0xFF, 0xFF, 0x00, 0x96, 0x31, 0x80, 0x86, 0x10, 0x02, 0x54, 0xCC, 0x33, 0xEA, 0x00,
+0x20, 0x85, 0x00, 0x00, 0x86, 0x00, 0x00, 0x06, 0x00, 0x20, 0x33, 0xCA, 0x4C, 0x8C, 0x85, 0xEF,
+0x85, 0xF0, 0x86, 0x10, 0xDF, 0x7B, 0x86, 0xFF, 0xFF, 0x01, 0xEF, 0xBD, 0x8E, 0x31, 0x8D, 0x85,
+0xF0, 0x00, 0xAE, 0xB5, 0x87, 0xFF, 0xFF, 0x00, 0xAE, 0xB5, 0x80, 0x85, 0xF0, 0x02, 0x75, 0x8E,
+0x3C, 0x2B, 0x1A, 0x25, 0x86, 0x00, 0x00, 0x87, 0x00, 0x00, 0x02, 0x11, 0x84, 0x3C, 0x2B, 0x6D,
+0x6E, 0x80, 0x85, 0xEF, 0x01, 0x85, 0xF0, 0xC7, 0x18, 0x84, 0xFF, 0xFF, 0x01, 0xDF, 0x5B, 0x8E,
+0x11, 0x8F, 0x85, 0xEF, 0x01, 0xA6, 0x94, 0xF7, 0xDE, 0x83, 0xFF, 0xFF, 0x01, 0xF7, 0xBE, 0xA6,
+0x94, 0x81, 0x85, 0xEF, 0x02, 0x4C, 0x8C, 0x33, 0xA9, 0x00, 0x20, 0x86, 0x00, 0x00, 0x88, 0x00,
+0x00, 0x01, 0x34, 0x0A, 0x5C, 0xED, 0x82, 0x7D, 0xEF, 0x05, 0x8E, 0x31, 0xBE, 0xD7, 0xCF, 0x39,
+0xD7, 0x3A, 0xC6, 0xF8, 0x9E, 0x53, 0x92, 0x7D, 0xEF, 0x06, 0x85, 0xF0, 0xAE, 0x95, 0xCF, 0x19,
+0xD7, 0x5A, 0xCF, 0x19, 0xAE, 0x95, 0x85, 0xF0, 0x81, 0x7D, 0xEF, 0x02, 0x7D, 0xCF, 0x3C, 0x2B,
+0x19, 0xE5, 0x87, 0x00, 0x00, 0x87, 0x00, 0x00, 0x02, 0x00, 0x40, 0x3C, 0x0A, 0x5D, 0x0D, 0xA7,
+0x7D, 0xCF, 0x01, 0x3C, 0x2B, 0x1A, 0x25, 0x87, 0x00, 0x00, 0x87, 0x00, 0x00, 0x02, 0x22, 0xC7,
+0x3C, 0x2B, 0x75, 0x8E, 0xA7, 0x7D, 0xCF, 0x02, 0x4C, 0xAC, 0x34, 0x0A, 0x08, 0xA1, 0x86, 0x00,
+0x00, 0x86, 0x00, 0x00, 0x02, 0x19, 0xE5, 0x3C, 0x2B, 0x5D, 0x0D, 0xA8, 0x7D, 0xCF, 0x03, 0x75,
+0x8F, 0x3C, 0x4B, 0x33, 0x89, 0x00, 0x40, 0x85, 0x00, 0x00, 0x85, 0x00, 0x00, 0x02, 0x09, 0x23,
+0x34, 0x2A, 0x4C, 0xAC, 0xAA, 0x75, 0xAF, 0x02, 0x6D, 0x4E, 0x3C, 0x2B, 0x22, 0xE7, 0x85, 0x00,
+0x00, 0x84, 0x00, 0x00, 0x02, 0x00, 0x20, 0x33, 0xCA, 0x44, 0x6B, 0xAC, 0x75, 0xAF, 0x02, 0x5D,
+0x0D, 0x3C, 0x2B, 0x11, 0x84, 0x84, 0x00, 0x00, 0x84, 0x00, 0x00, 0x02, 0x1A, 0x25, 0x3C, 0x2B,
+0x65, 0x4E, 0x91, 0x75, 0xAF, 0x02, 0x75, 0x8F, 0x64, 0x4C, 0x75, 0x6E, 0x81, 0x75, 0xAF, 0x01,
+0x64, 0x8C, 0x6D, 0x2E, 0x92, 0x75, 0xAF, 0x02, 0x44, 0x6B, 0x33, 0xCA, 0x00, 0x20, 0x83, 0x00,
+0x00, 0x83, 0x00, 0x00, 0x02, 0x00, 0x40, 0x33, 0xEA, 0x4C, 0x8C, 0x92, 0x75, 0x8F, 0x02, 0x5C,
+0x0C, 0x42, 0x08, 0x53, 0x6A, 0x80, 0x75, 0x8F, 0x02, 0x64, 0xCD, 0x42, 0x08, 0x4A, 0xC9, 0x92,
+0x75, 0x8F, 0x02, 0x65, 0x2D, 0x3C, 0x2B, 0x19, 0xC4, 0x83, 0x00, 0x00, 0x83, 0x00, 0x00, 0x02,
+0x11, 0xC4, 0x3C, 0x2B, 0x65, 0x4E, 0x92, 0x75, 0x8E, 0x02, 0x53, 0x6A, 0x42, 0x08, 0x4A, 0xC9,
+0x80, 0x75, 0x8E, 0x02, 0x5C, 0x2C, 0x42, 0x08, 0x42, 0x28, 0x93, 0x75, 0x8E, 0x01, 0x44, 0x6B,
+0x33, 0x89, 0x83, 0x00, 0x00, 0x83, 0x00, 0x00, 0x01, 0x2B, 0x48, 0x44, 0x6B, 0x93, 0x6D, 0x8E,
+0x02, 0x5C, 0x2C, 0x42, 0x08, 0x53, 0x8A, 0x80, 0x6D, 0x8E, 0x02, 0x64, 0xCD, 0x42, 0x08, 0x4A,
+0xC9, 0x93, 0x6D, 0x8E, 0x02, 0x54, 0xED, 0x3C, 0x2B, 0x08, 0xC2, 0x82, 0x00, 0x00, 0x82, 0x00,
+0x00, 0x02, 0x00, 0x40, 0x34, 0x2A, 0x54, 0xCC, 0x93, 0x6D, 0x8E, 0x02, 0x6D, 0x6E, 0x5C, 0x6C,
+0x6D, 0x4E, 0x81, 0x6D, 0x8E, 0x01, 0x64, 0x8C, 0x6D, 0x2E, 0x93, 0x6D, 0x8E, 0x02, 0x65, 0x4E,
+0x3C, 0x2B, 0x1A, 0x05, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x02, 0x09, 0x02, 0x3C, 0x2B, 0x5D,
+0x0D, 0xB1, 0x6D, 0x6E, 0x01, 0x44, 0x4B, 0x22, 0xE7, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x02,
+0x11, 0xA4, 0x3C, 0x2B, 0x65, 0x4E, 0xB1, 0x6D, 0x6E, 0x01, 0x4C, 0x8C, 0x33, 0x89, 0x82, 0x00,
+0x00, 0x82, 0x00, 0x00, 0x01, 0x1A, 0x05, 0x3C, 0x2B, 0xB2, 0x65, 0x6E, 0x01, 0x4C, 0xAC, 0x33,
+0xEA, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x01, 0x1A, 0x25, 0x3C, 0x2B, 0x85, 0x65, 0x4E, 0x06,
+0x8D, 0x92, 0xC6, 0x78, 0xBE, 0x37, 0xA5, 0xD5, 0x8D, 0xB2, 0x7D, 0x90, 0x6D, 0x6F, 0x96, 0x65,
+0x4E, 0x06, 0x6D, 0x6F, 0x7D, 0x90, 0x8D, 0x92, 0xA5, 0xD5, 0xBE, 0x37, 0xC6, 0x78, 0x8D, 0xB2,
+0x85, 0x65, 0x4E, 0x01, 0x4C, 0xAC, 0x34, 0x0A, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x02, 0x19,
+0xE5, 0x3C, 0x2B, 0x65, 0x4D, 0x83, 0x65, 0x4E, 0x02, 0x65, 0x2E, 0xB5, 0xB6, 0xFF, 0xDF, 0x83,
+0xFF, 0xFF, 0x0A, 0xFF, 0xDF, 0xEF, 0x5D, 0xD6, 0xDA, 0xCE, 0x99, 0xC6, 0x58, 0xB6, 0x37, 0xAE,
+0x16, 0xA5, 0xD5, 0xA5, 0xF5, 0xA5, 0xD4, 0x9D, 0xB4, 0x80, 0x9D, 0xD4, 0x01, 0x9D, 0xB4, 0xA5,
+0xD5, 0x80, 0xA5, 0xF5, 0x06, 0xAE, 0x16, 0xB6, 0x37, 0xC6, 0x78, 0xCE, 0x99, 0xD6, 0xDA, 0xEF,
+0x5D, 0xFF, 0xDF, 0x83, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xB5, 0xB6, 0x65, 0x2E, 0x84, 0x65, 0x4E,
+0x01, 0x4C, 0xAC, 0x33, 0xCA, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x02, 0x11, 0xA4, 0x3C, 0x2B,
+0x5D, 0x2D, 0x83, 0x65, 0x4D, 0x04, 0x65, 0x2D, 0x42, 0x28, 0x4A, 0x69, 0x94, 0xB2, 0xDE, 0xDB,
+0x9C, 0xFF, 0xFF, 0x04, 0xDE, 0xDB, 0x94, 0xB2, 0x4A, 0x69, 0x42, 0x28, 0x65, 0x2D, 0x84, 0x65,
+0x4D, 0x01, 0x44, 0x8B, 0x2B, 0x89, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x02, 0x08, 0xE2, 0x3C,
+0x2B, 0x54, 0xCD, 0x84, 0x5D, 0x2D, 0x00, 0x4B, 0x2A, 0x81, 0x42, 0x08, 0x02, 0x5A, 0xEB, 0x9C,
+0xF3, 0xD6, 0xBA, 0x96, 0xFF, 0xFF, 0x02, 0xD6, 0xBA, 0x9C, 0xF3, 0x5A, 0xEB, 0x81, 0x42, 0x08,
+0x00, 0x4B, 0x09, 0x85, 0x5D, 0x2D, 0x01, 0x3C, 0x2B, 0x22, 0xA7, 0x82, 0x00, 0x00, 0x82, 0x00,
+0x00, 0x02, 0x00, 0x20, 0x3C, 0x0A, 0x4C, 0x8C, 0x84, 0x5D, 0x2D, 0x00, 0x54, 0x4C, 0x84, 0x42,
+0x08, 0x04, 0x4A, 0x69, 0x7B, 0xCF, 0xA5, 0x34, 0xCE, 0x79, 0xEF, 0x7D, 0x8C, 0xFF, 0xFF, 0x04,
+0xEF, 0x7D, 0xCE, 0x79, 0xA5, 0x34, 0x7B, 0xCF, 0x4A, 0x69, 0x84, 0x42, 0x08, 0x00, 0x54, 0x2C,
+0x84, 0x5D, 0x2D, 0x02, 0x5D, 0x0D, 0x3C, 0x2B, 0x19, 0xC4, 0x82, 0x00, 0x00, 0x83, 0x00, 0x00,
+0x01, 0x22, 0xE7, 0x3C, 0x2B, 0x84, 0x5D, 0x2D, 0x01, 0x5D, 0x0D, 0x42, 0xC9, 0x88, 0x42, 0x08,
+0x04, 0x4A, 0x69, 0x6B, 0x4D, 0x7B, 0xCF, 0x8C, 0x71, 0x9C, 0xD3, 0x82, 0xA5, 0x34, 0x04, 0x9C,
+0xD3, 0x8C, 0x71, 0x7B, 0xCF, 0x6B, 0x4D, 0x4A, 0x69, 0x88, 0x42, 0x08, 0x01, 0x42, 0x89, 0x5D,
+0x0D, 0x84, 0x5D, 0x2D, 0x02, 0x4C, 0xAC, 0x3C, 0x2B, 0x08, 0x81, 0x82, 0x00, 0x00, 0x83, 0x00,
+0x00, 0x02, 0x11, 0x84, 0x3C, 0x2B, 0x54, 0xCC, 0x84, 0x5D, 0x0D, 0x00, 0x54, 0x8C, 0xA0, 0x42,
+0x08, 0x00, 0x54, 0x2B, 0x85, 0x5D, 0x0D, 0x01, 0x3C, 0x4B, 0x2B, 0x48, 0x83, 0x00, 0x00, 0x84,
+0x00, 0x00, 0x01, 0x33, 0xA9, 0x44, 0x4B, 0x85, 0x55, 0x0D, 0x00, 0x4B, 0x8A, 0x9E, 0x42, 0x08,
+0x00, 0x4B, 0x2A, 0x85, 0x55, 0x0D, 0x02, 0x4C, 0xCC, 0x3C, 0x2B, 0x11, 0x63, 0x83, 0x00, 0x00,
+0x84, 0x00, 0x00, 0x02, 0x19, 0xC4, 0x3C, 0x2B, 0x4C, 0xCC, 0x84, 0x55, 0x0D, 0x01, 0x54, 0xED,
+0x43, 0x09, 0x9C, 0x42, 0x08, 0x01, 0x42, 0xA9, 0x54, 0xED, 0x84, 0x55, 0x0D, 0x02, 0x54, 0xED,
+0x3C, 0x4B, 0x33, 0x89, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0x01, 0x2B, 0x69, 0x3C, 0x2B, 0x86,
+0x54, 0xED, 0x00, 0x42, 0xE9, 0x9A, 0x42, 0x08, 0x01, 0x42, 0x89, 0x54, 0xCC, 0x85, 0x54, 0xED,
+0x02, 0x44, 0x8C, 0x3C, 0x2B, 0x09, 0x02, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0x02, 0x08, 0xC2,
+0x34, 0x0A, 0x3C, 0x4B, 0x86, 0x54, 0xED, 0x00, 0x4B, 0x6A, 0x86, 0x42, 0x08, 0x03, 0x4A, 0x08,
+0x82, 0x28, 0xA2, 0x49, 0xC2, 0x49, 0x80, 0xCA, 0x49, 0x03, 0xC2, 0x49, 0xA2, 0x49, 0x7A, 0x28,
+0x4A, 0x08, 0x86, 0x42, 0x08, 0x01, 0x42, 0xC9, 0x54, 0xCC, 0x85, 0x54, 0xED, 0x02, 0x4C, 0xAC,
+0x3C, 0x2B, 0x22, 0x86, 0x85, 0x00, 0x00, 0x86, 0x00, 0x00, 0x02, 0x11, 0xA4, 0x3C, 0x2B, 0x44,
+0x6B, 0x86, 0x4C, 0xEC, 0x02, 0x4C, 0x0B, 0x42, 0x68, 0x39, 0xE7, 0x81, 0x42, 0x08, 0x01, 0x62,
+0x08, 0xBA, 0x49, 0x88, 0xFA, 0x69, 0x01, 0xBA, 0x49, 0x62, 0x08, 0x83, 0x42, 0x08, 0x01, 0x4B,
+0x8A, 0x4C, 0xCC, 0x85, 0x4C, 0xEC, 0x03, 0x4C, 0xCC, 0x3C, 0x2B, 0x2B, 0x48, 0x00, 0x20, 0x85,
+0x00, 0x00, 0x87, 0x00, 0x00, 0x02, 0x1A, 0x46, 0x3C, 0x2B, 0x44, 0x6B, 0x87, 0x4C, 0xCC, 0x03,
+0x43, 0x6A, 0x42, 0x08, 0x4A, 0x08, 0xB2, 0x49, 0x8C, 0xFA, 0x69, 0x00, 0xAA, 0x49, 0x80, 0x42,
+0x08, 0x01, 0x42, 0xE9, 0x4C, 0x8C, 0x86, 0x4C, 0xCC, 0x03, 0x4C, 0xAC, 0x3C, 0x2A, 0x33, 0xA9,
+0x00, 0x61, 0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x02, 0x22, 0x66, 0x3C, 0x2B, 0x3C, 0x6B, 0x87,
+0x4C, 0xCC, 0x02, 0x4C, 0xAC, 0x8B, 0x4A, 0xE2, 0x69, 0x8D, 0xFA, 0x69, 0x01, 0xAA, 0xCA, 0x4C,
+0x4B, 0x87, 0x4C, 0xCC, 0x03, 0x44, 0xAC, 0x3C, 0x2A, 0x33, 0xA9, 0x00, 0x81, 0x87, 0x00, 0x00,
+0x89, 0x00, 0x00, 0x03, 0x1A, 0x05, 0x3C, 0x2B, 0x3C, 0x4B, 0x44, 0xAC, 0x88, 0x4C, 0xCC, 0x03,
+0x6B, 0xEB, 0x9B, 0x2A, 0xC2, 0xA9, 0xEA, 0x69, 0x84, 0xFA, 0x69, 0x04, 0xEA, 0x69, 0xD2, 0x89,
+0xA3, 0x0A, 0x7B, 0xCB, 0x54, 0x8C, 0x88, 0x4C, 0xCC, 0x03, 0x44, 0x6B, 0x3C, 0x2B, 0x2B, 0x48,
+0x00, 0x61, 0x88, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x03, 0x11, 0x43, 0x33, 0xEA, 0x3C, 0x2B, 0x44,
+0x6B, 0x8C, 0x44, 0xAC, 0x04, 0x54, 0x8C, 0x5C, 0x4B, 0x5C, 0x2B, 0x5C, 0x6C, 0x4C, 0x8C, 0x8B,
+0x44, 0xAC, 0x04, 0x44, 0x8C, 0x3C, 0x4B, 0x3C, 0x2B, 0x22, 0xA7, 0x00, 0x20, 0x89, 0x00, 0x00,
+0x8B, 0x00, 0x00, 0x01, 0x00, 0x61, 0x2A, 0xE7, 0x80, 0x3C, 0x2B, 0x00, 0x44, 0x8B, 0x9A, 0x44,
+0xAC, 0x04, 0x44, 0x8C, 0x3C, 0x4B, 0x3C, 0x2B, 0x33, 0xCA, 0x11, 0x43, 0x8B, 0x00, 0x00, 0x8D,
+0x00, 0x00, 0x01, 0x11, 0x43, 0x33, 0x89, 0x80, 0x3C, 0x2B, 0x01, 0x3C, 0x6B, 0x44, 0x8C, 0x95,
+0x44, 0xAC, 0x05, 0x44, 0x8B, 0x3C, 0x4B, 0x3C, 0x2A, 0x34, 0x0A, 0x1A, 0x46, 0x00, 0x20, 0x8C,
+0x00, 0x00, 0x8F, 0x00, 0x00, 0x05, 0x11, 0x63, 0x2B, 0x69, 0x3C, 0x2B, 0x3C, 0x2A, 0x3C, 0x4B,
+0x3C, 0x6B, 0x90, 0x44, 0x8C, 0x80, 0x3C, 0x6B, 0x80, 0x3C, 0x2B, 0x02, 0x33, 0xEA, 0x1A, 0x46,
+0x00, 0x61, 0x8E, 0x00, 0x00, 0x91, 0x00, 0x00, 0x02, 0x08, 0xE2, 0x22, 0x86, 0x33, 0xEA, 0x81,
+0x3C, 0x2B, 0x00, 0x3C, 0x4B, 0x81, 0x3C, 0x6B, 0x85, 0x3C, 0x8B, 0x80, 0x3C, 0x6B, 0x80, 0x3C,
+0x4B, 0x05, 0x3C, 0x2A, 0x3C, 0x2B, 0x3C, 0x2A, 0x2B, 0x28, 0x11, 0x84, 0x00, 0x20, 0x90, 0x00,
+0x00, 0x94, 0x00, 0x00, 0x03, 0x09, 0x02, 0x1A, 0x25, 0x2B, 0x28, 0x33, 0xEA, 0x82, 0x3C, 0x2B,
+0x00, 0x3C, 0x2A, 0x80, 0x34, 0x2A, 0x00, 0x34, 0x2B, 0x82, 0x3C, 0x2B, 0x04, 0x34, 0x0A, 0x33,
+0x89, 0x22, 0x86, 0x11, 0x63, 0x00, 0x41, 0x93, 0x00, 0x00, 0x98, 0x00, 0x00, 0x0C, 0x08, 0x81,
+0x09, 0x23, 0x11, 0x84, 0x1A, 0x05, 0x1A, 0x25, 0x22, 0x66, 0x22, 0x86, 0x1A, 0x46, 0x1A, 0x25,
+0x19, 0xC4, 0x11, 0x43, 0x08, 0xC2, 0x00, 0x20, 0x97, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00,
+0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00,
+};
+static const uint16_t STATUS_AWAKE_PACKED_ROWS[128] PROGMEM = {
+0x0000, 0x0017, 0x004C, 0x0083, 0x00F1, 0x0168, 0x01E1, 0x024C, 0x02AF, 0x031A, 0x0383, 0x03F1, 0x045C, 0x046B, 0x046E, 0x0471,
+0x0474, 0x0477, 0x047A, 0x047D, 0x0480, 0x0483, 0x0486, 0x0489, 0x048C, 0x048F, 0x0492, 0x0495, 0x0498, 0x049B, 0x049E, 0x04A1,
+0x04A4, 0x04A7, 0x04AA, 0x04AD, 0x04B0, 0x04B3, 0x04B6, 0x04B9, 0x04BC, 0x04BF, 0x04C2, 0x04C5, 0x04C8, 0x04CB, 0x04CE, 0x04D1,
+0x04D4, 0x04D7, 0x04DA, 0x04DD, 0x04E0, 0x04E3, 0x04E6, 0x04E9, 0x04EC, 0x04EF, 0x04F2, 0x04F5, 0x04F8, 0x04FB, 0x04FE, 0x0501,
+0x0504, 0x0507, 0x050A, 0x050D, 0x0510, 0x0513, 0x0540, 0x057D, 0x05BC, 0x05EF, 0x061E, 0x0663, 0x06AC, 0x06F3, 0x0738, 0x0795,
+0x07F0, 0x0848, 0x089D, 0x08E4, 0x092F, 0x0974, 0x09A7, 0x09DE, 0x0A15, 0x0A2A, 0x0A41, 0x0A5A, 0x0A71, 0x0A88, 0x0AB1, 0x0ADC,
+0x0B05, 0x0B2E, 0x0B57, 0x0B6C, 0x0B81, 0x0B94, 0x0BCB, 0x0C28, 0x0C59, 0x0C8E, 0x0CCD, 0x0D0E, 0x0D2F, 0x0D50, 0x0D77, 0x0D9A,
+0x0DD7, 0x0E12, 0x0E45, 0x0E70, 0x0EA5, 0x0ED0, 0x0EEF, 0x0F12, 0x0F35, 0x0F61, 0x0F8A, 0x0FAB, 0x0FAE, 0x0FB1, 0x0FB4, 0x0FB7,
+};
+const PackedImage STATUS_AWAKE_PACKED = { 64, 128, PackedImage::Rle565, 0, 4026, nullptr, STATUS_AWAKE_PACKED_ROWS, STATUS_AWAKE_PACKED_DATA };
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef __STATUS_PANEL_H
+#define __STATUS_PANEL_H
+#include <Arduino.h>
+
+// The status panel on the right of the screen: the label of the state at
+// the top, for Sleeping and WakingUp a 3x3 grid of paws that the progress
+// hides, and the animal at the bottom. tools/bake_status.py composes it
+// for every state into include/status-panels.h, so drawing a state is one
+// image instead of a label, nine paws and an animal.
+constexpr int16_t STATUS_PANEL_WIDTH = 64;
+constexpr int16_t STATUS_PANEL_HEIGHT = 128;
+constexpr int16_t STATUS_LABEL_HEIGHT = 64;
+constexpr int16_t STATUS_ICON_SIZE = 64; // below the label
+
+// within the panel
+constexpr int16_t PAW_GRID_LEFT = 7;
+constexpr int16_t PAW_GRID_TOP = 15;
+constexpr int16_t PAW_SIZE = 16;
+constexpr int16_t AREA_AROUND_CAT = 18; // from paw to paw
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef __TEXT_CACHE_H
+#define __TEXT_CACHE_H
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "flash_font.hpp"
+#include "mask_cache.hpp"
+
+// Heap used to keep text rendered as alpha masks (0 disables). The name
+// takes 2 KB and a numeral 80 to 200 (the status labels are baked into
+// the status panels). Text is drawn a band of 8 lines at a time, so a
+// cached name saves reading its glyphs from flash for each band it spans.
+#ifndef TEXT_CACHE_BYTES
+#define TEXT_CACHE_BYTES 4096
+#endif
+
+// Text runs rendered once into an alpha mask of the box their glyphs
+// cover, so drawing them again is a masked blit instead of finding and
+// reading every glyph from flash. A mask holds coverage only, the colour
+// is applied when it is drawn, so it is keyed on the font and the text.
+// Text that does not fit the budget, or whose key collides with another
+// cached run, is drawn from the font as before.
+class TextCache {
+private:
+    MaskCache masks;
+public:
+    TextCache(uint32_t budget, uint8_t slots): masks(budget, slots) {}
+
+    // as FlashFont::draw
+    void draw(const FlashFont &font, TFT_eSprite &sprite, const char *text, int32_t x, int32_t y,
+        uint8_t datum, uint16_t color, uint16_t background);
+    void draw(const FlashFont &font, TFT_eSprite &sprite, const char *text, int32_t x, int32_t y,
+            uint8_t datum, uint16_t color) {
+        draw(font, sprite, text, x, y, datum, color, color);
+    }
+    const MaskCache &cache() const { return masks; }
+};
+
+#endif
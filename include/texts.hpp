@@ -0,0 +1,16 @@
+#ifndef __TEXTS_H
+#define __TEXTS_H
+
+// Everything the clock writes in a smooth font. The fonts are cut down to
+// the glyphs of these texts by tools/subset_fonts.py, so anything drawn in
+// a font has to come from its list here.
+
+// NotoSansBold36
+static constexpr const char *NAME_TEXT = "Tom";
+
+// NotoSansBold15, together with the dial numerals 1 to 12
+static constexpr const char *SLEEPING_TEXT = "Slapen";
+static constexpr const char *WAKING_UP_TEXT = "Rustig";
+static constexpr const char *AWAKE_TEXT = "Wakker";
+
+#endif
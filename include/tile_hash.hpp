@@ -0,0 +1,27 @@
+#ifndef __TILE_HASH_H
+#define __TILE_HASH_H
+#include <Arduino.h>
+
+// A hash per tile of what was last pushed to the lcd, so damaged tiles
+// that end up with the same pixels are not sent again. Costs 4 bytes per
+// tile, 1.3 KB for the 160x128 screen in 8x8 tiles.
+class TileHashes {
+public:
+    static constexpr int16_t SIZE = 8;
+    static constexpr uint8_t COLUMNS = 160 / SIZE;
+    static constexpr uint8_t ROWS = 128 / SIZE;
+
+    // start of a flush, a tile is only compared once per flush
+    void begin();
+    // does the tile (pixels point at its top left, stride in pixels)
+    // differ from what the lcd shows, remembers it as shown if so
+    bool changed(uint8_t column, uint8_t row, const uint16_t *pixels, int16_t stride);
+private:
+    static constexpr uint16_t COUNT = COLUMNS * ROWS;
+    uint32_t hashes[COUNT];
+    uint8_t known[(COUNT + 7) / 8] = {};   // hash is valid
+    uint8_t checked[(COUNT + 7) / 8] = {}; // compared in this flush
+    uint8_t pushed[(COUNT + 7) / 8] = {};  // outcome of that comparison
+};
+
+#endif
@@ -2,20 +2,58 @@
 #define __TIME_H
 #include <Arduino.h>
 #include <ezTime.h>
+#include <Ticker.h>
+
+// How far after the true second boundary the ticks were handled, in
+// micros, bucketed. The boundary is the one ezTime derives from its last
+// NTP sync; at the next sync the jump of that boundary shows how far the
+// local clock drifted in between.
+struct TickOffsets {
+    static constexpr uint8_t BUCKETS = 10;
+    // upper bounds of all but the last bucket
+    static constexpr uint32_t LIMITS[BUCKETS - 1] = { 100, 250, 500, 1000, 2000, 5000, 10000, 50000, 200000 };
+    uint32_t counts[BUCKETS];
+    uint32_t early;         // ticks before the second changed, re-armed
+    uint32_t maxOffset;
+    uint32_t syncs;         // re-alignments after the first one
+    int32_t maxCorrection;  // the largest boundary jump at a sync
+
+    void add(uint32_t offset);
+    void print(Print &out) const;
+};
 
 class Time {
 private:
     Timezone *now;
     const String zone;
+    Ticker ticker;
+    void (*onTick)() = nullptr;
+    bool aligned = false;
+    time_t lastSync = 0;
+    uint32_t boundary = 0; // micros() of the next second boundary
+    void align();
+    void arm();
 public:
     Time(const String zone): zone(zone) {
         now = nullptr;
         setDebug(ERROR); // if this is off, it crashes?
     };
+    // Calls `callback` from the SDK's timer context right after every
+    // second boundary, once the time is synced; it should only post an
+    // event for loop() to call process().
+    void onSecond(void (*callback)()) { onTick = callback; }
+    // until true, process() has to be polled for the first NTP sync
+    bool ticking() const { return aligned; }
     bool process();
+    // Moves the next tick to the `seconds`th boundary from now (up to a
+    // minute), when nothing is shown to change before it.
+    void tickIn(uint8_t seconds);
     bool didMinuteChanged();
     uint8_t hour();
     uint8_t minute();
     uint8_t second();
+    // days since 1970-01-01 in the time zone
+    uint16_t day();
+    TickOffsets offsets = {};
 };
-#endif
\ No newline at end of file
+#endif
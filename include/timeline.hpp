@@ -0,0 +1,45 @@
+#ifndef __TIMELINE_H
+#define __TIMELINE_H
+#include <Arduino.h>
+#include "display.hpp"
+
+// The day's schedule compiled into segments, built when the config
+// changes. A segment runs from its start to the start of the next one
+// with a fixed state; brightness and progress count down linearly to
+// their end value, reached `length` seconds after their start value at
+// second `end`. A lookup walks on from the previous one, so the per
+// second cost does not depend on the schedule.
+class Timeline {
+public:
+    static constexpr uint32_t DAY = 24 * 60 * 60;
+    static constexpr uint8_t MAX_SEGMENTS = 8;
+
+    struct Segment {
+        int32_t start;   // second of the day
+        int32_t end;     // of the count down, can be past the segment
+        uint32_t length; // of the count down, 0 for fixed values
+        State state;
+        uint8_t brightnessStart, brightnessEnd;
+        uint32_t progressStart, progressEnd;
+    };
+
+    struct Point {
+        State state;
+        uint8_t brightness;
+        uint32_t progress;
+        uint32_t until; // seconds until any of them changes
+    };
+
+    // times in minutes of the day, the transition in minutes
+    void build(uint16_t sleepTime, uint16_t awakeTime, uint16_t awakeTransition);
+    Point at(uint32_t second);
+
+    uint8_t size() const { return count; }
+    const Segment &segment(uint8_t i) const { return segments[i]; }
+private:
+    Segment segments[MAX_SEGMENTS];
+    uint8_t count = 0;
+    uint8_t current = 0;
+};
+
+#endif
@@ -0,0 +1,124 @@
+// Minimal stand-in for the ESP8266 Arduino core, just enough to compile the
+// clock for the host (see [env:native] in platformio.ini).
+#ifndef __NATIVE_ARDUINO_H
+#define __NATIVE_ARDUINO_H
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+
+#include "pgmspace.h"
+
+using std::min;
+using std::max;
+
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+#define OUTPUT 0x01
+#define INPUT 0x00
+#define LOW 0x0
+#define HIGH 0x1
+
+// D1 mini pin names
+#define D0 16
+#define D1 5
+#define D2 4
+#define D3 0
+#define D4 2
+#define D5 14
+#define D6 12
+#define D7 13
+#define D8 15
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+class String {
+private:
+    std::string s;
+public:
+    String() {}
+    String(const char *c): s(c == nullptr ? "" : c) {}
+    String(const std::string &c): s(c) {}
+    String(char c): s(1, c) {}
+    String(int v): s(std::to_string(v)) {}
+    String(unsigned int v): s(std::to_string(v)) {}
+    String(long v): s(std::to_string(v)) {}
+    String(unsigned long v): s(std::to_string(v)) {}
+
+    unsigned int length() const { return s.length(); }
+    const char *c_str() const { return s.c_str(); }
+    char charAt(unsigned int i) const { return i < s.length() ? s[i] : 0; }
+    char operator[](unsigned int i) const { return charAt(i); }
+    int indexOf(char c, unsigned int from = 0) const {
+        auto r = s.find(c, from);
+        return r == std::string::npos ? -1 : (int)r;
+    }
+    String substring(unsigned int from) const { return from >= s.length() ? String() : String(s.substr(from)); }
+    String substring(unsigned int from, unsigned int to) const {
+        if (from > to) std::swap(from, to);
+        return from >= s.length() ? String() : String(s.substr(from, to - from));
+    }
+    long toInt() const { return atol(s.c_str()); }
+
+    String &operator+=(const String &o) { s += o.s; return *this; }
+    String &operator+=(const char *o) { s += o; return *this; }
+    String &operator+=(char o) { s += o; return *this; }
+    friend String operator+(const String &a, const String &b) { return String(a.s + b.s); }
+    friend String operator+(const String &a, const char *b) { return String(a.s + b); }
+    friend String operator+(const char *a, const String &b) { return String(a + b.s); }
+    bool operator==(const String &o) const { return s == o.s; }
+    bool operator!=(const String &o) const { return s != o.s; }
+    bool operator==(const char *o) const { return s == o; }
+};
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    size_t print(const char *s) { size_t n = 0; while (*s) n += write((uint8_t)*s++); return n; }
+    size_t print(const String &s) { return print(s.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(long v) { return print(String(v)); }
+    size_t print(int v) { return print(String(v)); }
+    size_t print(unsigned long v) { return print(String(v)); }
+    size_t print(unsigned int v) { return print(String(v)); }
+    size_t println() { return write('\n'); }
+    template<typename T> size_t println(const T &v) { size_t n = print(v); return n + println(); }
+    size_t printf(const char *format, ...) __attribute__ ((format (printf, 2, 3)));
+};
+
+class HardwareSerial: public Print {
+public:
+    void begin(unsigned long) {}
+    size_t write(uint8_t c) override;
+};
+extern HardwareSerial Serial;
+
+class EspClass {
+public:
+    uint32_t getCycleCount();
+    uint32_t getFreeHeap();
+    uint32_t getCpuFreqMHz();
+};
+extern EspClass ESP;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+void analogWrite(uint8_t pin, int val);
+
+// provided by the sketch
+void setup();
+void loop();
+
+#endif
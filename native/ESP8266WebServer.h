@@ -0,0 +1,7 @@
+#ifndef __NATIVE_ESP8266WEBSERVER_H
+#define __NATIVE_ESP8266WEBSERVER_H
+// Only here so config.hpp compiles; native/config.cpp replaces the web
+// interface with a fixed schedule the harness can change.
+#include <Arduino.h>
+#include <FS.h>
+#endif
@@ -0,0 +1,33 @@
+#ifndef __NATIVE_ESP8266WIFI_H
+#define __NATIVE_ESP8266WIFI_H
+#include <Arduino.h>
+#include <FS.h>
+#include <functional>
+#include <memory>
+
+enum WiFiMode_t { WIFI_OFF, WIFI_STA, WIFI_AP, WIFI_AP_STA };
+enum wl_status_t { WL_IDLE_STATUS = 0, WL_CONNECTED = 3, WL_DISCONNECTED = 6 };
+
+struct IPAddress {
+    String toString() const { return "127.0.0.1"; }
+};
+
+struct WiFiEventStationModeGotIP {};
+struct WiFiEventStationModeDisconnected {};
+typedef std::shared_ptr<void> WiFiEventHandler;
+
+// The emulated board is always connected, so the event callbacks never fire.
+class ESP8266WiFiClass {
+public:
+    void persistent(bool) {}
+    bool mode(WiFiMode_t) { return true; }
+    bool hostname(const char *) { return true; }
+    int begin(const char *, const char *) { return 0; }
+    wl_status_t status() { return WL_CONNECTED; }
+    IPAddress localIP() { return IPAddress(); }
+    WiFiEventHandler onStationModeGotIP(std::function<void(const WiFiEventStationModeGotIP &)>) { return nullptr; }
+    WiFiEventHandler onStationModeDisconnected(std::function<void(const WiFiEventStationModeDisconnected &)>) { return nullptr; }
+};
+extern ESP8266WiFiClass WiFi;
+
+#endif
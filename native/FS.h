@@ -0,0 +1,11 @@
+#ifndef __NATIVE_FS_H
+#define __NATIVE_FS_H
+#include <Arduino.h>
+
+class FS {
+public:
+    bool begin() { return true; }
+};
+extern FS SPIFFS;
+
+#endif
@@ -0,0 +1,4 @@
+#ifndef __NATIVE_SPI_H
+#define __NATIVE_SPI_H
+// The emulated panel in TFT_eSPI.h accounts SPI traffic itself.
+#endif
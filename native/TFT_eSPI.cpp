@@ -0,0 +1,437 @@
+#include <TFT_eSPI.h>
+#include "emulator.hpp"
+
+// CASET + 4 bytes, RASET + 4 bytes, RAMWR
+static constexpr uint32_t WINDOW_BYTES = 11;
+
+static inline uint16_t swap16(uint16_t c) {
+    return (c >> 8) | (c << 8);
+}
+
+static inline uint32_t readBE32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h): _width(w), _height(h), _initWidth(w), _initHeight(h), _vpW(w), _vpH(h) {
+}
+
+TFT_eSPI::~TFT_eSPI() {
+    unloadFont();
+    free(_panel);
+}
+
+void TFT_eSPI::init() {
+    if (_panel == nullptr) {
+        // panel memory lives on the display, not in the ESP heap
+        _panel = (uint16_t *)malloc(sizeof(uint16_t) * _initWidth * _initHeight);
+    }
+    memset(_panel, 0, sizeof(uint16_t) * _initWidth * _initHeight);
+    emulator::attachPanel(this, _panel);
+}
+
+void TFT_eSPI::setRotation(uint8_t r) {
+    // the emulated panel memory is kept in the rotated orientation
+    if (r & 1) {
+        _width = _initHeight;
+        _height = _initWidth;
+    }
+    else {
+        _width = _initWidth;
+        _height = _initHeight;
+    }
+    resetViewport();
+}
+
+void TFT_eSPI::setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool) {
+    _vpX = max(x, (int32_t)0);
+    _vpY = max(y, (int32_t)0);
+    _vpW = min(x + w, (int32_t)_width);
+    _vpH = min(y + h, (int32_t)_height);
+}
+
+void TFT_eSPI::resetViewport() {
+    _vpX = _vpY = 0;
+    _vpW = _width;
+    _vpH = _height;
+}
+
+void TFT_eSPI::setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
+    _winX0 = _winX = x0;
+    _winY0 = _winY = y0;
+    _winX1 = x1;
+    _winY1 = y1;
+    emulator::spiTransfer(WINDOW_BYTES);
+    emulator::stats().spiWindows++;
+    emulator::stats().spiBytes += WINDOW_BYTES;
+    emulator::traceWindow(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+}
+
+void TFT_eSPI::writePixel(uint16_t color) {
+    emulator::stats().spiBytes += 2;
+    emulator::stats().panelPixels++;
+    if (_winY > _winY1) {
+        return; // overflowing the window, the panel ignores it
+    }
+    if (_winX >= 0 && _winX < _width && _winY >= 0 && _winY < _height) {
+        _panel[_winY * _width + _winX] = color;
+    }
+    if (++_winX > _winX1) {
+        _winX = _winX0;
+        _winY++;
+    }
+}
+
+void TFT_eSPI::pushBlock(uint16_t color, uint32_t len) {
+    emulator::spiTransfer(len * 2);
+    while (len--) {
+        writePixel(color);
+    }
+}
+
+void TFT_eSPI::setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h) {
+    setWindow(x, y, x + w - 1, y + h - 1);
+}
+
+void TFT_eSPI::pushPixels(const void *data, uint32_t len) {
+    const uint16_t *d = (const uint16_t *)data;
+    emulator::spiTransfer(len * 2);
+    while (len--) {
+        writePixel(_swapBytes ? *d : swap16(*d));
+        d++;
+    }
+}
+
+void TFT_eSPI::pushFifo(const uint16_t *data, uint8_t len) {
+    emulator::spiStart(len * 2);
+    while (len--) {
+        writePixel(swap16(*data++));
+    }
+}
+
+bool TFT_eSPI::fifoBusy() const {
+    return emulator::spiBusy();
+}
+
+void TFT_eSPI::pushColor(uint16_t color, uint32_t len) {
+    pushBlock(color, len);
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color) {
+    if (x < _vpX || y < _vpY || x >= _vpW || y >= _vpH) {
+        return;
+    }
+    setWindow(x, y, x, y);
+    emulator::spiTransfer(2);
+    writePixel(color);
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    if (x < _vpX) { w -= _vpX - x; x = _vpX; }
+    if (y < _vpY) { h -= _vpY - y; y = _vpY; }
+    if (x + w > _vpW) w = _vpW - x;
+    if (y + h > _vpH) h = _vpH - y;
+    if (w < 1 || h < 1) {
+        return;
+    }
+    setWindow(x, y, x + w - 1, y + h - 1);
+    pushBlock(color, w * h);
+}
+
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y) {
+    if (x < 0 || y < 0 || x >= _width || y >= _height) {
+        return 0;
+    }
+    return _panel[y * _width + x];
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data) {
+    int32_t dx = 0, dy = 0, dw = w, dh = h;
+    if (x < _vpX) { dx = _vpX - x; dw -= dx; x = _vpX; }
+    if (y < _vpY) { dy = _vpY - y; dh -= dy; y = _vpY; }
+    if (x + dw > _vpW) dw = _vpW - x;
+    if (y + dh > _vpH) dh = _vpH - y;
+    if (dw < 1 || dh < 1) {
+        return;
+    }
+    setWindow(x, y, x + dw - 1, y + dh - 1);
+    for (int32_t row = 0; row < dh; row++) {
+        pushPixels(data + ((row + dy) * w) + dx, dw);
+    }
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data, uint16_t transparent) {
+    for (int32_t row = 0; row < h; row++) {
+        if (y + row < _vpY || y + row >= _vpH) {
+            continue;
+        }
+        const uint16_t *line = data + (row * w);
+        int32_t col = 0;
+        while (col < w) {
+            // one window per run of opaque pixels, like TFT_eSPI does
+            while (col < w && (_swapBytes ? line[col] : swap16(line[col])) == transparent) {
+                col++;
+            }
+            int32_t start = col;
+            while (col < w && (_swapBytes ? line[col] : swap16(line[col])) != transparent) {
+                col++;
+            }
+            int32_t from = max(start, _vpX - x), to = min(col, _vpW - x);
+            if (to > from) {
+                setWindow(x + from, y + row, x + to - 1, y + row);
+                pushPixels(line + from, to - from);
+            }
+        }
+    }
+}
+
+uint16_t TFT_eSPI::alphaBlend(uint8_t alpha, uint16_t fgc, uint16_t bgc) {
+    // copy of the TFT_eSPI fixed point blend
+    uint16_t fgR = ((fgc >> 10) & 0x3E) + 1;
+    uint16_t fgG = ((fgc >>  4) & 0x7E) + 1;
+    uint16_t fgB = ((fgc <<  1) & 0x3E) + 1;
+
+    uint16_t bgR = ((bgc >> 10) & 0x3E) + 1;
+    uint16_t bgG = ((bgc >>  4) & 0x7E) + 1;
+    uint16_t bgB = ((bgc <<  1) & 0x3E) + 1;
+
+    uint16_t r = (((fgR * alpha) + (bgR * (255 - alpha))) >> 9);
+    uint16_t g = (((fgG * alpha) + (bgG * (255 - alpha))) >> 9);
+    uint16_t b = (((fgB * alpha) + (bgB * (255 - alpha))) >> 9);
+
+    return (r << 11) | (g << 5) | (b << 0);
+}
+
+void TFT_eSPI::loadFont(const uint8_t array[]) {
+    if (_fontLoaded) {
+        unloadFont();
+    }
+    _font.data = array;
+    _font.count = readBE32(array);
+    _font.yAdvance = readBE32(array + 8);
+    _font.spaceWidth = _font.yAdvance / 4;
+    _font.ascent = readBE32(array + 16);
+    _font.descent = readBE32(array + 20);
+    _font.maxAscent = _font.ascent;
+    _font.maxDescent = _font.descent;
+    _font.glyphs = new Glyph[_font.count];
+
+    const uint8_t *record = array + 24;
+    uint32_t bitmap = 24 + (_font.count * 28);
+    for (uint16_t i = 0; i < _font.count; i++, record += 28) {
+        Glyph &g = _font.glyphs[i];
+        g.code = readBE32(record);
+        g.height = readBE32(record + 4);
+        g.width = readBE32(record + 8);
+        g.xAdvance = readBE32(record + 12);
+        g.dY = (int32_t)readBE32(record + 16);
+        g.dX = (int32_t)readBE32(record + 20);
+        g.bitmap = bitmap;
+        bitmap += g.width * g.height;
+        if (g.code == ' ') {
+            _font.spaceWidth = g.xAdvance;
+        }
+        if (g.code > 0x20 && g.code < 0x7F) {
+            _font.maxAscent = max<int16_t>(_font.maxAscent, g.dY);
+            _font.maxDescent = max<int16_t>(_font.maxDescent, g.height - g.dY);
+        }
+    }
+    _fontLoaded = true;
+}
+
+void TFT_eSPI::unloadFont() {
+    if (_fontLoaded) {
+        delete[] _font.glyphs;
+        _font = {};
+        _fontLoaded = false;
+    }
+}
+
+const TFT_eSPI::Glyph *TFT_eSPI::findGlyph(uint32_t code) const {
+    for (uint16_t i = 0; i < _font.count; i++) {
+        if (_font.glyphs[i].code == code) {
+            return &_font.glyphs[i];
+        }
+    }
+    return nullptr;
+}
+
+int16_t TFT_eSPI::textWidth(const String &txt) {
+    if (!_fontLoaded) {
+        return txt.length() * 6;
+    }
+    int16_t width = 0;
+    for (unsigned int i = 0; i < txt.length(); i++) {
+        const Glyph *g = findGlyph((uint8_t)txt[i]);
+        width += g == nullptr ? _font.spaceWidth : g->xAdvance;
+    }
+    return width;
+}
+
+void TFT_eSPI::drawGlyph(uint32_t code) {
+    if (code == '\n') {
+        _cursorX = 0;
+        _cursorY += _font.yAdvance;
+        return;
+    }
+    const Glyph *g = findGlyph(code);
+    if (g == nullptr) {
+        _cursorX += _font.spaceWidth;
+        return;
+    }
+    const int32_t x = _cursorX + g->dX;
+    const int32_t y = _cursorY + _font.maxAscent - g->dY;
+    const uint8_t *bits = _font.data + g->bitmap;
+    for (int32_t cy = 0; cy < g->height; cy++) {
+        int32_t run = 0;
+        for (int32_t cx = 0; cx < g->width; cx++) {
+            uint8_t alpha = pgm_read_byte(bits + (cy * g->width) + cx);
+            if (alpha == 0xFF) {
+                run++;
+                continue;
+            }
+            if (run) {
+                drawFastHLine(x + cx - run, y + cy, run, _textColor);
+                run = 0;
+            }
+            if (alpha) {
+                drawPixel(x + cx, y + cy, alphaBlend(alpha, _textColor, glyphBackground(x + cx, y + cy)));
+            }
+        }
+        if (run) {
+            drawFastHLine(x + g->width - run, y + cy, run, _textColor);
+        }
+    }
+    _cursorX += g->xAdvance;
+}
+
+int16_t TFT_eSPI::drawString(const String &txt, int32_t x, int32_t y, uint8_t) {
+    if (!_fontLoaded) {
+        return 0; // the built-in GLCD fonts are not emulated
+    }
+    const int16_t w = textWidth(txt);
+    const int16_t h = fontHeight();
+    switch (_textDatum) {
+        case TC_DATUM: x -= w / 2; break;
+        case TR_DATUM: x -= w; break;
+        case ML_DATUM: y -= h / 2; break;
+        case MC_DATUM: x -= w / 2; y -= h / 2; break;
+        case MR_DATUM: x -= w; y -= h / 2; break;
+        case BL_DATUM: y -= h; break;
+        case BC_DATUM: x -= w / 2; y -= h; break;
+        case BR_DATUM: x -= w; y -= h; break;
+    }
+    _cursorX = x;
+    _cursorY = y;
+    for (unsigned int i = 0; i < txt.length(); i++) {
+        drawGlyph((uint8_t)txt[i]);
+    }
+    return w;
+}
+
+size_t TFT_eSPI::write(uint8_t c) {
+    if (_fontLoaded) {
+        drawGlyph(c);
+    }
+    return 1;
+}
+
+TFT_eSprite::TFT_eSprite(TFT_eSPI *tft): TFT_eSPI(0, 0), _tft(tft) {
+}
+
+TFT_eSprite::~TFT_eSprite() {
+    deleteSprite();
+}
+
+void *TFT_eSprite::createSprite(int16_t w, int16_t h) {
+    deleteSprite();
+    _img = new uint16_t[w * h]();
+    _width = w;
+    _height = h;
+    return _img;
+}
+
+void TFT_eSprite::deleteSprite() {
+    delete[] _img;
+    _img = nullptr;
+    _width = _height = 0;
+}
+
+void TFT_eSprite::drawPixel(int32_t x, int32_t y, uint32_t color) {
+    if (x < 0 || y < 0 || x >= _width || y >= _height) {
+        return;
+    }
+    _img[y * _width + x] = swap16(color);
+    emulator::stats().spritePixels++;
+}
+
+void TFT_eSprite::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > _width) w = _width - x;
+    if (y + h > _height) h = _height - y;
+    for (int32_t row = y; row < y + h; row++) {
+        for (int32_t col = x; col < x + w; col++) {
+            _img[row * _width + col] = swap16(color);
+        }
+    }
+    if (w > 0 && h > 0) {
+        emulator::stats().spritePixels += w * h;
+    }
+}
+
+uint16_t TFT_eSprite::readPixel(int32_t x, int32_t y) {
+    if (x < 0 || y < 0 || x >= _width || y >= _height) {
+        return 0xFFFF;
+    }
+    emulator::stats().spriteReads++;
+    return swap16(_img[y * _width + x]);
+}
+
+void TFT_eSprite::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data) {
+    for (int32_t row = 0; row < h; row++) {
+        if (y + row < 0 || y + row >= _height) {
+            continue;
+        }
+        for (int32_t col = 0; col < w; col++) {
+            if (x + col < 0 || x + col >= _width) {
+                continue;
+            }
+            uint16_t c = data[(row * w) + col];
+            _img[((y + row) * _width) + x + col] = _swapBytes ? swap16(c) : c;
+            emulator::stats().spritePixels++;
+        }
+    }
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y) {
+    bool swap = _tft->getSwapBytes();
+    _tft->setSwapBytes(false);
+    _tft->pushImage(x, y, _width, _height, _img);
+    _tft->setSwapBytes(swap);
+}
+
+bool TFT_eSprite::pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh) {
+    if (sx < 0) { sw += sx; tx -= sx; sx = 0; }
+    if (sy < 0) { sh += sy; ty -= sy; sy = 0; }
+    if (sx + sw > _width) sw = _width - sx;
+    if (sy + sh > _height) sh = _height - sy;
+    if (sw < 1 || sh < 1) {
+        return false;
+    }
+    bool swap = _tft->getSwapBytes();
+    _tft->setSwapBytes(false);
+    // one window for the whole area, like TFT_eSPI does
+    _tft->setAddrWindow(tx, ty, sw, sh);
+    for (int32_t row = 0; row < sh; row++) {
+        _tft->pushPixels(_img + ((sy + row) * _width) + sx, sw);
+    }
+    _tft->setSwapBytes(swap);
+    return true;
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y, uint16_t transparent) {
+    bool swap = _tft->getSwapBytes();
+    _tft->setSwapBytes(false);
+    _tft->pushImage(x, y, _width, _height, _img, transparent);
+    _tft->setSwapBytes(swap);
+}
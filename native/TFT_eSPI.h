@@ -0,0 +1,176 @@
+// Stand-in for bodmer/TFT_eSPI driving an emulated ST7735 (128x160). Only
+// the API the clock uses is provided. Every panel write goes through
+// setWindow()/pushBlock() so the emulator can count SPI windows and bytes;
+// sprites count the pixels they write and read back.
+#ifndef __NATIVE_TFT_ESPI_H
+#define __NATIVE_TFT_ESPI_H
+#include <Arduino.h>
+#include "emulator.hpp"
+
+#define TFT_WIDTH  128
+#define TFT_HEIGHT 160
+#define SPI_FREQUENCY (emulator::spiClock()) // 27 MHz as in Setup2_ST7735.h
+
+#define TFT_BLACK       0x0000
+#define TFT_NAVY        0x000F
+#define TFT_DARKGREEN   0x03E0
+#define TFT_DARKCYAN    0x03EF
+#define TFT_MAROON      0x7800
+#define TFT_PURPLE      0x780F
+#define TFT_OLIVE       0x7BE0
+#define TFT_LIGHTGREY   0xD69A
+#define TFT_DARKGREY    0x7BEF
+#define TFT_BLUE        0x001F
+#define TFT_GREEN       0x07E0
+#define TFT_CYAN        0x07FF
+#define TFT_RED         0xF800
+#define TFT_MAGENTA     0xF81F
+#define TFT_YELLOW      0xFFE0
+#define TFT_WHITE       0xFFFF
+#define TFT_ORANGE      0xFDA0
+#define TFT_TRANSPARENT 0x0120
+
+#define TL_DATUM 0
+#define TC_DATUM 1
+#define TR_DATUM 2
+#define ML_DATUM 3
+#define CL_DATUM 3
+#define MC_DATUM 4
+#define CC_DATUM 4
+#define MR_DATUM 5
+#define CR_DATUM 5
+#define BL_DATUM 6
+#define BC_DATUM 7
+#define BR_DATUM 8
+
+class TFT_eSPI: public Print {
+public:
+    TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT);
+    virtual ~TFT_eSPI();
+
+    void init();
+    void setRotation(uint8_t r);
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+
+    // only clipping viewports are emulated (vpDatum = false)
+    void setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum = true);
+    void resetViewport();
+
+    void setSwapBytes(bool swap) { _swapBytes = swap; }
+    bool getSwapBytes() const { return _swapBytes; }
+
+    virtual void drawPixel(int32_t x, int32_t y, uint32_t color);
+    virtual void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    virtual uint16_t readPixel(int32_t x, int32_t y);
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) { fillRect(x, y, w, 1, color); }
+    void fillScreen(uint32_t color) { fillRect(0, 0, _width, _height, color); }
+
+    virtual void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data);
+    virtual void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data, uint16_t transparent);
+
+    // raw panel access, as in TFT_eSPI
+    void setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h);
+    void pushPixels(const void *data, uint32_t len);
+    void pushColor(uint16_t color, uint32_t len);
+    void startWrite() {}
+    void endWrite() {}
+
+    // the ESP8266 SPI FIFO as SpiPipe drives it: up to 32 pixels, already
+    // in lcd byte order, are started and the call returns right away
+    void pushFifo(const uint16_t *data, uint8_t len);
+    bool fifoBusy() const;
+
+    uint16_t alphaBlend(uint8_t alpha, uint16_t fgc, uint16_t bgc);
+
+    // smooth (vlw) fonts
+    void loadFont(const uint8_t array[]);
+    void unloadFont();
+    bool fontLoaded() const { return _fontLoaded; }
+    void setTextColor(uint16_t color) { _textColor = color; _textBgColor = color; }
+    void setTextColor(uint16_t fg, uint16_t bg) { _textColor = fg; _textBgColor = bg; }
+    void setTextDatum(uint8_t datum) { _textDatum = datum; }
+    void setCursor(int16_t x, int16_t y) { _cursorX = x; _cursorY = y; }
+    int16_t fontHeight() const { return _fontLoaded ? _font.yAdvance : 8; }
+    int16_t textWidth(const String &txt);
+    int16_t drawString(const String &txt, int32_t x, int32_t y, uint8_t font = 1);
+    int16_t drawCentreString(const String &txt, int32_t x, int32_t y, uint8_t font) {
+        uint8_t d = _textDatum;
+        _textDatum = TC_DATUM;
+        int16_t w = drawString(txt, x, y, font);
+        _textDatum = d;
+        return w;
+    }
+    int16_t drawNumber(long n, int32_t x, int32_t y, uint8_t font = 1) { return drawString(String(n), x, y, font); }
+    size_t write(uint8_t c) override;
+
+protected:
+    int16_t _width, _height;
+    const int16_t _initWidth, _initHeight;
+    bool _swapBytes = false;
+    int32_t _vpX = 0, _vpY = 0, _vpW, _vpH; // clip area, right and bottom exclusive
+
+    // emulated panel memory and the active address window
+    uint16_t *_panel = nullptr;
+    int32_t _winX0 = 0, _winY0 = 0, _winX1 = -1, _winY1 = -1, _winX = 0, _winY = 0;
+    void setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+    void pushBlock(uint16_t color, uint32_t len);
+    void writePixel(uint16_t color);
+
+    // same field widths as the metric tables TFT_eSPI allocates
+    struct Glyph {
+        uint16_t code;
+        uint8_t height, width, xAdvance;
+        int16_t dY;
+        int8_t dX;
+        uint32_t bitmap; // offset into the font array
+    };
+    struct Font {
+        const uint8_t *data;
+        uint16_t count, yAdvance, spaceWidth;
+        int16_t ascent, descent, maxAscent, maxDescent;
+        Glyph *glyphs;
+    } _font = {};
+    bool _fontLoaded = false;
+    uint16_t _textColor = TFT_WHITE, _textBgColor = TFT_BLACK;
+    uint8_t _textDatum = TL_DATUM;
+    int32_t _cursorX = 0, _cursorY = 0;
+
+    const Glyph *findGlyph(uint32_t code) const;
+    void drawGlyph(uint32_t code);
+    // background used to blend anti-aliased glyph edges
+    virtual uint16_t glyphBackground(int32_t x, int32_t y) { return _textBgColor; }
+};
+
+class TFT_eSprite: public TFT_eSPI {
+public:
+    explicit TFT_eSprite(TFT_eSPI *tft);
+    ~TFT_eSprite();
+
+    void *createSprite(int16_t w, int16_t h);
+    void deleteSprite();
+    bool created() const { return _img != nullptr; }
+    void *getPointer() { return _img; }
+
+    void drawPixel(int32_t x, int32_t y, uint32_t color) override;
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) override;
+    uint16_t readPixel(int32_t x, int32_t y) override;
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data) override;
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data, uint16_t transparent) override {
+        pushImage(x, y, w, h, data);
+    }
+
+    void pushSprite(int32_t x, int32_t y);
+    void pushSprite(int32_t x, int32_t y, uint16_t transparent);
+    // push the sw * sh area at sx, sy of the sprite to tx, ty
+    bool pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh);
+
+protected:
+    TFT_eSPI *_tft;
+    uint16_t *_img = nullptr; // stored byte swapped, ready for SPI
+    uint16_t glyphBackground(int32_t x, int32_t y) override {
+        return _textColor == _textBgColor ? readPixel(x, y) : _textBgColor;
+    }
+};
+
+#endif
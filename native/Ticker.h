@@ -0,0 +1,25 @@
+// Stand-in for the ESP8266 core's Ticker: the emulator fires it when the
+// virtual clock passes its deadline inside delay()/delayMicroseconds(),
+// like the SDK runs its timers while the sketch yields.
+#ifndef __NATIVE_TICKER_H
+#define __NATIVE_TICKER_H
+#include <Arduino.h>
+#include <functional>
+
+class Ticker {
+public:
+    typedef std::function<void(void)> callback_function_t;
+    ~Ticker() { detach(); }
+    void once_ms(uint32_t milliseconds, callback_function_t callback);
+    void detach();
+    bool active() const { return armed; }
+    // the emulator's side
+    uint64_t deadline() const { return due; }
+    void fire();
+private:
+    callback_function_t callback;
+    uint64_t due = 0;
+    bool armed = false;
+};
+
+#endif
@@ -0,0 +1,743 @@
+#include <Arduino.h>
+#include "bench.hpp"
+#include "needle.hpp"
+#include "face.hpp"
+#include "blend.hpp"
+#include "mask_cache.hpp"
+#include "display.hpp"
+#include "packed_image.hpp"
+#include "text_cache.hpp"
+#include "texts.hpp"
+#include "timeline.hpp"
+#include "schedule.hpp"
+#include <TFT_eSPI.h>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "NotoFox64-flatten.h"
+#include "NotoFrog64-flatten.h"
+#include "NotoGiraffe64-flatten.h"
+#include "cat-paw.h"
+#include "cat-watch-face.h"
+#include "cat-watch-face-dial.h"
+#include "packed-images.h"
+#include "cat-watch-face-dial-packed.h"
+#include "NotoSansBold15.h"
+#include "NotoSansBold36.h"
+
+static constexpr uint32_t FACE_SIZE = CLOCK_RADIUS * 2;
+static constexpr int REPEATS = 20;
+
+struct NeedleEnd {
+    float x, y;
+};
+
+// all needles are in one array, so a needle knows its index
+static const NeedleEnd *needleBase;
+
+static float fixPosition(float x) {
+    return x <= 90 ? x + 270 : x - 90;
+}
+
+// the double precision geometry Display::drawNeedle had before the tables
+static NeedleEnd doubleEnd(float angle, uint16_t length) {
+    const double rad = DEG_TO_RAD * (uint32_t)angle;
+    return { (float)(CLOCK_RADIUS + (length * cos(rad))), (float)(CLOCK_RADIUS + (length * sin(rad))) };
+}
+
+static void allNeedles(NeedleEnd *minutes, NeedleEnd *hours) {
+    needleBase = minutes;
+    for (int m = 0; m < 60; m++) {
+        minutes[m] = doubleEnd(fixPosition(6.0f * m), MINUTE_LENGTH);
+    }
+    for (int h = 0; h < 12 * 60; h++) {
+        hours[h] = doubleEnd(fixPosition(30.0f * (h / 60 + ((h % 60) / 60.0f))), HOUR_LENGTH);
+    }
+}
+
+// The flash tables of src/face.cpp against the double precision cos/sin
+// that Display::showTime and drawDial used before: every needle position
+// of a 12 hour day and the numerals. Returns the number that differ.
+static int checkDialGeometry() {
+    auto same = [](float angle, uint16_t length, const DialPoint &point) {
+        const NeedleEnd end = doubleEnd(angle, length);
+        return lroundf(end.x * 65536) == point.x && lroundf(end.y * 65536) == point.y;
+    };
+    int differing = 0;
+    for (uint8_t hour = 0; hour < 12; hour++) {
+        for (uint8_t minute = 0; minute < 60; minute++) {
+            const float hourPosition = (360 / 12.0) * (hour + (minute / 60.0));
+            if (!same(fixPosition(hourPosition), HOUR_LENGTH, needleEnd(HOUR_LENGTH, hourDegrees(hour, minute)))) {
+                printf("dial tables: hour needle end at %u:%02u differs\n", hour, minute);
+                differing++;
+            }
+        }
+    }
+    for (uint8_t minute = 0; minute < 60; minute++) {
+        if (!same(fixPosition((360 / 60.0) * minute), MINUTE_LENGTH, needleEnd(MINUTE_LENGTH, minuteDegrees(minute)))) {
+            printf("dial tables: minute needle end at %u differs\n", minute);
+            differing++;
+        }
+    }
+    for (uint32_t h = 0; h < 12; h++) {
+        const double rad = DEG_TO_RAD * (h * HOUR_ANGLE);
+        const DialPoint center = numeralCenter(h);
+        if (round(CLOCK_RADIUS + (NUMERAL_OFFSET * cos(rad))) != center.x
+            || round(CLOCK_RADIUS + (NUMERAL_OFFSET * sin(rad))) != center.y) {
+            printf("dial tables: centre of numeral %u differs\n", h);
+            differing++;
+        }
+    }
+    return differing;
+}
+
+struct AlphaBuffer {
+    uint8_t pixels[FACE_SIZE * FACE_SIZE];
+    void clear() { memset(pixels, 0, sizeof(pixels)); }
+    void plot(int16_t x, int16_t y, uint8_t alpha) {
+        if (x >= 0 && y >= 0 && x < (int16_t)FACE_SIZE && y < (int16_t)FACE_SIZE) {
+            pixels[(y * FACE_SIZE) + x] = alpha;
+        }
+    }
+};
+
+// updateState() as it was before the timeline, for one second of the day
+static Timeline::Point scheduleAt(uint32_t second, uint16_t sleepTime, uint16_t awakeTime, uint16_t awakeTransition) {
+    const int time = second / 60;
+    Timeline::Point p = { Sleeping, 80, 0, 0 };
+    if (time > sleepTime) {
+        return p;
+    }
+    if (time < awakeTime) {
+        auto toWait = ((uint32_t)awakeTime * 60) - second;
+        const uint32_t transition = (uint32_t)awakeTransition * 60;
+        if (toWait < transition) {
+            p = { WakingUp, 160, PROGRESS_FULL - (uint32_t)(((uint64_t)toWait * PROGRESS_FULL) / transition), 0 };
+        }
+        else if (toWait < (2 * transition)) {
+            toWait -= transition;
+            p = { Sleeping, 120, PROGRESS_FULL - (uint32_t)(((uint64_t)toWait * PROGRESS_FULL) / transition), 0 };
+        }
+        return p;
+    }
+    return { Awake, (uint8_t)(time - awakeTime < 30 || sleepTime - time < 10 ? 200 : 80), PROGRESS_FULL, 0 };
+}
+
+// The timeline of a range of schedules against updateState() as it was,
+// for every second of the day. Returns the number of mismatches.
+static int checkTimeline() {
+    static const uint16_t times[] = { 0, 1, 6 * 60, 7 * 60, 7 * 60 + 2, 12 * 60, 19 * 60, 23 * 60 + 50, 23 * 60 + 59 };
+    static const uint16_t transitions[] = { 0, 1, 5, 30, 300, 2000 };
+    auto same = [](const Timeline::Point &a, const Timeline::Point &b) {
+        return a.state == b.state && a.brightness == b.brightness && a.progress == b.progress;
+    };
+    int failures = 0;
+    auto fail = [&failures](const char *what, uint16_t sleepTime, uint16_t awakeTime, uint16_t transition, uint32_t second) {
+        if (failures++ < 10) {
+            printf("timeline: %s for sleep %02u:%02u, awake %02u:%02u, %u minutes at second %u\n", what,
+                sleepTime / 60, sleepTime % 60, awakeTime / 60, awakeTime % 60, transition, second);
+        }
+    };
+    uint32_t viaTimeline = UINT32_MAX, viaSchedule = UINT32_MAX;
+    Timeline timeline;
+    for (uint16_t sleepTime : times) {
+        for (uint16_t awakeTime : times) {
+            for (uint16_t transition : transitions) {
+                timeline.build(sleepTime, awakeTime, transition);
+                for (uint8_t i = 1; i < timeline.size(); i++) {
+                    if (timeline.segment(i).start <= timeline.segment(i - 1).start) {
+                        fail("segments out of order", sleepTime, awakeTime, transition, timeline.segment(i).start);
+                    }
+                }
+                Timeline::Point previous = {};
+                for (uint32_t second = 0; second < Timeline::DAY; second++) {
+                    const Timeline::Point point = timeline.at(second);
+                    if (!same(point, scheduleAt(second, sleepTime, awakeTime, transition))) {
+                        fail("differs from updateState()", sleepTime, awakeTime, transition, second);
+                    }
+                    // nothing changes before `until` runs out, and something does then
+                    if (second > 0 && previous.until > 1 && (!same(point, previous) || point.until != previous.until - 1)) {
+                        fail("changes before the wait is over", sleepTime, awakeTime, transition, second);
+                    }
+                    const uint32_t next = second + point.until;
+                    if (point.until > 1 && next < Timeline::DAY && same(point, scheduleAt(next, sleepTime, awakeTime, transition))) {
+                        fail("nothing changes when the wait is over", sleepTime, awakeTime, transition, second);
+                    }
+                    previous = point;
+                }
+            }
+        }
+    }
+    // a day of lookups with the default schedule
+    timeline.build(19 * 60, 7 * 60, 5);
+    for (int r = 0; r < REPEATS; r++) {
+        uint32_t sum = 0;
+        uint32_t start = ESP.getCycleCount();
+        for (uint32_t second = 0; second < Timeline::DAY; second++) {
+            sum += timeline.at(second).progress;
+        }
+        viaTimeline = min(viaTimeline, ESP.getCycleCount() - start);
+        start = ESP.getCycleCount();
+        for (uint32_t second = 0; second < Timeline::DAY; second++) {
+            sum += scheduleAt(second, 19 * 60, 7 * 60, 5).progress;
+        }
+        viaSchedule = min(viaSchedule, ESP.getCycleCount() - start);
+        if (sum == 1) {
+            printf("unlikely\n");
+        }
+    }
+    printf("timeline: %.1f cycles a lookup, %.1f recomputing the schedule\n",
+        (double)viaTimeline / Timeline::DAY, (double)viaSchedule / Timeline::DAY);
+    return failures;
+}
+
+// The weekday and exception lookups, the stored bytes and the settings
+// page's exception lines. Returns the number of failed checks.
+static int checkWeekSchedule() {
+    int failures = 0;
+    auto expect = [&failures](bool ok, const char *what, int value) {
+        if (!ok && failures++ < 10) {
+            printf("week schedule: %s (%d)\n", what, value);
+        }
+    };
+    const DaySchedule school = { 19 * 60, 7 * 60, 5 }, weekend = { 20 * 60, 8 * 60, 10 };
+    const DaySchedule holiday = { 21 * 60, 9 * 60, 15 }, party = { 22 * 60 + 30, 9 * 60 + 30, 0 };
+
+    // the weekdays, 1970-01-01 was a Thursday
+    WeekSchedule week;
+    week.clear(school);
+    expect(week.setWeekday(0, weekend) && week.setWeekday(6, weekend), "weekend not set", 0);
+    expect(!week.setWeekday(7, holiday), "weekday 7 accepted", 7);
+    for (uint16_t day = 0; day < 14; day++) {
+        const uint8_t weekday = (day + 4) % 7;
+        expect(week.forDay(day) == (weekday == 0 || weekday == 6 ? weekend : school), "wrong weekday schedule", day);
+    }
+    // binary search edges: before, on and after the first and last
+    // exception, and a date in between two of them
+    const uint16_t christmas = WeekSchedule::dayNumber(2026, 12, 25);
+    const uint16_t newYear = WeekSchedule::dayNumber(2027, 1, 1);
+    const uint16_t party1 = WeekSchedule::dayNumber(2027, 2, 14);
+    expect(week.forDay(christmas) == school, "no exceptions yet", christmas);
+    expect(week.setException(newYear, party) && week.setException(christmas, holiday), "exceptions not set", 0);
+    expect(week.forDay(christmas) == holiday && week.forDay(newYear) == party, "single exceptions", 0);
+    expect(week.setException(party1, party), "exception not set", party1);
+    expect(week.exceptionCount() == 3 && week.exceptionDay(0) == christmas && week.exceptionDay(2) == party1, "exceptions not sorted", 0);
+    expect(week.forDay(christmas - 1) == school, "day before the first exception", christmas - 1);
+    expect(week.forDay(christmas) == holiday, "first exception", christmas);
+    expect(week.forDay(christmas + 2) == weekend, "between exceptions", christmas + 2); // a Sunday
+    expect(week.forDay(newYear) == party, "middle exception", newYear);
+    expect(week.forDay(party1) == party, "last exception", party1);
+    expect(week.forDay(party1 + 1) == school, "day after the last exception", party1 + 1);
+    expect(week.setException(newYear, holiday) && week.exceptionCount() == 3 && week.forDay(newYear) == holiday, "exception not replaced", newYear);
+    expect(week.forDay(0) == school && week.forDay(UINT16_MAX) == school, "ends of the day range", 0); // Thursdays
+
+    // stored and read back, and as the 6 bytes older firmware reads
+    uint8_t data[WeekSchedule::MAX_BYTES];
+    WeekSchedule stored, old;
+    expect(stored.read(data, week.write(data)) && old.read(data, 6), "not read back", 0);
+    expect(!old.read(data, 5), "5 bytes read", 5);
+    for (uint16_t day = christmas - 7; day < party1 + 7; day++) {
+        expect(stored.forDay(day) == week.forDay(day), "stored schedule differs", day);
+        expect(old.forDay(day) == school, "6 byte schedule differs", day);
+    }
+
+    // dates, and the exception lines of the settings page
+    expect(WeekSchedule::dayNumber(1970, 1, 1) == 0, "1970-01-01", 0);
+    expect(WeekSchedule::dayNumber(2000, 3, 1) == 11017, "2000-03-01", 11017);
+    expect(WeekSchedule::dayNumber(2024, 2, 29) == 19782, "2024-02-29", 19782);
+    expect(WeekSchedule::dayNumber(2149, 6, 6) == UINT16_MAX, "2149-06-06", UINT16_MAX);
+    for (uint32_t day = 0; day <= UINT16_MAX; day++) {
+        int32_t year;
+        uint32_t month, dayOfMonth;
+        WeekSchedule::date(day, year, month, dayOfMonth);
+        expect(WeekSchedule::dayNumber(year, month, dayOfMonth) == (int32_t)day, "date does not round trip", day);
+    }
+    WeekSchedule parsed;
+    expect(parsed.parseExceptions("2027-02-14 22:30 0 09:30\ngarbage\n2026-02-30 19:00 5 07:00\n"
+        "2026-12-25 21:00 15 09:00\n2027-01-01 21:00 15 09:00\n2026-13-01 19:00 5 07:00\n2026-12-26 25:00 5 07:00"),
+        "exception lines rejected", 0);
+    char line[64];
+    const char *lines[] = { "2026-12-25 21:00 15 09:00", "2027-01-01 21:00 15 09:00", "2027-02-14 22:30 0 09:30" };
+    expect(parsed.exceptionCount() == 3, "invalid exception lines kept", parsed.exceptionCount());
+    for (uint8_t i = 0; i < parsed.exceptionCount() && i < 3; i++) {
+        parsed.formatException(i, line, sizeof(line));
+        expect(strcmp(line, lines[i]) == 0, "exception line differs", i);
+    }
+    String full;
+    for (uint16_t i = 0; i <= WeekSchedule::MAX_EXCEPTIONS; i++) {
+        int32_t year;
+        uint32_t month, day;
+        WeekSchedule::date(20000 + i, year, month, day);
+        snprintf(line, sizeof(line), "%04d-%02u-%02u 19:00 5 07:00\n", (int)year, (unsigned)month, (unsigned)day);
+        full += line;
+    }
+    expect(!WeekSchedule().parseExceptions(full), "too many exceptions accepted", WeekSchedule::MAX_EXCEPTIONS + 1);
+    // the settings page drops the days before today, the full table then fits again
+    WeekSchedule pruned;
+    expect(pruned.parseExceptions(full + "2026-12-25 21:00 15 09:00", 20060), "past exceptions kept", 20060);
+    expect(pruned.exceptionCount() == 6 && pruned.exceptionDay(0) == 20060 && pruned.exceptionDay(5) == christmas,
+        "wrong exceptions after dropping the past", pruned.exceptionCount());
+
+    // random weeks against a linear search
+    srand(25);
+    auto randomSchedule = []() {
+        return DaySchedule { (uint16_t)(rand() % 1440), (uint16_t)(rand() % 1440), (uint16_t)(rand() % 60) };
+    };
+    uint32_t cycles[2] = { UINT32_MAX, UINT32_MAX };
+    for (int round = 0; round < 200; round++) {
+        WeekSchedule random;
+        DaySchedule weekdays[7];
+        std::vector<std::pair<uint16_t, DaySchedule>> exceptions; // last one of a day wins
+        for (uint8_t d = 0; d < 7; d++) {
+            weekdays[d] = d > 0 && rand() % 2 ? weekdays[0] : randomSchedule();
+        }
+        random.clear(weekdays[0]);
+        for (uint8_t d = 0; d < 7; d++) {
+            random.setWeekday(d, weekdays[d]);
+        }
+        const uint16_t first = 20000 + (rand() % 1000);
+        for (int i = 0; i < WeekSchedule::MAX_EXCEPTIONS + 8; i++) {
+            const uint16_t day = first + (rand() % 400);
+            const DaySchedule schedule = rand() % 4 ? weekdays[rand() % 7] : randomSchedule();
+            if (random.setException(day, schedule)) {
+                auto it = std::find_if(exceptions.begin(), exceptions.end(), [day](const std::pair<uint16_t, DaySchedule> &e) { return e.first == day; });
+                if (it != exceptions.end()) {
+                    it->second = schedule;
+                }
+                else {
+                    exceptions.push_back({ day, schedule });
+                }
+            }
+        }
+        WeekSchedule copy;
+        expect(copy.read(data, random.write(data)), "random week not read back", round);
+        for (uint16_t day = first - 10; day < first + 410; day++) {
+            const DaySchedule *expected = &weekdays[(day + 4) % 7];
+            for (const auto &e : exceptions) {
+                if (e.first == day) {
+                    expected = &e.second;
+                }
+            }
+            expect(random.forDay(day) == *expected && copy.forDay(day) == *expected, "random week resolves wrong", day);
+        }
+        // the lookup with and without exceptions
+        WeekSchedule plain;
+        for (int r = 0; r < REPEATS; r++) {
+            const WeekSchedule *both[] = { &plain, &random };
+            for (int i = 0; i < 2; i++) {
+                uint32_t sum = 0;
+                const uint32_t start = ESP.getCycleCount();
+                for (uint16_t day = first; day < first + 400; day++) {
+                    sum += both[i]->forDay(day).sleepTime;
+                }
+                cycles[i] = min(cycles[i], ESP.getCycleCount() - start);
+                if (sum == 1) {
+                    printf("unlikely\n");
+                }
+            }
+        }
+    }
+    printf("week schedule: %.1f cycles a day without exceptions, %.1f with %u\n",
+        cycles[0] / 400.0, cycles[1] / 400.0, WeekSchedule::MAX_EXCEPTIONS);
+    return failures;
+}
+
+// the needles are timed blending into a sprite, like Display does
+static TFT_eSPI lcd;
+static TFT_eSprite face(&lcd);
+
+static void plotPixel(int16_t x, int16_t y, uint8_t alpha) {
+    face.drawPixel(x, y, face.alphaBlend(alpha, TFT_NAVY, face.readPixel(x, y)));
+}
+
+template<typename Draw>
+static uint32_t cyclesPerNeedle(const NeedleEnd *needles, int count, Draw draw) {
+    uint32_t best = UINT32_MAX;
+    for (int r = 0; r < REPEATS; r++) {
+        const uint32_t start = ESP.getCycleCount();
+        for (int i = 0; i < count; i++) {
+            draw(needles[i]);
+        }
+        best = min(best, ESP.getCycleCount() - start);
+    }
+    return best / count;
+}
+
+template<typename Plot>
+static void drawFloat(const NeedleEnd &n, Plot plot) {
+    drawWideLineAAFloat(CLOCK_RADIUS, CLOCK_RADIUS, n.x, n.y, 2., plot);
+}
+
+template<typename Plot>
+static void drawFixed(const NeedleEnd &n, Plot plot) {
+    WideLineAA line(CLOCK_RADIUS, CLOCK_RADIUS, n.x, n.y, 2.);
+    line.draw(plot);
+}
+
+template<typename Solid, typename Plot>
+static void drawSpans(const NeedleEnd &n, Solid solid, Plot plot) {
+    WideLineAA line(CLOCK_RADIUS, CLOCK_RADIUS, n.x, n.y, 2.);
+    line.drawSpans(solid, plot);
+}
+
+static uint32_t plotted;
+
+static void floatIntoBuffer(const NeedleEnd &n, AlphaBuffer &buffer) {
+    drawFloat(n, [&buffer](int16_t x, int16_t y, uint8_t alpha) { buffer.plot(x, y, alpha); });
+}
+
+static void fixedIntoBuffer(const NeedleEnd &n, AlphaBuffer &buffer) {
+    drawFixed(n, [&buffer](int16_t x, int16_t y, uint8_t alpha) { buffer.plot(x, y, alpha); });
+}
+
+static void spansIntoBuffer(const NeedleEnd &n, AlphaBuffer &buffer) {
+    drawSpans(n, [&buffer](int16_t x, int16_t y, int16_t w) {
+        memset(buffer.pixels + (y * FACE_SIZE) + x, 255, w);
+        plotted += w;
+    }, [&buffer](int16_t x, int16_t y, uint8_t alpha) {
+        buffer.plot(x, y, alpha);
+        plotted++;
+    });
+}
+
+static void floatIntoSprite(const NeedleEnd &n) {
+    drawFloat(n, plotPixel);
+}
+
+static void fixedIntoSprite(const NeedleEnd &n) {
+    drawFixed(n, plotPixel);
+}
+
+static void spansIntoSprite(const NeedleEnd &n) {
+    drawSpans(n, [](int16_t x, int16_t y, int16_t w) { face.drawFastHLine(x, y, w, TFT_NAVY); }, plotPixel);
+}
+
+// what Display does: blend straight into the sprite memory
+static void spansIntoMemory(const NeedleEnd &n) {
+    static const ColorBlend blend(TFT_NAVY);
+    uint16_t *pixels = (uint16_t *)face.getPointer();
+    drawSpans(n, [pixels](int16_t x, int16_t y, int16_t w) {
+        uint16_t *p = pixels + (y * FACE_SIZE) + x;
+        while (w-- > 0) *p++ = blend.swapped;
+    }, [pixels](int16_t x, int16_t y, uint8_t alpha) {
+        blend.blendSwapped(alpha, pixels + (y * FACE_SIZE) + x);
+    });
+}
+
+static uint8_t recorded[60 + (12 * 60)][512];
+static uint16_t recordedSize[60 + (12 * 60)];
+
+// replaying a cached mask, the rest of what Display does on a cache hit
+static void maskIntoMemory(const NeedleEnd &n) {
+    static const ColorBlend blend(TFT_NAVY);
+    uint16_t *pixels = (uint16_t *)face.getPointer();
+    const NeedleMask mask(recorded[&n - needleBase]);
+    mask.drawSpans([pixels](int16_t x, int16_t y, int16_t w) {
+        uint16_t *p = pixels + (y * FACE_SIZE) + x;
+        while (w-- > 0) *p++ = blend.swapped;
+    }, [pixels](int16_t x, int16_t y, uint8_t alpha) {
+        blend.blendSwapped(alpha, pixels + (y * FACE_SIZE) + x);
+    });
+}
+
+// do both sprite paths leave the same pixels behind
+static bool sameInSprite(const NeedleEnd *needles, int count) {
+    static uint16_t viaApi[FACE_SIZE * FACE_SIZE];
+    for (int i = 0; i < count; i++) {
+        face.fillRect(0, 0, FACE_SIZE, FACE_SIZE, TFT_ORANGE);
+        spansIntoSprite(needles[i]);
+        memcpy(viaApi, face.getPointer(), sizeof(viaApi));
+        face.fillRect(0, 0, FACE_SIZE, FACE_SIZE, TFT_ORANGE);
+        spansIntoMemory(needles[i]);
+        if (memcmp(viaApi, face.getPointer(), sizeof(viaApi)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// largest alpha difference between two rasterisers
+template<typename Draw>
+static int compareNeedles(const NeedleEnd *needles, int count, Draw draw, uint32_t &differing) {
+    static AlphaBuffer reference, other;
+    int worst = 0;
+    for (int i = 0; i < count; i++) {
+        reference.clear();
+        other.clear();
+        floatIntoBuffer(needles[i], reference);
+        draw(needles[i], other);
+        for (uint32_t p = 0; p < sizeof(reference.pixels); p++) {
+            int diff = abs(reference.pixels[p] - other.pixels[p]);
+            differing += diff != 0;
+            worst = max(worst, diff);
+        }
+    }
+    return worst;
+}
+
+static void benchNeedles(const char *name, const NeedleEnd *needles, int count) {
+    uint32_t bbox = 0;
+    for (int i = 0; i < count; i++) {
+        WideLineAA line(CLOCK_RADIUS, CLOCK_RADIUS, needles[i].x, needles[i].y, 2.);
+        bbox += (line.x1 - line.x0 + 1) * (line.y1 - line.y0 + 1);
+    }
+    uint32_t maskBytes = 0, maskMax = 0;
+    for (int i = 0; i < count; i++) {
+        const int index = &needles[i] - needleBase;
+        WideLineAA line(CLOCK_RADIUS, CLOCK_RADIUS, needles[i].x, needles[i].y, 2.);
+        recordedSize[index] = NeedleMask::record(line, recorded[index], sizeof(recorded[index]));
+        maskBytes += recordedSize[index];
+        maskMax = max<uint32_t>(maskMax, recordedSize[index]);
+    }
+    uint32_t fixedDiffering = 0, spansDiffering = 0;
+    const int fixedWorst = compareNeedles(needles, count, fixedIntoBuffer, fixedDiffering);
+    plotted = 0;
+    const int spansWorst = compareNeedles(needles, count, spansIntoBuffer, spansDiffering);
+    const uint32_t spanPixels = plotted;
+
+    const uint32_t floatCycles = cyclesPerNeedle(needles, count, floatIntoSprite);
+    const uint32_t fixedCycles = cyclesPerNeedle(needles, count, fixedIntoSprite);
+    const uint32_t spansCycles = cyclesPerNeedle(needles, count, spansIntoSprite);
+    const uint32_t memoryCycles = cyclesPerNeedle(needles, count, spansIntoMemory);
+    const uint32_t maskCycles = cyclesPerNeedle(needles, count, maskIntoMemory);
+    printf("%-6s needle: float %6u cycles\n", name, floatCycles);
+    printf("%-6s needle: fixed %6u cycles (%.2fx), max alpha diff %d (%u pixels)\n",
+        name, fixedCycles, (double)floatCycles / fixedCycles, fixedWorst, fixedDiffering);
+    printf("%-6s needle: spans %6u cycles (%.2fx) via the sprite, %.1f cycles per plotted pixel, max alpha diff %d (%u pixels), %u of %u pixels plotted\n",
+        name, spansCycles, (double)floatCycles / spansCycles, (double)spansCycles * count / spanPixels, spansWorst, spansDiffering, spanPixels / count, bbox / count);
+    printf("%-6s needle: spans %6u cycles (%.2fx) into sprite memory, %.1f cycles per plotted pixel, %s as via the sprite\n",
+        name, memoryCycles, (double)floatCycles / memoryCycles, (double)memoryCycles * count / spanPixels,
+        sameInSprite(needles, count) ? "same" : "NOT the same");
+    printf("%-6s needle: mask  %6u cycles (%.2fx) from the cache, %u bytes per mask (max %u)\n",
+        name, maskCycles, (double)floatCycles / maskCycles, maskBytes / count, maskMax);
+}
+
+// a day minute by minute, as Display::loadNeedle uses the cache: only
+// a needle that moved is looked up
+static void benchCache(const NeedleEnd *minutes, const NeedleEnd *hours) {
+    static const uint32_t budgets[] = { 0, 1024, 4096, 16384, 65536 };
+    for (uint32_t budget : budgets) {
+        MaskCache cache(budget, needleCacheSlots(budget));
+        uint32_t cycles = 0, keys[2] = { UINT32_MAX, UINT32_MAX };
+        for (int minute = 0; minute < 24 * 60; minute++) {
+            const NeedleEnd *drawn[2] = { &hours[minute % (12 * 60)], &minutes[minute % 60] };
+            const uint32_t moved[2] = { hourDegrees(minute / 60, minute % 60) | ((uint32_t)HOUR_LENGTH << 16),
+                                        minuteDegrees(minute % 60) | ((uint32_t)MINUTE_LENGTH << 16) };
+            for (int n = 0; n < 2; n++) {
+                if (moved[n] == keys[n]) {
+                    continue;
+                }
+                keys[n] = moved[n];
+                const uint32_t start = ESP.getCycleCount();
+                const int index = drawn[n] - needleBase;
+                if (cache.find(keys[n]) == nullptr) {
+                    uint8_t scratch[512];
+                    WideLineAA line(CLOCK_RADIUS, CLOCK_RADIUS, drawn[n]->x, drawn[n]->y, 2.);
+                    cache.insert(keys[n], scratch, NeedleMask::record(line, scratch, sizeof(scratch)));
+                }
+                maskIntoMemory(needleBase[index]);
+                cycles += ESP.getCycleCount() - start;
+            }
+        }
+        printf("needle cache of %5u bytes (%3u slots): %4.1f%% hits, %5u cycles a minute, %5u bytes used\n",
+            budget, needleCacheSlots(budget), 100.0 * cache.hits / (cache.hits + cache.misses), cycles / (24 * 60), cache.used());
+    }
+}
+
+// the cost of blending alone, replaying the edge pixels of all needles
+static void benchBlend(const NeedleEnd *needles, int count) {
+    struct Edge { int16_t x, y; uint8_t alpha; };
+    static Edge edges[FACE_SIZE * FACE_SIZE];
+    uint32_t total = 0;
+    for (int i = 0; i < count && total < FACE_SIZE * FACE_SIZE; i++) {
+        drawSpans(needles[i], [](int16_t, int16_t, int16_t) {}, [&total](int16_t x, int16_t y, uint8_t alpha) {
+            if (total < FACE_SIZE * FACE_SIZE) edges[total++] = { x, y, alpha };
+        });
+    }
+    uint32_t viaSprite = UINT32_MAX, viaMemory = UINT32_MAX;
+    const ColorBlend blend(TFT_NAVY);
+    uint16_t *pixels = (uint16_t *)face.getPointer();
+    for (int r = 0; r < REPEATS; r++) {
+        uint32_t start = ESP.getCycleCount();
+        for (uint32_t i = 0; i < total; i++) {
+            plotPixel(edges[i].x, edges[i].y, edges[i].alpha);
+        }
+        viaSprite = min(viaSprite, ESP.getCycleCount() - start);
+        start = ESP.getCycleCount();
+        for (uint32_t i = 0; i < total; i++) {
+            blend.blendSwapped(edges[i].alpha, pixels + (edges[i].y * FACE_SIZE) + edges[i].x);
+        }
+        viaMemory = min(viaMemory, ESP.getCycleCount() - start);
+    }
+    printf("blend only: %.1f cycles per pixel via the sprite, %.1f in sprite memory\n",
+        (double)viaSprite / total, (double)viaMemory / total);
+}
+
+// decoding packed images a row at a time into a band, against pushing the
+// raw RGB565 rows from flash into it like Display used to
+static void benchImages() {
+    struct Image { const char *name; const PackedImage &packed; const uint16_t *raw; };
+    static const Image images[] = {
+        { "NotoFox64", NotoFox64_PACKED, NotoFox64 },
+        { "NotoFrog64", NotoFrog64_PACKED, NotoFrog64 },
+        { "NotoGiraffe64", NotoGiraffe64_PACKED, NotoGiraffe64 },
+        { "cat_paw", cat_paw_PACKED, cat_paw },
+        { "CAT_WATCH_FACE", CAT_WATCH_FACE_PACKED, CAT_WATCH_FACE },
+        { "CAT_WATCH_FACE_DIAL", CAT_WATCH_FACE_DIAL_PACKED, CAT_WATCH_FACE_DIAL },
+        { "CAT_WATCH_FACE_DIAL8", CAT_WATCH_FACE_DIAL8_PACKED, CAT_WATCH_FACE_DIAL },
+    };
+    TFT_eSprite band(&lcd);
+    band.createSprite(160, 1);
+    uint16_t *pixels = (uint16_t *)band.getPointer();
+    uint32_t rawTotal = 0, packedTotal = 0;
+    for (const Image &image : images) {
+        const int16_t w = image.packed.width, h = image.packed.height;
+        uint32_t viaPushImage = UINT32_MAX, copied = UINT32_MAX, decoded = UINT32_MAX;
+        for (int r = 0; r < REPEATS; r++) {
+            uint32_t start = ESP.getCycleCount();
+            band.setSwapBytes(true);
+            for (int16_t y = 0; y < h; y++) {
+                band.pushImage(0, 0, w, 1, image.raw + (y * w));
+            }
+            band.setSwapBytes(false);
+            viaPushImage = min(viaPushImage, ESP.getCycleCount() - start);
+            start = ESP.getCycleCount();
+            for (int16_t y = 0; y < h; y++) {
+                const uint16_t *row = image.raw + (y * w);
+                for (int16_t x = 0; x < w; x++) {
+                    pixels[x] = swap565(pgm_read_word(row + x));
+                }
+            }
+            copied = min(copied, ESP.getCycleCount() - start);
+            start = ESP.getCycleCount();
+            for (int16_t y = 0; y < h; y++) {
+                image.packed.decodeRow(y, 0, w, pixels);
+            }
+            decoded = min(decoded, ESP.getCycleCount() - start);
+        }
+        const uint32_t raw = w * h * sizeof(uint16_t);
+        rawTotal += raw;
+        packedTotal += image.packed.size();
+        printf("%-20s %5u bytes raw, %5u packed (%3.0f%%), cycles per pixel: %4.1f pushImage, %4.1f copied, %4.1f decoded\n",
+            image.name, raw, image.packed.size(), 100.0 * image.packed.size() / raw,
+            (double)viaPushImage / (w * h), (double)copied / (w * h), (double)decoded / (w * h));
+    }
+    printf("images: %u bytes raw, %u packed\n", rawTotal, packedTotal);
+}
+
+// The text cache against drawing from the font, also once the heap is
+// used up and for two texts whose keys collide. Returns the number of
+// failed checks.
+static int checkTextCache() {
+    static const FlashFont name(NotoSansBold36), text(NotoSansBold15);
+    TFT_eSprite direct(&lcd), cached(&lcd);
+    direct.createSprite(160, 48);
+    cached.createSprite(160, 48);
+    auto draw = [&](TextCache *cache, const FlashFont &font, const char *run) {
+        direct.fillRect(0, 0, 160, 48, TFT_BLACK);
+        cached.fillRect(0, 0, 160, 48, TFT_BLACK);
+        font.draw(direct, run, 0, 0, TL_DATUM, TFT_RED, TFT_BLACK);
+        cache->draw(font, cached, run, 0, 0, TL_DATUM, TFT_RED, TFT_BLACK);
+        return memcmp(direct.getPointer(), cached.getPointer(), 160 * 48 * sizeof(uint16_t)) == 0;
+    };
+    int failures = 0;
+    {
+        TextCache cache(UINT16_MAX, 8);
+        uint8_t *rest = new (std::nothrow) uint8_t[ESP.getFreeHeap()];
+        if (rest == nullptr || !draw(&cache, name, NAME_TEXT) || cache.cache().used() != 0) {
+            printf("text cache: drawn wrong without heap\n");
+            failures++;
+        }
+        delete[] rest;
+        if (!draw(&cache, name, NAME_TEXT) || !draw(&cache, name, NAME_TEXT) || cache.cache().hits != 1) {
+            printf("text cache: drawn wrong from the cache\n");
+            failures++;
+        }
+    }
+
+    // the FNV-1a of src/text_cache.cpp, to find two runs of the glyphs
+    // in the font whose keys collide
+    auto key = [](const FlashFont &font, const char *run) {
+        uint32_t hash = 2166136261u;
+        const uintptr_t id = (uintptr_t)&font;
+        for (uint8_t i = 0; i < sizeof(id); i++) {
+            hash = (hash ^ ((id >> (i * 8)) & 0xFF)) * 16777619u;
+        }
+        for (const char *c = run; *c; c++) {
+            hash = (hash ^ (uint8_t)*c) * 16777619u;
+        }
+        return hash;
+    };
+    static const char glyphs[] = "SlapenRustigWakker0123456789";
+    char first[8] = "", second[8] = "";
+    srand(18);
+    {
+        // gone again before drawing, it takes more than the emulated heap
+        std::unordered_map<uint32_t, std::string> seen;
+        for (uint32_t i = 0; first[0] == 0 && i < 1000000; i++) {
+            for (int c = 0; c < 5; c++) {
+                second[c] = glyphs[rand() % (sizeof(glyphs) - 1)];
+            }
+            const auto found = seen.emplace(key(text, second), second);
+            if (!found.second && found.first->second != second) {
+                strcpy(first, found.first->second.c_str());
+            }
+        }
+    }
+    TextCache cache(UINT16_MAX, 8);
+    if (first[0] == 0 || !draw(&cache, text, first) || !draw(&cache, text, second) || cache.cache().hits != 1) {
+        printf("text cache: \"%s\" drawn wrong after \"%s\" with the same key\n", second, first);
+        failures++;
+    }
+    return failures;
+}
+
+// drawing the texts from the font every time, against blitting the mask
+// the text cache keeps of them
+static void benchText() {
+    static const FlashFont name(NotoSansBold36), text(NotoSansBold15);
+    struct Run { const FlashFont &font; const char *text; };
+    static const Run runs[] = {
+        { name, NAME_TEXT }, { text, SLEEPING_TEXT }, { text, WAKING_UP_TEXT }, { text, AWAKE_TEXT },
+        { text, "1" }, { text, "10" }, { text, "12" },
+    };
+    TFT_eSprite band(&lcd);
+    band.createSprite(160, 48);
+    TextCache cache(UINT16_MAX, 8);
+    for (const Run &run : runs) {
+        uint32_t direct = UINT32_MAX, cached = UINT32_MAX;
+        const uint32_t before = cache.cache().used();
+        cache.draw(run.font, band, run.text, 0, 0, TL_DATUM, TFT_RED, TFT_BLACK);
+        for (int r = 0; r < REPEATS; r++) {
+            uint32_t start = ESP.getCycleCount();
+            run.font.draw(band, run.text, 0, 0, TL_DATUM, TFT_RED, TFT_BLACK);
+            direct = min(direct, ESP.getCycleCount() - start);
+            start = ESP.getCycleCount();
+            cache.draw(run.font, band, run.text, 0, 0, TL_DATUM, TFT_RED, TFT_BLACK);
+            cached = min(cached, ESP.getCycleCount() - start);
+        }
+        printf("text %-8s %5u bytes cached, cycles per draw: %6u from the font, %6u from the cache\n",
+            run.text, cache.cache().used() - before, direct, cached);
+    }
+}
+
+int runBenchmarks() {
+    face.createSprite(FACE_SIZE, FACE_SIZE);
+    face.fillRect(0, 0, FACE_SIZE, FACE_SIZE, TFT_WHITE);
+    printf("cycles per needle, blending into a %ux%u sprite\n", FACE_SIZE, FACE_SIZE);
+    static NeedleEnd needles[60 + (12 * 60)];
+    NeedleEnd *minutes = needles, *hours = needles + 60;
+    allNeedles(minutes, hours);
+    int failures = checkDialGeometry();
+    failures += checkTimeline();
+    failures += checkWeekSchedule();
+    failures += checkTextCache();
+    benchNeedles("minute", minutes, 60);
+    benchNeedles("hour", hours, 12 * 60);
+    benchBlend(minutes, 60);
+    benchCache(minutes, hours);
+    benchImages();
+    benchText();
+    return failures;
+}
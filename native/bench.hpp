@@ -0,0 +1,8 @@
+#ifndef __NATIVE_BENCH_H
+#define __NATIVE_BENCH_H
+
+// micro benchmarks of the render building blocks, run with --bench;
+// returns the number of failed checks
+int runBenchmarks();
+
+#endif
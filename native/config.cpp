@@ -0,0 +1,28 @@
+#include "config.hpp"
+#include "emulator.hpp"
+
+// The web interface and SPIFFS storage are not emulated, the harness sets
+// the schedule directly.
+static WeekSchedule schedule;
+static void (*changed)() = nullptr;
+
+Config::Config() {
+}
+
+void Config::handle() {
+}
+
+void Config::onChange(void (*callback)()) {
+    changed = callback;
+}
+
+const DaySchedule &Config::scheduleFor(uint16_t day) {
+    return schedule.forDay(day);
+}
+
+void emulator::setSchedule(uint16_t sleep, uint16_t awake, uint16_t transition) {
+    schedule.clear({ sleep, awake, transition });
+    if (changed != nullptr) {
+        changed();
+    }
+}
@@ -0,0 +1,319 @@
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <ESP8266WiFi.h>
+#include <Ticker.h>
+#include <chrono>
+#include <new>
+#include <stdarg.h>
+#include <vector>
+#include "emulator.hpp"
+
+// free heap of a D1 mini after the WiFi stack has started
+static constexpr uint32_t HEAP_SIZE = 50 * 1024;
+
+HardwareSerial Serial;
+EspClass ESP;
+FS SPIFFS;
+ESP8266WiFiClass WiFi;
+
+static emulator::Stats currentStats;
+static uint64_t virtualMicros = 0;
+static int64_t trueBase = 0; // true local time in micros at virtualMicros 0
+static int32_t driftPpm = 0;
+static bool timeSet = false;
+static std::vector<Ticker *> tickers;
+static uint8_t currentBrightness = 0;
+static FILE *trace = nullptr;
+static TFT_eSPI *panel = nullptr;
+static const uint16_t *panelMemory = nullptr;
+static uint32_t allocated = 0;
+static uint32_t spiHz = 27000000;
+static uint64_t spiFreeAt = 0; // host nanoseconds
+
+void *operator new(size_t size) {
+    size_t *p = (size_t *)malloc(size + sizeof(size_t));
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    *p = size;
+    allocated += size;
+    return p + 1;
+}
+
+void *operator new[](size_t size) {
+    return operator new(size);
+}
+
+// like on the ESP8266, nothrow new fails once the heap is used up
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+    if (allocated + size > HEAP_SIZE) {
+        return nullptr;
+    }
+    try {
+        return operator new(size);
+    }
+    catch (const std::bad_alloc &) {
+        return nullptr;
+    }
+}
+
+void *operator new[](size_t size, const std::nothrow_t &nothrow) noexcept {
+    return operator new(size, nothrow);
+}
+
+void operator delete(void *ptr) noexcept {
+    if (ptr != nullptr) {
+        size_t *p = ((size_t *)ptr) - 1;
+        allocated -= *p;
+        free(p);
+    }
+}
+
+void operator delete[](void *ptr) noexcept {
+    operator delete(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+    operator delete(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept {
+    operator delete(ptr);
+}
+
+namespace emulator {
+
+Stats &stats() {
+    return currentStats;
+}
+
+void resetStats() {
+    currentStats = {};
+}
+
+uint64_t nowMicros() {
+    return virtualMicros;
+}
+
+// fires the tickers that come due on the way, in order
+void advanceMicros(uint64_t us) {
+    const uint64_t end = virtualMicros + us;
+    while (true) {
+        Ticker *next = nullptr;
+        for (Ticker *t : tickers) {
+            if (t->active() && t->deadline() <= end && (next == nullptr || t->deadline() < next->deadline())) {
+                next = t;
+            }
+        }
+        if (next == nullptr) {
+            break;
+        }
+        virtualMicros = max(virtualMicros, next->deadline());
+        next->fire();
+    }
+    virtualMicros = end;
+}
+
+static int64_t driftedMicros() {
+    return (int64_t)virtualMicros - (((int64_t)virtualMicros * driftPpm) / 1000000);
+}
+
+void setLocalTime(time_t t, uint32_t us) {
+    trueBase = ((int64_t)t * 1000000) + us - driftedMicros();
+    timeSet = true;
+}
+
+void setDrift(int32_t ppm) {
+    const int64_t now = trueMicros();
+    driftPpm = ppm;
+    trueBase = now - driftedMicros();
+}
+
+int64_t trueMicros() {
+    return trueBase + driftedMicros();
+}
+
+bool timeIsSet() {
+    return timeSet;
+}
+
+uint8_t brightness() {
+    return currentBrightness;
+}
+
+uint32_t heapUsed() {
+    return allocated;
+}
+
+static uint64_t hostNanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void setSpiClock(uint32_t hz) {
+    spiHz = hz;
+}
+
+uint32_t spiClock() {
+    return spiHz;
+}
+
+void spiStart(uint32_t bytes) {
+    const uint64_t now = hostNanos();
+    spiFreeAt = max(now, spiFreeAt) + ((bytes * 8ull * 1000000000ull) / spiHz);
+}
+
+bool spiBusy() {
+    return hostNanos() < spiFreeAt;
+}
+
+void spiTransfer(uint32_t bytes) {
+    spiStart(bytes);
+    while (spiBusy()) {
+    }
+}
+
+void setTrace(FILE *f) {
+    trace = f;
+}
+
+void traceWindow(int32_t x, int32_t y, int32_t w, int32_t h) {
+    if (trace != nullptr) {
+        fprintf(trace, "%llu window %d,%d %dx%d\n", (unsigned long long)virtualMicros, x, y, w, h);
+    }
+}
+
+void attachPanel(TFT_eSPI *lcd, const uint16_t *memory) {
+    panel = lcd;
+    panelMemory = memory;
+}
+
+const uint16_t *framebuffer() {
+    return panelMemory;
+}
+
+int32_t panelWidth() {
+    return panel == nullptr ? 0 : panel->width();
+}
+
+int32_t panelHeight() {
+    return panel == nullptr ? 0 : panel->height();
+}
+
+bool writePPM(const char *path) {
+    if (panelMemory == nullptr) {
+        return false;
+    }
+    FILE *f = fopen(path, "wb");
+    if (f == nullptr) {
+        return false;
+    }
+    const int32_t w = panelWidth(), h = panelHeight();
+    fprintf(f, "P6\n%d %d\n255\n", w, h);
+    for (int32_t i = 0; i < w * h; i++) {
+        uint16_t c = panelMemory[i];
+        uint8_t rgb[3] = {
+            (uint8_t)(((c >> 11) & 0x1F) * 255 / 31),
+            (uint8_t)(((c >> 5) & 0x3F) * 255 / 63),
+            (uint8_t)((c & 0x1F) * 255 / 31)
+        };
+        fwrite(rgb, 1, 3, f);
+    }
+    fclose(f);
+    return true;
+}
+
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+    return fputc(c, stdout) == EOF ? 0 : 1;
+}
+
+size_t Print::printf(const char *format, ...) {
+    char buf[256];
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    print(buf);
+    return n;
+}
+
+uint32_t EspClass::getCycleCount() {
+#if defined(__x86_64__) || defined(__i386__)
+    return (uint32_t)__builtin_ia32_rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((ts.tv_sec * 1000000000ull) + ts.tv_nsec);
+#endif
+}
+
+// the rate of getCycleCount(), measured once
+uint32_t EspClass::getCpuFreqMHz() {
+    static uint32_t mhz = 0;
+    if (mhz == 0) {
+        const auto start = std::chrono::steady_clock::now();
+        const uint32_t cycles = getCycleCount();
+        while (std::chrono::steady_clock::now() - start < std::chrono::milliseconds(10)) {
+        }
+        const auto spent = std::chrono::steady_clock::now() - start;
+        mhz = (getCycleCount() - cycles) / std::chrono::duration_cast<std::chrono::microseconds>(spent).count();
+    }
+    return mhz;
+}
+
+uint32_t EspClass::getFreeHeap() {
+    return allocated > HEAP_SIZE ? 0 : HEAP_SIZE - allocated;
+}
+
+void Ticker::once_ms(uint32_t milliseconds, callback_function_t fn) {
+    if (std::find(tickers.begin(), tickers.end(), this) == tickers.end()) {
+        tickers.push_back(this);
+    }
+    callback = fn;
+    due = virtualMicros + (milliseconds * 1000ull);
+    armed = true;
+}
+
+void Ticker::detach() {
+    armed = false;
+    tickers.erase(std::remove(tickers.begin(), tickers.end(), this), tickers.end());
+}
+
+void Ticker::fire() {
+    armed = false;
+    const callback_function_t fn = callback; // it may re-arm itself
+    fn();
+}
+
+unsigned long millis() {
+    return virtualMicros / 1000;
+}
+
+unsigned long micros() {
+    return virtualMicros;
+}
+
+void delay(unsigned long ms) {
+    emulator::advanceMicros(ms * 1000ull);
+}
+
+void delayMicroseconds(unsigned int us) {
+    emulator::advanceMicros(us);
+}
+
+void yield() {
+}
+
+void pinMode(uint8_t, uint8_t) {
+}
+
+void digitalWrite(uint8_t, uint8_t) {
+}
+
+void analogWrite(uint8_t pin, int val) {
+    if (pin == D1) {
+        currentBrightness = val;
+    }
+}
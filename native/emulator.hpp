@@ -0,0 +1,66 @@
+// Host-side hooks into the emulated board: virtual clock, panel framebuffer
+// and the SPI/pixel accounting done by the TFT_eSPI stand-in.
+#ifndef __NATIVE_EMULATOR_H
+#define __NATIVE_EMULATOR_H
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+class TFT_eSPI;
+
+namespace emulator {
+
+struct Stats {
+    uint32_t spiWindows;    // setAddrWindow calls (CASET + RASET + RAMWR)
+    uint32_t spiBytes;      // command and pixel bytes sent to the panel
+    uint32_t panelPixels;   // pixels written to the panel
+    uint32_t spritePixels;  // pixels written into sprite memory
+    uint32_t spriteReads;   // pixels read back from sprite memory
+};
+
+Stats &stats();
+void resetStats();
+
+// virtual time, only moves on delay()/delayMicroseconds()
+uint64_t nowMicros();
+void advanceMicros(uint64_t us);
+// The true local time, what NTP tells; micros() runs `ppm` parts per
+// million slow against it (negative: fast). It counts as synced once set.
+void setLocalTime(time_t t, uint32_t us = 0);
+void setDrift(int32_t ppm);
+int64_t trueMicros();
+bool timeIsSet();
+
+uint8_t brightness();
+
+// the Config stand-in (native/config.cpp), times in minutes of the day
+void setSchedule(uint16_t sleepTime, uint16_t awakeTime, uint16_t awakeTransition);
+
+// SPI timing model: a transfer keeps the bus busy for 8 bits a byte at
+// the SPI clock in host time. Blocking panel writes spin until the bus is
+// done, like TFT_eSPI does on the D1 mini. The host composes far faster
+// than the ESP8266, lower the clock by that factor to see the overlap the
+// device would get.
+void setSpiClock(uint32_t hz);
+uint32_t spiClock();
+void spiStart(uint32_t bytes); // starts behind a transfer still going out
+bool spiBusy();
+void spiTransfer(uint32_t bytes); // start and wait for it
+
+// bytes currently allocated through new/delete
+uint32_t heapUsed();
+
+// log every SPI window to `f` (nullptr disables)
+void setTrace(FILE *f);
+void traceWindow(int32_t x, int32_t y, int32_t w, int32_t h);
+
+// panel contents, in natural RGB565 order
+void attachPanel(TFT_eSPI *lcd, const uint16_t *memory);
+const uint16_t *framebuffer();
+int32_t panelWidth();
+int32_t panelHeight();
+bool writePPM(const char *path);
+
+}
+
+#endif
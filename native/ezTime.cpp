@@ -0,0 +1,97 @@
+#include <ezTime.h>
+#include "emulator.hpp"
+
+// like ezTime's default NTP interval
+static constexpr uint64_t NTP_INTERVAL = 1801 * 1000000ull;
+
+static time_t lastRead = 0;
+// Between syncs the clock runs on micros(), as ezTime runs on millis(),
+// so it drifts away from the true time until the next sync.
+static bool synced = false;
+static uint64_t syncedAt = 0;  // micros()
+static int64_t syncedTrue = 0; // true local time then, in micros
+static time_t lastSync = 0;
+
+static void sync() {
+    syncedAt = emulator::nowMicros();
+    syncedTrue = emulator::trueMicros();
+    lastSync = syncedTrue / 1000000;
+    synced = true;
+}
+
+static int64_t localMicros() {
+    if (!synced && emulator::timeIsSet()) {
+        sync();
+    }
+    return syncedTrue + (int64_t)(emulator::nowMicros() - syncedAt);
+}
+
+static time_t localTime() {
+    return localMicros() / 1000000;
+}
+
+static time_t readTime() {
+    lastRead = localTime();
+    return lastRead;
+}
+
+void setDebug(ezDebugLevel_t) {}
+
+void events() {
+    if (emulator::timeIsSet() && (!synced || emulator::nowMicros() - syncedAt >= NTP_INTERVAL)) {
+        sync();
+    }
+}
+
+timeStatus_t timeStatus() {
+    return emulator::timeIsSet() ? timeSet : timeNotSet;
+}
+
+time_t lastNtpUpdateTime() {
+    return lastSync;
+}
+
+bool secondChanged() {
+    return localTime() != lastRead;
+}
+
+bool minuteChanged() {
+    return localTime() / 60 != lastRead / 60;
+}
+
+uint16_t ms() {
+    return (localMicros() / 1000) % 1000;
+}
+bool Timezone::setLocation(const String &) {
+    return true;
+}
+
+String Timezone::dateTime() {
+    time_t t = readTime();
+    struct tm parts;
+    gmtime_r(&t, &parts);
+    char buf[64];
+    strftime(buf, sizeof(buf), "%A, %d-%b-%Y %H:%M:%S", &parts);
+    return String(buf);
+}
+
+uint8_t Timezone::hour() {
+    return (readTime() / 3600) % 24;
+}
+
+uint8_t Timezone::minute() {
+    return (readTime() / 60) % 60;
+}
+
+uint8_t Timezone::second() {
+    return readTime() % 60;
+}
+
+uint8_t Timezone::weekday() {
+    // 1 = Sunday, like ezTime; the epoch was a Thursday
+    return (((readTime() / 86400) + 4) % 7) + 1;
+}
+
+time_t Timezone::now() {
+    return readTime();
+}
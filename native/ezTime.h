@@ -0,0 +1,31 @@
+// Stand-in for ropg/ezTime driven by the emulator's virtual clock. The clock
+// counts as NTP-synced once `emulator::setLocalTime` has been called, and
+// syncs again every NTP interval.
+#ifndef __NATIVE_EZTIME_H
+#define __NATIVE_EZTIME_H
+#include <Arduino.h>
+#include <time.h>
+
+enum ezDebugLevel_t { NONE, ERROR, INFO, DEBUG };
+enum timeStatus_t { timeNotSet, timeNeedsSync, timeSet };
+
+void setDebug(ezDebugLevel_t level);
+void events();
+timeStatus_t timeStatus();
+bool secondChanged();
+bool minuteChanged();
+uint16_t ms();
+time_t lastNtpUpdateTime();
+
+class Timezone {
+public:
+    bool setLocation(const String &location = "GeoIP");
+    String dateTime();
+    uint8_t hour();
+    uint8_t minute();
+    uint8_t second();
+    uint8_t weekday();
+    time_t now();
+};
+
+#endif
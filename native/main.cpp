@@ -0,0 +1,188 @@
+// Host harness for [env:native]: boots the sketch against the emulated
+// board, runs it for a stretch of virtual time and reports what the render
+// path cost per second tick.
+//
+//   .pio/build/native/program --start 06:50 --seconds 900 --ppm face.ppm
+//   .pio/build/native/program --start 10:10:00.300 --drift 40 --seconds 7200
+//   .pio/build/native/program --bench
+#include <Arduino.h>
+#include <chrono>
+#include "emulator.hpp"
+#include "bench.hpp"
+#include "display.hpp"
+#include "scheduler.hpp"
+#include "time.hpp"
+
+extern Display *display;
+extern Scheduler scheduler;
+extern Time *currentTime;
+
+struct Options {
+    time_t start = (6 * 3600) + (50 * 60);
+    uint32_t startMicros = 0;
+    uint32_t seconds = 600;
+    const char *ppm = nullptr;
+    const char *trace = nullptr;
+    bool bench = false;
+};
+
+static bool parseClock(const char *s, time_t &out, uint32_t &us) {
+    int h = 0, m = 0;
+    double sec = 0;
+    if (sscanf(s, "%d:%d:%lf", &h, &m, &sec) < 2 || sec < 0 || sec >= 60) {
+        return false;
+    }
+    out = (h * 3600) + (m * 60) + (int)sec;
+    us = (sec - (int)sec) * 1000000;
+    return true;
+}
+
+static bool parseSchedule(const char *s) {
+    int sh, sm, ah, am, t;
+    if (sscanf(s, "%d:%d,%d:%d,%d", &sh, &sm, &ah, &am, &t) != 5) {
+        return false;
+    }
+    emulator::setSchedule((sh * 60) + sm, (ah * 60) + am, t);
+    return true;
+}
+
+static bool parseMHz(const char *s) {
+    const double mhz = atof(s);
+    if (mhz <= 0) {
+        return false;
+    }
+    emulator::setSpiClock(mhz * 1000000);
+    return true;
+}
+
+static void usage(const char *self) {
+    fprintf(stderr, "usage: %s [--start HH:MM[:SS[.mmm]]] [--seconds N] [--schedule HH:MM,HH:MM,MIN]\n"
+        "          [--ppm out.ppm] [--trace windows.txt] [--spi-mhz 27] [--drift PPM]\n"
+        "       %s --bench\n", self, self);
+}
+
+static bool parseOptions(int argc, char **argv, Options &opt) {
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        if (strcmp(arg, "--bench") == 0) {
+            opt.bench = true;
+            continue;
+        }
+        const char *val = i + 1 < argc ? argv[i + 1] : nullptr;
+        bool ok = val != nullptr;
+        if (strcmp(arg, "--start") == 0) ok = ok && parseClock(val, opt.start, opt.startMicros);
+        else if (strcmp(arg, "--seconds") == 0) ok = ok && (opt.seconds = atol(val)) > 0;
+        else if (strcmp(arg, "--schedule") == 0) ok = ok && parseSchedule(val);
+        else if (strcmp(arg, "--ppm") == 0) opt.ppm = val;
+        else if (strcmp(arg, "--trace") == 0) opt.trace = val;
+        else if (strcmp(arg, "--spi-mhz") == 0) ok = ok && parseMHz(val);
+        else if (strcmp(arg, "--drift") == 0) emulator::setDrift(ok ? atol(val) : 0);
+        else ok = false;
+        if (!ok) {
+            usage(argv[0]);
+            return false;
+        }
+        i++;
+    }
+    return true;
+}
+
+struct Totals {
+    uint64_t spiWindows = 0, spiBytes = 0, panelPixels = 0, spritePixels = 0, spriteReads = 0;
+    uint64_t nanos = 0;
+    uint32_t maxSpiBytes = 0;
+    uint64_t maxNanos = 0;
+    uint32_t frames = 0;     // loops that pushed (or skipped) pixels
+    uint64_t savedBytes = 0; // skipped by the tile hashes
+    uint64_t compose = 0, spi = 0, stall = 0; // cycles in those frames
+
+    void add(const emulator::Stats &s, uint64_t ns, uint32_t saved, const FrameTiming &timing) {
+        // frameTiming() keeps the last flush until the next one
+        if (s.spiBytes > 0 || saved > 0) {
+            frames++;
+            compose += timing.compose;
+            spi += timing.spi;
+            stall += timing.stall;
+        }
+        savedBytes += saved;
+        spiWindows += s.spiWindows;
+        spiBytes += s.spiBytes;
+        panelPixels += s.panelPixels;
+        spritePixels += s.spritePixels;
+        spriteReads += s.spriteReads;
+        nanos += ns;
+        maxSpiBytes = max(maxSpiBytes, s.spiBytes);
+        maxNanos = max(maxNanos, ns);
+    }
+};
+
+int main(int argc, char **argv) {
+    Options opt;
+    if (!parseOptions(argc, argv, opt)) {
+        return 1;
+    }
+    if (opt.bench) {
+        return runBenchmarks() > 0 ? 1 : 0;
+    }
+    FILE *trace = nullptr;
+    if (opt.trace != nullptr) {
+        trace = fopen(opt.trace, "w");
+        emulator::setTrace(trace);
+    }
+
+    const uint32_t heapBefore = emulator::heapUsed();
+    setup();
+    emulator::setLocalTime(opt.start, opt.startMicros);
+    scheduler.resetStats();
+    printf("boot: %u bytes heap, %u SPI bytes (%u saved by tile hashes)\n", emulator::heapUsed() - heapBefore,
+        emulator::stats().spiBytes, display->spiBytesSaved());
+
+    Totals totals;
+    uint32_t loops = 0;
+    const uint64_t end = emulator::nowMicros() + (opt.seconds * 1000000ull);
+    while (emulator::nowMicros() < end) {
+        emulator::resetStats();
+        const uint32_t savedBefore = display->spiBytesSaved();
+        auto before = std::chrono::steady_clock::now();
+        loop();
+        auto spent = std::chrono::steady_clock::now() - before;
+        totals.add(emulator::stats(), std::chrono::duration_cast<std::chrono::nanoseconds>(spent).count(),
+            display->spiBytesSaved() - savedBefore, display->frameTiming());
+        loops++;
+    }
+
+    const double ticks = opt.seconds;
+    printf("ran %u seconds in %u loops\n", opt.seconds, loops);
+    printf("per second: %.1f SPI windows, %.0f SPI bytes, %.0f panel pixels, %.0f sprite writes, %.0f sprite reads\n",
+        totals.spiWindows / ticks, totals.spiBytes / ticks, totals.panelPixels / ticks,
+        totals.spritePixels / ticks, totals.spriteReads / ticks);
+    printf("per second: %.1f us host time in loop()\n", totals.nanos / ticks / 1000.0);
+    printf("worst loop: %u SPI bytes, %.1f us host time\n", totals.maxSpiBytes, totals.maxNanos / 1000.0);
+    printf("per frame: %.0f SPI bytes saved by tile hashes (%u frames)\n",
+        totals.frames ? (double)totals.savedBytes / totals.frames : 0.0, totals.frames);
+    if (totals.frames > 0) {
+        // cycles of the host, with the SPI bus modelled at --spi-mhz
+        const double us = (double)ESP.getCpuFreqMHz() * totals.frames;
+        printf("per frame: %.1f us compose, %.1f us SPI, %.1f us stall (%.0f%% of SPI overlapped)\n",
+            totals.compose / us, totals.spi / us, totals.stall / us,
+            totals.spi ? 100.0 * (1.0 - min(1.0, (double)totals.stall / totals.spi)) : 0.0);
+    }
+    // busy time is host cycles, idle time is the virtual time slept
+    const uint64_t schedulerTotal = scheduler.busyMicros + scheduler.idleMicros;
+    printf("scheduler: %.2f%% idle\n", schedulerTotal ? 100.0 * scheduler.idleMicros / schedulerTotal : 0.0);
+    for (uint8_t i = 0; i < scheduler.size(); i++) {
+        const Scheduler::TaskStats &task = scheduler.stats(i);
+        printf("  %-10s %6u runs, %.1f us late on average, %u us at most\n", task.name, task.runs,
+            task.runs ? (double)task.late / task.runs : 0.0, task.maxLate);
+    }
+    currentTime->offsets.print(Serial);
+
+    if (opt.ppm != nullptr && !emulator::writePPM(opt.ppm)) {
+        fprintf(stderr, "could not write %s\n", opt.ppm);
+        return 1;
+    }
+    if (trace != nullptr) {
+        fclose(trace);
+    }
+    return 0;
+}
@@ -0,0 +1,5 @@
+#ifndef __NATIVE_SECRETS_H
+#define __NATIVE_SECRETS_H
+#define WIFI_ACCESPOINT "native"
+#define WIFI_PASSWORD "native"
+#endif
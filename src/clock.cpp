@@ -5,10 +5,32 @@
 #include "time.hpp"
 #include "config.hpp"
 #include "display.hpp"
+#include "scheduler.hpp"
+#include "timeline.hpp"
+
+// how long a web request can wait before the server looks at it
+#ifndef HTTP_POLL_MS
+#define HTTP_POLL_MS 50
+#endif
 
 Time* currentTime;
 Config* config;
 Display* display;
+Scheduler scheduler;
+
+static Timeline timeline;
+static uint16_t today = UINT16_MAX; // the day the timeline is for
+static uint8_t tickTask, renderTask, brightnessTask, wifiTask;
+static WiFiEventHandler wifiConnected, wifiDisconnected;
+static void scheduleChanged();
+static uint32_t tick();
+static uint32_t render();
+static uint32_t handleHttp();
+static uint32_t rampBrightness();
+static uint32_t maintainWiFi();
+#ifdef PROFILE_SCHEDULER
+static uint32_t reportScheduler();
+#endif
 
 void setup() {
   Serial.begin(74880); // native to debug output of bootloader
@@ -20,60 +42,141 @@ void setup() {
   WiFi.begin(WIFI_ACCESPOINT, WIFI_PASSWORD);
   currentTime = new Time("Europe/Amsterdam");
   config = new Config();
+  config->onChange(scheduleChanged);
   display = new Display();
+  tickTask = scheduler.add("tick", tick);
+  currentTime->onSecond([]() { scheduler.wake(tickTask); });
+  renderTask = scheduler.add("render", render);
+  scheduler.add("http", handleHttp);
+  brightnessTask = scheduler.add("brightness", rampBrightness);
+  wifiTask = scheduler.add("wifi", maintainWiFi);
+#ifdef PROFILE_SCHEDULER
+  scheduler.add("report", reportScheduler);
+#endif
+  wifiConnected = WiFi.onStationModeGotIP([](const WiFiEventStationModeGotIP &) { scheduler.wake(wifiTask); });
+  wifiDisconnected = WiFi.onStationModeDisconnected([](const WiFiEventStationModeDisconnected &) { scheduler.wake(wifiTask); });
+  Serial.printf("Free heap after boot: %u bytes\n", ESP.getFreeHeap());
 }
 
 static State currentState = Awake;
-static float progress = 0;
-
-static void updateState() {
-  const auto time = ((uint16_t)currentTime->hour() * 60) + currentTime->minute();
-  if (time > config->getSleepTime()) {
-    display->setBrightness(80);
-    currentState = Sleeping;
-    progress = 0;
+static uint32_t progress = 0;
+static uint8_t brightness = 200; // as Display starts
+static uint8_t targetBrightness = 200;
+
+// the ramp task fades to it
+static void setBrightness(uint8_t target) {
+  if (target != targetBrightness) {
+    targetBrightness = target;
+    scheduler.wake(brightnessTask);
   }
-  else if (time < config->getAwakeTime()) {
-    // now we switch to second precision for smoother progress reports
-    auto toWait = ((uint32_t)config->getAwakeTime() * 60) - (((uint32_t)time * 60) + currentTime->second());
-    auto transition = (float)(config->getAwakeTransition() * 60);
-    if (toWait < transition) {
-      display->setBrightness(160);
-      currentState = WakingUp;
-      progress = 1.0 - (toWait / transition);
-    }
-    else if (toWait < (2 * transition)) {
-      display->setBrightness(120);
-      // we start with decreasing sleep counter
-      // the same time as we do the awake counter
-      toWait -= transition;
-      currentState = Sleeping;
-      progress = 1.0 - (toWait / transition);
-    }
-    else {
-      currentState = Sleeping;
-      progress = 0;
-      display->setBrightness(80);
-    }
+}
+
+// The schedule of the day, from the weekday or an exception, only looked
+// up when the day or the config changes.
+static void resolveDay() {
+  const uint16_t day = currentTime->day();
+  if (day != today) {
+    const DaySchedule &schedule = config->scheduleFor(day);
+    timeline.build(schedule.sleepTime, schedule.awakeTime, schedule.awakeTransition);
+    today = day;
+  }
+}
+
+// returns the seconds until the next tick that changes anything
+static uint8_t updateState() {
+  resolveDay();
+  const uint32_t now = ((uint32_t)currentTime->hour() * 3600) + (currentTime->minute() * 60) + currentTime->second();
+  const Timeline::Point point = timeline.at(now);
+  currentState = point.state;
+  progress = point.progress;
+  setBrightness(point.brightness);
+  // the needles move every minute
+  return min<uint32_t>(point.until, 60 - currentTime->second());
+}
+
+static void scheduleChanged() {
+  today = UINT16_MAX;
+  if (currentTime->ticking()) {
+    currentTime->tickIn(updateState());
+    scheduler.wake(renderTask);
+  }
+}
+
+// Woken by the second timer, on the seconds something changes: follows
+// the time and state, and leaves the drawing to the render task. Polls
+// until the first NTP sync.
+static uint32_t tick() {
+  if (currentTime->process()) {
+    currentTime->tickIn(updateState());
+    scheduler.wake(renderTask);
+  }
+  return currentTime->ticking() ? Scheduler::NEVER : 100000;
+}
+
+static uint32_t render() {
+  display->render(currentTime->hour(), currentTime->minute(), currentState, progress);
+  return Scheduler::NEVER;
+}
+
+static uint32_t handleHttp() {
+  config->handle();
+  return HTTP_POLL_MS * 1000;
+}
+
+// a step every 20 ms, 0.4 s from the darkest to the brightest setting
+static uint32_t rampBrightness() {
+  constexpr uint8_t STEP = 15;
+  if (brightness == targetBrightness) {
+    return Scheduler::NEVER;
+  }
+  if (brightness < targetBrightness) {
+    brightness = min<int>(brightness + STEP, targetBrightness);
   }
   else {
-    // we must be awake!
-    currentState = Awake;
-    progress = 1;
-    if (time - config->getAwakeTime() < 30 || config->getSleepTime() - time < 10) {
-      display->setBrightness(200);
+    brightness = max<int>(brightness - STEP, targetBrightness);
+  }
+  display->setBrightness(brightness);
+  return 20000;
+}
+
+// Reports the connection as the WiFi events (or a periodic check) see it,
+// the SDK takes care of reconnecting.
+static uint32_t maintainWiFi() {
+  static bool connected = false;
+  if ((WiFi.status() == WL_CONNECTED) != connected) {
+    connected = !connected;
+    if (connected) {
+      Serial.printf("WiFi connected, settings at http://%s/\n", WiFi.localIP().toString().c_str());
     }
     else {
-      display->setBrightness(80);
+      Serial.println("WiFi connection lost");
     }
   }
+  return 10000000;
 }
 
-void loop() {
-  config->handle();
-  if (currentTime->process()) {
-    updateState();
-    display->render(currentTime->hour(), currentTime->minute(), currentState, progress);
+#ifdef PROFILE_SCHEDULER
+// once a minute: how late the tasks and ticks ran and how much of the time
+// was idle
+static uint32_t reportScheduler() {
+  const uint64_t total = scheduler.busyMicros + scheduler.idleMicros;
+  if (total > 0) {
+    Serial.printf("scheduler: %.1f%% idle\n", 100.0 * scheduler.idleMicros / total);
+    for (uint8_t i = 0; i < scheduler.size(); i++) {
+      const Scheduler::TaskStats &task = scheduler.stats(i);
+      if (task.runs > 0) {
+        Serial.printf("  %-10s %5u runs, %6u us late on average, %6u us at most\n",
+          task.name, task.runs, (uint32_t)(task.late / task.runs), task.maxLate);
+      }
+    }
   }
-  delay(200);
-}
\ No newline at end of file
+  currentTime->offsets.print(Serial);
+  currentTime->offsets = {};
+  scheduler.resetStats();
+  return 60000000;
+}
+#endif
+
+void loop() {
+  scheduler.run();
+}
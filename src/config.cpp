@@ -1,4 +1,5 @@
 #include "config.hpp"
+#include "time.hpp"
 
 static ESP8266WebServer http(80);
 
@@ -9,9 +10,9 @@ static void readAlarmConfig();
 static void faviconSVG();
 static void faviconPNG();
 
-static uint16_t sleepTime = 19 * 60;
-static uint16_t awakeTime = 7 * 60;
-static uint16_t awakeTransition = 5;
+extern Time *currentTime;
+static WeekSchedule schedule;
+static void (*changed)() = nullptr;
 
 Config::Config() {
   SPIFFS.begin();
@@ -24,30 +25,16 @@ Config::Config() {
   http.begin();
 }
 
-uint16_t Config::getAwakeTime() {
-    return awakeTime;
-}
-uint16_t Config::getSleepTime() {
-    return sleepTime;
-}
-
-uint16_t Config::getAwakeTransition() {
-    return awakeTransition;
+const DaySchedule &Config::scheduleFor(uint16_t day) {
+    return schedule.forDay(day);
 }
 
 void Config::handle() {
     http.handleClient();
 }
 
-static uint16_t read16(File & f) {
-  uint8_t buf[2];
-  f.read(buf, 2);
-  return buf[0] | (buf[1] << 8);
-}
-
-static void write16(File & f, uint16_t v) {
-  f.write((uint8_t)(v & 0xFF));
-  f.write((uint8_t)((v >> 8) & 0xFF));
+void Config::onChange(void (*callback)()) {
+    changed = callback;
 }
 
 static void readAlarmConfig() {
@@ -57,10 +44,12 @@ static void readAlarmConfig() {
     return;
   }
   Serial.println("Reading config file");
-  sleepTime = read16(f);
-  awakeTime = read16(f);
-  awakeTransition = read16(f);
+  uint8_t data[WeekSchedule::MAX_BYTES];
+  const size_t size = f.read(data, sizeof(data));
   f.close();
+  if (!schedule.read(data, size)) {
+    Serial.println("Config file too short");
+  }
 }
 
 static void writeAlarmConfig() {
@@ -69,15 +58,19 @@ static void writeAlarmConfig() {
     Serial.println("Error opening config file");
     return;
   }
-  write16(f, sleepTime);
-  write16(f, awakeTime);
-  write16(f, awakeTransition);
+  uint8_t data[WeekSchedule::MAX_BYTES];
+  f.write(data, schedule.write(data));
   f.close();
 }
 
+// Monday first on the page, as the week is read here
+static const uint8_t WEEK_ORDER[] = { 1, 2, 3, 4, 5, 6, 0 };
+static const char *const WEEKDAY_NAMES[] = { "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday" };
+
 static void renderConfigPage() {
-  char buffer[2048];
-  int generated = sprintf(buffer, "<!DOCTYPE html>"
+  http.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  http.send(200, "text/html", "");
+  http.sendContent("<!DOCTYPE html>"
     "<html lang=\"nl\"><head><title>Kids Clock</title>"
     "<meta charset=\"UTF-8\">"
     "<meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">"
@@ -89,18 +82,36 @@ static void renderConfigPage() {
       "@import url('https://fonts.googleapis.com/css2?family=Noto+Sans&display=swap');"
       "body{ font-family: 'Noto Sans', sans-serif; margin: 1em; line-height: 1.2; }"
       ".entry{ display: block; margin: 0.5em; }"
+      "td{ padding: 0.2em 0.5em; }"
     "</style></head>"
     "<body>"
     "<img src=\"/favicon.svg\" width=\"100%\" style=\"max-width: 200px; margin: 0 auto; display: block;\"/>"
     "<form action=\"/set\" method=\"POST\">"
-    "<span class=\"entry\"><label for=\"sleep\">Sleep</label><input id=\"sleep\" name=\"sleep\" type=\"time\" value=\"%02d:%02d\"/></span>"
-    "<span class=\"entry\"><label for=\"awakeTransition\">Awake transition</label><input id=\"awakeTransition\" name=\"awakeTransition\" type=\"number\" style=\"width:3em\" value=\"%d\"/> minutes</span>"
-    "<span class=\"entry\"><label for=\"awake\">Awake</label><input id=\"awake\" name=\"awake\" type=\"time\" value=\"%02d:%02d\"/></span>"
+    "<table><tr><th></th><th>Sleep</th><th>Awake transition</th><th>Awake</th></tr>");
+  char buffer[384];
+  for (uint8_t day : WEEK_ORDER) {
+    const DaySchedule &s = schedule.weekday(day);
+    snprintf(buffer, sizeof(buffer), "<tr><td>%s</td>"
+      "<td><input name=\"sleep%u\" type=\"time\" value=\"%02d:%02d\"/></td>"
+      "<td><input name=\"awakeTransition%u\" type=\"number\" style=\"width:3em\" value=\"%d\"/> minutes</td>"
+      "<td><input name=\"awake%u\" type=\"time\" value=\"%02d:%02d\"/></td></tr>",
+      WEEKDAY_NAMES[day], day, s.sleepTime / 60, s.sleepTime % 60, day, s.awakeTransition, day, s.awakeTime / 60, s.awakeTime % 60);
+    http.sendContent(buffer);
+  }
+  http.sendContent("</table>"
+    "<span class=\"entry\"><label for=\"exceptions\">Exceptions, a line per date: YYYY-MM-DD sleep transition awake, like 2026-12-24 20:30 5 08:00</label></span>"
+    "<textarea id=\"exceptions\" name=\"exceptions\" rows=\"6\" cols=\"32\">");
+  for (uint8_t i = 0; i < schedule.exceptionCount(); i++) {
+    const size_t length = min(schedule.formatException(i, buffer, sizeof(buffer)), sizeof(buffer) - 2);
+    buffer[length] = '\n';
+    buffer[length + 1] = '\0';
+    http.sendContent(buffer);
+  }
+  http.sendContent("</textarea>"
     "<input type=\"submit\" value=\"Change\" style=\"display:block\">"
     "</form>"
-    "</body></html>"
-  , sleepTime / 60, sleepTime % 60, awakeTransition, awakeTime / 60, awakeTime % 60);
-  http.send(200, "text/html", buffer, generated);
+    "</body></html>");
+  http.sendContent("");
 }
 
 static void faviconSVG() {
@@ -119,10 +130,40 @@ static long parseTime(const String & arg) {
 }
 
 static void handleConfigChange() {
-  sleepTime = parseTime(http.arg("sleep"));
-  awakeTime = parseTime(http.arg("awake"));
-  awakeTransition = http.arg("awakeTransition").toInt();
+  // exceptions for past dates are dropped, or they would fill the table
+  const uint16_t today = currentTime->ticking() ? currentTime->day() : 0;
+  WeekSchedule next;
+  bool fits = true;
+  if (http.hasArg("sleep")) {
+    // the single schedule of the page before the weekdays, for every day
+    next.clear({ (uint16_t)parseTime(http.arg("sleep")), (uint16_t)parseTime(http.arg("awake")), (uint16_t)http.arg("awakeTransition").toInt() });
+    for (uint8_t i = 0; i < schedule.exceptionCount(); i++) {
+      if (schedule.exceptionDay(i) >= today) {
+        next.setException(schedule.exceptionDay(i), schedule.exception(i));
+      }
+    }
+  }
+  else {
+    // the first schedule, all older firmware reads, is Monday's
+    for (uint8_t day : WEEK_ORDER) {
+      const String n(day);
+      const DaySchedule s = { (uint16_t)parseTime(http.arg("sleep" + n)), (uint16_t)parseTime(http.arg("awake" + n)), (uint16_t)http.arg("awakeTransition" + n).toInt() };
+      if (day == WEEK_ORDER[0]) {
+        next.clear(s);
+      }
+      fits = fits && next.setWeekday(day, s);
+    }
+    fits = fits && next.parseExceptions(http.arg("exceptions"), today);
+  }
+  if (!fits) {
+    http.send(400, "text/plain", "Too many different schedules or exceptions");
+    return;
+  }
+  schedule = next;
   writeAlarmConfig();
+  if (changed != nullptr) {
+    changed();
+  }
   http.sendHeader("Location", String("/"), true);
   http.send(302, "text/plain", "");
 }
\ No newline at end of file
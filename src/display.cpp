@@ -1,75 +1,120 @@
 #include "display.hpp"
-#include "NotoSansBold15.h"
+#include "face.hpp"
+#include "needle.hpp"
+#include "blend.hpp"
+#include "texts.hpp"
+#include "flash_font.hpp"
+#include "status_panel.hpp"
 #include "NotoSansBold36.h"
+#ifdef CLOCK_RUNTIME_NUMERALS
+#include "NotoSansBold15.h"
+#endif
 //#include "rabbit.h"
-#include "cat-paw.h"
-#include "cat-watch-face.h"
-#include "NotoGiraffe64-flatten.h"
-#include "NotoFrog64-flatten.h"
-#include "NotoFox64-flatten.h"
-
-#define HEX_TO_565(c) (((c & 0xf80000) >> 8) + ((c & 0xfc00) >> 5) + ((c & 0xf8) >> 3))
+// bits per pixel of the baked face in flash: 16 (RGB565), or palette
+// indices with 8 (256 colours) or 4 (16 colours)
+#ifndef CLOCK_FACE_BPP
+#define CLOCK_FACE_BPP 16
+#endif
+#if CLOCK_FACE_BPP != 16 && (defined(CLOCK_FACE_SPRITE) || defined(CLOCK_RUNTIME_NUMERALS))
+#error "CLOCK_FACE_BPP needs the baked dial composed per band, the needles can not blend into an indexed sprite"
+#endif
+#if CLOCK_FACE_BPP == 4
+#include "cat-watch-face-dial-indexed.h"
+#endif
+#include "packed-images.h"
+#include "cat-watch-face-dial-packed.h"
+#include "status-panels.h"
 
 constexpr uint32_t WIDTH = 160;
 constexpr uint32_t HEIGHT = 128;
-//constexpr uint32_t CLOCK_CENTER_X = 44;
-//constexpr uint32_t CLOCK_CENTER_Y = CLOCK_CENTER_X;
-constexpr uint32_t CLOCK_RADIUS = 46;
-
-constexpr uint16_t CLOCK_COLOR_FACE = HEX_TO_565(0x004488);
-
-#define ALPHA_GAIN 1.3f  // Should be 1.0 but 1.3 looks good on my TFT
-                         // Less than 1.0 makes hands look transparent
-
-// Support
-#define ipart(X) ((int16_t)(X))
-#define iround(X) ((uint16_t)(((float)(X))+0.5))
-#define fpart(X) (((float)(X))-(float)ipart(X))
-#define rfpart(X) (1.0-fpart(X))
-
-// Calculate distance of px,py to closest part of line ax,ay .... bx,by
-// ESP32 has FPU so floats are quite quick
-float lineDistance(float px, float py, float ax, float ay, float bx, float by) {
-  float pax = px - ax, pay = py - ay, bax = bx - ax, bay = by - ay;
-  float h = fmaxf(fminf((pax * bax + pay * bay) / (bax * bax + bay * bay), 1.0f), 0.0f);
-  float dx = pax - bax * h, dy = pay - bay * h;
-  return sqrtf(dx * dx + dy * dy);
-}
-
-// Alphablend specified color with image background pixel and plot at x,y
-void Display::plotPixel(int16_t x, int16_t y, float alpha, uint16_t color) {
-  // Adjust alpha, 1.3 gain is good for my display
-  alpha = alpha * ALPHA_GAIN * 255; // 1.3 alpha gain is good for my display gamma curve
-  // Clip alpha
-  if (alpha > 255) alpha = 255;
-  //Blend color with background and plot
-  face.drawPixel(x, y, face.alphaBlend((uint8_t)alpha, color, face.readPixel(x, y)));
-}
-
-// Anti aliased line ax,ay to bx,by, (2 * r) wide with rounded ends
-// Note: not optimised to minimise sampling zone
-// Using floats for line coordinates allows for sub-pixel positioning
-void Display::drawWideLineAA(float ax, float ay, float bx, float by, float r, uint16_t color) {
-  int16_t x0 = (int16_t)floorf(fminf(ax, bx) - r);
-  int16_t x1 = (int16_t) ceilf(fmaxf(ax, bx) + r);
-  int16_t y0 = (int16_t)floorf(fminf(ay, by) - r);
-  int16_t y1 = (int16_t) ceilf(fmaxf(ay, by) + r);
-
-  for (int y = y0; y <= y1; y++) {
-    for (int x = x0; x <= x1; x++) {
-      plotPixel(x, y, fmaxf(fminf(0.5f - (lineDistance(x, y, ax, ay, bx, by) - r), 1.0f), 0.0f), color);
+
+#ifdef CLOCK_FACE_SPRITE
+// Blend the spans of a needle (WideLineAA or NeedleMask) straight into
+// sprite memory (byte swapped RGB565), clip is only needed when the needle
+// sticks out of the sprite
+template<bool clip, typename Spans>
+static void blendSpans(const Spans &spans, const ColorBlend &blend, uint16_t *pixels, int16_t width, int16_t height) {
+  spans.drawSpans([&](int16_t x, int16_t y, int16_t w) {
+    if (clip) {
+      if (y < 0 || y >= height) return;
+      if (x < 0) { w += x; x = 0; }
+      if (x + w > width) w = width - x;
     }
+    uint16_t *p = pixels + (y * width) + x;
+    while (w-- > 0) *p++ = blend.swapped;
+  }, [&](int16_t x, int16_t y, uint8_t alpha) {
+    if (clip && (x < 0 || y < 0 || x >= width || y >= height)) return;
+    blend.blendSwapped(alpha, pixels + (y * width) + x);
+  });
+}
+
+template<typename Spans>
+static void blendSpans(const Spans &spans, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color, uint16_t *pixels, int16_t width, int16_t height) {
+  const ColorBlend blend(color);
+  if (x0 >= 0 && y0 >= 0 && x1 < width && y1 < height) {
+    blendSpans<false>(spans, blend, pixels, width, height);
   }
+  else {
+    blendSpans<true>(spans, blend, pixels, width, height);
+  }
+}
+#endif
+
+constexpr uint32_t STATUS_BOX_X = WIDTH - STATUS_PANEL_WIDTH;
+constexpr uint32_t PAW_GRID_X = STATUS_BOX_X + PAW_GRID_LEFT;
+constexpr uint32_t PAW_GRID_Y = PAW_GRID_TOP;
+
+constexpr int16_t FACE_SIZE = CLOCK_RADIUS * 2;
+constexpr int16_t NAME_Y = FACE_SIZE + 2;
+
+static const FlashFont NAME_FONT(NotoSansBold36);
+#ifdef CLOCK_RUNTIME_NUMERALS
+static const FlashFont TEXT_FONT(NotoSansBold15);
+#endif
+
+static const PackedImage *statusPanel(State state) {
+    switch (state) {
+        case Sleeping: return &STATUS_SLEEPING_PACKED;
+        case WakingUp: return &STATUS_WAKING_UP_PACKED;
+        case Awake: return &STATUS_AWAKE_PACKED;
+        default: return nullptr;
+    }
+}
+
+#ifdef CLOCK_RUNTIME_NUMERALS
+static const PackedImage &FACE_IMAGE = CAT_WATCH_FACE_PACKED;
+#elif CLOCK_FACE_BPP == 16
+static const PackedImage &FACE_IMAGE = CAT_WATCH_FACE_DIAL_PACKED;
+#elif CLOCK_FACE_BPP == 8
+static const PackedImage &FACE_IMAGE = CAT_WATCH_FACE_DIAL8_PACKED;
+#elif CLOCK_FACE_BPP == 4
+// Look up w pixels of line y of the 4 bit face, starting at x, and store
+// them byte swapped at to[x]. Two pixels a byte, the left one in the high
+// nibble; this does not pack any smaller with runs.
+static void expandFaceRow(uint16_t *to, int16_t y, int16_t x, int16_t w) {
+    const uint8_t *from = CAT_WATCH_FACE_DIAL_INDEX4 + (y * FACE_SIZE / 2);
+    for (int16_t i = x; i < x + w; i++) {
+        const uint8_t pair = pgm_read_byte(from + (i / 2));
+        const uint16_t c = pgm_read_word(CAT_WATCH_FACE_DIAL_PALETTE4 + ((i & 1) ? pair & 0xF : pair >> 4));
+        to[i] = (c >> 8) | (c << 8);
+    }
 }
+#else
+#error "CLOCK_FACE_BPP has to be 16, 8 or 4"
+#endif
 
 Display::Display() {
   lcd.init();
   lcd.setRotation(1);
-  lcd.fillScreen(TFT_BLACK);
-  renderEdges();
-  lcd.loadFont(NotoSansBold15);
-  face.loadFont(NotoSansBold15);
-  face.createSprite(CLOCK_RADIUS * 2, CLOCK_RADIUS * 2);
+  band.createSprite(WIDTH, TileHashes::SIZE);
+  layers[NameBanner].bounds = Rect(0, NAME_Y, NAME_FONT.textWidth(NAME_TEXT), NAME_FONT.height());
+#ifdef CLOCK_FACE_SPRITE
+  face.createSprite(FACE_SIZE, FACE_SIZE);
+#endif
+  layers[Background].bounds = Rect(0, 0, WIDTH, HEIGHT);
+  invalidate(Background);
+  invalidate(NameBanner);
+  flush();
   pinMode(D1, OUTPUT);
   setBrightness(200);
 }
@@ -78,127 +123,546 @@ void Display::setBrightness(uint8_t brightness) {
   analogWrite(D1, brightness);
 }
 
-void Display::render(uint8_t hour, uint8_t minute, State state, float progress) {
-    showTime(hour, minute);
+// only repaint what changed since the last call, the face only changes once a minute
+void Display::render(uint8_t hour, uint8_t minute, State state, uint32_t progress) {
+    if (hour != currentHour || minute != currentMinute) {
+        currentHour = hour;
+        currentMinute = minute;
+        showTime(hour, minute);
+    }
     if (state != currentState) {
         currentState = state;
         updateStatus(state);
+        currentProgress = UINT32_MAX; // the paws have been redrawn
     }
-    if (state != Awake) {
+    if (state != Awake && progress != currentProgress) {
+        currentProgress = progress;
         updateProgress(progress);
     }
+    flush();
+}
+
+// repaint the whole layer on the next flush
+void Display::invalidate(Layer layer) {
+    layers[layer].dirty = true;
+}
+
+// repaint only this area on the next flush
+void Display::invalidate(const Rect &area) {
+    damage.add(area);
 }
 
-void Display::renderEdges() {
-    lcd.loadFont(NotoSansBold36);
-    lcd.setTextColor(TFT_RED, TFT_BLACK);
-    lcd.setCursor(0, (CLOCK_RADIUS * 2) + 2);
-    lcd.setTextDatum(BL_DATUM);
-    lcd.println("Tom");
-    lcd.unloadFont();
+void Display::moveLayer(Layer layer, const Rect &bounds) {
+    damage.add(layers[layer].bounds);
+    layers[layer].bounds = bounds;
+    layers[layer].dirty = true;
 }
 
-constexpr uint32_t HOUR_ANGLE = 360 / 12;
-constexpr uint32_t MINUTE_ANGLE = 360 / 60;
+// Damaged areas are composed a row of tiles at a time in the band, with
+// each area painted from the top most layer that is opaque over it. Only
+// tiles whose hash changed are pushed, an area that changed completely
+// goes out in one lcd window. A row of tiles is sent by the pipe while the
+// next one is composed.
+void Display::flush() {
+    for (uint8_t l = 0; l < LayerCount; l++) {
+        if (layers[l].dirty) {
+            damage.add(layers[l].bounds);
+            layers[l].dirty = false;
+        }
+    }
+    timing = FrameTiming();
+    pipe.stallCycles = 0;
+    pipe.sentBytes = 0;
+    tiles.begin();
+    lcd.startWrite();
+    for (uint8_t i = 0; i < damage.size(); i++) {
+        pushArea(damage[i].intersect(Rect(0, 0, WIDTH, HEIGHT)), burst);
+    }
+    pipe.wait();
+    lcd.endWrite();
+    damage.clear();
+    burst = Rect();
+    timing.stall = pipe.stallCycles;
+    timing.spi = ((uint64_t)pipe.sentBytes * 8 * ESP.getCpuFreqMHz() * 1000000) / SPI_FREQUENCY;
+#ifdef PROFILE_RENDER
+    if (pipe.sentBytes > 0) {
+        const uint32_t mhz = ESP.getCpuFreqMHz();
+        Serial.printf("frame: %u us compose, %u us SPI, %u us stall\n",
+            timing.compose / mhz, timing.spi / mhz, timing.stall / mhz);
+    }
+#endif
+}
 
-static double toRad(uint32_t angle) {
-    return DEG_TO_RAD * angle;
+void Display::compose(const Rect &area) {
+    uint8_t first = Background;
+    for (uint8_t l = LayerCount - 1; l > Background; l--) {
+        if (covers((Layer)l, area)) {
+            first = l;
+            break;
+        }
+    }
+    for (uint8_t l = first; l < LayerCount; l++) {
+        const Rect clip = layers[l].bounds.intersect(area);
+        if (!clip.empty()) {
+            paint((Layer)l, clip, area.y);
+            pipe.pump();
+        }
+    }
 }
 
-uint16_t Display::lookupColor(uint16_t x, uint16_t y) {
-    //Serial.printf("Lookup: %d , %d: %x\n", x, y, face.readPixel(x, y));
-    //return TFT_RED;
-    return face.readPixel(x, y);
+// queue the rows of area in the band behind the lcd window already queued
+void Display::pushRows(const Rect &area) {
+    const uint16_t *pixels = (const uint16_t *)band.getPointer();
+    pipe.rows(pixels + (area.y * WIDTH) + area.x, WIDTH, area.w, area.h);
 }
 
-void Display::drawNeedle(float angle, uint16_t length) {
-    double x = CLOCK_RADIUS + (length * cos(toRad(angle))); 
-    double y = CLOCK_RADIUS + (length * sin(toRad(angle)));
-    drawWideLineAA(CLOCK_RADIUS, CLOCK_RADIUS, x, y, 2., CLOCK_COLOR_FACE);
+// the tiles within whole are pushed even when their hash is the same, so
+// an area that changed almost completely goes out in one window
+void Display::pushArea(const Rect &area, const Rect &whole) {
+    constexpr int16_t TILE = TileHashes::SIZE;
+    if (area.empty()) {
+        return;
+    }
+    const uint8_t firstColumn = area.x / TILE;
+    const uint8_t lastColumn = (area.right() - 1) / TILE;
+    bool streaming = false;  // the lcd window is still open for the rest of area
+    for (int16_t top = area.y - (area.y % TILE); top < area.bottom(); top += TILE) {
+        const Rect tileRow(firstColumn * TILE, top, (lastColumn + 1 - firstColumn) * TILE, TILE);
+        const Rect part = area.intersect(tileRow);
+        const uint32_t start = ESP.getCycleCount();
+        // the whole tiles are composed, the hash covers all of them
+        compose(tileRow);
+        const uint16_t *pixels = (const uint16_t *)band.getPointer();
+        bool changed[TileHashes::COLUMNS];
+        bool all = true;
+        for (uint8_t c = firstColumn; c <= lastColumn; c++) {
+            changed[c] = tiles.changed(c, top / TILE, pixels + (c * TILE), WIDTH)
+                || whole.contains(Rect(c * TILE, top, TILE, TILE));
+            all = all && changed[c];
+            pipe.pump();
+        }
+        timing.compose += ESP.getCycleCount() - start;
+        if (all) {
+            if (!streaming) {
+                pipe.window(Rect(area.x, part.y, area.w, area.bottom() - part.y));
+                streaming = true;
+            }
+            pushRows(Rect(part.x, part.y - top, part.w, part.h));
+            pipe.pump();
+            continue;
+        }
+        streaming = false;
+        for (uint8_t c = firstColumn; c <= lastColumn;) {
+            uint8_t end = c;
+            while (end <= lastColumn && changed[end] == changed[c]) {
+                end++;
+            }
+            const Rect run = part.intersect(Rect(c * TILE, top, (end - c) * TILE, TILE));
+            if (changed[c]) {
+                pipe.window(run);
+                pushRows(Rect(run.x, run.y - top, run.w, run.h));
+            }
+            else {
+                bytesSaved += run.w * run.h * sizeof(uint16_t);
+            }
+            c = end;
+        }
+        pipe.pump();
+    }
 }
 
-void Display::renderFace(float hourAngle, float minuteAngle) {
-  face.setSwapBytes(true);
-  face.pushImage(0,0, 92, 92, CAT_WATCH_FACE);
-  face.setSwapBytes(false);
+// the part of a paw row hidden by the progress mask
+Rect Display::progressBand(uint8_t band) const {
+    return Rect(PAW_GRID_X, PAW_GRID_Y + (band * AREA_AROUND_CAT), progressWidth[band], AREA_AROUND_CAT);
+}
 
-  //face.fillCircle(CLOCK_RADIUS, CLOCK_RADIUS, 3, CLOCK_COLOR_FACE);
-  face.setTextDatum(MC_DATUM);
-  face.setTextColor(CLOCK_COLOR_FACE); 
-  constexpr uint32_t dialOffset = CLOCK_RADIUS - 7;
-  for (uint32_t h = 0; h < 12; h++) {
-      double x = CLOCK_RADIUS + (dialOffset * cos(toRad(h * HOUR_ANGLE))); 
-      double y = CLOCK_RADIUS + (dialOffset * sin(toRad(h * HOUR_ANGLE)));
+// does the layer hide everything below it in area
+bool Display::covers(Layer layer, const Rect &area) const {
+    switch (layer) {
+        case Background:
+        case Dial:
+        case StatusPanel:
+            return layers[layer].bounds.contains(area);
+        case ProgressMask:
+            if (layers[ProgressMask].bounds.empty()) {
+                return false;
+            }
+            for (uint8_t band = 0; band < 3; band++) {
+                if (progressBand(band).contains(area)) {
+                    return true;
+                }
+            }
+            return false;
+        default:
+            // needles, paws and text leave the layers below showing
+            return false;
+    }
+}
 
-      uint32_t actualHour = (h + 3) % 12;
-      face.drawNumber(actualHour == 0 ? 12 : actualHour, round(x), round(y));
-  }
-  //face.unloadFont();
-  drawNeedle(hourAngle, CLOCK_RADIUS / 3);
-  drawNeedle(minuteAngle, CLOCK_RADIUS - 16);
-  face.pushSprite(0,0, TFT_TRANSPARENT);
+// paint the part of a layer within clip into the band, which starts at
+// line top of the screen
+void Display::paint(Layer layer, const Rect &clip, int16_t top) {
+    switch (layer) {
+        case Background:
+            band.fillRect(clip.x, clip.y - top, clip.w, clip.h, TFT_BLACK);
+            return;
+#ifdef CLOCK_FACE_SPRITE
+        case Dial: {
+            // the needles are drawn into the face sprite, so this copies them too
+            const uint16_t *from = (const uint16_t *)face.getPointer();
+            uint16_t *to = (uint16_t *)band.getPointer();
+            for (int16_t y = clip.y; y < clip.bottom(); y++) {
+                memcpy(to + ((y - top) * WIDTH) + clip.x, from + (y * face.width()) + clip.x, clip.w * sizeof(uint16_t));
+            }
+            return;
+        }
+        case HourNeedle:
+        case MinuteNeedle:
+            return;
+#else
+        case Dial: {
+            // a row at a time, the pipe is fed in between
+            uint16_t *pixels = (uint16_t *)band.getPointer();
+            for (int16_t y = clip.y; y < clip.bottom(); y++) {
+#if CLOCK_FACE_BPP == 4
+                expandFaceRow(pixels + ((y - top) * WIDTH), y, clip.x, clip.w);
+#else
+                FACE_IMAGE.decodeRow(y, clip.x, clip.w, pixels + ((y - top) * WIDTH) + clip.x);
+#endif
+                pipe.pump();
+            }
+#ifdef CLOCK_RUNTIME_NUMERALS
+            drawDial(TEXT_FONT, band, top, &texts);
+#endif
+            return;
+        }
+        case HourNeedle:
+            paintNeedle(hourNeedle, clip, top);
+            return;
+        case MinuteNeedle:
+            paintNeedle(minuteNeedle, clip, top);
+            return;
+#endif
+        case StatusPanel:
+            paintImage(*statusPanel(currentState), STATUS_BOX_X, 0, top);
+            return;
+        case ProgressMask:
+            for (uint8_t row = 0; row < 3; row++) {
+                const Rect hidden = progressBand(row).intersect(clip);
+                if (!hidden.empty()) {
+                    band.fillRect(hidden.x, hidden.y - top, hidden.w, hidden.h, TFT_BLACK);
+                }
+            }
+            return;
+        case NameBanner:
+            paintNameBanner(top);
+            return;
+        default:
+            return;
+    }
 }
 
-constexpr uint32_t STATUS_BOX_WIDTH = 64;
-constexpr uint32_t STATUS_BOX_HEIGHT = 64;
-constexpr uint32_t STATUS_BOX_X = WIDTH - STATUS_BOX_WIDTH;
+void Display::paintNameBanner(int16_t top) {
+    texts.draw(NAME_FONT, band, NAME_TEXT, 0, NAME_Y - top, TL_DATUM, TFT_RED, TFT_BLACK);
+}
+
+// the needles are tabled per whole degree, so that is all the key needs
+static uint32_t needleKey(uint16_t degrees, uint16_t length) {
+    return ((uint32_t)length << 16) | degrees;
+}
 
-constexpr uint32_t AREA_AROUND_CAT = 18;
+// Anti aliased needle, (2 * 2) wide with rounded ends
+static WideLineAA needleLine(uint32_t key) {
+    const DialPoint end = needleEnd(key >> 16, key & 0xFFFF);
+    constexpr int32_t center = CLOCK_RADIUS << 16;
+    return WideLineAA::fromQ16(center, center, end.x, end.y, 2 << 16);
+}
 
+static Rect needleBounds(const DrawnNeedle &needle) {
+    if (!needle.valid) {
+        const WideLineAA line = needleLine(needle.key);
+        return Rect(line.x0, line.y0, line.x1 - line.x0 + 1, line.y1 - line.y0 + 1);
+    }
+    const NeedleMask mask(needle.mask);
+    return Rect(mask.x0(), mask.y0(), mask.x1() - mask.x0() + 1, mask.y1() - mask.y0() + 1);
+}
 
-void Display::updateStatus(State newState) {
-    switch(newState) {
-        case Sleeping: updateStatus(NotoFox64, "Slapen", TFT_RED); return;
-        case WakingUp: updateStatus(NotoGiraffe64, "Rustig", TFT_YELLOW); return;
-        case Awake: updateStatus(NotoFrog64, "Wakker", TFT_DARKGREEN); return;
-    }
-}
-void Display::updateStatus(const uint16_t* img, const String &txt, uint16_t color) {
-    lcd.fillRect(STATUS_BOX_X, 0, STATUS_BOX_WIDTH, STATUS_BOX_HEIGHT, TFT_BLACK);
-    lcd.setTextColor(color, TFT_BLACK);
-    lcd.drawCentreString(txt, STATUS_BOX_X + (STATUS_BOX_WIDTH /  2), 0, 1);
-    lcd.setSwapBytes(true);
-    if (img != NotoFrog64) {
-        for (uint32_t x = 0; x < 3; x++) {
-            for (uint32_t y = 0; y < 3; y++) {
-                lcd.pushImage(STATUS_BOX_X + 7 + (x * 18), 15 + y * 18, 16, 16, cat_paw);
+// Pixels of the face that have to be pushed to the lcd again, kept as the
+// changed columns per row. Rows are pushed together in one window as long
+// as that costs less than the 11 bytes of setting up a new window.
+class DirtyRows {
+private:
+    static constexpr int16_t ROWS = FACE_SIZE;
+    static constexpr uint32_t WINDOW_BYTES = 11;
+    int16_t left[ROWS], right[ROWS];
+public:
+    DirtyRows() {
+        for (int16_t y = 0; y < ROWS; y++) {
+            left[y] = INT16_MAX;
+            right[y] = INT16_MIN;
+        }
+    }
+    void add(int16_t x, int16_t y, int16_t w) {
+        if (y >= 0 && y < ROWS) {
+            left[y] = min(left[y], x);
+            right[y] = max(right[y], (int16_t)(x + w - 1));
+        }
+    }
+    void add(const DrawnNeedle &needle) {
+        if (!needle.valid) {
+            const Rect box = needleBounds(needle);
+            for (int16_t y = box.y; y < box.bottom(); y++) {
+                add(box.x, y, box.w);
+            }
+            return;
+        }
+        NeedleMask(needle.mask).drawSpans([&](int16_t x, int16_t y, int16_t w) {
+            add(x, y, w);
+        }, [&](int16_t x, int16_t y, uint8_t) {
+            add(x, y, 1);
+        });
+    }
+    template<typename Window>
+    void windows(Window window) const {
+        int16_t x0 = 0, x1 = -1, y0 = 0;
+        auto flush = [&](int16_t y1) {
+            if (x1 >= x0) {
+                window(Rect(x0, y0, x1 - x0 + 1, y1 - y0));
+            }
+        };
+        for (int16_t y = 0; y < ROWS; y++) {
+            if (left[y] > right[y]) {
+                flush(y);
+                x1 = -1;
+                continue;
             }
+            if (x1 >= x0) {
+                const int16_t l = min(x0, left[y]), r = max(x1, right[y]);
+                const uint32_t merged = (r - l + 1) * (y - y0 + 1) * 2;
+                const uint32_t split = ((x1 - x0 + 1) * (y - y0) * 2) + WINDOW_BYTES + ((right[y] - left[y] + 1) * 2);
+                if (merged <= split) {
+                    x0 = l;
+                    x1 = r;
+                    continue;
+                }
+                flush(y);
+            }
+            x0 = left[y];
+            x1 = right[y];
+            y0 = y;
         }
+        flush(ROWS);
+    }
+};
+
+// Put the coverage of the needle in needle.mask. It is cached per angle,
+// so only new angles have to be rasterised.
+void Display::loadNeedle(DrawnNeedle &needle, uint16_t degrees, uint16_t length) {
+    needle.key = needleKey(degrees, length);
+    const uint8_t *mask = needleCache.find(needle.key);
+    if (mask != nullptr) {
+        memcpy(needle.mask, mask, min(NeedleMask(mask).size(), (uint16_t)sizeof(needle.mask)));
+        needle.valid = true;
+        return;
+    }
+    const uint16_t size = NeedleMask::record(needleLine(needle.key), needle.mask, sizeof(needle.mask));
+    needle.valid = size > 0;
+    if (needle.valid) {
+        needleCache.insert(needle.key, needle.mask, size);
     }
-    lcd.pushImage(WIDTH - 64, HEIGHT-64, 64, 64, img);
-    lcd.setSwapBytes(false);
 }
 
-static float min(float a, float b) {
-    return a > b ? b : a;
+#ifdef CLOCK_FACE_SPRITE
+// Draw the needle into the face sprite, keeping the pixels it covers so
+// restoreNeedle can take it off again.
+void Display::drawNeedle(uint16_t *pixels, uint16_t degrees, uint16_t length, DrawnNeedle &needle) {
+    loadNeedle(needle, degrees, length);
+    if (!needle.valid) {
+        const WideLineAA line = needleLine(needle.key);
+        blendSpans(line, line.x0, line.y0, line.x1, line.y1, CLOCK_COLOR_FACE, pixels, face.width(), face.height());
+        return;
+    }
+    const NeedleMask mask(needle.mask);
+    const int16_t width = face.width();
+    needle.valid = false;
+    if (mask.x0() >= 0 && mask.y0() >= 0 && mask.x1() < width && mask.y1() < face.height()) {
+        uint16_t saved = 0;
+        mask.drawSpans([&](int16_t x, int16_t y, int16_t w) {
+            const uint16_t *p = pixels + (y * width) + x;
+            while (w-- > 0 && saved < NEEDLE_PIXELS) needle.pixels[saved++] = *p++;
+        }, [&](int16_t x, int16_t y, uint8_t) {
+            if (saved < NEEDLE_PIXELS) needle.pixels[saved++] = pixels[(y * width) + x];
+        });
+        needle.valid = saved < NEEDLE_PIXELS;
+    }
+    blendSpans(mask, mask.x0(), mask.y0(), mask.x1(), mask.y1(), CLOCK_COLOR_FACE, pixels, face.width(), face.height());
 }
 
-void Display::progressLine(uint32_t line_y, float hide_line) {
-    lcd.fillRect(STATUS_BOX_X + 7, line_y, round(AREA_AROUND_CAT * 3 * min(hide_line, 1.0)), AREA_AROUND_CAT, TFT_BLACK);
+// put back the face pixels a needle was drawn over
+void Display::restoreNeedle(uint16_t *pixels, const DrawnNeedle &needle) {
+    const NeedleMask mask(needle.mask);
+    const int16_t width = face.width();
+    const uint16_t *saved = needle.pixels;
+    mask.drawSpans([&](int16_t x, int16_t y, int16_t w) {
+        uint16_t *p = pixels + (y * width) + x;
+        while (w-- > 0) *p++ = *saved++;
+    }, [&](int16_t x, int16_t y, uint8_t) {
+        pixels[(y * width) + x] = *saved++;
+    });
 }
-void Display::updateProgress(float progress) {
-    uint32_t line_y = 15;
-    for (int i = 0; i < 3; i++) {
-        progressLine(line_y, progress / 0.33);
-        line_y += AREA_AROUND_CAT;
-        progress -= 0.33;
+
+// The first face is drawn in full, after that the needles are taken off by
+// restoring the pixels under them, and only the area they moved in is
+// pushed to the lcd (a few hundred bytes instead of the 17KB face).
+void Display::renderFace(uint16_t hourAngle, uint16_t minuteAngle) {
+  uint16_t *pixels = (uint16_t *)face.getPointer();
+  if (!hourNeedle.valid || !minuteNeedle.valid) {
+    for (int16_t y = 0; y < FACE_SIZE; y++) {
+      FACE_IMAGE.decodeRow(y, 0, FACE_SIZE, pixels + (y * FACE_SIZE));
     }
+#ifdef CLOCK_RUNTIME_NUMERALS
+    drawDial(TEXT_FONT, face, 0, &texts);
+#endif
+    drawNeedle(pixels, hourAngle, HOUR_LENGTH, hourNeedle);
+    drawNeedle(pixels, minuteAngle, MINUTE_LENGTH, minuteNeedle);
+    layers[HourNeedle].bounds = needleBounds(hourNeedle);
+    layers[MinuteNeedle].bounds = needleBounds(minuteNeedle);
+    moveLayer(Dial, Rect(0, 0, FACE_SIZE, FACE_SIZE));
+    return;
+  }
+  const bool hourMoved = needleKey(hourAngle, HOUR_LENGTH) != hourNeedle.key;
+  if (!hourMoved && needleKey(minuteAngle, MINUTE_LENGTH) == minuteNeedle.key) {
+    return;
+  }
+#ifdef PROFILE_RENDER
+  const uint32_t start = ESP.getCycleCount();
+#endif
+  DirtyRows dirty;
+  // the minute needle is on top, so it comes off first
+  dirty.add(minuteNeedle);
+  restoreNeedle(pixels, minuteNeedle);
+  if (hourMoved) {
+    dirty.add(hourNeedle);
+    restoreNeedle(pixels, hourNeedle);
+    drawNeedle(pixels, hourAngle, HOUR_LENGTH, hourNeedle);
+  }
+  drawNeedle(pixels, minuteAngle, MINUTE_LENGTH, minuteNeedle);
+  if (!hourNeedle.valid || !minuteNeedle.valid) {
+    invalidate(Dial);
+    return;
+  }
+  layers[HourNeedle].bounds = needleBounds(hourNeedle);
+  layers[MinuteNeedle].bounds = needleBounds(minuteNeedle);
+  if (hourMoved) {
+    dirty.add(hourNeedle);
+  }
+  dirty.add(minuteNeedle);
+#ifdef PROFILE_RENDER
+  Serial.printf("needles: %u cycles\n", ESP.getCycleCount() - start);
+#endif
+  dirty.windows([&](const Rect &area) {
+    invalidate(area);
+  });
+}
+#else
+// Blend the part of a needle within clip into the band, which starts at
+// line top of the screen
+template<typename Spans>
+static void blendSpans(const Spans &spans, uint16_t color, const Rect &clip, uint16_t *band, int16_t top) {
+  const ColorBlend blend(color);
+  spans.drawSpans([&](int16_t x, int16_t y, int16_t w) {
+    if (y < clip.y || y >= clip.bottom()) return;
+    const int16_t from = max(x, clip.x), to = min((int16_t)(x + w), clip.right());
+    uint16_t *p = band + ((y - top) * WIDTH) + from;
+    for (int16_t i = from; i < to; i++) *p++ = blend.swapped;
+  }, [&](int16_t x, int16_t y, uint8_t alpha) {
+    if (x < clip.x || y < clip.y || x >= clip.right() || y >= clip.bottom()) return;
+    blend.blendSwapped(alpha, band + ((y - top) * WIDTH) + x);
+  });
 }
 
+void Display::paintNeedle(const DrawnNeedle &needle, const Rect &clip, int16_t top) {
+    uint16_t *pixels = (uint16_t *)band.getPointer();
+    if (needle.valid) {
+        blendSpans(NeedleMask(needle.mask), CLOCK_COLOR_FACE, clip, pixels, top);
+    }
+    else {
+        blendSpans(needleLine(needle.key), CLOCK_COLOR_FACE, clip, pixels, top);
+    }
+}
 
-static float fixPosition(float x) {
-  if (x <= 90) {
-    return x + 270;
+// The face is composed from flash a band at a time in flush(), all that
+// changes here are the needle masks and the area they moved in.
+void Display::renderFace(uint16_t hourAngle, uint16_t minuteAngle) {
+  const bool first = layers[Dial].bounds.empty();
+  const bool hourMoved = first || needleKey(hourAngle, HOUR_LENGTH) != hourNeedle.key;
+  const bool minuteMoved = first || needleKey(minuteAngle, MINUTE_LENGTH) != minuteNeedle.key;
+  if (!hourMoved && !minuteMoved) {
+    return;
+  }
+  DirtyRows dirty;
+  if (hourMoved) {
+    if (!first) dirty.add(hourNeedle);
+    loadNeedle(hourNeedle, hourAngle, HOUR_LENGTH);
+    dirty.add(hourNeedle);
+  }
+  if (minuteMoved) {
+    if (!first) dirty.add(minuteNeedle);
+    loadNeedle(minuteNeedle, minuteAngle, MINUTE_LENGTH);
+    dirty.add(minuteNeedle);
   }
-  return x - 90;
+  layers[HourNeedle].bounds = needleBounds(hourNeedle);
+  layers[MinuteNeedle].bounds = needleBounds(minuteNeedle);
+  if (first) {
+    moveLayer(Dial, Rect(0, 0, FACE_SIZE, FACE_SIZE));
+    return;
+  }
+  dirty.windows([&](const Rect &area) {
+    invalidate(area);
+  });
 }
+#endif
 
+// The panel of the new state goes out in one window, the progress mask
+// over its paws included.
+void Display::updateStatus(State newState) {
+    const bool paws = newState == Sleeping || newState == WakingUp;
+    moveLayer(StatusPanel, statusPanel(newState) != nullptr
+        ? Rect(STATUS_BOX_X, 0, STATUS_PANEL_WIDTH, STATUS_PANEL_HEIGHT) : Rect());
+    burst = layers[StatusPanel].bounds;
+    layers[ProgressMask].bounds = paws ? Rect(PAW_GRID_X, PAW_GRID_Y, AREA_AROUND_CAT * 3, AREA_AROUND_CAT * 3) : Rect();
+}
 
-void Display::showTime(uint8_t hour, uint8_t minute) {
-  if (hour >= 12) {
-    hour -= 12;
-  }
-  float hourPosition = (360 / 12.0) * (hour + (minute / 60.0));
+// decode the rows of the image at x, y that fall in the band
+void Display::paintImage(const PackedImage &image, int16_t x, int16_t y, int16_t top) {
+    uint16_t *pixels = (uint16_t *)band.getPointer();
+    const int16_t first = max(y, top), last = min((int16_t)(y + image.height), (int16_t)(top + band.height()));
+    for (int16_t row = first; row < last; row++) {
+        image.decodeRow(row - y, 0, image.width, pixels + ((row - top) * WIDTH) + x);
+        pipe.pump();
+    }
+}
+
+// The rows of paws are hidden one after the other, each over 33% of the
+// progress. Only the columns that got hidden (or shown again) are damaged,
+// nothing when the widths stay the same.
+void Display::updateProgress(uint32_t progress) {
+    // in hundredths, so a row is exactly 33
+    constexpr int32_t ROW_PROGRESS = PROGRESS_FULL * 33;
+    constexpr int32_t ROW_WIDTH = AREA_AROUND_CAT * 3;
+    for (uint8_t band = 0; band < 3; band++) {
+        const int32_t into = (int32_t)(progress * 100) - (band * ROW_PROGRESS);
+        const uint8_t width = into <= 0 ? 0 : min(((into * ROW_WIDTH) + (ROW_PROGRESS / 2)) / ROW_PROGRESS, ROW_WIDTH);
+        const Rect before = progressBand(band);
+        if (width == before.w) {
+            continue;
+        }
+        progressWidth[band] = width;
+        const uint8_t from = min(before.w, (int16_t)width), to = max(before.w, (int16_t)width);
+        invalidate(Rect(PAW_GRID_X + from, before.y, to - from, AREA_AROUND_CAT));
+    }
+}
 
-  renderFace(fixPosition(hourPosition), fixPosition((360 / 60.0) * minute));
+void Display::showTime(uint8_t hour, uint8_t minute) {
+  renderFace(hourDegrees(hour, minute), minuteDegrees(minute));
 }
\ No newline at end of file
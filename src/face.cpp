@@ -0,0 +1,141 @@
+#include "face.hpp"
+
+// Compile time sin and cos of DEG_TO_RAD * degrees, for the tables below,
+// so the needles and numerals cost no soft float at run time. The argument
+// is reduced to within pi / 4 of a quarter turn and the series summed with
+// about twice the bits of a double (a value is kept as the sum of two), so
+// the result is the double nearest to the exact value.
+struct Double2 {
+  double high, low;
+};
+
+static constexpr Double2 twoSum(double a, double b) {
+  const double sum = a + b, bb = sum - a;
+  return { sum, (a - (sum - bb)) + (b - bb) };
+}
+
+static constexpr Double2 twoProduct(double a, double b) {
+  // split in halves of 26 bits, their products are exact
+  const double splitA = (134217729.0 * a) - ((134217729.0 * a) - a);
+  const double splitB = (134217729.0 * b) - ((134217729.0 * b) - b);
+  const double product = a * b;
+  return { product, ((splitA * splitB) - product) + (splitA * (b - splitB)) + ((a - splitA) * splitB)
+    + ((a - splitA) * (b - splitB)) };
+}
+
+static constexpr Double2 add(Double2 a, Double2 b) {
+  const Double2 sum = twoSum(a.high, b.high);
+  return twoSum(sum.high, sum.low + a.low + b.low);
+}
+
+static constexpr Double2 multiply(Double2 a, Double2 b) {
+  const Double2 product = twoProduct(a.high, b.high);
+  return twoSum(product.high, product.low + (a.high * b.low) + (a.low * b.high));
+}
+
+static constexpr Double2 divide(Double2 a, double b) {
+  const double q = a.high / b;
+  const Double2 rest = add(a, { -twoProduct(q, b).high, -twoProduct(q, b).low });
+  return twoSum(q, (rest.high + rest.low) / b);
+}
+
+// the series of sin (first 1) or cos (first 0), up to x^25
+static constexpr double series(Double2 x, int first) {
+  const Double2 square = multiply(x, x);
+  Double2 term = first == 1 ? x : Double2{ 1, 0 }, sum = term;
+  for (int n = first + 1; n < 26; n += 2) {
+    term = divide(multiply(term, { -square.high, -square.low }), n * (n + 1));
+    sum = add(sum, term);
+  }
+  return sum.high + sum.low;
+}
+
+// pi / 2 in three parts, the first two of 33 bits
+static constexpr double PI_2[] = { 1.57079632673412561417e+00, 6.07710050630396597660e-11, 2.02226624879595063154e-21 };
+
+// quadrant is 0 for cos, 1 for sin (which is cos a quarter turn back)
+static constexpr double quarterTurns(uint32_t degrees, uint32_t quadrant) {
+  const double angle = DEG_TO_RAD * degrees;
+  const uint32_t turns = (degrees + 45) / 90;
+  // turns times the first two parts and angle minus the first are exact
+  const Double2 x = add(twoSum(angle - (turns * PI_2[0]), -(turns * PI_2[1])), { -(turns * PI_2[2]), 0 });
+  switch ((turns + 4 - quadrant) % 4) {
+    case 0: return series(x, 0);
+    case 1: return -series(x, 1);
+    case 2: return -series(x, 0);
+    default: return series(x, 1);
+  }
+}
+
+static constexpr double constCos(uint32_t degrees) {
+  return quarterTurns(degrees, 0);
+}
+
+static constexpr double constSin(uint32_t degrees) {
+  return quarterTurns(degrees, 1);
+}
+
+// Q16 as WideLineAA rounds it, after the double went through a float
+static constexpr int32_t floatQ16(double v) {
+  return (int32_t)(((double)(float)v * 65536) + 0.5);
+}
+
+// The end points of a needle of length pixels, COUNT steps around the dial
+template <uint16_t COUNT>
+struct NeedleEnds {
+  DialPoint ends[COUNT];
+  constexpr NeedleEnds(uint16_t length): ends() {
+    for (uint32_t i = 0; i < COUNT; i++) {
+      ends[i].x = floatQ16(CLOCK_RADIUS + (length * constCos(i * (360 / COUNT))));
+      ends[i].y = floatQ16(CLOCK_RADIUS + (length * constSin(i * (360 / COUNT))));
+    }
+  }
+};
+
+// The centres of the numerals, from 3 o'clock on
+struct NumeralCenters {
+  DialPoint centers[12];
+  constexpr NumeralCenters(): centers() {
+    for (uint32_t h = 0; h < 12; h++) {
+      centers[h].x = (int32_t)(CLOCK_RADIUS + (NUMERAL_OFFSET * constCos(h * HOUR_ANGLE)) + 0.5);
+      centers[h].y = (int32_t)(CLOCK_RADIUS + (NUMERAL_OFFSET * constSin(h * HOUR_ANGLE)) + 0.5);
+    }
+  }
+};
+
+// the hour needle stops on every whole degree, the minute needle on 60
+static constexpr NeedleEnds<360> HOUR_ENDS PROGMEM = NeedleEnds<360>(HOUR_LENGTH);
+static constexpr NeedleEnds<60> MINUTE_ENDS PROGMEM = NeedleEnds<60>(MINUTE_LENGTH);
+static constexpr NumeralCenters NUMERALS PROGMEM = NumeralCenters();
+
+static DialPoint readPoint(const DialPoint *p) {
+  return { (int32_t)pgm_read_dword(&p->x), (int32_t)pgm_read_dword(&p->y) };
+}
+
+DialPoint needleEnd(uint16_t length, uint16_t degrees) {
+  if (length == HOUR_LENGTH) {
+    return readPoint(&HOUR_ENDS.ends[degrees % 360]);
+  }
+  return readPoint(&MINUTE_ENDS.ends[(degrees % 360) / MINUTE_ANGLE]);
+}
+
+DialPoint numeralCenter(uint8_t h) {
+  return readPoint(&NUMERALS.centers[h]);
+}
+
+void drawDial(const FlashFont &font, TFT_eSprite &face, int16_t top, TextCache *cache) {
+  //face.fillCircle(CLOCK_RADIUS, CLOCK_RADIUS, 3, CLOCK_COLOR_FACE);
+  for (uint32_t h = 0; h < 12; h++) {
+      const DialPoint center = numeralCenter(h);
+
+      uint32_t actualHour = (h + 3) % 12;
+      char numeral[4];
+      snprintf(numeral, sizeof(numeral), "%u", actualHour == 0 ? 12 : actualHour);
+      if (cache != nullptr) {
+        cache->draw(font, face, numeral, center.x, center.y - top, MC_DATUM, CLOCK_COLOR_FACE);
+      }
+      else {
+        font.draw(face, numeral, center.x, center.y - top, MC_DATUM, CLOCK_COLOR_FACE);
+      }
+  }
+}
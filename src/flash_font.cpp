@@ -0,0 +1,147 @@
+#include "flash_font.hpp"
+#include "blend.hpp"
+
+static constexpr uint32_t HEADER_BYTES = 24, RECORD_BYTES = 28;
+
+static uint32_t readWord(const uint8_t *p) {
+    return ((uint32_t)pgm_read_byte(p) << 24) | ((uint32_t)pgm_read_byte(p + 1) << 16)
+        | ((uint32_t)pgm_read_byte(p + 2) << 8) | pgm_read_byte(p + 3);
+}
+
+// the line metrics loadFont() works out
+FlashFont::FlashFont(const uint8_t *vlw): vlw(vlw) {
+    count = readWord(vlw);
+    yAdvance = readWord(vlw + 8);
+    spaceWidth = yAdvance / 4;
+    maxAscent = readWord(vlw + 16);
+    const uint8_t *record = vlw + HEADER_BYTES;
+    for (uint16_t i = 0; i < count; i++, record += RECORD_BYTES) {
+        const uint32_t code = readWord(record);
+        if (code == ' ') {
+            spaceWidth = readWord(record + 12);
+        }
+        if (code > 0x20 && code < 0x7F) {
+            maxAscent = max(maxAscent, (int16_t)readWord(record + 16));
+        }
+    }
+}
+
+bool FlashFont::find(uint8_t code, Glyph &glyph) const {
+    const uint8_t *record = vlw + HEADER_BYTES;
+    const uint8_t *bitmap = record + (count * RECORD_BYTES);
+    for (uint16_t i = 0; i < count; i++, record += RECORD_BYTES) {
+        const uint8_t height = readWord(record + 4), width = readWord(record + 8);
+        if (readWord(record) == code) {
+            glyph = { height, width, (uint8_t)readWord(record + 12),
+                (int16_t)readWord(record + 16), (int8_t)readWord(record + 20), bitmap };
+            return true;
+        }
+        bitmap += width * height;
+    }
+    return false;
+}
+
+template<typename Visit>
+void FlashFont::forEachGlyph(const char *text, Visit visit) const {
+    int32_t x = 0;
+    Glyph glyph;
+    for (const char *c = text; *c; c++) {
+        if (!find(*c, glyph)) {
+            x += spaceWidth;
+            continue;
+        }
+        visit(glyph, x + glyph.dX, maxAscent - glyph.dY);
+        x += glyph.xAdvance;
+    }
+}
+
+int16_t FlashFont::textWidth(const char *text) const {
+    int16_t width = 0;
+    Glyph glyph;
+    for (const char *c = text; *c; c++) {
+        width += find(*c, glyph) ? glyph.xAdvance : spaceWidth;
+    }
+    return width;
+}
+
+void FlashFont::place(int32_t &x, int32_t &y, uint8_t datum, int16_t width) const {
+    if (datum == TC_DATUM || datum == MC_DATUM) {
+        x -= width / 2;
+    }
+    if (datum == MC_DATUM) {
+        y -= height() / 2;
+    }
+}
+
+void FlashFont::bounds(const char *text, int16_t &x, int16_t &y, int16_t &w, int16_t &h) const {
+    int32_t x0 = INT16_MAX, y0 = INT16_MAX, x1 = INT16_MIN, y1 = INT16_MIN;
+    forEachGlyph(text, [&](const Glyph &glyph, int32_t left, int32_t top) {
+        if (glyph.width > 0 && glyph.height > 0) {
+            x0 = min(x0, left);
+            y0 = min(y0, top);
+            x1 = max(x1, left + glyph.width);
+            y1 = max(y1, top + glyph.height);
+        }
+    });
+    if (x0 >= x1) {
+        x = y = w = h = 0;
+        return;
+    }
+    x = x0;
+    y = y0;
+    w = x1 - x0;
+    h = y1 - y0;
+}
+
+void FlashFont::render(const char *text, uint8_t *alpha, int16_t x, int16_t y, int16_t w, int16_t h) const {
+    memset(alpha, 0, w * h);
+    forEachGlyph(text, [&](const Glyph &glyph, int32_t left, int32_t top) {
+        const uint8_t *bits = glyph.bitmap;
+        for (int32_t gy = 0; gy < glyph.height; gy++, bits += glyph.width) {
+            uint8_t *row = alpha + ((top + gy - y) * w) + (left - x);
+            for (int32_t gx = 0; gx < glyph.width; gx++) {
+                const uint8_t a = pgm_read_byte(bits + gx);
+                if (a != 0) {
+                    row[gx] = a;
+                }
+            }
+        }
+    });
+}
+
+void FlashFont::draw(TFT_eSprite &sprite, const char *text, int32_t x, int32_t y, uint8_t datum,
+        uint16_t color, uint16_t background) const {
+    place(x, y, datum, datum == TL_DATUM ? 0 : textWidth(text));
+    uint16_t *pixels = (uint16_t *)sprite.getPointer();
+    const int32_t w = sprite.width(), h = sprite.height();
+    const ColorBlend blend(color);
+    const bool over = color == background;
+    forEachGlyph(text, [&](const Glyph &glyph, int32_t left, int32_t top) {
+        left += x;
+        top += y;
+        const uint8_t *alpha = glyph.bitmap;
+        for (int32_t gy = 0; gy < glyph.height; gy++, alpha += glyph.width) {
+            const int32_t py = top + gy;
+            if (py < 0 || py >= h) {
+                continue;
+            }
+            uint16_t *row = pixels + (py * w);
+            for (int32_t gx = 0; gx < glyph.width; gx++) {
+                const int32_t px = left + gx;
+                const uint8_t a = pgm_read_byte(alpha + gx);
+                if (a == 0 || px < 0 || px >= w) {
+                    continue;
+                }
+                if (a == 0xFF) {
+                    row[px] = blend.swapped;
+                }
+                else if (over) {
+                    blend.blendSwapped(a, row + px);
+                }
+                else {
+                    row[px] = swap565(blend.blend(a, background));
+                }
+            }
+        }
+    });
+}
@@ -0,0 +1,75 @@
+#include "mask_cache.hpp"
+#include <new>
+
+MaskCache::MaskCache(uint32_t budget, uint8_t slots): slots(slots), budget(budget) {
+    entries = new Entry[slots]();
+}
+
+MaskCache::~MaskCache() {
+    for (uint8_t i = 0; i < slots; i++) {
+        evict(entries[i]);
+    }
+    delete[] entries;
+}
+
+void MaskCache::evict(Entry &entry) {
+    if (entry.data != nullptr) {
+        bytes -= entry.size;
+        delete[] entry.data;
+        entry = {};
+    }
+}
+
+const uint8_t *MaskCache::find(uint32_t key) {
+    for (uint8_t i = 0; i < slots; i++) {
+        if (entries[i].data != nullptr && entries[i].key == key) {
+            entries[i].lastUse = ++clock;
+            hits++;
+            return entries[i].data;
+        }
+    }
+    misses++;
+    return nullptr;
+}
+
+const uint8_t *MaskCache::insert(uint32_t key, const uint8_t *data, uint16_t size) {
+    uint8_t *mask = reserve(key, size);
+    if (mask != nullptr) {
+        memcpy(mask, data, size);
+    }
+    return mask;
+}
+
+uint8_t *MaskCache::reserve(uint32_t key, uint16_t size) {
+    if (size > budget || slots == 0) {
+        return nullptr;
+    }
+    Entry *target = nullptr;
+    while (target == nullptr) {
+        Entry *empty = nullptr, *oldest = nullptr;
+        for (uint8_t i = 0; i < slots; i++) {
+            if (entries[i].data == nullptr) {
+                empty = empty == nullptr ? &entries[i] : empty;
+            }
+            else if (oldest == nullptr || entries[i].lastUse < oldest->lastUse) {
+                oldest = &entries[i];
+            }
+        }
+        if (empty != nullptr && bytes + size <= budget) {
+            target = empty;
+        }
+        else {
+            evict(*oldest);
+        }
+    }
+    // nullptr when the heap is exhausted, the caller then draws directly
+    target->data = new (std::nothrow) uint8_t[size];
+    if (target->data == nullptr) {
+        return nullptr;
+    }
+    target->key = key;
+    target->size = size;
+    target->lastUse = ++clock;
+    bytes += size;
+    return target->data;
+}
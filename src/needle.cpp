@@ -0,0 +1,192 @@
+#include "needle.hpp"
+
+// Calculate distance of px,py to closest part of line ax,ay .... bx,by
+float lineDistance(float px, float py, float ax, float ay, float bx, float by) {
+  float pax = px - ax, pay = py - ay, bax = bx - ax, bay = by - ay;
+  float h = fmaxf(fminf((pax * bax + pay * bay) / (bax * bax + bay * bay), 1.0f), 0.0f);
+  float dx = pax - bax * h, dy = pay - bay * h;
+  return sqrtf(dx * dx + dy * dy);
+}
+
+static uint32_t isqrt(uint32_t v) {
+    uint32_t result = 0;
+    uint32_t bit = 1UL << 30;
+    while (bit > v) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (v >= result + bit) {
+            v -= result + bit;
+            result = (result >> 1) + bit;
+        }
+        else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return result;
+}
+
+static uint64_t isqrt64(uint64_t v) {
+    uint64_t result = 0;
+    uint64_t bit = 1ULL << 62;
+    while (bit > v) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (v >= result + bit) {
+            v -= result + bit;
+            result = (result >> 1) + bit;
+        }
+        else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return result;
+}
+
+static int32_t toQ16(float v) {
+    return lroundf(v * 65536);
+}
+
+WideLineAA::WideLineAA(float ax, float ay, float bx, float by, float r) {
+    setup(toQ16(ax), toQ16(ay), toQ16(bx), toQ16(by), toQ16(r));
+}
+
+WideLineAA WideLineAA::fromQ16(int32_t ax, int32_t ay, int32_t bx, int32_t by, int32_t r) {
+    WideLineAA line;
+    line.setup(ax, ay, bx, by, r);
+    return line;
+}
+
+void WideLineAA::setup(int32_t ax, int32_t ay, int32_t bx, int32_t by, int32_t r16) {
+    this->ax = ax;
+    this->ay = ay;
+    this->bx = bx;
+    this->by = by;
+    outer = r16 + (1 << 15);
+
+    const int32_t bax = this->bx - this->ax, bay = this->by - this->ay;
+    length = isqrt64(((int64_t)bax * bax) + ((int64_t)bay * bay));
+    if (length == 0) {
+        // a dot, any direction will do
+        ux = 1 << 16;
+        uy = 0;
+    }
+    else {
+        ux = ((int64_t)bax << 16) / length;
+        uy = ((int64_t)bay << 16) / length;
+    }
+    // less than 1/256 pixel of vertical travel counts as horizontal
+    slope = abs(bay) < 256 ? 0 : ((int64_t)bax << 16) / bay;
+
+    // floor/ceil of Q16 values
+    x0 = (min(this->ax, this->bx) - r16) >> 16;
+    y0 = (min(this->ay, this->by) - r16) >> 16;
+    x1 = -((-(max(this->ax, this->bx) + r16)) >> 16);
+    y1 = -((-(max(this->ay, this->by) + r16)) >> 16);
+}
+
+uint8_t WideLineAA::alpha(int32_t s, int32_t c) const {
+    int32_t distance = c < 0 ? -c : c;
+    if (distance >= outer) {
+        return 0;
+    }
+    if (s < 0 || s > length) {
+        // on one of the rounded ends
+        const int32_t along = s < 0 ? -s : s - length;
+        if (along >= outer) {
+            return 0;
+        }
+        // both are below 10.5 pixels, so the squares fit in Q12
+        const uint32_t a12 = along >> 4, c12 = distance >> 4;
+        distance = isqrt((a12 * a12) + (c12 * c12)) << 4;
+        if (distance >= outer) {
+            return 0;
+        }
+    }
+    const int32_t coverage = min<int32_t>(outer - distance, 1 << 16);
+    // coverage * ALPHA_GAIN * 255, truncated like the float version
+    constexpr uint32_t GAIN = (ALPHA_GAIN * 255 * 2) + 0.5f;
+    return min<uint32_t>((coverage * GAIN) >> 17, 255);
+}
+
+// a pixel in row y close to the centre line, inside the needle for every
+// row the line itself passes through
+int16_t WideLineAA::seed(int32_t y) const {
+    int32_t cx;
+    if (abs(by - ay) < 256) {
+        cx = (ax + bx) / 2;
+    }
+    else {
+        const int32_t cy = max(min(y << 16, max(ay, by)), min(ay, by));
+        cx = ax + (((int64_t)(cy - ay) * slope) >> 16);
+    }
+    return max<int32_t>(min<int32_t>((cx + (1 << 15)) >> 16, x1), x0);
+}
+
+uint16_t NeedleMask::record(const WideLineAA &line, uint8_t *out, uint16_t capacity) {
+    uint8_t row[128];
+    const int16_t width = line.x1 - line.x0 + 1;
+    if (width > (int16_t)sizeof(row) || line.y1 - line.y0 > 255 || capacity < HEADER) {
+        return 0;
+    }
+    const int16_t box[4] = { line.x0, line.y0, line.x1, line.y1 };
+    for (uint8_t i = 0; i < 4; i++) {
+        out[i * 2] = box[i] & 0xFF;
+        out[(i * 2) + 1] = (box[i] >> 8) & 0xFF;
+    }
+    uint8_t rows = 0;
+    uint16_t size = HEADER;
+    bool full = false;
+
+    // collect one row at a time: edge alphas and the solid run
+    int16_t rowY = INT16_MIN, left = 0, right = 0, start = -1, end = -1;
+    auto flush = [&]() {
+        if (rowY == INT16_MIN) {
+            return;
+        }
+        const uint8_t edge = start < 0 ? right - left + 1 : start - left;
+        const uint8_t run = start < 0 ? 0 : end - start + 1;
+        const uint8_t other = start < 0 ? 0 : right - end;
+        if (size + 5 + edge + other > capacity) {
+            full = true;
+            return;
+        }
+        uint8_t *p = out + size;
+        *p++ = rowY - line.y0;
+        *p++ = left - line.x0;
+        *p++ = edge;
+        *p++ = run;
+        *p++ = other;
+        memcpy(p, row + (left - line.x0), edge);
+        memcpy(p + edge, row + (end + 1 - line.x0), other);
+        size += 5 + edge + other;
+        rows++;
+    };
+    auto toRow = [&](int16_t y) {
+        if (y != rowY) {
+            flush();
+            rowY = y;
+            left = INT16_MAX;
+            right = INT16_MIN;
+            start = end = -1;
+        }
+    };
+    line.drawSpans([&](int16_t x, int16_t y, int16_t w) {
+        toRow(y);
+        start = x;
+        end = x + w - 1;
+        left = min(left, start);
+        right = max(right, end);
+    }, [&](int16_t x, int16_t y, uint8_t alpha) {
+        toRow(y);
+        row[x - line.x0] = alpha;
+        left = min(left, x);
+        right = max(right, x);
+    });
+    flush();
+    out[8] = rows;
+    return full ? 0 : size;
+}
@@ -0,0 +1,60 @@
+#include "packed_image.hpp"
+
+template<PackedImage::Encoding encoding>
+static inline uint16_t item(const uint8_t *p, const uint16_t *palette) {
+    if (encoding == PackedImage::Rle565) {
+        // stored high byte first, which is the byte order of sprite memory
+        return pgm_read_byte(p) | (pgm_read_byte(p + 1) << 8);
+    }
+    const uint16_t c = pgm_read_word(palette + pgm_read_byte(p));
+    return (c >> 8) | (c << 8);
+}
+
+template<PackedImage::Encoding encoding>
+static void decode(const uint8_t *p, const uint16_t *palette, int16_t x, int16_t w, uint16_t *to) {
+    constexpr uint8_t SIZE = encoding == PackedImage::Rle565 ? 2 : 1;
+    const int16_t end = x + w;
+    int16_t at = 0; // image column of the next item
+    while (at < end) {
+        const uint8_t control = pgm_read_byte(p++);
+        if (control < PackedImage::RUN) {
+            const int16_t count = control + 1;
+            if (at + count <= x) {
+                // all left of the part we want
+                p += count * SIZE;
+                at += count;
+                continue;
+            }
+            for (int16_t i = 0; i < count && at < end; i++, at++, p += SIZE) {
+                if (at >= x) {
+                    to[at - x] = item<encoding>(p, palette);
+                }
+            }
+            continue;
+        }
+        const int16_t count = control - (PackedImage::RUN - 2);
+        const int16_t from = max(at, x), stop = min((int16_t)(at + count), end);
+        if (from < stop) {
+            const uint16_t c = item<encoding>(p, palette);
+            for (int16_t i = from; i < stop; i++) {
+                to[i - x] = c;
+            }
+        }
+        p += SIZE;
+        at += count;
+    }
+}
+
+void PackedImage::decodeRow(int16_t y, int16_t x, int16_t w, uint16_t *to) const {
+    const uint8_t *row = data + pgm_read_word(rows + y);
+    if (encoding == Rle565) {
+        decode<Rle565>(row, palette, x, w, to);
+    }
+    else {
+        decode<PaletteRle>(row, palette, x, w, to);
+    }
+}
+
+uint32_t PackedImage::size() const {
+    return bytes + (height * sizeof(uint16_t)) + (colors * sizeof(uint16_t));
+}
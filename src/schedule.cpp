@@ -0,0 +1,226 @@
+#include "schedule.hpp"
+
+void WeekSchedule::clear(const DaySchedule &everyDay) {
+    schedules[0] = everyDay;
+    schedulesUsed = 1;
+    memset(weekdays, 0, sizeof(weekdays));
+    exceptionsUsed = 0;
+}
+
+int16_t WeekSchedule::intern(const DaySchedule &schedule) {
+    for (uint8_t i = 0; i < schedulesUsed; i++) {
+        if (schedules[i] == schedule) {
+            return i;
+        }
+    }
+    if (schedulesUsed == MAX_SCHEDULES) {
+        return -1;
+    }
+    schedules[schedulesUsed] = schedule;
+    return schedulesUsed++;
+}
+
+bool WeekSchedule::setWeekday(uint8_t weekday, const DaySchedule &schedule) {
+    if (weekday >= 7) {
+        return false;
+    }
+    const int16_t i = intern(schedule);
+    if (i < 0) {
+        return false;
+    }
+    weekdays[weekday] = i;
+    return true;
+}
+
+// the first exception on or after `day`
+const WeekSchedule::Exception *WeekSchedule::find(uint16_t day) const {
+    uint8_t low = 0, high = exceptionsUsed;
+    while (low < high) {
+        const uint8_t middle = (low + high) / 2;
+        if (exceptions[middle].day < day) {
+            low = middle + 1;
+        }
+        else {
+            high = middle;
+        }
+    }
+    return exceptions + low;
+}
+
+bool WeekSchedule::setException(uint16_t day, const DaySchedule &schedule) {
+    Exception *at = (Exception *)find(day);
+    const bool replaces = at < exceptions + exceptionsUsed && at->day == day;
+    if (!replaces && exceptionsUsed == MAX_EXCEPTIONS) {
+        return false;
+    }
+    const int16_t i = intern(schedule);
+    if (i < 0) {
+        return false;
+    }
+    if (!replaces) {
+        memmove(at + 1, at, (exceptions + exceptionsUsed - at) * sizeof(Exception));
+        exceptionsUsed++;
+    }
+    *at = { day, (uint8_t)i };
+    return true;
+}
+
+const DaySchedule &WeekSchedule::forDay(uint16_t day) const {
+    const Exception *at = find(day);
+    if (at < exceptions + exceptionsUsed && at->day == day) {
+        return schedules[at->schedule];
+    }
+    // 1970-01-01 was a Thursday
+    return schedules[weekdays[(day + 4) % 7]];
+}
+
+static void put16(uint8_t *&out, uint16_t v) {
+    *out++ = v & 0xFF;
+    *out++ = (v >> 8) & 0xFF;
+}
+
+static uint16_t get16(const uint8_t *&in) {
+    const uint16_t v = in[0] | (in[1] << 8);
+    in += 2;
+    return v;
+}
+
+static void putSchedule(uint8_t *&out, const DaySchedule &s) {
+    put16(out, s.sleepTime);
+    put16(out, s.awakeTime);
+    put16(out, s.awakeTransition);
+}
+
+static DaySchedule getSchedule(const uint8_t *&in) {
+    DaySchedule s;
+    s.sleepTime = get16(in);
+    s.awakeTime = get16(in);
+    s.awakeTransition = get16(in);
+    return s;
+}
+
+size_t WeekSchedule::write(uint8_t *out) const {
+    uint8_t *p = out;
+    putSchedule(p, schedules[0]);
+    *p++ = VERSION;
+    *p++ = schedulesUsed;
+    for (uint8_t i = 1; i < schedulesUsed; i++) {
+        putSchedule(p, schedules[i]);
+    }
+    memcpy(p, weekdays, 7);
+    p += 7;
+    *p++ = exceptionsUsed;
+    for (uint8_t i = 0; i < exceptionsUsed; i++) {
+        put16(p, exceptions[i].day);
+        *p++ = exceptions[i].schedule;
+    }
+    return p - out;
+}
+
+// Anything past the first schedule that does not add up is dropped, the
+// clock then runs on that schedule every day.
+bool WeekSchedule::read(const uint8_t *data, size_t size) {
+    if (size < 6) {
+        return false;
+    }
+    const uint8_t *p = data, *end = data + size;
+    clear(getSchedule(p));
+    if (end - p < 2 || p[0] != VERSION || p[1] == 0 || p[1] > MAX_SCHEDULES) {
+        return true;
+    }
+    const uint8_t used = p[1];
+    p += 2;
+    if (end - p < ((used - 1) * 6) + 7 + 1) {
+        return true;
+    }
+    for (uint8_t i = 1; i < used; i++) {
+        schedules[i] = getSchedule(p);
+    }
+    for (uint8_t i = 0; i < 7; i++) {
+        if (p[i] >= used) {
+            return true;
+        }
+    }
+    schedulesUsed = used;
+    memcpy(weekdays, p, 7);
+    p += 7;
+    const uint8_t count = min<uint8_t>(*p++, MAX_EXCEPTIONS);
+    for (uint8_t i = 0; i < count && end - p >= 3; i++) {
+        const uint16_t day = get16(p);
+        const uint8_t schedule = *p++;
+        if (schedule < used) {
+            setException(day, schedules[schedule]);
+        }
+    }
+    return true;
+}
+
+// after Howard Hinnant's days_from_civil, with March as the first month
+int32_t WeekSchedule::dayNumber(int32_t year, uint32_t month, uint32_t day) {
+    year -= month <= 2;
+    const int32_t era = (year >= 0 ? year : year - 399) / 400;
+    const uint32_t yearOfEra = year - (era * 400);
+    const uint32_t dayOfYear = (((153 * (month > 2 ? month - 3 : month + 9)) + 2) / 5) + day - 1;
+    const uint32_t dayOfEra = (yearOfEra * 365) + (yearOfEra / 4) - (yearOfEra / 100) + dayOfYear;
+    return (era * 146097) + (int32_t)dayOfEra - 719468;
+}
+
+void WeekSchedule::date(uint16_t day, int32_t &year, uint32_t &month, uint32_t &dayOfMonth) {
+    const uint32_t shifted = day + 719468;
+    const uint32_t era = shifted / 146097;
+    const uint32_t dayOfEra = shifted - (era * 146097);
+    const uint32_t yearOfEra = (dayOfEra - (dayOfEra / 1460) + (dayOfEra / 36524) - (dayOfEra / 146096)) / 365;
+    const uint32_t dayOfYear = dayOfEra - ((365 * yearOfEra) + (yearOfEra / 4) - (yearOfEra / 100));
+    const uint32_t monthFromMarch = ((5 * dayOfYear) + 2) / 153;
+    dayOfMonth = dayOfYear - (((153 * monthFromMarch) + 2) / 5) + 1;
+    month = monthFromMarch < 10 ? monthFromMarch + 3 : monthFromMarch - 9;
+    year = yearOfEra + (era * 400) + (month <= 2);
+}
+
+bool WeekSchedule::parseExceptions(const String &text, uint16_t today) {
+    int from = 0;
+    while (from < (int)text.length()) {
+        int end = text.indexOf('\n', from);
+        if (end < 0) {
+            end = text.length();
+        }
+        const String line = text.substring(from, end);
+        from = end + 1;
+        int year, month, day, sleepHour, sleepMinute, transition, awakeHour, awakeMinute;
+        if (sscanf(line.c_str(), "%d-%d-%d %d:%d %d %d:%d", &year, &month, &day,
+                &sleepHour, &sleepMinute, &transition, &awakeHour, &awakeMinute) != 8
+            || month < 1 || month > 12 || day < 1 || day > 31
+            || sleepHour < 0 || sleepHour > 23 || sleepMinute < 0 || sleepMinute > 59
+            || awakeHour < 0 || awakeHour > 23 || awakeMinute < 0 || awakeMinute > 59
+            || transition < 0 || transition > 24 * 60) {
+            continue;
+        }
+        const int32_t number = dayNumber(year, month, day);
+        if (number < today || number > UINT16_MAX) {
+            continue;
+        }
+        // the 31st of a shorter month ends up in the next one
+        int32_t checkYear;
+        uint32_t checkMonth, checkDay;
+        date(number, checkYear, checkMonth, checkDay);
+        if (checkMonth != (uint32_t)month || checkDay != (uint32_t)day) {
+            continue;
+        }
+        const DaySchedule s = {
+            (uint16_t)((sleepHour * 60) + sleepMinute), (uint16_t)((awakeHour * 60) + awakeMinute), (uint16_t)transition
+        };
+        if (!setException(number, s)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t WeekSchedule::formatException(uint8_t i, char *out, size_t size) const {
+    int32_t year;
+    uint32_t month, day;
+    date(exceptions[i].day, year, month, day);
+    const DaySchedule &s = schedules[exceptions[i].schedule];
+    return snprintf(out, size, "%04d-%02u-%02u %02u:%02u %u %02u:%02u", (int)year, (unsigned)month, (unsigned)day,
+        s.sleepTime / 60, s.sleepTime % 60, s.awakeTransition, s.awakeTime / 60, s.awakeTime % 60);
+}
@@ -0,0 +1,88 @@
+#include "scheduler.hpp"
+#ifdef ARDUINO_ARCH_ESP8266
+#include <coredecls.h>
+#endif
+
+uint8_t Scheduler::add(const char *name, Task task) {
+    if (count == MAX_TASKS) {
+        return count;
+    }
+    Entry &entry = tasks[count];
+    entry.task = task;
+    entry.deadline = micros();
+    entry.waiting = false;
+    entry.stats = { name, 0, 0, 0 };
+    return count++;
+}
+
+void Scheduler::wake(uint8_t task) {
+    if (task >= count) {
+        return;
+    }
+    if (tasks[task].waiting) {
+        tasks[task].deadline = micros();
+        tasks[task].waiting = false;
+    }
+    woken = true;
+#ifdef ARDUINO_ARCH_ESP8266
+    esp_schedule(); // ends the esp_delay() in sleep()
+#endif
+}
+
+void Scheduler::resetStats() {
+    for (uint8_t i = 0; i < count; i++) {
+        tasks[i].stats = { tasks[i].stats.name, 0, 0, 0 };
+    }
+    busyMicros = idleMicros = 0;
+}
+
+// The tasks run in the order they were added, so a task woken by an
+// earlier one runs in the same pass. Deadlines are compared as the
+// difference to now, which survives micros() wrapping every 71 minutes.
+void Scheduler::run() {
+    const uint32_t start = ESP.getCycleCount();
+    woken = false;
+    for (uint8_t i = 0; i < count; i++) {
+        Entry &entry = tasks[i];
+        const int32_t late = micros() - entry.deadline;
+        if (entry.waiting || late < 0) {
+            continue;
+        }
+        entry.stats.runs++;
+        entry.stats.late += late;
+        entry.stats.maxLate = max(entry.stats.maxLate, (uint32_t)late);
+        const uint32_t next = entry.task();
+        entry.waiting = next == NEVER;
+        entry.deadline = micros() + (entry.waiting ? 0 : next);
+    }
+    busyMicros += (ESP.getCycleCount() - start) / ESP.getCpuFreqMHz();
+
+    uint32_t until = MAX_SLEEP;
+    for (uint8_t i = 0; i < count; i++) {
+        if (!tasks[i].waiting) {
+            const int32_t left = tasks[i].deadline - micros();
+            until = min(until, (uint32_t)max<int32_t>(left, 0));
+        }
+    }
+    if (until > 0 && !woken) {
+        sleep(until);
+    }
+}
+
+// Whole milliseconds are slept with the SDK running (WiFi, TCP), the rest
+// is waited out, so a tick lands on its microsecond.
+void Scheduler::sleep(uint32_t us) {
+    const uint32_t start = micros();
+#ifdef ARDUINO_ARCH_ESP8266
+    esp_delay(us / 1000, [this]() { return !woken; });
+#else
+    // the emulator's timers fire inside delay()
+    for (uint32_t ms = us / 1000; ms > 0 && !woken; ms--) {
+        delay(1);
+    }
+#endif
+    if (!woken) {
+        delayMicroseconds(us % 1000);
+    }
+    idleMicros += micros() - start;
+}
@@ -0,0 +1,104 @@
+#include "spi_pipe.hpp"
+
+static constexpr uint8_t FIFO_PIXELS = 32; // 16 words of 32 bits
+
+#ifdef ESP8266
+bool SpiPipe::busy() const {
+    return SPI1CMD & SPIBUSY;
+}
+
+// start sending count pixels through the FIFO, like TFT_eSPI's
+// pushPixels() does, but without waiting for it to finish
+void SpiPipe::send(const uint16_t *data, uint8_t count) {
+    volatile uint32_t *fifo = &SPI1W0;
+    for (uint8_t i = 0; i < count; i += 2) {
+        // the FIFO sends the low byte of a word first
+        const uint32_t next = i + 1 < count ? data[i + 1] : 0;
+        fifo[i / 2] = data[i] | (next << 16);
+    }
+    const uint32_t bits = (count * 16) - 1;
+    const uint32_t mask = ~((SPIMMOSI << SPILMOSI) | (SPIMMISO << SPILMISO));
+    SPI1U1 = (SPI1U1 & mask) | (bits << SPILMOSI) | (bits << SPILMISO);
+    SPI1CMD |= SPIBUSY;
+}
+#else
+// the emulator models how long the bus stays busy
+bool SpiPipe::busy() const {
+    return lcd.fifoBusy();
+}
+
+void SpiPipe::send(const uint16_t *data, uint8_t count) {
+    lcd.pushFifo(data, count);
+}
+#endif
+
+void SpiPipe::window(const Rect &area) {
+    if (queued == COMMANDS) {
+        wait();
+    }
+    commands[queued++] = { area, 0 };
+}
+
+void SpiPipe::rows(const uint16_t *data, int16_t stride, int16_t w, int16_t h) {
+    if (stored + (w * h) > CAPACITY) {
+        // the window already went out, the rows continue in it
+        wait();
+    }
+    if (queued == 0) {
+        commands[queued++] = { Rect(), 0 };
+    }
+    for (int16_t y = 0; y < h; y++) {
+        memcpy(pixels + stored, data + (y * stride), w * sizeof(uint16_t));
+        stored += w;
+    }
+    commands[queued - 1].count += w * h;
+}
+
+void SpiPipe::pump() {
+    stallCycles += feed();
+}
+
+void SpiPipe::wait() {
+    const uint32_t start = ESP.getCycleCount();
+    while (busy() || sent < stored || current + 1 < queued || (queued > 0 && !started)) {
+        feed();
+    }
+    stallCycles += ESP.getCycleCount() - start;
+    queued = current = 0;
+    stored = sent = done = 0;
+    started = false;
+}
+
+// hand the FIFO its next chunk if it is free, returns the cycles spent
+// blocked on setting an lcd window
+uint32_t SpiPipe::feed() {
+    uint32_t blocked = 0;
+    while (current < queued && !busy()) {
+        const Command &command = commands[current];
+        if (!started) {
+            if (!command.window.empty()) {
+                const uint32_t start = ESP.getCycleCount();
+                const Rect &w = command.window;
+                lcd.setAddrWindow(w.x, w.y, w.w, w.h);
+                blocked += ESP.getCycleCount() - start;
+                sentBytes += WINDOW_BYTES;
+            }
+            started = true;
+        }
+        if (done == command.count) {
+            if (current + 1 == queued) {
+                break; // more rows might follow in this window
+            }
+            current++;
+            started = false;
+            done = 0;
+            continue;
+        }
+        const uint8_t count = min((uint16_t)(command.count - done), (uint16_t)FIFO_PIXELS);
+        send(pixels + sent, count);
+        sent += count;
+        done += count;
+        sentBytes += count * sizeof(uint16_t);
+    }
+    return blocked;
+}
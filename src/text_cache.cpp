@@ -0,0 +1,83 @@
+#include "text_cache.hpp"
+#include "blend.hpp"
+
+// in front of every mask, followed by the text and then its coverage
+struct TextMask {
+    const FlashFont *font; // with the text, to tell runs whose keys collide apart
+    uint16_t length;       // of the text
+    int16_t width;         // textWidth(), to place it by datum
+    int16_t x, y, w, h;    // box of the coverage, from the top left of the text
+};
+
+// FNV-1a over the font and the text
+static uint32_t textKey(const FlashFont &font, const char *text) {
+    uint32_t hash = 2166136261u;
+    const uintptr_t id = (uintptr_t)&font;
+    for (uint8_t i = 0; i < sizeof(id); i++) {
+        hash = (hash ^ ((id >> (i * 8)) & 0xFF)) * 16777619u;
+    }
+    for (const char *c = text; *c; c++) {
+        hash = (hash ^ (uint8_t)*c) * 16777619u;
+    }
+    return hash;
+}
+
+void TextCache::draw(const FlashFont &font, TFT_eSprite &sprite, const char *text, int32_t x, int32_t y,
+        uint8_t datum, uint16_t color, uint16_t background) {
+    const uint32_t key = textKey(font, text);
+    const size_t length = strlen(text);
+    const uint8_t *mask = masks.find(key);
+    TextMask box;
+    if (mask != nullptr) {
+        memcpy(&box, mask, sizeof(TextMask));
+        if (box.font != &font || box.length != length || memcmp(mask + sizeof(TextMask), text, length) != 0) {
+            font.draw(sprite, text, x, y, datum, color, background);
+            return;
+        }
+    }
+    else {
+        box.font = &font;
+        box.length = length;
+        box.width = font.textWidth(text);
+        font.bounds(text, box.x, box.y, box.w, box.h);
+        const uint32_t size = sizeof(TextMask) + length + (box.w * box.h);
+        uint8_t *fresh = size > UINT16_MAX ? nullptr : masks.reserve(key, size);
+        if (fresh == nullptr) {
+            font.draw(sprite, text, x, y, datum, color, background);
+            return;
+        }
+        memcpy(fresh, &box, sizeof(TextMask));
+        memcpy(fresh + sizeof(TextMask), text, length);
+        font.render(text, fresh + sizeof(TextMask) + length, box.x, box.y, box.w, box.h);
+        mask = fresh;
+    }
+    const uint8_t *alpha = mask + sizeof(TextMask) + box.length;
+    font.place(x, y, datum, box.width);
+    x += box.x;
+    y += box.y;
+
+    uint16_t *pixels = (uint16_t *)sprite.getPointer();
+    const int32_t w = sprite.width(), h = sprite.height();
+    const int32_t x0 = max(x, (int32_t)0), x1 = min(x + box.w, w);
+    const int32_t y0 = max(y, (int32_t)0), y1 = min(y + box.h, h);
+    const ColorBlend blend(color);
+    const bool over = color == background;
+    for (int32_t py = y0; py < y1; py++) {
+        const uint8_t *a = alpha + ((py - y) * box.w) - x;
+        uint16_t *row = pixels + (py * w);
+        for (int32_t px = x0; px < x1; px++) {
+            if (a[px] == 0) {
+                continue;
+            }
+            if (a[px] == 0xFF) {
+                row[px] = blend.swapped;
+            }
+            else if (over) {
+                blend.blendSwapped(a[px], row + px);
+            }
+            else {
+                row[px] = swap565(blend.blend(a[px], background));
+            }
+        }
+    }
+}
@@ -0,0 +1,40 @@
+#include "tile_hash.hpp"
+
+static inline bool getBit(const uint8_t *bits, uint16_t i) {
+    return bits[i >> 3] & (1 << (i & 7));
+}
+
+static inline void setBit(uint8_t *bits, uint16_t i, bool value) {
+    if (value) {
+        bits[i >> 3] |= 1 << (i & 7);
+    }
+    else {
+        bits[i >> 3] &= ~(1 << (i & 7));
+    }
+}
+
+void TileHashes::begin() {
+    memset(checked, 0, sizeof(checked));
+}
+
+bool TileHashes::changed(uint8_t column, uint8_t row, const uint16_t *pixels, int16_t stride) {
+    const uint16_t i = (row * COLUMNS) + column;
+    if (getBit(checked, i)) {
+        // an earlier area of this flush shared the tile
+        return getBit(pushed, i);
+    }
+    // FNV-1a over the pixels
+    uint32_t hash = 2166136261u;
+    for (int16_t y = 0; y < SIZE; y++) {
+        const uint16_t *p = pixels + (y * stride);
+        for (int16_t x = 0; x < SIZE; x++) {
+            hash = (hash ^ p[x]) * 16777619u;
+        }
+    }
+    const bool different = !getBit(known, i) || hashes[i] != hash;
+    hashes[i] = hash;
+    setBit(known, i, true);
+    setBit(checked, i, true);
+    setBit(pushed, i, different);
+    return different;
+}
@@ -1,17 +1,119 @@
 #include "time.hpp"
 #include <ezTime.h>
 
+constexpr uint32_t TickOffsets::LIMITS[];
+
+void TickOffsets::add(uint32_t offset) {
+    uint8_t bucket = 0;
+    while (bucket < BUCKETS - 1 && offset >= LIMITS[bucket]) {
+        bucket++;
+    }
+    counts[bucket]++;
+    maxOffset = max(maxOffset, offset);
+}
+
+void TickOffsets::print(Print &out) const {
+    uint32_t ticks = 0;
+    for (uint8_t i = 0; i < BUCKETS; i++) {
+        ticks += counts[i];
+    }
+    out.printf("tick offsets: %u ticks, %u early, %u us at most, %u syncs moved the second by %d us at most\n",
+        ticks, early, maxOffset, syncs, maxCorrection);
+    for (uint8_t i = 0; i < BUCKETS; i++) {
+        if (i < BUCKETS - 1) {
+            out.printf("  < %6u us: %u\n", LIMITS[i], counts[i]);
+        }
+        else {
+            out.printf("  >=%6u us: %u\n", LIMITS[i - 1], counts[i]);
+        }
+    }
+}
+
+// Takes the second boundary from ezTime's sub second phase, right after
+// an NTP sync. ms() is truncated, so the boundary is at most a millisecond
+// past the true one and a tick never lands before ezTime's second changes.
+void Time::align() {
+    const uint32_t started = micros() - (ms() * 1000);
+    if (aligned) {
+        int32_t moved = (int32_t)(started - boundary) % 1000000;
+        if (moved >= 500000) {
+            moved -= 1000000;
+        }
+        else if (moved < -500000) {
+            moved += 1000000;
+        }
+        offsets.syncs++;
+        if (abs(moved) > abs(offsets.maxCorrection)) {
+            offsets.maxCorrection = moved;
+        }
+        boundary += moved; // the tick due, on the corrected second
+    }
+    else {
+        boundary = started;
+    }
+    lastSync = lastNtpUpdateTime();
+    aligned = true;
+}
+
+// The timer only counts whole milliseconds, so it is rounded up. Every
+// second is armed from the boundary itself, the timer's own lateness does
+// not add up.
+void Time::arm() {
+    int32_t left = boundary - micros();
+    while (left <= 0) {
+        boundary += 1000000;
+        left += 1000000;
+    }
+    if (onTick != nullptr) {
+        ticker.once_ms((left + 999) / 1000, onTick);
+    }
+}
+
 bool Time::process() {
     events();
-    if (timeStatus() == timeSet && secondChanged()) {
-        if (now == nullptr) {
-            now = new Timezone();
-            now->setLocation(this->zone);
-            Serial.println(now->dateTime());
+    if (timeStatus() != timeSet) {
+        return false;
+    }
+    const bool first = !aligned;
+    if (first || lastNtpUpdateTime() != lastSync) {
+        align();
+    }
+    const int32_t since = micros() - boundary;
+    if (since < 0 || !secondChanged()) {
+        // early, or this second was already handled before a sync moved it
+        offsets.early++;
+        if (since >= 0 && since < 1000 && onTick != nullptr) {
+            ticker.once_ms(1, onTick); // ezTime only counts whole milliseconds
         }
-        return true;
+        else {
+            arm();
+        }
+        return false;
+    }
+    if (!first) {
+        offsets.add(since);
+    }
+    if (now == nullptr) {
+        now = new Timezone();
+        now->setLocation(this->zone);
+        Serial.println(now->dateTime());
     }
-    return false;
+    arm();
+    return true;
+}
+
+void Time::tickIn(uint8_t seconds) {
+    if (!aligned || seconds == 0) {
+        return;
+    }
+    // back to the next boundary, it may have been moved on already
+    int32_t left = boundary - micros();
+    while (left > 1000000) {
+        boundary -= 1000000;
+        left -= 1000000;
+    }
+    boundary += (seconds - 1) * 1000000;
+    arm();
 }
 
 bool Time::didMinuteChanged() {
@@ -36,4 +138,11 @@ uint8_t Time::second() {
         return 0;
     }
     return now->second();
+}
+
+uint16_t Time::day() {
+    if (now == nullptr) {
+        return 0;
+    }
+    return now->now() / 86400;
 }
\ No newline at end of file
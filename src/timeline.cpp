@@ -0,0 +1,91 @@
+#include "timeline.hpp"
+#include <algorithm>
+
+// The schedule as updateState() used to follow it every second, as the
+// segment starting at `second`. Its conditions only flip on the edges
+// build() collects.
+static Timeline::Segment evaluate(int32_t second, uint16_t sleepTime, uint16_t awakeTime, uint16_t awakeTransition) {
+    const int32_t time = second / 60;
+    const int32_t awake = (int32_t)awakeTime * 60;
+    const int32_t transition = (int32_t)awakeTransition * 60;
+    if (time > sleepTime) {
+        return { second, second, 0, Sleeping, 80, 80, 0, 0 };
+    }
+    if (time < awakeTime) {
+        const int32_t toWait = awake - second;
+        if (toWait < transition) {
+            return { second, awake, (uint32_t)transition, WakingUp, 160, 160, 0, PROGRESS_FULL };
+        }
+        if (toWait < (2 * transition)) {
+            // we start with decreasing sleep counter
+            // the same time as we do the awake counter
+            return { second, awake - transition, (uint32_t)transition, Sleeping, 120, 120, 0, PROGRESS_FULL };
+        }
+        return { second, second, 0, Sleeping, 80, 80, 0, 0 };
+    }
+    // we must be awake!
+    const uint8_t brightness = time - awakeTime < 30 || sleepTime - time < 10 ? 200 : 80;
+    return { second, second, 0, Awake, brightness, brightness, PROGRESS_FULL, PROGRESS_FULL };
+}
+
+void Timeline::build(uint16_t sleepTime, uint16_t awakeTime, uint16_t awakeTransition) {
+    const int32_t awake = (int32_t)awakeTime * 60;
+    const int32_t transition = (int32_t)awakeTransition * 60;
+    int32_t edges[] = {
+        0,
+        awake - (2 * transition) + 1,  // sleep count down
+        awake - transition + 1,        // waking up count down
+        awake,
+        awake + (30 * 60),             // end of the bright morning
+        ((int32_t)sleepTime - 9) * 60, // start of the bright evening
+        ((int32_t)sleepTime + 1) * 60, // asleep
+    };
+    constexpr uint8_t EDGES = sizeof(edges) / sizeof(edges[0]);
+    for (int32_t &edge : edges) {
+        edge = min(max(edge, (int32_t)0), (int32_t)DAY - 1);
+    }
+    std::sort(edges, edges + EDGES);
+
+    count = 0;
+    current = 0;
+    for (uint8_t i = 0; i < EDGES; i++) {
+        if (i > 0 && edges[i] == edges[i - 1]) {
+            continue;
+        }
+        const Segment s = evaluate(edges[i], sleepTime, awakeTime, awakeTransition);
+        if (count > 0) {
+            // fixed values the previous segment already has
+            const Segment &last = segments[count - 1];
+            if (s.length == 0 && last.length == 0 && s.state == last.state
+                && s.brightnessStart == last.brightnessStart && s.progressStart == last.progressStart) {
+                continue;
+            }
+        }
+        segments[count++] = s;
+    }
+}
+
+Timeline::Point Timeline::at(uint32_t second) {
+    if (count == 0) {
+        return { Awake, 200, PROGRESS_FULL, DAY };
+    }
+    if (current >= count || (int32_t)second < segments[current].start) {
+        current = 0; // a new day
+    }
+    while (current + 1 < count && segments[current + 1].start <= (int32_t)second) {
+        current++;
+    }
+    const Segment &s = segments[current];
+    const uint32_t next = current + 1 < count ? segments[current + 1].start : DAY;
+    if (s.length == 0) {
+        return { s.state, s.brightnessStart, s.progressStart, next - second };
+    }
+    // counted back from the end, as the count downs always were
+    const uint32_t left = s.end - (int32_t)second;
+    return {
+        s.state,
+        (uint8_t)(s.brightnessEnd - (((int32_t)s.brightnessEnd - s.brightnessStart) * (int32_t)left / (int32_t)s.length)),
+        s.progressEnd - (uint32_t)(((uint64_t)(s.progressEnd - s.progressStart) * left) / s.length),
+        1
+    };
+}
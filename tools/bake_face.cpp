@@ -0,0 +1,77 @@
+// Host tool run by bake_face.py before every build: draws the hour numerals
+// on CAT_WATCH_FACE with the same code and font the clock would use at
+// runtime, and writes the result as CAT_WATCH_FACE_DIAL. The result is
+// also quantised to 256 and 16 colours for the indexed (CLOCK_FACE_BPP)
+// versions of the face, and run length encoded for the clock to draw (see
+// tools/image_encode.hpp for the encodings).
+//
+// Built against the TFT_eSPI stand-in in native/.
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "face.hpp"
+#include "cat-watch-face.h"
+#include "NotoSansBold15.h"
+#include "image_encode.hpp"
+
+static constexpr int32_t SIZE = CLOCK_RADIUS * 2;
+
+// the encodings of the dial that go into one header
+static bool writeHeader(const char *path, const Image &dial, const char *guard,
+        std::initializer_list<std::pair<const char *, Encoding>> arrays) {
+    std::string body;
+    uint32_t bytes = 0;
+    bool packed = false;
+    for (const auto &array : arrays) {
+        const Encoded encoded = encode(dial, array.first, array.second);
+        if (!encoded.failure.empty()) {
+            fprintf(stderr, "%s: %s\n", array.first, encoded.failure.c_str());
+            return false;
+        }
+        if (encoded.error > 0) {
+            printf("%s %s: %.2f steps of 565 off per pixel\n", array.first, encodingName(array.second), encoded.error);
+        }
+        body += (body.empty() ? "" : "\n") + encoded.code;
+        bytes += encoded.bytes;
+        packed |= isPacked(array.second);
+    }
+    bool changed;
+    return writeIfChanged(path, headerStart("tools/bake_face.py", "cat-watch-face.h + NotoSansBold15.h numerals",
+        guard, bytes, packed) + body + "\n" + headerEnd(), changed);
+}
+
+int main(int argc, char **argv) {
+    if (argc != 4) {
+        fprintf(stderr, "usage: %s cat-watch-face-dial.h cat-watch-face-dial-indexed.h cat-watch-face-dial-packed.h\n", argv[0]);
+        return 1;
+    }
+    TFT_eSPI lcd;
+    TFT_eSprite face(&lcd);
+    face.createSprite(SIZE, SIZE);
+    face.setSwapBytes(true);
+    face.pushImage(0, 0, SIZE, SIZE, CAT_WATCH_FACE);
+    face.setSwapBytes(false);
+    drawDial(FlashFont(NotoSansBold15), face);
+
+    Image dial;
+    dial.width = dial.height = SIZE;
+    for (int32_t y = 0; y < SIZE; y++) {
+        for (int32_t x = 0; x < SIZE; x++) {
+            dial.pixels.push_back(face.readPixel(x, y));
+        }
+    }
+    if (!writeHeader(argv[1], dial, "__CAT_WATCH_FACE_DIAL_H", { { "CAT_WATCH_FACE_DIAL", Encoding::Raw565 } })) {
+        fprintf(stderr, "could not write %s\n", argv[1]);
+        return 1;
+    }
+    if (!writeHeader(argv[2], dial, "__CAT_WATCH_FACE_DIAL_INDEXED_H", {
+            { "CAT_WATCH_FACE_DIAL", Encoding::Palette8 }, { "CAT_WATCH_FACE_DIAL", Encoding::Palette4 } })) {
+        fprintf(stderr, "could not write %s\n", argv[2]);
+        return 1;
+    }
+    if (!writeHeader(argv[3], dial, "__CAT_WATCH_FACE_DIAL_PACKED_H", {
+            { "CAT_WATCH_FACE_DIAL", Encoding::Rle565 }, { "CAT_WATCH_FACE_DIAL8", Encoding::RlePalette8 } })) {
+        fprintf(stderr, "could not write %s\n", argv[3]);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,48 @@
+# PlatformIO pre-build step, after subset_fonts.py and convert_images.py:
+# bakes the dial numerals into the watch face (include/cat-watch-face-dial.h,
+# its 8 and 4 bit indexed versions in include/cat-watch-face-dial-indexed.h
+# and the run length encoded ones in include/cat-watch-face-dial-packed.h)
+# whenever the face, font or dial code changed.
+Import("env")
+import os
+import sys
+
+sys.path.insert(0, os.path.join(env.subst("$PROJECT_DIR"), "tools"))
+from prebuild_common import Step
+
+step = Step(env, "bake_face")
+path = step.path
+
+sources = [
+    path("tools", "bake_face.cpp"),
+    path("tools", "image_encode.cpp"),
+    path("src", "face.cpp"),
+    path("src", "flash_font.cpp"),
+    path("src", "text_cache.cpp"),
+    path("src", "mask_cache.cpp"),
+    path("src", "packed_image.cpp"),
+    path("native", "TFT_eSPI.cpp"),
+    path("native", "emulator.cpp"),
+]
+inputs = sources + [
+    path("tools", "prebuild_common.py"),
+    path("tools", "image_encode.hpp"),
+    path("include", "face.hpp"),
+    path("include", "flash_font.hpp"),
+    path("include", "text_cache.hpp"),
+    path("include", "mask_cache.hpp"),
+    path("include", "blend.hpp"),
+    path("include", "packed_image.hpp"),
+    path("include", "cat-watch-face.h"),
+    path("include", "NotoSansBold15.h"),
+    path("native", "TFT_eSPI.h"),
+]
+outputs = [
+    path("include", "cat-watch-face-dial.h"),
+    path("include", "cat-watch-face-dial-indexed.h"),
+    path("include", "cat-watch-face-dial-packed.h"),
+]
+
+if step.stale(inputs, outputs):
+    print("Baking dial numerals into %s" % step.relative(outputs))
+    step.run(sources, outputs)
@@ -0,0 +1,83 @@
+// Host tool run by bake_status.py before every build: composes the status
+// panel (see include/status_panel.hpp) of each state from its label, the
+// paws and the animal, drawn in that order as the clock drew them, and
+// writes them run length encoded as STATUS_<STATE>_PACKED.
+//
+// Built against the TFT_eSPI stand-in in native/.
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "status_panel.hpp"
+#include "flash_font.hpp"
+#include "texts.hpp"
+#include "NotoSansBold15.h"
+#include "NotoFox64-flatten.h"
+#include "NotoFrog64-flatten.h"
+#include "NotoGiraffe64-flatten.h"
+#include "cat-paw.h"
+#include "image_encode.hpp"
+
+struct Panel {
+    const char *name;
+    const char *label;
+    uint16_t color;
+    bool paws;
+    const uint16_t *animal;
+};
+
+static const Panel PANELS[] = {
+    { "STATUS_SLEEPING", SLEEPING_TEXT, TFT_RED, true, NotoFox64 },
+    { "STATUS_WAKING_UP", WAKING_UP_TEXT, TFT_YELLOW, true, NotoGiraffe64 },
+    { "STATUS_AWAKE", AWAKE_TEXT, TFT_DARKGREEN, false, NotoFrog64 },
+};
+
+static Image compose(const Panel &panel) {
+    TFT_eSPI lcd;
+    TFT_eSprite sprite(&lcd);
+    sprite.createSprite(STATUS_PANEL_WIDTH, STATUS_PANEL_HEIGHT);
+    sprite.fillRect(0, 0, STATUS_PANEL_WIDTH, STATUS_PANEL_HEIGHT, TFT_BLACK);
+    FlashFont(NotoSansBold15).draw(sprite, panel.label, STATUS_PANEL_WIDTH / 2, 0, TC_DATUM, panel.color, TFT_BLACK);
+    sprite.setSwapBytes(true);
+    for (int16_t x = 0; x < 3 && panel.paws; x++) {
+        for (int16_t y = 0; y < 3; y++) {
+            sprite.pushImage(PAW_GRID_LEFT + (x * AREA_AROUND_CAT), PAW_GRID_TOP + (y * AREA_AROUND_CAT),
+                PAW_SIZE, PAW_SIZE, cat_paw);
+        }
+    }
+    sprite.pushImage(0, STATUS_LABEL_HEIGHT, STATUS_ICON_SIZE, STATUS_ICON_SIZE, panel.animal);
+
+    Image image;
+    image.width = STATUS_PANEL_WIDTH;
+    image.height = STATUS_PANEL_HEIGHT;
+    for (int32_t y = 0; y < image.height; y++) {
+        for (int32_t x = 0; x < image.width; x++) {
+            image.pixels.push_back(sprite.readPixel(x, y));
+        }
+    }
+    return image;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s status-panels.h\n", argv[0]);
+        return 1;
+    }
+    std::string body;
+    uint32_t bytes = 0;
+    for (const Panel &panel : PANELS) {
+        const Encoded encoded = encode(compose(panel), panel.name, Encoding::Rle565);
+        if (!encoded.failure.empty()) {
+            fprintf(stderr, "%s: %s\n", panel.name, encoded.failure.c_str());
+            return 1;
+        }
+        printf("%s: %u bytes of flash\n", panel.name, encoded.bytes);
+        body += (body.empty() ? "" : "\n") + encoded.code;
+        bytes += encoded.bytes;
+    }
+    bool changed;
+    if (!writeIfChanged(argv[1], headerStart("tools/bake_status.py", "texts.hpp labels + cat-paw.h + Noto*64-flatten.h",
+            "__STATUS_PANELS_H", bytes, true) + body + "\n" + headerEnd(), changed)) {
+        fprintf(stderr, "could not write %s\n", argv[1]);
+        return 1;
+    }
+    return 0;
+}
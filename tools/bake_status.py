@@ -0,0 +1,42 @@
+# PlatformIO pre-build step, after subset_fonts.py and convert_images.py:
+# composes the status panel of every state (label, paws and animal) into
+# include/status-panels.h whenever the images, font, texts or layout
+# changed.
+Import("env")
+import os
+import sys
+
+sys.path.insert(0, os.path.join(env.subst("$PROJECT_DIR"), "tools"))
+from prebuild_common import Step
+
+step = Step(env, "bake_status")
+path = step.path
+
+sources = [
+    path("tools", "bake_status.cpp"),
+    path("tools", "image_encode.cpp"),
+    path("src", "flash_font.cpp"),
+    path("src", "packed_image.cpp"),
+    path("native", "TFT_eSPI.cpp"),
+    path("native", "emulator.cpp"),
+]
+inputs = sources + [
+    path("tools", "prebuild_common.py"),
+    path("tools", "image_encode.hpp"),
+    path("include", "status_panel.hpp"),
+    path("include", "flash_font.hpp"),
+    path("include", "blend.hpp"),
+    path("include", "packed_image.hpp"),
+    path("include", "texts.hpp"),
+    path("include", "NotoSansBold15.h"),
+    path("include", "NotoFox64-flatten.h"),
+    path("include", "NotoFrog64-flatten.h"),
+    path("include", "NotoGiraffe64-flatten.h"),
+    path("include", "cat-paw.h"),
+    path("native", "TFT_eSPI.h"),
+]
+output = path("include", "status-panels.h")
+
+if step.stale(inputs, [output]):
+    print("Composing the status panels into %s" % step.relative([output]))
+    step.run(sources, [output])
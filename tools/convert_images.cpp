@@ -0,0 +1,238 @@
+// Host tool run by convert_images.py before every build: reads the source
+// PNGs listed in assets/images.txt and writes them into include/ in the
+// encoding each line asks for (see tools/image_encode.hpp). The images are
+// encoded in parallel, and a header is only rewritten when it changed.
+//
+// With --survey every image is encoded in every encoding instead, and a
+// table of the flash each takes and how far it is off is printed, without
+// writing anything:
+//
+//   convert_images [--jobs N] [--survey] assets/images.txt include
+//
+// Built against the Arduino stand-in in native/.
+#include <Arduino.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "image_encode.hpp"
+#include "png.hpp"
+
+struct Entry {
+    std::string header, name, source;
+    Encoding encoding;
+    uint32_t background; // 0xRRGGBB that transparency and masks fall back to
+};
+
+static bool readManifest(const std::string &path, std::vector<Entry> &entries) {
+    FILE *f = fopen(path.c_str(), "r");
+    if (f == nullptr) {
+        fprintf(stderr, "could not read %s\n", path.c_str());
+        return false;
+    }
+    char line[512];
+    int number = 0;
+    bool ok = true;
+    while (fgets(line, sizeof(line), f) != nullptr) {
+        number++;
+        if (char *comment = strchr(line, '#')) {
+            *comment = '\0';
+        }
+        char header[128], name[128], encoding[32], source[256], background[16] = "000000";
+        const int fields = sscanf(line, "%127s %127s %31s %255s %15s", header, name, encoding, source, background);
+        if (fields <= 0) {
+            continue;
+        }
+        Entry entry = { header, name, source, Encoding::Raw565, 0 };
+        char *end = nullptr;
+        entry.background = strtoul(background, &end, 16);
+        if (fields < 4 || !parseEncoding(encoding, entry.encoding) || *end != '\0') {
+            fprintf(stderr, "%s:%d: expected: header name encoding source.png [background RRGGBB]\n", path.c_str(), number);
+            ok = false;
+            continue;
+        }
+        entries.push_back(entry);
+    }
+    fclose(f);
+    return ok;
+}
+
+// flattened over the background and truncated to RGB565, so an image
+// exported from a 565 header reads back exactly
+static bool load(const std::string &path, uint32_t background, Image &image, std::string &error) {
+    Png png;
+    if (!readPng(path, png, error)) {
+        return false;
+    }
+    image.width = png.width;
+    image.height = png.height;
+    image.pixels.resize(png.pixels.size());
+    for (size_t i = 0; i < png.pixels.size(); i++) {
+        const uint32_t p = png.pixels[i], alpha = p >> 24;
+        auto channel = [&](int shift) {
+            const uint32_t c = (p >> shift) & 0xFF, b = (background >> shift) & 0xFF;
+            return ((c * alpha) + (b * (255 - alpha)) + 127) / 255;
+        };
+        image.pixels[i] = ((channel(16) >> 3) << 11) | ((channel(8) >> 2) << 5) | (channel(0) >> 3);
+    }
+    return true;
+}
+
+static uint16_t to565(uint32_t rgb) {
+    return (((rgb >> 19) & 0x1F) << 11) | (((rgb >> 10) & 0x3F) << 5) | ((rgb >> 3) & 0x1F);
+}
+
+// run work(0 .. count - 1) on jobs threads
+template<typename Work>
+static void parallel(size_t count, unsigned jobs, Work work) {
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < max(1u, jobs); t++) {
+        threads.emplace_back([&]() {
+            for (size_t i; (i = next++) < count;) {
+                work(i);
+            }
+        });
+    }
+    for (std::thread &t : threads) {
+        t.join();
+    }
+}
+
+static std::string guardFor(const std::string &header) {
+    std::string guard = "__";
+    for (char c : header) {
+        guard += isalnum((unsigned char)c) ? toupper((unsigned char)c) : '_';
+    }
+    return guard.substr(0, guard.rfind('_')) + "_H";
+}
+
+static int survey(const std::vector<Entry> &entries, const std::string &assets, unsigned jobs) {
+    std::vector<Entry> sources;
+    for (const Entry &e : entries) {
+        bool seen = false;
+        for (const Entry &s : sources) {
+            seen |= s.source == e.source;
+        }
+        if (!seen) {
+            sources.push_back(e);
+        }
+    }
+    constexpr size_t COUNT = sizeof(ENCODINGS) / sizeof(ENCODINGS[0]);
+    std::vector<Encoded> results(sources.size() * COUNT);
+    parallel(results.size(), jobs, [&](size_t i) {
+        const Entry &source = sources[i / COUNT];
+        Image image;
+        if (!load(assets + source.source, source.background, image, results[i].failure)) {
+            return;
+        }
+        results[i] = encode(image, "SURVEY", ENCODINGS[i % COUNT], to565(source.background));
+    });
+    printf("%-28s", "bytes (565 steps off)");
+    for (Encoding e : ENCODINGS) {
+        printf(" %15s", encodingName(e));
+    }
+    printf("\n");
+    for (size_t s = 0; s < sources.size(); s++) {
+        printf("%-28s", sources[s].source.c_str());
+        for (size_t e = 0; e < COUNT; e++) {
+            const Encoded &r = results[(s * COUNT) + e];
+            char cell[32];
+            if (!r.failure.empty()) {
+                snprintf(cell, sizeof(cell), "-");
+            }
+            else if (r.error > 0) {
+                snprintf(cell, sizeof(cell), "%u (%.2f)", r.bytes, r.error);
+            }
+            else {
+                snprintf(cell, sizeof(cell), "%u", r.bytes);
+            }
+            printf(" %15s", cell);
+        }
+        printf("\n");
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    unsigned jobs = std::thread::hardware_concurrency();
+    bool surveying = false;
+    int arg = 1;
+    for (; arg < argc && argv[arg][0] == '-'; arg++) {
+        if (strcmp(argv[arg], "--survey") == 0) {
+            surveying = true;
+        }
+        else if (strcmp(argv[arg], "--jobs") == 0 && arg + 1 < argc) {
+            jobs = atoi(argv[++arg]);
+        }
+        else {
+            break;
+        }
+    }
+    if (argc - arg != 2) {
+        fprintf(stderr, "usage: %s [--jobs N] [--survey] assets/images.txt include\n", argv[0]);
+        return 1;
+    }
+    const std::string manifest = argv[arg], include = std::string(argv[arg + 1]) + "/";
+    const size_t slash = manifest.rfind('/');
+    const std::string assets = slash == std::string::npos ? "" : manifest.substr(0, slash + 1);
+    std::vector<Entry> entries;
+    if (!readManifest(manifest, entries)) {
+        return 1;
+    }
+    if (surveying) {
+        return survey(entries, assets, jobs);
+    }
+
+    std::vector<Encoded> results(entries.size());
+    parallel(entries.size(), jobs, [&](size_t i) {
+        const Entry &entry = entries[i];
+        Image image;
+        if (load(assets + entry.source, entry.background, image, results[i].failure)) {
+            results[i] = encode(image, entry.name, entry.encoding, to565(entry.background));
+        }
+    });
+    bool failed = false;
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (!results[i].failure.empty()) {
+            fprintf(stderr, "%s (%s): %s\n", entries[i].source.c_str(), entries[i].name.c_str(), results[i].failure.c_str());
+            failed = true;
+        }
+    }
+    if (failed) {
+        return 1;
+    }
+
+    // the headers, each with its images in manifest order
+    std::vector<std::string> headers;
+    for (const Entry &e : entries) {
+        if (std::find(headers.begin(), headers.end(), e.header) == headers.end()) {
+            headers.push_back(e.header);
+        }
+    }
+    for (const std::string &header : headers) {
+        std::string from, body;
+        uint32_t bytes = 0;
+        bool packed = false;
+        for (size_t i = 0; i < entries.size(); i++) {
+            if (entries[i].header != header) {
+                continue;
+            }
+            from += (from.empty() ? "assets/" : ", assets/") + entries[i].source;
+            body += (body.empty() ? "" : "\n") + results[i].code;
+            bytes += results[i].bytes;
+            packed |= isPacked(entries[i].encoding);
+            printf("%s: %s, %u bytes\n", entries[i].name.c_str(), encodingName(entries[i].encoding), results[i].bytes);
+        }
+        const std::string content = headerStart("tools/convert_images.py", from, guardFor(header), bytes, packed)
+            + body + "\n" + headerEnd();
+        bool changed;
+        if (!writeIfChanged(include + header, content, changed)) {
+            fprintf(stderr, "could not write %s\n", (include + header).c_str());
+            return 1;
+        }
+        if (changed) {
+            printf("wrote %s\n", (include + header).c_str());
+        }
+    }
+    return 0;
+}
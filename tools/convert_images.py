@@ -0,0 +1,36 @@
+# PlatformIO pre-build step: converts the PNGs in assets/ into the headers
+# listed in assets/images.txt whenever an image, the list or the converter
+# changed.
+Import("env")
+import os
+import sys
+
+sys.path.insert(0, os.path.join(env.subst("$PROJECT_DIR"), "tools"))
+from prebuild_common import Step
+
+step = Step(env, "convert_images")
+path = step.path
+
+sources = [
+    path("tools", "convert_images.cpp"),
+    path("tools", "image_encode.cpp"),
+    path("tools", "png.cpp"),
+    path("src", "packed_image.cpp"),
+]
+manifest = path("assets", "images.txt")
+inputs = sources + [
+    manifest,
+    path("tools", "prebuild_common.py"),
+    path("tools", "image_encode.hpp"),
+    path("tools", "png.hpp"),
+    path("include", "packed_image.hpp"),
+] + [path("assets", f) for f in os.listdir(path("assets")) if f.endswith(".png")]
+
+def outputs():
+    with open(manifest) as f:
+        lines = [l.split("#")[0].split() for l in f]
+    return set(path("include", l[0]) for l in lines if l)
+
+if step.stale(inputs, outputs()):
+    print("Converting the images in assets/images.txt")
+    step.run(sources, [manifest, path("include")], ["-pthread"])
@@ -0,0 +1,494 @@
+#include "image_encode.hpp"
+#include <Arduino.h>
+#include <stdarg.h>
+#include <map>
+#include "packed_image.hpp"
+
+static void appendf(std::string &out, const char *format, ...) {
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    out += buffer;
+}
+
+const char *encodingName(Encoding encoding) {
+    switch (encoding) {
+        case Encoding::Raw565: return "raw565";
+        case Encoding::Palette8: return "palette8";
+        case Encoding::Palette4: return "palette4";
+        case Encoding::Rle565: return "rle565";
+        case Encoding::RlePalette8: return "rle-palette8";
+        case Encoding::RlePalette4: return "rle-palette4";
+        case Encoding::Mask: return "mask";
+    }
+    return "?";
+}
+
+bool parseEncoding(const std::string &name, Encoding &encoding) {
+    for (Encoding e : ENCODINGS) {
+        if (name == encodingName(e)) {
+            encoding = e;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool isPacked(Encoding encoding) {
+    return encoding == Encoding::Rle565 || encoding == Encoding::RlePalette8 || encoding == Encoding::RlePalette4;
+}
+
+struct Color {
+    double r, g, b;
+};
+
+static Color expand(uint16_t c) {
+    return { (double)(c >> 11), (double)((c >> 5) & 0x3F), (double)(c & 0x1F) };
+}
+
+static uint16_t pack(const Color &c) {
+    auto channel = [](double v, int top) { return (uint16_t)min(max((int)lround(v), 0), top); };
+    return (channel(c.r, 31) << 11) | (channel(c.g, 63) << 5) | channel(c.b, 31);
+}
+
+// in 565 steps, green has twice the resolution so it is halved
+static double distance(const Color &a, const Color &b) {
+    const double r = a.r - b.r, g = (a.g - b.g) / 2, bl = a.b - b.b;
+    return (r * r) + (g * g) + (bl * bl);
+}
+
+static double pixelError(uint16_t a, uint16_t b) {
+    return sqrt(distance(expand(a), expand(b)));
+}
+
+// Pick the palette by median cut over the distinct colours, weighted by
+// how often they occur, refined with a few rounds of k-means.
+static std::vector<uint16_t> quantise(const uint16_t *pixels, int32_t count, size_t colors) {
+    std::map<uint16_t, uint32_t> histogram;
+    for (int32_t i = 0; i < count; i++) {
+        histogram[pixels[i]]++;
+    }
+    struct Entry { Color color; uint16_t packed; uint32_t weight; };
+    std::vector<Entry> entries;
+    for (const auto &h : histogram) {
+        entries.push_back({ expand(h.first), h.first, h.second });
+    }
+    std::vector<uint16_t> palette;
+    if (entries.size() <= colors) {
+        for (const auto &e : entries) {
+            palette.push_back(e.packed);
+        }
+        palette.resize(colors, 0);
+        return palette;
+    }
+    using Box = std::vector<Entry>;
+    std::vector<Box> boxes = { entries };
+    auto spread = [](const Box &box, int &channel) {
+        double lo[3] = { 1e9, 1e9, 1e9 }, hi[3] = { -1e9, -1e9, -1e9 };
+        for (const auto &e : box) {
+            const double v[3] = { e.color.r, e.color.g / 2, e.color.b };
+            for (int c = 0; c < 3; c++) {
+                lo[c] = min(lo[c], v[c]);
+                hi[c] = max(hi[c], v[c]);
+            }
+        }
+        channel = 0;
+        for (int c = 1; c < 3; c++) {
+            if (hi[c] - lo[c] > hi[channel] - lo[channel]) {
+                channel = c;
+            }
+        }
+        return hi[channel] - lo[channel];
+    };
+    while (boxes.size() < colors) {
+        // split the box with the most weighted spread
+        size_t widest = 0;
+        double best = -1;
+        int channel = 0;
+        for (size_t i = 0; i < boxes.size(); i++) {
+            if (boxes[i].size() < 2) {
+                continue;
+            }
+            int c;
+            uint64_t weight = 0;
+            for (const auto &e : boxes[i]) {
+                weight += e.weight;
+            }
+            const double score = spread(boxes[i], c) * weight;
+            if (score > best) {
+                best = score;
+                widest = i;
+                channel = c;
+            }
+        }
+        if (best < 0) {
+            break;
+        }
+        Box &box = boxes[widest];
+        auto value = [channel](const Entry &e) {
+            return channel == 0 ? e.color.r : channel == 1 ? e.color.g : e.color.b;
+        };
+        std::sort(box.begin(), box.end(), [&](const Entry &a, const Entry &b) { return value(a) < value(b); });
+        uint64_t total = 0, half = 0;
+        for (const auto &e : box) {
+            total += e.weight;
+        }
+        size_t split = 1;
+        for (; split < box.size() - 1; split++) {
+            half += box[split - 1].weight;
+            if (half * 2 >= total) {
+                break;
+            }
+        }
+        boxes.push_back(Box(box.begin() + split, box.end()));
+        box.resize(split);
+    }
+    std::vector<Color> centres;
+    for (const auto &box : boxes) {
+        Color sum = { 0, 0, 0 };
+        double weight = 0;
+        for (const auto &e : box) {
+            sum.r += e.color.r * e.weight;
+            sum.g += e.color.g * e.weight;
+            sum.b += e.color.b * e.weight;
+            weight += e.weight;
+        }
+        centres.push_back({ sum.r / weight, sum.g / weight, sum.b / weight });
+    }
+    for (int round = 0; round < 8; round++) {
+        std::vector<Color> sums(centres.size(), { 0, 0, 0 });
+        std::vector<double> weights(centres.size(), 0);
+        for (const auto &e : entries) {
+            size_t nearest = 0;
+            for (size_t i = 1; i < centres.size(); i++) {
+                if (distance(e.color, centres[i]) < distance(e.color, centres[nearest])) {
+                    nearest = i;
+                }
+            }
+            sums[nearest].r += e.color.r * e.weight;
+            sums[nearest].g += e.color.g * e.weight;
+            sums[nearest].b += e.color.b * e.weight;
+            weights[nearest] += e.weight;
+        }
+        for (size_t i = 0; i < centres.size(); i++) {
+            if (weights[i] > 0) {
+                centres[i] = { sums[i].r / weights[i], sums[i].g / weights[i], sums[i].b / weights[i] };
+            }
+        }
+    }
+    for (const auto &c : centres) {
+        if (std::find(palette.begin(), palette.end(), pack(c)) == palette.end()) {
+            palette.push_back(pack(c));
+        }
+    }
+    // centres that rounded to the same colour leave room for the colours
+    // that are worst off
+    while (palette.size() < colors) {
+        const Entry *worst = nullptr;
+        double worstError = 0;
+        for (const auto &e : entries) {
+            double error = 1e9;
+            for (uint16_t p : palette) {
+                error = min(error, distance(e.color, expand(p)));
+            }
+            if (error * e.weight > worstError) {
+                worstError = error * e.weight;
+                worst = &e;
+            }
+        }
+        if (worst == nullptr) {
+            break;
+        }
+        palette.push_back(worst->packed);
+    }
+    palette.resize(colors, 0);
+    return palette;
+}
+
+static uint8_t nearest(const std::vector<uint16_t> &palette, uint16_t pixel) {
+    uint8_t best = 0;
+    for (size_t i = 1; i < palette.size(); i++) {
+        if (distance(expand(pixel), expand(palette[i])) < distance(expand(pixel), expand(palette[best]))) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+// in the layout ImageConverter 565 used for the original headers
+static void writeArray(std::string &out, const std::string &name, const uint16_t *values, int32_t count) {
+    appendf(out, "const unsigned short %s[%d] PROGMEM={\n", name.c_str(), count);
+    for (int32_t i = 0; i < count; i++) {
+        appendf(out, "0x%04X,%s", values[i], (i % 16) == 15 ? "" : " ");
+        if ((i % 16) == 15 || i == count - 1) {
+            appendf(out, "   // 0x%04X (%d) pixels\n", i + 1, i + 1);
+        }
+    }
+    out += "};\n";
+}
+
+static void writeArray(std::string &out, const std::string &name, const uint8_t *values, int32_t count) {
+    appendf(out, "const unsigned char %s[%d] PROGMEM={\n", name.c_str(), count);
+    for (int32_t i = 0; i < count; i++) {
+        appendf(out, "0x%02X,%s", values[i], (i % 16) == 15 || i == count - 1 ? "\n" : " ");
+    }
+    out += "};\n";
+}
+
+static void writeBytes(std::string &out, const std::string &name, const std::vector<uint8_t> &bytes) {
+    appendf(out, "static const uint8_t %s[%u] PROGMEM = {\n", name.c_str(), (unsigned)bytes.size());
+    for (size_t i = 0; i < bytes.size(); i++) {
+        appendf(out, "0x%02X,%s", bytes[i], (i % 16) == 15 || i == bytes.size() - 1 ? "\n" : " ");
+    }
+    out += "};\n";
+}
+
+static void writeWords(std::string &out, const std::string &name, const uint16_t *words, size_t count) {
+    appendf(out, "static const uint16_t %s[%u] PROGMEM = {\n", name.c_str(), (unsigned)count);
+    for (size_t i = 0; i < count; i++) {
+        appendf(out, "0x%04X,%s", words[i], (i % 16) == 15 || i == count - 1 ? "\n" : " ");
+    }
+    out += "};\n";
+}
+
+static void title(std::string &out, const std::string &name, const Image &image, Encoding encoding, uint32_t bytes) {
+    appendf(out, "// %s: %dx%d %s, %u bytes of flash\n", name.c_str(), image.width, image.height, encodingName(encoding), bytes);
+}
+
+static Encoded raw(const Image &image, const std::string &name) {
+    Encoded result;
+    result.bytes = image.pixels.size() * 2;
+    title(result.code, name, image, Encoding::Raw565, result.bytes);
+    writeArray(result.code, name, image.pixels.data(), image.pixels.size());
+    return result;
+}
+
+// the image as 8 or 4 bit palette indices, two pixels to a byte high
+// nibble first for 4 bits
+static Encoded indexed(const Image &image, const std::string &name, uint8_t bpp) {
+    const int32_t count = image.pixels.size();
+    const std::vector<uint16_t> palette = quantise(image.pixels.data(), count, 1 << bpp);
+    std::vector<uint8_t> indices(((count * bpp) + 7) / 8, 0);
+    Encoded result;
+    for (int32_t i = 0; i < count; i++) {
+        const uint8_t index = nearest(palette, image.pixels[i]);
+        if (bpp == 8) {
+            indices[i] = index;
+        }
+        else {
+            indices[i / 2] |= (i % 2) == 0 ? index << 4 : index;
+        }
+        result.error += pixelError(image.pixels[i], palette[index]);
+    }
+    result.error /= count;
+    result.bytes = indices.size() + (palette.size() * 2);
+    title(result.code, name, image, bpp == 8 ? Encoding::Palette8 : Encoding::Palette4, result.bytes);
+    char array[128];
+    snprintf(array, sizeof(array), "%s_PALETTE%d", name.c_str(), bpp);
+    writeArray(result.code, array, palette.data(), palette.size());
+    result.code += "\n";
+    snprintf(array, sizeof(array), "%s_INDEX%d", name.c_str(), bpp);
+    writeArray(result.code, array, indices.data(), indices.size());
+    return result;
+}
+
+// Runs pay off from 2 pixels, or 3 palette indices, shorter ones go with
+// the literals around them.
+static void packRow(std::vector<uint8_t> &out, const uint16_t *row, int32_t width, bool pixels) {
+    const int32_t minRun = pixels ? 2 : 3;
+    auto putItem = [&](uint16_t item) {
+        if (pixels) {
+            out.push_back(item >> 8);
+        }
+        out.push_back(item & 0xFF);
+    };
+    std::vector<uint16_t> literals;
+    auto flushLiterals = [&]() {
+        for (size_t i = 0; i < literals.size(); i += PackedImage::MAX_PACKET) {
+            const size_t count = min(literals.size() - i, (size_t)PackedImage::MAX_PACKET);
+            out.push_back(count - 1);
+            for (size_t j = 0; j < count; j++) {
+                putItem(literals[i + j]);
+            }
+        }
+        literals.clear();
+    };
+    int32_t x = 0;
+    while (x < width) {
+        const uint16_t item = row[x];
+        int32_t run = 1;
+        while (x + run < width && run < PackedImage::MAX_PACKET + 1 && row[x + run] == item) {
+            run++;
+        }
+        if (run >= minRun) {
+            flushLiterals();
+            out.push_back(PackedImage::RUN + run - 2);
+            putItem(item);
+        }
+        else {
+            for (int32_t i = 0; i < run; i++) {
+                literals.push_back(item);
+            }
+        }
+        x += run;
+    }
+    flushLiterals();
+}
+
+// PackedImage rows, decoded again and compared before they are written
+static Encoded packed(const Image &image, const std::string &name, Encoding encoding) {
+    Encoded result;
+    const bool pixels = encoding == Encoding::Rle565;
+    std::vector<uint16_t> palette, items = image.pixels;
+    if (!pixels) {
+        palette = quantise(image.pixels.data(), image.pixels.size(), encoding == Encoding::RlePalette8 ? 256 : 16);
+        for (uint16_t &item : items) {
+            item = nearest(palette, item);
+        }
+    }
+    std::vector<uint8_t> data;
+    std::vector<uint16_t> rows;
+    for (int32_t y = 0; y < image.height; y++) {
+        rows.push_back(data.size());
+        packRow(data, items.data() + (y * image.width), image.width, pixels);
+    }
+    if (data.size() > UINT16_MAX || image.width > INT16_MAX || image.height > INT16_MAX) {
+        result.failure = "does not fit 16 bit row offsets";
+        return result;
+    }
+    const PackedImage decoder = {
+        (int16_t)image.width, (int16_t)image.height,
+        pixels ? PackedImage::Rle565 : PackedImage::PaletteRle,
+        (uint16_t)palette.size(), (uint16_t)data.size(),
+        pixels ? nullptr : palette.data(), rows.data(), data.data()
+    };
+    std::vector<uint16_t> row(image.width);
+    for (int32_t y = 0; y < image.height; y++) {
+        decoder.decodeRow(y, 0, image.width, row.data());
+        for (int32_t x = 0; x < image.width; x++) {
+            const uint16_t item = items[(y * image.width) + x];
+            const uint16_t expected = pixels ? item : palette[item];
+            if (row[x] != (uint16_t)((expected >> 8) | (expected << 8))) {
+                result.failure = "does not decode at " + std::to_string(x) + "," + std::to_string(y);
+                return result;
+            }
+            result.error += pixelError(image.pixels[(y * image.width) + x], expected);
+        }
+    }
+    result.error /= image.pixels.size();
+    result.bytes = decoder.size();
+
+    std::string &out = result.code;
+    title(out, name, image, encoding, result.bytes);
+    writeBytes(out, name + "_PACKED_DATA", data);
+    writeWords(out, name + "_PACKED_ROWS", rows.data(), rows.size());
+    std::string paletteName = "nullptr";
+    if (!pixels) {
+        paletteName = name + "_PACKED_PALETTE";
+        writeWords(out, paletteName, palette.data(), palette.size());
+    }
+    appendf(out, "const PackedImage %s_PACKED = { %d, %d, PackedImage::%s, %u, %u, ",
+        name.c_str(), image.width, image.height, pixels ? "Rle565" : "PaletteRle",
+        (unsigned)palette.size(), (unsigned)data.size());
+    out += paletteName + ", " + name + "_PACKED_ROWS, " + name + "_PACKED_DATA };\n";
+    return result;
+}
+
+// one bit per pixel in XBM order (rows of whole bytes, least significant
+// bit first), drawn in a single colour
+static Encoded mask(const Image &image, const std::string &name, uint16_t background) {
+    std::map<uint16_t, uint32_t> histogram;
+    for (uint16_t p : image.pixels) {
+        if (p != background) {
+            histogram[p]++;
+        }
+    }
+    uint16_t color = ~background;
+    uint32_t most = 0;
+    for (const auto &h : histogram) {
+        if (h.second > most) {
+            most = h.second;
+            color = h.first;
+        }
+    }
+    const int32_t stride = (image.width + 7) / 8;
+    std::vector<uint8_t> bits(stride * image.height, 0);
+    Encoded result;
+    for (int32_t y = 0; y < image.height; y++) {
+        for (int32_t x = 0; x < image.width; x++) {
+            const uint16_t p = image.pixels[(y * image.width) + x];
+            if (p != background) {
+                bits[(y * stride) + (x / 8)] |= 1 << (x % 8);
+            }
+            result.error += pixelError(p, p != background ? color : background);
+        }
+    }
+    result.error /= image.pixels.size();
+    result.bytes = bits.size() + 2;
+    std::string &out = result.code;
+    title(out, name, image, Encoding::Mask, result.bytes);
+    appendf(out, "#define %s_width %d\n#define %s_height %d\n", name.c_str(), image.width, name.c_str(), image.height);
+    appendf(out, "static const uint16_t %s_color = 0x%04X;\n", name.c_str(), color);
+    writeArray(out, name + "_bits", bits.data(), bits.size());
+    return result;
+}
+
+Encoded encode(const Image &image, const std::string &name, Encoding encoding, uint16_t background) {
+    switch (encoding) {
+        case Encoding::Raw565: return raw(image, name);
+        case Encoding::Palette8: return indexed(image, name, 8);
+        case Encoding::Palette4: return indexed(image, name, 4);
+        case Encoding::Rle565:
+        case Encoding::RlePalette8:
+        case Encoding::RlePalette4: return packed(image, name, encoding);
+        case Encoding::Mask: return mask(image, name, background);
+    }
+    Encoded failed;
+    failed.failure = "unknown encoding";
+    return failed;
+}
+
+std::string headerStart(const std::string &generator, const std::string &from,
+        const std::string &guard, uint32_t bytes, bool packed) {
+    std::string out;
+    appendf(out, "// Generated by   : %s, do not edit\n", generator.c_str());
+    out += "// Generated from : " + from + "\n";
+    appendf(out, "// Memory usage   : %u bytes\n\n", bytes);
+    out += "#ifndef " + guard + "\n#define " + guard + "\n";
+    out += "#if defined(__AVR__)\n    #include <avr/pgmspace.h>\n#elif defined(__PIC32MX__)\n"
+        "    #define PROGMEM\n#elif defined(__arm__)\n    #define PROGMEM\n#endif\n";
+    if (packed) {
+        out += "#include \"packed_image.hpp\"\n";
+    }
+    return out + "\n";
+}
+
+std::string headerEnd() {
+    return "#endif\n";
+}
+
+bool writeIfChanged(const std::string &path, const std::string &content, bool &changed) {
+    changed = false;
+    FILE *f = fopen(path.c_str(), "rb");
+    if (f != nullptr) {
+        std::string existing;
+        char buffer[4096];
+        size_t n;
+        while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+            existing.append(buffer, n);
+        }
+        fclose(f);
+        if (existing == content) {
+            return true;
+        }
+    }
+    changed = true;
+    f = fopen(path.c_str(), "wb");
+    if (f == nullptr) {
+        return false;
+    }
+    const bool written = fwrite(content.data(), 1, content.size(), f) == content.size();
+    return fclose(f) == 0 && written;
+}
@@ -0,0 +1,57 @@
+// The image encodings the clock can draw from flash, shared by the host
+// tools (convert_images and bake_face). Every encoder returns the C source
+// of its arrays together with the flash it takes and how far the result is
+// from the source pixels, so encodings can be compared before picking one.
+#ifndef __TOOLS_IMAGE_ENCODE_H
+#define __TOOLS_IMAGE_ENCODE_H
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+struct Image {
+    int32_t width = 0, height = 0;
+    std::vector<uint16_t> pixels; // RGB565
+};
+
+enum class Encoding {
+    Raw565,      // NAME[w * h], what TFT_eSPI pushImage() takes
+    Palette8,    // NAME_PALETTE8[256] + NAME_INDEX8[w * h]
+    Palette4,    // NAME_PALETTE4[16] + NAME_INDEX4[w * h / 2], high nibble first
+    Rle565,      // PackedImage NAME_PACKED, see include/packed_image.hpp
+    RlePalette8, // PackedImage NAME_PACKED over 256 colours
+    RlePalette4, // PackedImage NAME_PACKED over 16 colours
+    Mask,        // XBM style NAME_bits[] + NAME_color, set where not background
+};
+
+static constexpr Encoding ENCODINGS[] = {
+    Encoding::Raw565, Encoding::Palette8, Encoding::Palette4,
+    Encoding::Rle565, Encoding::RlePalette8, Encoding::RlePalette4, Encoding::Mask,
+};
+
+const char *encodingName(Encoding encoding);
+bool parseEncoding(const std::string &name, Encoding &encoding);
+// whether the header needs packed_image.hpp
+bool isPacked(Encoding encoding);
+
+struct Encoded {
+    std::string code;
+    uint32_t bytes = 0;   // of flash
+    double error = 0;     // mean distance per pixel, in 565 steps
+    std::string failure;  // set if the image can not be encoded this way
+};
+
+// background is the colour a Mask leaves unset, the rest takes the most
+// common other colour
+Encoded encode(const Image &image, const std::string &name, Encoding encoding, uint16_t background = 0);
+
+// the comment and PROGMEM block every generated header starts with, the
+// guard is closed by headerEnd()
+std::string headerStart(const std::string &generator, const std::string &from,
+    const std::string &guard, uint32_t bytes, bool packed);
+std::string headerEnd();
+
+// write path only if its content differs, so unchanged headers do not
+// trigger a rebuild
+bool writeIfChanged(const std::string &path, const std::string &content, bool &changed);
+
+#endif
@@ -0,0 +1,388 @@
+#include "png.hpp"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+namespace {
+
+// Bit reader over the deflate stream, least significant bit first.
+class Bits {
+public:
+    Bits(const uint8_t *data, size_t size): data(data), size(size) {}
+
+    bool failed() const { return overrun; }
+    uint32_t get(int count) {
+        uint32_t value = 0;
+        for (int i = 0; i < count; i++) {
+            value |= bit() << i;
+        }
+        return value;
+    }
+    uint32_t bit() {
+        if (position >= size * 8) {
+            overrun = true;
+            return 0;
+        }
+        const uint32_t b = (data[position / 8] >> (position % 8)) & 1;
+        position++;
+        return b;
+    }
+    void alignToByte() { position = (position + 7) & ~(size_t)7; }
+    size_t byte() const { return position / 8; }
+    void skipBytes(size_t count) { position += count * 8; }
+private:
+    const uint8_t *data;
+    size_t size;
+    size_t position = 0;
+    bool overrun = false;
+};
+
+// canonical Huffman code, decoded a bit at a time (assets are small)
+struct Huffman {
+    uint16_t counts[16] = {};
+    std::vector<uint16_t> symbols;
+
+    bool build(const uint8_t *lengths, int count) {
+        memset(counts, 0, sizeof(counts));
+        for (int i = 0; i < count; i++) {
+            counts[lengths[i]]++;
+        }
+        counts[0] = 0;
+        uint16_t offsets[16] = {};
+        for (int len = 1; len < 16; len++) {
+            offsets[len] = offsets[len - 1] + counts[len - 1];
+        }
+        symbols.assign(count, 0);
+        for (int i = 0; i < count; i++) {
+            if (lengths[i] != 0) {
+                symbols[offsets[lengths[i]]++] = i;
+            }
+        }
+        return true;
+    }
+    int decode(Bits &bits) const {
+        int code = 0, first = 0, index = 0;
+        for (int len = 1; len < 16; len++) {
+            code |= bits.bit();
+            const int count = counts[len];
+            if (code - first < count) {
+                return symbols[index + (code - first)];
+            }
+            index += count;
+            first = (first + count) << 1;
+            code <<= 1;
+        }
+        return -1;
+    }
+};
+
+const uint16_t LENGTH_BASE[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+const uint8_t LENGTH_EXTRA[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+const uint16_t DISTANCE_BASE[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+const uint8_t DISTANCE_EXTRA[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+bool inflateBlock(Bits &bits, const Huffman &literals, const Huffman &distances, std::vector<uint8_t> &out) {
+    for (;;) {
+        const int symbol = literals.decode(bits);
+        if (symbol < 0 || bits.failed()) {
+            return false;
+        }
+        if (symbol < 256) {
+            out.push_back(symbol);
+            continue;
+        }
+        if (symbol == 256) {
+            return true;
+        }
+        if (symbol > 285) {
+            return false;
+        }
+        const uint32_t length = LENGTH_BASE[symbol - 257] + bits.get(LENGTH_EXTRA[symbol - 257]);
+        const int d = distances.decode(bits);
+        if (d < 0 || d > 29) {
+            return false;
+        }
+        const uint32_t distance = DISTANCE_BASE[d] + bits.get(DISTANCE_EXTRA[d]);
+        if (distance > out.size()) {
+            return false;
+        }
+        const size_t from = out.size() - distance;
+        for (uint32_t i = 0; i < length; i++) {
+            out.push_back(out[from + i]);
+        }
+    }
+}
+
+bool dynamicTables(Bits &bits, Huffman &literals, Huffman &distances) {
+    static const uint8_t ORDER[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+    const int hlit = bits.get(5) + 257, hdist = bits.get(5) + 1, hclen = bits.get(4) + 4;
+    uint8_t codeLengths[19] = {};
+    for (int i = 0; i < hclen; i++) {
+        codeLengths[ORDER[i]] = bits.get(3);
+    }
+    Huffman lengthCode;
+    lengthCode.build(codeLengths, 19);
+    uint8_t lengths[286 + 30] = {};
+    for (int i = 0; i < hlit + hdist;) {
+        const int symbol = lengthCode.decode(bits);
+        if (symbol < 0 || bits.failed()) {
+            return false;
+        }
+        if (symbol < 16) {
+            lengths[i++] = symbol;
+            continue;
+        }
+        int repeat = 0;
+        uint8_t value = 0;
+        if (symbol == 16) {
+            if (i == 0) {
+                return false;
+            }
+            value = lengths[i - 1];
+            repeat = 3 + bits.get(2);
+        }
+        else if (symbol == 17) {
+            repeat = 3 + bits.get(3);
+        }
+        else {
+            repeat = 11 + bits.get(7);
+        }
+        if (i + repeat > hlit + hdist) {
+            return false;
+        }
+        while (repeat--) {
+            lengths[i++] = value;
+        }
+    }
+    literals.build(lengths, hlit);
+    distances.build(lengths + hlit, hdist);
+    return true;
+}
+
+// zlib stream (RFC 1950) around deflate (RFC 1951)
+bool inflate(const std::vector<uint8_t> &in, std::vector<uint8_t> &out, std::string &error) {
+    if (in.size() < 2 || (in[0] & 0x0F) != 8 || ((in[0] << 8) | in[1]) % 31 != 0 || (in[1] & 0x20)) {
+        error = "not a zlib stream";
+        return false;
+    }
+    Bits bits(in.data() + 2, in.size() - 2);
+    bool last = false;
+    while (!last) {
+        last = bits.bit();
+        const uint32_t type = bits.get(2);
+        if (type == 0) {
+            bits.alignToByte();
+            const size_t at = bits.byte() + 2;
+            if (at + 4 > in.size()) {
+                error = "truncated stored block";
+                return false;
+            }
+            const uint16_t len = in[at] | (in[at + 1] << 8);
+            const uint16_t nlen = in[at + 2] | (in[at + 3] << 8);
+            if ((uint16_t)~nlen != len || at + 4 + len > in.size()) {
+                error = "bad stored block";
+                return false;
+            }
+            out.insert(out.end(), in.begin() + at + 4, in.begin() + at + 4 + len);
+            bits.skipBytes(4 + len);
+            continue;
+        }
+        Huffman literals, distances;
+        if (type == 1) {
+            uint8_t lengths[288 + 30];
+            memset(lengths, 8, 144);
+            memset(lengths + 144, 9, 112);
+            memset(lengths + 256, 7, 24);
+            memset(lengths + 280, 8, 8);
+            memset(lengths + 288, 5, 30);
+            literals.build(lengths, 288);
+            distances.build(lengths + 288, 30);
+        }
+        else if (type != 2 || !dynamicTables(bits, literals, distances)) {
+            error = "bad deflate block";
+            return false;
+        }
+        if (!inflateBlock(bits, literals, distances, out)) {
+            error = "corrupt deflate data";
+            return false;
+        }
+    }
+    return true;
+}
+
+uint32_t crc32(const uint8_t *data, size_t size) {
+    static uint32_t table[256];
+    if (table[1] == 0) {
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; k++) {
+                c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            table[n] = c;
+        }
+    }
+    uint32_t c = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; i++) {
+        c = table[(c ^ data[i]) & 0xFF] ^ (c >> 8);
+    }
+    return c ^ 0xFFFFFFFFu;
+}
+
+uint32_t bigEndian(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+uint8_t paeth(uint8_t a, uint8_t b, uint8_t c) {
+    const int p = a + b - c;
+    const int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+    return pa <= pb && pa <= pc ? a : pb <= pc ? b : c;
+}
+
+}
+
+bool readPng(const std::string &path, Png &png, std::string &error) {
+    FILE *f = fopen(path.c_str(), "rb");
+    if (f == nullptr) {
+        error = "can not open";
+        return false;
+    }
+    std::vector<uint8_t> file;
+    uint8_t buffer[4096];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+        file.insert(file.end(), buffer, buffer + n);
+    }
+    fclose(f);
+
+    static const uint8_t SIGNATURE[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    if (file.size() < 8 || memcmp(file.data(), SIGNATURE, 8) != 0) {
+        error = "not a PNG file";
+        return false;
+    }
+    uint8_t depth = 0, colorType = 0;
+    std::vector<uint8_t> compressed;
+    std::vector<uint32_t> palette;
+    bool ended = false;
+    for (size_t at = 8; at + 12 <= file.size() && !ended;) {
+        const uint32_t length = bigEndian(&file[at]);
+        if (at + 12 + length > file.size()) {
+            error = "truncated chunk";
+            return false;
+        }
+        const uint8_t *type = &file[at + 4], *data = &file[at + 8];
+        if (crc32(type, length + 4) != bigEndian(data + length)) {
+            error = "chunk checksum mismatch";
+            return false;
+        }
+        if (memcmp(type, "IHDR", 4) == 0 && length >= 13) {
+            png.width = bigEndian(data);
+            png.height = bigEndian(data + 4);
+            depth = data[8];
+            colorType = data[9];
+            if (data[10] != 0 || data[11] != 0 || data[12] != 0) {
+                error = "interlaced or unknown compression/filter method";
+                return false;
+            }
+        }
+        else if (memcmp(type, "PLTE", 4) == 0) {
+            for (uint32_t i = 0; i + 2 < length; i += 3) {
+                palette.push_back(0xFF000000u | (data[i] << 16) | (data[i + 1] << 8) | data[i + 2]);
+            }
+        }
+        else if (memcmp(type, "tRNS", 4) == 0 && colorType == 3) {
+            for (uint32_t i = 0; i < length && i < palette.size(); i++) {
+                palette[i] = (palette[i] & 0x00FFFFFFu) | ((uint32_t)data[i] << 24);
+            }
+        }
+        else if (memcmp(type, "IDAT", 4) == 0) {
+            compressed.insert(compressed.end(), data, data + length);
+        }
+        else if (memcmp(type, "IEND", 4) == 0) {
+            ended = true;
+        }
+        at += 12 + length;
+    }
+    int channels;
+    switch (colorType) {
+        case 0: channels = 1; break;
+        case 2: channels = 3; break;
+        case 3: channels = 1; break;
+        case 4: channels = 2; break;
+        case 6: channels = 4; break;
+        default: error = "unknown colour type"; return false;
+    }
+    const bool depthOk = colorType == 3 ? depth <= 8 : colorType == 0 ? true : depth >= 8;
+    if (png.width <= 0 || png.height <= 0 || !depthOk || (depth & (depth - 1)) != 0 || depth > 16) {
+        error = "unsupported image header";
+        return false;
+    }
+
+    std::vector<uint8_t> raw;
+    if (!inflate(compressed, raw, error)) {
+        return false;
+    }
+    const size_t bitsPerPixel = channels * depth;
+    const size_t stride = ((png.width * bitsPerPixel) + 7) / 8;
+    const size_t bpp = std::max<size_t>(1, bitsPerPixel / 8); // filter distance
+    if (raw.size() < (stride + 1) * png.height) {
+        error = "image data too short";
+        return false;
+    }
+    std::vector<uint8_t> previous(stride, 0), row(stride);
+    png.pixels.assign(png.width * png.height, 0);
+    for (int32_t y = 0; y < png.height; y++) {
+        const uint8_t filter = raw[y * (stride + 1)];
+        const uint8_t *in = &raw[(y * (stride + 1)) + 1];
+        for (size_t i = 0; i < stride; i++) {
+            const uint8_t a = i >= bpp ? row[i - bpp] : 0, b = previous[i], c = i >= bpp ? previous[i - bpp] : 0;
+            uint8_t predicted;
+            switch (filter) {
+                case 0: predicted = 0; break;
+                case 1: predicted = a; break;
+                case 2: predicted = b; break;
+                case 3: predicted = (a + b) / 2; break;
+                case 4: predicted = paeth(a, b, c); break;
+                default: error = "unknown row filter"; return false;
+            }
+            row[i] = in[i] + predicted;
+        }
+        for (int32_t x = 0; x < png.width; x++) {
+            // samples scaled to 8 bits
+            auto sample = [&](int channel) -> uint32_t {
+                if (depth == 16) {
+                    return row[(((x * channels) + channel) * 2)];
+                }
+                if (depth == 8) {
+                    return row[(x * channels) + channel];
+                }
+                const size_t bit = x * depth;
+                const uint32_t v = (row[bit / 8] >> (8 - depth - (bit % 8))) & ((1 << depth) - 1);
+                return colorType == 3 ? v : (v * 255) / ((1 << depth) - 1);
+            };
+            uint32_t argb;
+            switch (colorType) {
+                case 0: argb = 0xFF000000u | (sample(0) * 0x010101u); break;
+                case 2: argb = 0xFF000000u | (sample(0) << 16) | (sample(1) << 8) | sample(2); break;
+                case 3: {
+                    const uint32_t index = sample(0);
+                    if (index >= palette.size()) {
+                        error = "palette index out of range";
+                        return false;
+                    }
+                    argb = palette[index];
+                    break;
+                }
+                case 4: argb = (sample(1) << 24) | (sample(0) * 0x010101u); break;
+                default: argb = (sample(3) << 24) | (sample(0) << 16) | (sample(1) << 8) | sample(2); break;
+            }
+            png.pixels[(y * png.width) + x] = argb;
+        }
+        previous.swap(row);
+    }
+    return true;
+}
@@ -0,0 +1,20 @@
+// Minimal PNG reader for the host tools: grey (1 to 16 bits), palette (1
+// to 8 bits) and 8 or 16 bit grey + alpha, RGB and RGBA images, not
+// interlaced. 16 bit samples keep their high byte. Enough for the
+// assets an image editor exports, with its own inflate so the tools need
+// nothing but a C++ compiler.
+#ifndef __TOOLS_PNG_H
+#define __TOOLS_PNG_H
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+struct Png {
+    int32_t width = 0, height = 0;
+    std::vector<uint32_t> pixels; // 0xAARRGGBB
+};
+
+// false with a reason in error if the file can not be read or decoded
+bool readPng(const std::string &path, Png &png, std::string &error);
+
+#endif
@@ -0,0 +1,33 @@
+# Shared by the PlatformIO pre-build steps in tools/: each one compiles a
+# host tool and runs it whenever one of its inputs is newer than the stamp
+# of the last run. Headers are only rewritten when they change, so an
+# unchanged run does not trigger a rebuild. Needs a host C++ compiler, set
+# HOST_CXX to pick another one.
+import os
+import subprocess
+
+class Step:
+    def __init__(self, env, name):
+        self.project = env.subst("$PROJECT_DIR")
+        self.build = os.path.join(env.subst("$PROJECT_WORKSPACE_DIR"), "tools")
+        self.tool = os.path.join(self.build, name)
+        self.stamp = os.path.join(self.build, name + ".stamp")
+
+    def path(self, *parts):
+        return os.path.join(self.project, *parts)
+
+    def relative(self, paths):
+        return ", ".join(os.path.relpath(p, self.project) for p in paths)
+
+    def stale(self, inputs, outputs):
+        if not os.path.exists(self.stamp) or not all(os.path.exists(o) for o in outputs):
+            return True
+        return os.path.getmtime(self.stamp) < max(os.path.getmtime(i) for i in inputs)
+
+    def run(self, sources, arguments, flags=[]):
+        os.makedirs(self.build, exist_ok=True)
+        cxx = os.environ.get("HOST_CXX", "c++")
+        subprocess.check_call([cxx, "-std=gnu++17", "-O1"] + flags + ["-I", self.path("native"),
+            "-I", self.path("include"), "-o", self.tool] + sources)
+        subprocess.check_call([self.tool] + arguments)
+        open(self.stamp, "w").close()
@@ -0,0 +1,191 @@
+// Host tool run by subset_fonts.py before every build: cuts the smooth
+// fonts in assets/ down to the glyphs of the texts in include/texts.hpp
+// and the dial numerals, and writes them as the vlw arrays TFT_eSPI's
+// loadFont() takes.
+//
+// A vlw file is a header of 6 big endian words (glyph count, version,
+// size, 0, ascent, descent), a 7 word record per glyph (code, height,
+// width, xAdvance, dY, dX, 0), the 8 bit alpha bitmaps of the glyphs in
+// record order and the font names. loadFont() takes the line height and
+// baseline from the tallest and deepest glyph in the font, so the glyphs
+// that set those are kept as records without a bitmap: text is placed
+// exactly as with the full font.
+//
+//   subset_fonts assets include
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "texts.hpp"
+
+struct Subset {
+    const char *name;
+    std::string text;
+};
+
+static std::string dialNumerals() {
+    // as drawDial() in src/face.cpp draws them
+    std::string text;
+    for (int hour = 1; hour <= 12; hour++) {
+        text += std::to_string(hour);
+    }
+    return text;
+}
+
+static const Subset SUBSETS[] = {
+    { "NotoSansBold36", NAME_TEXT },
+    { "NotoSansBold15", std::string(SLEEPING_TEXT) + WAKING_UP_TEXT + AWAKE_TEXT + dialNumerals() },
+};
+
+// the size of the metric tables loadFont() allocates per glyph
+static constexpr uint32_t METRICS_BYTES = 12;
+
+static uint32_t word(const std::vector<uint8_t> &data, size_t at) {
+    return ((uint32_t)data[at] << 24) | (data[at + 1] << 16) | (data[at + 2] << 8) | data[at + 3];
+}
+
+static void putWord(std::vector<uint8_t> &out, uint32_t value) {
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        out.push_back(value >> shift);
+    }
+}
+
+// the glyphs TFT_eSPI looks at for the font's ascent and descent
+static bool setsMetrics(uint32_t code) {
+    return (code > 0x20 && code < 0x7F) || code > 0xA0;
+}
+
+static bool subset(const std::string &assets, const std::string &include, const Subset &font) {
+    const std::string source = assets + "/" + font.name + ".vlw";
+    FILE *f = fopen(source.c_str(), "rb");
+    if (f == nullptr) {
+        fprintf(stderr, "could not read %s\n", source.c_str());
+        return false;
+    }
+    std::vector<uint8_t> vlw;
+    int c;
+    while ((c = fgetc(f)) != EOF) {
+        vlw.push_back(c);
+    }
+    fclose(f);
+
+    struct Glyph {
+        uint32_t code, height, width;
+        int32_t dY;
+        size_t record, bitmap;
+    };
+    const uint32_t count = vlw.size() >= 24 ? word(vlw, 0) : 0;
+    std::vector<Glyph> glyphs;
+    size_t bitmap = 24 + (count * 28);
+    for (uint32_t i = 0; i < count && bitmap <= vlw.size(); i++) {
+        const size_t record = 24 + (i * 28);
+        const Glyph g = { word(vlw, record), word(vlw, record + 4), word(vlw, record + 8),
+            (int32_t)word(vlw, record + 16), record, bitmap };
+        glyphs.push_back(g);
+        bitmap += g.width * g.height;
+    }
+    if (count == 0 || glyphs.size() != count || bitmap > vlw.size()) {
+        fprintf(stderr, "%s is not a vlw font\n", source.c_str());
+        return false;
+    }
+
+    auto used = [&](uint32_t code) { return code < 0x80 && font.text.find((char)code) != std::string::npos; };
+    for (char ch : font.text) {
+        if (std::none_of(glyphs.begin(), glyphs.end(), [ch](const Glyph &g) { return g.code == (uint8_t)ch; })) {
+            fprintf(stderr, "%s has no glyph for '%c'\n", font.name, ch);
+            return false;
+        }
+    }
+    // the glyphs setting the ascent and descent when the kept ones do not
+    const Glyph *ascent = nullptr, *descent = nullptr;
+    int32_t keptAscent = INT32_MIN, keptDescent = INT32_MIN;
+    for (const Glyph &g : glyphs) {
+        if (!setsMetrics(g.code)) {
+            continue;
+        }
+        if (ascent == nullptr || g.dY > ascent->dY) {
+            ascent = &g;
+        }
+        if (descent == nullptr || (int32_t)g.height - g.dY > (int32_t)descent->height - descent->dY) {
+            descent = &g;
+        }
+        if (used(g.code)) {
+            keptAscent = std::max(keptAscent, g.dY);
+            keptDescent = std::max(keptDescent, (int32_t)g.height - g.dY);
+        }
+    }
+    auto placeholder = [&](const Glyph &g) {
+        return !used(g.code) && ((&g == ascent && g.dY > keptAscent)
+            || (&g == descent && (int32_t)g.height - g.dY > keptDescent));
+    };
+
+    std::vector<uint8_t> records, bitmaps;
+    uint32_t kept = 0, placeholders = 0;
+    for (const Glyph &g : glyphs) {
+        const bool drawn = used(g.code);
+        if (!drawn && !placeholder(g)) {
+            continue;
+        }
+        for (size_t i = 0; i < 28; i++) {
+            records.push_back(vlw[g.record + i]);
+        }
+        if (drawn) {
+            bitmaps.insert(bitmaps.end(), vlw.begin() + g.bitmap, vlw.begin() + g.bitmap + (g.width * g.height));
+        }
+        else {
+            // width 0: no bitmap, the height and dY stay for the metrics
+            std::fill(records.end() - 20, records.end() - 16, 0);
+            placeholders++;
+        }
+        kept++;
+    }
+    std::vector<uint8_t> out;
+    putWord(out, kept);
+    out.insert(out.end(), vlw.begin() + 4, vlw.begin() + 24);
+    out.insert(out.end(), records.begin(), records.end());
+    out.insert(out.end(), bitmaps.begin(), bitmaps.end());
+    out.insert(out.end(), vlw.begin() + bitmap, vlw.end()); // font names
+
+    std::string glyphList;
+    for (const Glyph &g : glyphs) {
+        if (used(g.code)) {
+            glyphList += (char)g.code;
+        }
+    }
+    const std::string header = include + "/" + font.name + ".h";
+    f = fopen(header.c_str(), "w");
+    if (f == nullptr) {
+        fprintf(stderr, "could not write %s\n", header.c_str());
+        return false;
+    }
+    fprintf(f, "// Generated by   : tools/subset_fonts.py, do not edit\n");
+    fprintf(f, "// Generated from : assets/%s.vlw\n", font.name);
+    fprintf(f, "// Glyphs         : %s (+ %u without bitmap for the line height)\n", glyphList.c_str(), placeholders);
+    fprintf(f, "// Memory usage   : %u bytes\n\n", (unsigned)out.size());
+    fprintf(f, "#include <pgmspace.h>\n\nconst uint8_t  %s[] PROGMEM = {\n", font.name);
+    for (size_t i = 0; i < out.size(); i++) {
+        fprintf(f, "0x%02X,%s", out[i], (i % 16) == 15 || i == out.size() - 1 ? "\n" : " ");
+    }
+    fprintf(f, "};\n");
+    if (fclose(f) != 0) {
+        fprintf(stderr, "could not write %s\n", header.c_str());
+        return false;
+    }
+    printf("%s: %u of %u glyphs, %u bytes of flash instead of %u, %u bytes of heap for the metrics instead of %u\n",
+        font.name, kept, count, (unsigned)out.size(), (unsigned)vlw.size(), kept * METRICS_BYTES, count * METRICS_BYTES);
+    return true;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s assets include\n", argv[0]);
+        return 1;
+    }
+    for (const Subset &font : SUBSETS) {
+        if (!subset(argv[1], argv[2], font)) {
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,31 @@
+# PlatformIO pre-build step: cuts the fonts in assets/ down to the glyphs
+# the clock draws (include/texts.hpp and the dial numerals) and writes
+# them to include/NotoSansBold36.h and include/NotoSansBold15.h whenever
+# the texts, fonts or subsetter changed.
+Import("env")
+import os
+import sys
+
+sys.path.insert(0, os.path.join(env.subst("$PROJECT_DIR"), "tools"))
+from prebuild_common import Step
+
+step = Step(env, "subset_fonts")
+path = step.path
+
+sources = [
+    path("tools", "subset_fonts.cpp"),
+]
+inputs = sources + [
+    path("tools", "prebuild_common.py"),
+    path("include", "texts.hpp"),
+    path("assets", "NotoSansBold36.vlw"),
+    path("assets", "NotoSansBold15.vlw"),
+]
+outputs = [
+    path("include", "NotoSansBold36.h"),
+    path("include", "NotoSansBold15.h"),
+]
+
+if step.stale(inputs, outputs):
+    print("Subsetting fonts into %s" % step.relative(outputs))
+    step.run(sources, [path("assets"), path("include")])